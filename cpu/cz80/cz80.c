@@ -60,15 +60,8 @@ cz80_struc ALIGN_DATA CZ80;
 
 static UINT8 ALIGN_DATA cz80_bad_address[1 << CZ80_FETCH_SFT];
 
-static UINT8 ALIGN_DATA SZ[256];
-static UINT8 ALIGN_DATA SZP[256];
-static UINT8 ALIGN_DATA SZ_BIT[256];
-static UINT8 ALIGN_DATA SZHV_inc[256];
-static UINT8 ALIGN_DATA SZHV_dec[256];
-#if CZ80_BIG_FLAGS_ARRAY
-static UINT8 ALIGN_DATA SZHVC_add[2*256*256];
-static UINT8 ALIGN_DATA SZHVC_sub[2*256*256];
-#endif
+/* flags tables, generated by tools/make_tables_c */
+#include "cz80_tab.c"
 
 
 /******************************************************************************
@@ -95,11 +88,7 @@ static INT32 Cz80_Interrupt_Callback(INT32 line)
 
 void Cz80_Init(cz80_struc *CPU)
 {
-	UINT32 i, j, p;
-#if CZ80_BIG_FLAGS_ARRAY
-	int oldval, newval, val;
-	UINT8 *padd, *padc, *psub, *psbc;
-#endif
+	UINT32 i;
 
 	memset(CPU, 0, sizeof(cz80_struc));
 
@@ -113,77 +102,6 @@ void Cz80_Init(cz80_struc *CPU)
 #endif
 	}
 
-	// flags tables initialisation
-	for (i = 0; i < 256; i++)
-	{
-		SZ[i] = i & (SF | YF | XF);
-		if (!i) SZ[i] |= ZF;
-
-		SZ_BIT[i] = i & (SF | YF | XF);
-		if (!i) SZ_BIT[i] |= ZF | PF;
-
-		for (j = 0, p = 0; j < 8; j++) if (i & (1 << j)) p++;
-		SZP[i] = SZ[i];
-		if (!(p & 1)) SZP[i] |= PF;
-
-		SZHV_inc[i] = SZ[i];
-		if(i == 0x80) SZHV_inc[i] |= VF;
-		if((i & 0x0f) == 0x00) SZHV_inc[i] |= HF;
-
-		SZHV_dec[i] = SZ[i] | NF;
-		if (i == 0x7f) SZHV_dec[i] |= VF;
-		if ((i & 0x0f) == 0x0f) SZHV_dec[i] |= HF;
-	}
-
-#if CZ80_BIG_FLAGS_ARRAY
-	padd = &SZHVC_add[  0*256];
-	padc = &SZHVC_add[256*256];
-	psub = &SZHVC_sub[  0*256];
-	psbc = &SZHVC_sub[256*256];
-
-	for (oldval = 0; oldval < 256; oldval++)
-	{
-		for (newval = 0; newval < 256; newval++)
-		{
-			/* add or adc w/o carry set */
-			val = newval - oldval;
-			*padd = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
-			*padd |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
-			if ((newval & 0x0f) < (oldval & 0x0f)) *padd |= HF;
-			if (newval < oldval ) *padd |= CF;
-			if ((val ^ oldval ^ 0x80) & (val ^ newval) & 0x80) *padd |= VF;
-			padd++;
-
-			/* adc with carry set */
-			val = newval - oldval - 1;
-			*padc = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
-			*padc |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
-			if ((newval & 0x0f) <= (oldval & 0x0f)) *padc |= HF;
-			if (newval <= oldval) *padc |= CF;
-			if ((val ^ oldval ^ 0x80) & (val ^ newval) & 0x80) *padc |= VF;
-			padc++;
-
-			/* cp, sub or sbc w/o carry set */
-			val = oldval - newval;
-			*psub = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
-			*psub |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
-			if ((newval & 0x0f) > (oldval & 0x0f)) *psub |= HF;
-			if (newval > oldval) *psub |= CF;
-			if ((val^oldval) & (oldval^newval) & 0x80) *psub |= VF;
-			psub++;
-
-			/* sbc with carry set */
-			val = oldval - newval - 1;
-			*psbc = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
-			*psbc |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
-			if ((newval & 0x0f) >= (oldval & 0x0f)) *psbc |= HF;
-			if (newval >= oldval) *psbc |= CF;
-			if ((val ^ oldval) & (oldval^newval) & 0x80) *psbc |= VF;
-			psbc++;
-		}
-	}
-#endif
-
 	CPU->pzR8[0] = &zB;
 	CPU->pzR8[1] = &zC;
 	CPU->pzR8[2] = &zD;
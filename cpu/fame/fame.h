@@ -22,6 +22,7 @@ extern "C" {
 // PicoDrive hacks
 #define FAMEC_FETCHBITS 8
 #define M68K_FETCHBANK1 (1 << FAMEC_FETCHBITS)
+#define FAMEC_MAP_SHIFT 16 // M68K_MEM_SHIFT
 
 //#define M68K_RUNNING    0x01
 #define FM68K_HALTED     0x80
@@ -157,6 +158,12 @@ typedef struct
 	unsigned char  not_polling;
 	unsigned char  pad[3];
 
+	// memory maps for direct access, see pico/memory.h
+	const uintptr_t *read8_map;
+	const uintptr_t *read16_map;
+	const uintptr_t *write8_map;
+	const uintptr_t *write16_map;
+
 	uintptr_t      Fetch[M68K_FETCHBANK1];
 } M68K_CONTEXT;
 
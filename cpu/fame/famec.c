@@ -24,7 +24,9 @@
 #define FAMEC_CHECK_BRANCHES
 #define FAMEC_EXTRA_INLINE
 // #define FAMEC_DEBUG
+#ifndef FAMEC_USE_GOTOS // threaded dispatch, needs gcc and lots of RAM to build
 #define FAMEC_NO_GOTOS
+#endif
 #define FAMEC_ADR_BITS  24
 // #define FAMEC_FETCHBITS 8
 #define FAMEC_DATABITS  8
@@ -314,6 +316,84 @@
 #define POST_IO                 \
 //    CCnt = io_cycle_counter;
 
+#ifdef PICODRIVE_HACK
+
+// access memory directly if it is in the memory map, and call the handlers
+// only for I/O. The maps have the same format as in pico/memory.h
+#define MAP_FLAG_F ((uptr)1 << (sizeof(uptr) * 8 - 1))
+
+#define READ_BYTE_F(A, D)           \
+{                                   \
+	u32 a_ = (A) & 0xFFFFFF;        \
+	uptr v_ = ctx->read8_map[a_ >> FAMEC_MAP_SHIFT];     \
+	if (v_ & MAP_FLAG_F) D = ctx->read_byte(a_) & 0xFF;  \
+	else D = *(u8 *)((v_ << 1) + MEM_BE2(a_));           \
+}
+
+#define READ_WORD_F(A, D)           \
+{                                   \
+	u32 a_ = (A) & 0xFFFFFE;        \
+	uptr v_ = ctx->read16_map[a_ >> FAMEC_MAP_SHIFT];    \
+	if (v_ & MAP_FLAG_F) D = ctx->read_word(a_) & 0xFFFF;\
+	else D = *(u16 *)((v_ << 1) + a_);                   \
+}
+
+#define READ_LONG_F(A, D)           \
+{                                   \
+	u32 a_ = (A) & 0xFFFFFE;        \
+	uptr v_ = ctx->read16_map[a_ >> FAMEC_MAP_SHIFT];    \
+	if (v_ & MAP_FLAG_F) D = ctx->read_long(a_);         \
+	else {                                               \
+		u16 *m_ = (u16 *)((v_ << 1) + a_);               \
+		D = (m_[0] << 16) | m_[1];                       \
+	}                                                    \
+}
+
+#define WRITE_BYTE_F(A, D)          \
+{                                   \
+	u32 a_ = (A) & 0xFFFFFF;        \
+	uptr v_ = ctx->write8_map[a_ >> FAMEC_MAP_SHIFT];    \
+	if (v_ & MAP_FLAG_F) ctx->write_byte(a_, D);         \
+	else *(u8 *)((v_ << 1) + MEM_BE2(a_)) = D;           \
+}
+
+#define WRITE_WORD_F(A, D)          \
+{                                   \
+	u32 a_ = (A) & 0xFFFFFE;        \
+	uptr v_ = ctx->write16_map[a_ >> FAMEC_MAP_SHIFT];   \
+	if (v_ & MAP_FLAG_F) ctx->write_word(a_, D);         \
+	else *(u16 *)((v_ << 1) + a_) = D;                   \
+}
+
+#define WRITE_LONG_F(A, D)          \
+{                                   \
+	u32 a_ = (A) & 0xFFFFFE, d_ = D;\
+	uptr v_ = ctx->write16_map[a_ >> FAMEC_MAP_SHIFT];   \
+	if (v_ & MAP_FLAG_F) ctx->write_long(a_, d_);        \
+	else {                                               \
+		u16 *m_ = (u16 *)((v_ << 1) + a_);               \
+		m_[0] = d_ >> 16;                                \
+		m_[1] = d_;                                      \
+	}                                                    \
+}
+
+#define WRITE_LONG_DEC_F(A, D)      \
+{                                   \
+	u32 ad_ = (A), dd_ = D;         \
+	WRITE_WORD_F(ad_ + 2, dd_ & 0xFFFF) \
+	WRITE_WORD_F(ad_, dd_ >> 16)    \
+}
+
+#define PUSH_32_F(D)                        \
+	AREG(7) -= 4;                               \
+	WRITE_LONG_F(AREG(7), D)
+
+#define POP_32_F(D)                         \
+	READ_LONG_F(AREG(7), D)                 \
+	AREG(7) += 4;
+
+#else
+
 #define READ_BYTE_F(A, D)           \
 	D = ctx->read_byte(A) & 0xFF;
 
@@ -323,8 +403,6 @@
 #define READ_LONG_F(A, D)           \
 	D = ctx->read_long(A);
 
-#define READSX_LONG_F READ_LONG_F
-
 #define WRITE_LONG_F(A, D)          \
 	ctx->write_long(A, D);
 
@@ -340,6 +418,10 @@
 	D = ctx->read_long(AREG(7));         \
 	AREG(7) += 4;
 
+#endif
+
+#define READSX_LONG_F READ_LONG_F
+
 #ifndef FAME_BIG_ENDIAN
 
 	#define FETCH_LONG(A)               \
@@ -408,6 +490,32 @@
 
 #endif
 
+#ifdef PICODRIVE_HACK
+
+#define READSX_BYTE_F(A, D)             \
+{                                       \
+    u32 t_;                             \
+    READ_BYTE_F(A, t_)                  \
+    D = (s8)t_;                         \
+}
+
+#define READSX_WORD_F(A, D)             \
+{                                       \
+    u32 t_;                             \
+    READ_WORD_F(A, t_)                  \
+    D = (s16)t_;                        \
+}
+
+#define PUSH_16_F(D)                    \
+    AREG(7) -= 2;                       \
+    WRITE_WORD_F(AREG(7), D)
+
+#define POP_16_F(D)                     \
+    READ_WORD_F(AREG(7), D)             \
+    AREG(7) += 2;
+
+#else
+
 #define READSX_BYTE_F(A, D)             \
     D = (s8)ctx->read_byte(A);
 
@@ -428,6 +536,8 @@
     D = (u16)ctx->read_word(AREG(7));   \
     AREG(7) += 2;
 
+#endif
+
 #define GET_CCR                                     \
     (((flag_C >> (M68K_SR_C_SFT - 0)) & 1) |   \
      ((flag_V >> (M68K_SR_V_SFT - 1)) & 2) |   \
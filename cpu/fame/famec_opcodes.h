@@ -23458,6 +23458,26 @@ OPCODE(0x51C8)
 	NOT_POLLING
 
 	res = DREGu16((Opcode >> 0) & 7);
+#ifdef PICODRIVE_HACK
+	if (GET_SWORD == -2 && res > 1)
+	{
+		// "dbf dN,*" delay loop, run all iterations fitting in this timeslice
+		s32 n = (ctx->io_cycle_counter + 9) / 10;
+
+		if ((s32)res < n)
+		{
+			ctx->io_cycle_counter -= 10 * res;
+			DREGu16((Opcode >> 0) & 7) = 0xffff;
+			PC++;
+	RET(14)
+		}
+		if (n > 1)
+		{
+			ctx->io_cycle_counter -= 10 * (n - 1);
+			res -= n - 1;
+		}
+	}
+#endif
 	res--;
 	DREGu16((Opcode >> 0) & 7) = res;
 	if ((s32)res != -1)
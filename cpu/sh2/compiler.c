@@ -50,6 +50,7 @@
 #define LOOP_OPTIMIZER          1
 #define T_OPTIMIZER             1
 #define DIV_OPTIMIZER           1
+#define FAST_SDRAM_WRITE        1
 
 #define MAX_LITERAL_OFFSET      0x200	// max. MOVA, MOV @(PC) offset
 #define MAX_LOCAL_TARGETS       (BLOCK_INSN_LIMIT / 4)
@@ -5254,6 +5255,61 @@ end_op:
   return block_entry_ptr;
 }
 
+#if FAST_SDRAM_WRITE
+// store to SDRAM in the write utility if there's no compiled code in the
+// written area, else fall through to the handler doing the SMC checks.
+// The interpreter opcode cache marks aren't checked, the cache is unused
+// while the DRC runs and flushed when switching to the interpreter.
+// 8 bit stores aren't done since x86 can't store the low byte of all regs.
+static void emit_sdram_write(int size, int a, int d, int t1, int t2)
+{
+#ifndef emith_write16_r_r_offs
+  if (size == 1)
+    return;
+#endif
+  // SDRAM at 0x06000000-0x07ffffff, cached or cache-through
+  emith_lsr(t1, a, 30);
+  emith_tst_r_r(t1, t1);
+  EMITH_JMP_START(DCOND_NE);
+  emith_lsl(t1, a, 3);
+  emith_lsr(t1, t1, 28);
+  emith_cmp_r_imm(t1, 3);
+  EMITH_JMP_START(DCOND_NE);
+
+  // check the drcblk entries covering the written data (1 per 16 bit word)
+  emith_lsl(t1, a, 14);
+  emith_lsr(t1, t1, 14+size);
+  if (size == 2)
+    emith_lsl(t1, t1, 1);
+  emith_ctx_read_ptr(t2, offsetof(SH2, p_drcblk_ram));
+  if (size == 2)
+    emith_read16_r_r_r(t2, t2, t1);
+  else
+    emith_read8_r_r_r(t2, t2, t1);
+  emith_tst_r_r(t2, t2);
+  EMITH_JMP_START(DCOND_NE);
+
+  emith_lsl(t1, a, 14);
+  emith_lsr(t1, t1, 14+size);
+  emith_lsl(t1, t1, size);
+  emith_ctx_read_ptr(t2, offsetof(SH2, p_sdram));
+  emith_add_r_r_ptr(t2, t1);
+  if (size == 2) {
+    emit_le_swap(d);
+    emith_write_r_r_offs(d, t2, 0);
+  }
+#ifdef emith_write16_r_r_offs
+  else
+    emith_write16_r_r_offs(d, t2, 0);
+#endif
+  emith_ret();
+
+  EMITH_JMP_END(DCOND_NE);
+  EMITH_JMP_END(DCOND_NE);
+  EMITH_JMP_END(DCOND_NE);
+}
+#endif
+
 static void sh2_generate_utils(void)
 {
   int arg0, arg1, arg2, arg3, sr, tmp, tmp2;
@@ -5274,12 +5330,18 @@ static void sh2_generate_utils(void)
 
   // sh2_drc_write16(u32 a, u32 d)
   sh2_drc_write16 = (void *)tcache_ptr;
+#if FAST_SDRAM_WRITE
+  emit_sdram_write(1, arg0, arg1, arg2, arg3);
+#endif
   emith_ctx_read_ptr(arg2, offsetof(SH2, write16_tab));
   emith_sh2_wcall(arg0, arg1, arg2, arg3);
   emith_flush();
 
   // sh2_drc_write32(u32 a, u32 d)
   sh2_drc_write32 = (void *)tcache_ptr;
+#if FAST_SDRAM_WRITE
+  emit_sdram_write(2, arg0, arg1, arg2, arg3);
+#endif
   emith_ctx_read_ptr(arg2, offsetof(SH2, write32_tab));
   emith_sh2_wcall(arg0, arg1, arg2, arg3);
   emith_flush();
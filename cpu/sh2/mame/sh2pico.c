@@ -1,3 +1,4 @@
+#include <string.h>
 #include "../sh2.h"
 
 #ifdef DRC_CMP
@@ -107,12 +108,411 @@ static unsigned int op_refs[0x10000];
 
 #include "sh2.c"
 
+// opcode cache, saving the memory handler call for each fetch.
+// Only code in ROM, SDRAM and the data array is cached. Writes to the latter
+// two are checked in the memory handlers, for pages marked as containing code.
+#ifndef _ASM_32X_MEMORY_C // asm memory handlers lack the checks
+#define ICACHE_ENABLED 1
+#else
+#define ICACHE_ENABLED 0
+#endif
+#define ICACHE_SIZE 0x2000 // entries, must be 2^n
+
+// The entries hold the opcodes predecoded: the MAME handler and its operands
+// as extracted by the dispatch in sh2.c.
+struct sh2_icache_entry;
+typedef void (sh2_op)(SH2 *sh2, const struct sh2_icache_entry *e);
+
+struct sh2_icache_entry {
+	u32 pc;
+	u16 opcode;
+	u16 a;		// operands, in the order the handler takes them
+	u8 b, c;
+	sh2_op *op;
+};
+static struct sh2_icache_entry sh2_icache[2][ICACHE_SIZE];
+
+u8 sh2_icache_ram[0x40000 >> SH2_ICACHE_PAGE_SHIFT];
+u8 sh2_icache_da[2][0x1000 >> SH2_ICACHE_PAGE_SHIFT];
+
+void sh2_icache_flush(void)
+{
+	memset(sh2_icache, 0xff, sizeof(sh2_icache));
+	memset(sh2_icache_ram, 0, sizeof(sh2_icache_ram));
+	memset(sh2_icache_da, 0, sizeof(sh2_icache_da));
+}
+
+void sh2_icache_wcheck_ram(u32 a, unsigned len)
+{
+	u32 end = a + len;
+	int i;
+
+	for (a &= ~1; a < end; a += 2) {
+		for (i = 0; i < 2; i++) {
+			u32 *pc = &sh2_icache[i][(a >> 1) & (ICACHE_SIZE-1)].pc;
+			if ((*pc & 0xc7fc0000) == 0x06000000 && !((*pc ^ a) & 0x3fffe))
+				*pc = -1;
+		}
+	}
+}
+
+void sh2_icache_wcheck_da(u32 a, unsigned len, SH2 *sh2)
+{
+	u32 end = a + len;
+
+	for (a &= ~1; a < end; a += 2) {
+		u32 *pc = &sh2_icache[sh2->is_slave][(a >> 1) & (ICACHE_SIZE-1)].pc;
+		if ((*pc & 0xfffff000) == 0xc0000000 && !((*pc ^ a) & 0xffe))
+			*pc = -1;
+	}
+}
+
+static __inline void sh2_exec_op(SH2 *sh2, UINT32 opcode)
+{
+	switch ((opcode >> 12) & 15)
+	{
+	case  0: op0000(sh2, opcode); break;
+	case  1: op0001(sh2, opcode); break;
+	case  2: op0010(sh2, opcode); break;
+	case  3: op0011(sh2, opcode); break;
+	case  4: op0100(sh2, opcode); break;
+	case  5: op0101(sh2, opcode); break;
+	case  6: op0110(sh2, opcode); break;
+	case  7: op0111(sh2, opcode); break;
+	case  8: op1000(sh2, opcode); break;
+	case  9: op1001(sh2, opcode); break;
+	case 10: op1010(sh2, opcode); break;
+	case 11: op1011(sh2, opcode); break;
+	case 12: op1100(sh2, opcode); break;
+	case 13: op1101(sh2, opcode); break;
+	case 14: op1110(sh2, opcode); break;
+	default: op1111(sh2, opcode); break;
+	}
+}
+
 #ifndef DRC_CMP
 
-int sh2_execute_interpreter(SH2 *sh2, int cycles)
+#define OP0(name) \
+static void op_##name(SH2 *sh2, const struct sh2_icache_entry *e) { name(sh2); }
+#define OP1(name) \
+static void op_##name(SH2 *sh2, const struct sh2_icache_entry *e) { name(sh2, e->a); }
+#define OP2(name) \
+static void op_##name(SH2 *sh2, const struct sh2_icache_entry *e) { name(sh2, e->a, e->b); }
+#define OP3(name) \
+static void op_##name(SH2 *sh2, const struct sh2_icache_entry *e) { name(sh2, e->a, e->b, e->c); }
+
+OP0(CLRMAC) OP0(CLRT) OP0(DIV0U) OP0(ILLEGAL) OP0(RTE) OP0(RTS)
+OP0(SETT) OP0(SLEEP)
+OP1(ANDI) OP1(ANDM) OP1(BF) OP1(BFS) OP1(BRA) OP1(BRAF) OP1(BSR)
+OP1(BSRF) OP1(BT) OP1(BTS) OP1(CMPIM) OP1(CMPPL) OP1(CMPPZ) OP1(DT)
+OP1(JMP) OP1(JSR) OP1(LDCGBR) OP1(LDCMGBR) OP1(LDCMSR) OP1(LDCMVBR)
+OP1(LDCSR) OP1(LDCVBR) OP1(LDSMACH) OP1(LDSMACL) OP1(LDSMMACH)
+OP1(LDSMMACL) OP1(LDSMPR) OP1(LDSPR) OP1(MOVA) OP1(MOVBLG) OP1(MOVBSG)
+OP1(MOVLLG) OP1(MOVLSG) OP1(MOVT) OP1(MOVWLG) OP1(MOVWSG) OP1(ORI)
+OP1(ORM) OP1(ROTCL) OP1(ROTCR) OP1(ROTL) OP1(ROTR) OP1(SHAL) OP1(SHAR)
+OP1(SHLL) OP1(SHLL16) OP1(SHLL2) OP1(SHLL8) OP1(SHLR) OP1(SHLR16)
+OP1(SHLR2) OP1(SHLR8) OP1(STCGBR) OP1(STCMGBR) OP1(STCMSR) OP1(STCMVBR)
+OP1(STCSR) OP1(STCVBR) OP1(STSMACH) OP1(STSMACL) OP1(STSMMACH)
+OP1(STSMMACL) OP1(STSMPR) OP1(STSPR) OP1(TAS) OP1(TRAPA) OP1(TSTI)
+OP1(TSTM) OP1(XORI) OP1(XORM)
+OP2(ADD) OP2(ADDC) OP2(ADDI) OP2(ADDV) OP2(AND) OP2(CMPEQ) OP2(CMPGE)
+OP2(CMPGT) OP2(CMPHI) OP2(CMPHS) OP2(CMPSTR) OP2(DIV0S) OP2(DIV1)
+OP2(DMULS) OP2(DMULU) OP2(EXTSB) OP2(EXTSW) OP2(EXTUB) OP2(EXTUW)
+OP2(MAC_L) OP2(MAC_W) OP2(MOV) OP2(MOVBL) OP2(MOVBL0) OP2(MOVBL4)
+OP2(MOVBM) OP2(MOVBP) OP2(MOVBS) OP2(MOVBS0) OP2(MOVBS4) OP2(MOVI)
+OP2(MOVLI) OP2(MOVLL) OP2(MOVLL0) OP2(MOVLM) OP2(MOVLP) OP2(MOVLS)
+OP2(MOVLS0) OP2(MOVWI) OP2(MOVWL) OP2(MOVWL0) OP2(MOVWL4) OP2(MOVWM)
+OP2(MOVWP) OP2(MOVWS) OP2(MOVWS0) OP2(MOVWS4) OP2(MULL) OP2(MULS)
+OP2(MULU) OP2(NEG) OP2(NEGC) OP2(NOT) OP2(OR) OP2(SUB) OP2(SUBC)
+OP2(SUBV) OP2(SWAPB) OP2(SWAPW) OP2(TST) OP2(XOR) OP2(XTRCT)
+OP3(MOVLL4) OP3(MOVLS4)
+
+static void op_NOP(SH2 *sh2, const struct sh2_icache_entry *e)
+{
+}
+
+// not predecoded, for opcodes which aren't cached
+static void op_any(SH2 *sh2, const struct sh2_icache_entry *e)
+{
+	sh2_exec_op(sh2, e->opcode);
+}
+
+static const struct sh2_icache_entry sh2_op_nop = { -1, 9, 0, 0, 0, op_NOP };
+
+#define DEC0(name)		{ e->op = op_##name; return; }
+#define DEC1(name, x)		{ e->op = op_##name; e->a = x; return; }
+#define DEC2(name, x, y)	{ e->op = op_##name; e->a = x; e->b = y; return; }
+#define DEC3(name, x, y, z)	{ e->op = op_##name; e->a = x; e->b = y; e->c = z; return; }
+
+static void sh2_decode(struct sh2_icache_entry *e, UINT32 opcode)
 {
+	e->opcode = opcode;
+	e->a = e->b = e->c = 0;
+	switch ((opcode >> 12) & 15)
+	{
+	case  0:
+		switch (opcode & 0x3F)
+		{
+		case 0x02: DEC1(STCSR, Rn);
+		case 0x03: DEC1(BSRF, Rn);
+		case 0x04: DEC2(MOVBS0, Rm, Rn);
+		case 0x05: DEC2(MOVWS0, Rm, Rn);
+		case 0x06: DEC2(MOVLS0, Rm, Rn);
+		case 0x07: DEC2(MULL, Rm, Rn);
+		case 0x08: DEC0(CLRT);
+		case 0x09: DEC0(NOP);
+		case 0x0a: DEC1(STSMACH, Rn);
+		case 0x0b: DEC0(RTS);
+		case 0x0c: DEC2(MOVBL0, Rm, Rn);
+		case 0x0d: DEC2(MOVWL0, Rm, Rn);
+		case 0x0e: DEC2(MOVLL0, Rm, Rn);
+		case 0x0f: DEC2(MAC_L, Rm, Rn);
+		case 0x12: DEC1(STCGBR, Rn);
+		case 0x14: DEC2(MOVBS0, Rm, Rn);
+		case 0x15: DEC2(MOVWS0, Rm, Rn);
+		case 0x16: DEC2(MOVLS0, Rm, Rn);
+		case 0x17: DEC2(MULL, Rm, Rn);
+		case 0x18: DEC0(SETT);
+		case 0x19: DEC0(DIV0U);
+		case 0x1a: DEC1(STSMACL, Rn);
+		case 0x1b: DEC0(SLEEP);
+		case 0x1c: DEC2(MOVBL0, Rm, Rn);
+		case 0x1d: DEC2(MOVWL0, Rm, Rn);
+		case 0x1e: DEC2(MOVLL0, Rm, Rn);
+		case 0x1f: DEC2(MAC_L, Rm, Rn);
+		case 0x22: DEC1(STCVBR, Rn);
+		case 0x23: DEC1(BRAF, Rn);
+		case 0x24: DEC2(MOVBS0, Rm, Rn);
+		case 0x25: DEC2(MOVWS0, Rm, Rn);
+		case 0x26: DEC2(MOVLS0, Rm, Rn);
+		case 0x27: DEC2(MULL, Rm, Rn);
+		case 0x28: DEC0(CLRMAC);
+		case 0x29: DEC1(MOVT, Rn);
+		case 0x2a: DEC1(STSPR, Rn);
+		case 0x2b: DEC0(RTE);
+		case 0x2c: DEC2(MOVBL0, Rm, Rn);
+		case 0x2d: DEC2(MOVWL0, Rm, Rn);
+		case 0x2e: DEC2(MOVLL0, Rm, Rn);
+		case 0x2f: DEC2(MAC_L, Rm, Rn);
+		case 0x34: DEC2(MOVBS0, Rm, Rn);
+		case 0x35: DEC2(MOVWS0, Rm, Rn);
+		case 0x36: DEC2(MOVLS0, Rm, Rn);
+		case 0x37: DEC2(MULL, Rm, Rn);
+		case 0x3c: DEC2(MOVBL0, Rm, Rn);
+		case 0x3d: DEC2(MOVWL0, Rm, Rn);
+		case 0x3e: DEC2(MOVLL0, Rm, Rn);
+		case 0x3f: DEC2(MAC_L, Rm, Rn);
+		}
+		break;
+	case  1:
+		DEC3(MOVLS4, Rm, opcode & 0x0f, Rn);
+	case  2:
+		switch (opcode & 15)
+		{
+		case 0: DEC2(MOVBS, Rm, Rn);
+		case 1: DEC2(MOVWS, Rm, Rn);
+		case 2: DEC2(MOVLS, Rm, Rn);
+		case 4: DEC2(MOVBM, Rm, Rn);
+		case 5: DEC2(MOVWM, Rm, Rn);
+		case 6: DEC2(MOVLM, Rm, Rn);
+		case 7: DEC2(DIV0S, Rm, Rn);
+		case 8: DEC2(TST, Rm, Rn);
+		case 9: DEC2(AND, Rm, Rn);
+		case 10: DEC2(XOR, Rm, Rn);
+		case 11: DEC2(OR, Rm, Rn);
+		case 12: DEC2(CMPSTR, Rm, Rn);
+		case 13: DEC2(XTRCT, Rm, Rn);
+		case 14: DEC2(MULU, Rm, Rn);
+		case 15: DEC2(MULS, Rm, Rn);
+		}
+		break;
+	case  3:
+		switch (opcode & 15)
+		{
+		case 0: DEC2(CMPEQ, Rm, Rn);
+		case 2: DEC2(CMPHS, Rm, Rn);
+		case 3: DEC2(CMPGE, Rm, Rn);
+		case 4: DEC2(DIV1, Rm, Rn);
+		case 5: DEC2(DMULU, Rm, Rn);
+		case 6: DEC2(CMPHI, Rm, Rn);
+		case 7: DEC2(CMPGT, Rm, Rn);
+		case 8: DEC2(SUB, Rm, Rn);
+		case 10: DEC2(SUBC, Rm, Rn);
+		case 11: DEC2(SUBV, Rm, Rn);
+		case 12: DEC2(ADD, Rm, Rn);
+		case 13: DEC2(DMULS, Rm, Rn);
+		case 14: DEC2(ADDC, Rm, Rn);
+		case 15: DEC2(ADDV, Rm, Rn);
+		}
+		break;
+	case  4:
+		switch (opcode & 0x3F)
+		{
+		case 0x00: DEC1(SHLL, Rn);
+		case 0x01: DEC1(SHLR, Rn);
+		case 0x02: DEC1(STSMMACH, Rn);
+		case 0x03: DEC1(STCMSR, Rn);
+		case 0x04: DEC1(ROTL, Rn);
+		case 0x05: DEC1(ROTR, Rn);
+		case 0x06: DEC1(LDSMMACH, Rn);
+		case 0x07: DEC1(LDCMSR, Rn);
+		case 0x08: DEC1(SHLL2, Rn);
+		case 0x09: DEC1(SHLR2, Rn);
+		case 0x0a: DEC1(LDSMACH, Rn);
+		case 0x0b: DEC1(JSR, Rn);
+		case 0x0e: DEC1(LDCSR, Rn);
+		case 0x0f: DEC2(MAC_W, Rm, Rn);
+		case 0x10: DEC1(DT, Rn);
+		case 0x11: DEC1(CMPPZ, Rn);
+		case 0x12: DEC1(STSMMACL, Rn);
+		case 0x13: DEC1(STCMGBR, Rn);
+		case 0x15: DEC1(CMPPL, Rn);
+		case 0x16: DEC1(LDSMMACL, Rn);
+		case 0x17: DEC1(LDCMGBR, Rn);
+		case 0x18: DEC1(SHLL8, Rn);
+		case 0x19: DEC1(SHLR8, Rn);
+		case 0x1a: DEC1(LDSMACL, Rn);
+		case 0x1b: DEC1(TAS, Rn);
+		case 0x1e: DEC1(LDCGBR, Rn);
+		case 0x1f: DEC2(MAC_W, Rm, Rn);
+		case 0x20: DEC1(SHAL, Rn);
+		case 0x21: DEC1(SHAR, Rn);
+		case 0x22: DEC1(STSMPR, Rn);
+		case 0x23: DEC1(STCMVBR, Rn);
+		case 0x24: DEC1(ROTCL, Rn);
+		case 0x25: DEC1(ROTCR, Rn);
+		case 0x26: DEC1(LDSMPR, Rn);
+		case 0x27: DEC1(LDCMVBR, Rn);
+		case 0x28: DEC1(SHLL16, Rn);
+		case 0x29: DEC1(SHLR16, Rn);
+		case 0x2a: DEC1(LDSPR, Rn);
+		case 0x2b: DEC1(JMP, Rn);
+		case 0x2e: DEC1(LDCVBR, Rn);
+		case 0x2f: DEC2(MAC_W, Rm, Rn);
+		case 0x30:
+		case 0x31:
+		case 0x32:
+		case 0x33:
+		case 0x34:
+		case 0x35:
+		case 0x36:
+		case 0x37:
+		case 0x38:
+		case 0x39:
+		case 0x3a:
+		case 0x3b:
+		case 0x3c:
+		case 0x3d:
+		case 0x3f: DEC2(MAC_W, Rm, Rn);
+		}
+		break;
+	case  5:
+		DEC3(MOVLL4, Rm, opcode & 0x0f, Rn);
+	case  6:
+		switch (opcode & 15)
+		{
+		case 0: DEC2(MOVBL, Rm, Rn);
+		case 1: DEC2(MOVWL, Rm, Rn);
+		case 2: DEC2(MOVLL, Rm, Rn);
+		case 3: DEC2(MOV, Rm, Rn);
+		case 4: DEC2(MOVBP, Rm, Rn);
+		case 5: DEC2(MOVWP, Rm, Rn);
+		case 6: DEC2(MOVLP, Rm, Rn);
+		case 7: DEC2(NOT, Rm, Rn);
+		case 8: DEC2(SWAPB, Rm, Rn);
+		case 9: DEC2(SWAPW, Rm, Rn);
+		case 10: DEC2(NEGC, Rm, Rn);
+		case 11: DEC2(NEG, Rm, Rn);
+		case 12: DEC2(EXTUB, Rm, Rn);
+		case 13: DEC2(EXTUW, Rm, Rn);
+		case 14: DEC2(EXTSB, Rm, Rn);
+		case 15: DEC2(EXTSW, Rm, Rn);
+		}
+		break;
+	case  7:
+		DEC2(ADDI, opcode & 0xff, Rn);
+	case  8:
+		switch (opcode & (15<<8))
+		{
+		case 0<<8: DEC2(MOVBS4, opcode & 0x0f, Rm);
+		case 1<<8: DEC2(MOVWS4, opcode & 0x0f, Rm);
+		case 4<<8: DEC2(MOVBL4, Rm, opcode & 0x0f);
+		case 5<<8: DEC2(MOVWL4, Rm, opcode & 0x0f);
+		case 8<<8: DEC1(CMPIM, opcode & 0xff);
+		case 9<<8: DEC1(BT, opcode & 0xff);
+		case 11<<8: DEC1(BF, opcode & 0xff);
+		case 13<<8: DEC1(BTS, opcode & 0xff);
+		case 15<<8: DEC1(BFS, opcode & 0xff);
+		}
+		break;
+	case  9:
+		DEC2(MOVWI, opcode & 0xff, Rn);
+	case 10:
+		DEC1(BRA, opcode & 0xfff);
+	case 11:
+		DEC1(BSR, opcode & 0xfff);
+	case 12:
+		switch (opcode & (15<<8))
+		{
+		case 0<<8: DEC1(MOVBSG, opcode & 0xff);
+		case 1<<8: DEC1(MOVWSG, opcode & 0xff);
+		case 2<<8: DEC1(MOVLSG, opcode & 0xff);
+		case 3<<8: DEC1(TRAPA, opcode & 0xff);
+		case 4<<8: DEC1(MOVBLG, opcode & 0xff);
+		case 5<<8: DEC1(MOVWLG, opcode & 0xff);
+		case 6<<8: DEC1(MOVLLG, opcode & 0xff);
+		case 7<<8: DEC1(MOVA, opcode & 0xff);
+		case 8<<8: DEC1(TSTI, opcode & 0xff);
+		case 9<<8: DEC1(ANDI, opcode & 0xff);
+		case 10<<8: DEC1(XORI, opcode & 0xff);
+		case 11<<8: DEC1(ORI, opcode & 0xff);
+		case 12<<8: DEC1(TSTM, opcode & 0xff);
+		case 13<<8: DEC1(ANDM, opcode & 0xff);
+		case 14<<8: DEC1(XORM, opcode & 0xff);
+		case 15<<8: DEC1(ORM, opcode & 0xff);
+		}
+		break;
+	case 13:
+		DEC2(MOVLI, opcode & 0xff, Rn);
+	case 14:
+		DEC2(MOVI, opcode & 0xff, Rn);
+	}
+	DEC0(ILLEGAL);
+}
+
+static __inline const struct sh2_icache_entry *sh2_fetch(SH2 *sh2, u32 a)
+{
+	static struct sh2_icache_entry uncached = { -1, 0, 0, 0, 0, op_any };
+	struct sh2_icache_entry *e =
+		&sh2_icache[sh2->is_slave][(a >> 1) & (ICACHE_SIZE-1)];
 	UINT32 opcode;
 
+	if (e->pc == a)
+		return e;
+
+	opcode = (UINT32)(UINT16)RW(sh2, a);
+	if (!ICACHE_ENABLED)
+		goto uncached;
+	if ((a & 0xc7fc0000) == 0x06000000)
+		sh2_icache_ram[(a & 0x3ffff) >> SH2_ICACHE_PAGE_SHIFT] = 1;
+	else if ((a & 0xfffff000) == 0xc0000000)
+		sh2_icache_da[sh2->is_slave][(a & 0xfff) >> SH2_ICACHE_PAGE_SHIFT] = 1;
+	else if (!p32x_sh2_mem_is_rom(a, sh2))
+		goto uncached;
+
+	e->pc = a;
+	sh2_decode(e, opcode);
+	return e;
+
+uncached:
+	uncached.opcode = opcode;
+	return &uncached;
+}
+
+int sh2_execute_interpreter(SH2 *sh2, int cycles)
+{
+	const struct sh2_icache_entry *e;
+
 	sh2->icount = cycles;
 
 	if (sh2->icount <= 0)
@@ -123,17 +523,17 @@ int sh2_execute_interpreter(SH2 *sh2, int cycles)
 		if (sh2->delay)
 		{
 			sh2->ppc = sh2->delay;
-			opcode = (UINT32)(UINT16)RW(sh2, sh2->delay);
+			e = sh2_fetch(sh2, sh2->delay);
 
 			// TODO: more branch types
-			if ((opcode >> 13) == 5) { // BRA/BSR
+			if ((e->opcode >> 13) == 5) { // BRA/BSR
 				sh2->r[15] -= 4;
 				WL(sh2, sh2->r[15], sh2->sr);
 				sh2->r[15] -= 4;
 				WL(sh2, sh2->r[15], sh2->pc);
 				sh2->pc = RL(sh2, sh2->vbr + 6 * 4);
 				sh2->icount -= 5;
-				opcode = 9; // NOP
+				e = &sh2_op_nop;
 			}
 
 			sh2->pc -= 2;
@@ -141,31 +541,17 @@ int sh2_execute_interpreter(SH2 *sh2, int cycles)
 		else
 		{
 			sh2->ppc = sh2->pc;
-			opcode = (UINT32)(UINT16)RW(sh2, sh2->pc);
+			e = sh2_fetch(sh2, sh2->pc);
 		}
 
 		sh2->delay = 0;
 		sh2->pc += 2;
 
-		switch ((opcode >> 12) & 15)
-		{
-		case  0: op0000(sh2, opcode); break;
-		case  1: op0001(sh2, opcode); break;
-		case  2: op0010(sh2, opcode); break;
-		case  3: op0011(sh2, opcode); break;
-		case  4: op0100(sh2, opcode); break;
-		case  5: op0101(sh2, opcode); break;
-		case  6: op0110(sh2, opcode); break;
-		case  7: op0111(sh2, opcode); break;
-		case  8: op1000(sh2, opcode); break;
-		case  9: op1001(sh2, opcode); break;
-		case 10: op1010(sh2, opcode); break;
-		case 11: op1011(sh2, opcode); break;
-		case 12: op1100(sh2, opcode); break;
-		case 13: op1101(sh2, opcode); break;
-		case 14: op1110(sh2, opcode); break;
-		default: op1111(sh2, opcode); break;
-		}
+#ifdef SH2_STATS
+		sh2_exec_op(sh2, e->opcode); // the statistics are gathered there
+#else
+		e->op(sh2, e);
+#endif
 
 		sh2->icount--;
 
@@ -248,25 +634,7 @@ int sh2_execute_interpreter(SH2 *sh2, int cycles)
 		sh2->delay = 0;
 		sh2->pc += 2;
 
-		switch ((opcode >> 12) & 15)
-		{
-		case  0: op0000(sh2, opcode); break;
-		case  1: op0001(sh2, opcode); break;
-		case  2: op0010(sh2, opcode); break;
-		case  3: op0011(sh2, opcode); break;
-		case  4: op0100(sh2, opcode); break;
-		case  5: op0101(sh2, opcode); break;
-		case  6: op0110(sh2, opcode); break;
-		case  7: op0111(sh2, opcode); break;
-		case  8: op1000(sh2, opcode); break;
-		case  9: op1001(sh2, opcode); break;
-		case 10: op1010(sh2, opcode); break;
-		case 11: op1011(sh2, opcode); break;
-		case 12: op1100(sh2, opcode); break;
-		case 13: op1101(sh2, opcode); break;
-		case 14: op1110(sh2, opcode); break;
-		default: op1111(sh2, opcode); break;
-		}
+		sh2_exec_op(sh2, opcode);
 
 		sh2->icount--;
 
@@ -109,10 +109,22 @@ void sh2_unpack(SH2 *sh2, const unsigned char *buff);
 int  sh2_execute_drc(SH2 *sh2c, int cycles);
 int  sh2_execute_interpreter(SH2 *sh2c, int cycles);
 
+// interpreter opcode cache. Pages with cached code are marked in these,
+// writes to marked pages must call the wcheck functions
+#define SH2_ICACHE_PAGE_SHIFT 8	// same page size as DRC invalidation
+extern u8 sh2_icache_ram[0x40000 >> SH2_ICACHE_PAGE_SHIFT];
+extern u8 sh2_icache_da[2][0x1000 >> SH2_ICACHE_PAGE_SHIFT];
+void sh2_icache_flush(void);
+void sh2_icache_wcheck_ram(u32 a, unsigned len);
+void sh2_icache_wcheck_da(u32 a, unsigned len, SH2 *sh2);
+
 static __inline void sh2_execute_prepare(SH2 *sh2, int use_drc)
 {
 #ifdef DRC_SH2
   sh2->run = use_drc ? sh2_execute_drc : sh2_execute_interpreter;
+  // the opcode cache may be stale since the DRC doesn't maintain it
+  if (!use_drc)
+    sh2_icache_flush();
 #else
   sh2->run = sh2_execute_interpreter;
 #endif
@@ -139,6 +151,7 @@ u32 REGPARM(2) p32x_sh2_read32(u32 a, SH2 *sh2);
 void REGPARM(3) p32x_sh2_write8 (u32 a, u32 d, SH2 *sh2);
 void REGPARM(3) p32x_sh2_write16(u32 a, u32 d, SH2 *sh2);
 void REGPARM(3) p32x_sh2_write32(u32 a, u32 d, SH2 *sh2);
+int p32x_sh2_mem_is_rom(u32 a, SH2 *sh2);
 
 // debug
 #ifdef DRC_CMP
@@ -124,6 +124,104 @@ static void convert_pal555(int invert_prio)
 #define MD_LAYER_CODE_H32 \
   *dst = dst[H32_OFFSET]
 
+// vectorized line compositing for hosts without the ARM asm. This uses the
+// generic gcc vector extensions, which the compiler maps to SSE2/AVX2/NEON.
+#if !defined(_ASM_32X_DRAW) && defined(__GNUC__) && \
+    (defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define _VEC_32X_DRAW
+
+typedef u16 v8u16 __attribute__((vector_size(16)));
+
+static inline v8u16 vld(const void *p)
+{
+  v8u16 v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline void vst(void *p, v8u16 v)
+{
+  memcpy(p, &v, sizeof(v));
+}
+
+static inline v8u16 vdup(u16 x)
+{
+  return (v8u16){ x, x, x, x, x, x, x, x };
+}
+
+// mask of MD pixels showing the background color
+static inline v8u16 vmdbg(const u8 *pmd, v8u16 vbg)
+{
+  v8u16 m = { pmd[0], pmd[1], pmd[2], pmd[3], pmd[4], pmd[5], pmd[6], pmd[7] };
+  return (v8u16)((m & 0x3f) == vbg);
+}
+
+static inline v8u16 vmdpal(const u8 *pmd, const u16 *palmd)
+{
+  return (v8u16){ palmd[pmd[0]], palmd[pmd[1]], palmd[pmd[2]], palmd[pmd[3]],
+                  palmd[pmd[4]], palmd[pmd[5]], palmd[pmd[6]], palmd[pmd[7]] };
+}
+
+// MD layer pixels for the 32X pixels not drawn
+#define MD_LAYER_VEC_NONE vld(dst)
+#define MD_LAYER_VEC      vmdpal(pmd, palmd)
+#define MD_LAYER_VEC_H32  vld(dst + H32_OFFSET)
+
+// direct color mode
+#define do_line_dc_v(pd, p32x, pmd, inv, md_vec)                  \
+{                                                                 \
+  const u16 mr = 0x001f;                                          \
+  const u16 mg = 0x03e0;                                          \
+  const u16 mb = 0x7c00;                                          \
+  const u16 mp = 0x0000;                                          \
+  v8u16 vbg = vdup(mdbg), vinv = vdup(inv), t, s;                 \
+  int i;                                                          \
+                                                                  \
+  for (i = 320; i > 0; i -= 8, pd += 8, p32x += 8, pmd += 8) {    \
+    t = vld(p32x);                                                \
+    s = vmdbg(pmd, vbg) | (v8u16)(((t ^ vinv) & 0x8000) != 0);    \
+    vst(pd, (PXCONV(t) & s) | (md_vec & ~s));                     \
+  }                                                               \
+}
+
+// composite 320 already converted 32X pixels from buffer ln
+#define do_line_ln_v(pd, ln, pmd, md_vec)                         \
+{                                                                 \
+  v8u16 vbg = vdup(mdbg), t, s;                                   \
+  int i;                                                          \
+                                                                  \
+  for (i = 0; i < 320; i += 8, pd += 8, pmd += 8) {               \
+    t = vld(ln + i);                                              \
+    s = vmdbg(pmd, vbg) | (v8u16)((t & PXPRIO) != 0);             \
+    vst(pd, (t & s) | (md_vec & ~s));                             \
+  }                                                               \
+}
+
+// packed pixel mode
+#define do_line_pp_v(pd, p32x, pmd, md_vec)                       \
+{                                                                 \
+  u16 ln[320];                                                    \
+  int j;                                                          \
+  for (j = 0; j < 320; j++)                                       \
+    ln[j] = pal[*(unsigned char *)(MEM_BE2((uintptr_t)(p32x++)))];\
+  do_line_ln_v(pd, ln, pmd, md_vec);                              \
+}
+
+// run length mode
+#define do_line_rl_v(pd, p32x, pmd, md_vec)                       \
+{                                                                 \
+  unsigned short len, t;                                          \
+  u16 ln[320];                                                    \
+  int j;                                                          \
+  for (j = 0; j < 320; p32x++) {                                  \
+    t = pal[*p32x & 0xff];                                        \
+    for (len = (*p32x >> 8) + 1; len > 0 && j < 320; len--, j++)  \
+      ln[j] = t;                                                  \
+  }                                                               \
+  do_line_ln_v(pd, ln, pmd, md_vec);                              \
+}
+#endif
+
 // this is almost never used (Wiz, vert sw scaling and menu bg gen only)
 void FinalizeLine32xRGB555(int sh, int line, struct PicoEState *est)
 {
@@ -203,6 +301,22 @@ void FinalizeLine32xRGB555(int sh, int line, struct PicoEState *est)
 #define MD_LAYER_CODE \
   *dst = palmd[*pmd]
 
+#ifdef _VEC_32X_DRAW
+#define do_line_dc_x(pd, p32x, pmd, inv, md_code, md_vec) \
+  do_line_dc_v(pd, p32x, pmd, inv, md_vec)
+#define do_line_pp_x(pd, p32x, pmd, md_code, md_vec) \
+  do_line_pp_v(pd, p32x, pmd, md_vec)
+#define do_line_rl_x(pd, p32x, pmd, md_code, md_vec) \
+  do_line_rl_v(pd, p32x, pmd, md_vec)
+#else
+#define do_line_dc_x(pd, p32x, pmd, inv, md_code, md_vec) \
+  do_line_dc(pd, p32x, pmd, inv, md_code)
+#define do_line_pp_x(pd, p32x, pmd, md_code, md_vec) \
+  do_line_pp(pd, p32x, pmd, md_code)
+#define do_line_rl_x(pd, p32x, pmd, md_code, md_vec) \
+  do_line_rl(pd, p32x, pmd, md_code)
+#endif
+
 #define PICOSCAN_PRE \
   PicoScan32xBegin(l + (lines_sft_offs & 0xff)); \
   dst = Pico.est.DrawLineDest; \
@@ -211,7 +325,7 @@ void FinalizeLine32xRGB555(int sh, int line, struct PicoEState *est)
   PicoScan32xEnd(l + (lines_sft_offs & 0xff)); \
   Pico.est.DrawLineDest = (char *)Pico.est.DrawLineDest + DrawLineDestIncrement32x; \
 
-#define make_do_loop(name, pre_code, post_code, md_code)        \
+#define make_do_loop(name, pre_code, post_code, md_code, md_vec) \
 /* Direct Color Mode */                                         \
 static void do_loop_dc##name(unsigned short *dst,               \
     unsigned short *dram, unsigned lines_sft_offs, int mdbg)    \
@@ -230,7 +344,7 @@ static void do_loop_dc##name(unsigned short *dst,               \
     pre_code;                                                   \
     p32x = dram + dram[l + (lines_sft_offs >> 24)];             \
     if (h32 && !(lines_sft_offs & (4<<8))) p32x -= H32_OFFSET;  \
-    do_line_dc(dst, p32x, pmd, inv_bit, md_code);               \
+    do_line_dc_x(dst, p32x, pmd, inv_bit, md_code, md_vec);     \
     post_code;                                                  \
     dst += DrawLineDestIncrement32x/2 - 320;                    \
   }                                                             \
@@ -255,7 +369,7 @@ static void do_loop_pp##name(unsigned short *dst,               \
     p32x = (void *)(dram + dram[l + (lines_sft_offs >> 24)]);   \
     p32x += (lines_sft_offs >> 8) & 1;                          \
     if (h32 && !(lines_sft_offs & (4<<8))) p32x -= H32_OFFSET;  \
-    do_line_pp(dst, p32x, pmd, md_code);                        \
+    do_line_pp_x(dst, p32x, pmd, md_code, md_vec);              \
     post_code;                                                  \
     dst += DrawLineDestIncrement32x/2 - 320;                    \
   }                                                             \
@@ -279,7 +393,7 @@ static void do_loop_rl##name(unsigned short *dst,               \
     pre_code;                                                   \
     p32x = dram + dram[l + (lines_sft_offs >> 24)];             \
     if (h32 && !(lines_sft_offs & (4<<8))) p32x -= H32_OFFSET;  \
-    do_line_rl(dst, p32x, pmd, md_code);                        \
+    do_line_rl_x(dst, p32x, pmd, md_code, md_vec);              \
     post_code;                                                  \
     dst += DrawLineDestIncrement32x/2 - 320;                    \
   }                                                             \
@@ -287,7 +401,7 @@ static void do_loop_rl##name(unsigned short *dst,               \
 
 #ifdef _ASM_32X_DRAW
 #undef make_do_loop
-#define make_do_loop(name, pre_code, post_code, md_code) \
+#define make_do_loop(name, pre_code, post_code, md_code, md_vec) \
 extern void do_loop_dc##name(unsigned short *dst,        \
     unsigned short *dram, unsigned lines_offs, int mdbg);\
 extern void do_loop_pp##name(unsigned short *dst,        \
@@ -296,12 +410,12 @@ extern void do_loop_rl##name(unsigned short *dst,        \
     unsigned short *dram, unsigned lines_offs, int mdbg);
 #endif
 
-make_do_loop(,,,)
-make_do_loop(_md, , , MD_LAYER_CODE)
-make_do_loop(_h32, , , MD_LAYER_CODE_H32)
-make_do_loop(_scan, PICOSCAN_PRE, PICOSCAN_POST, )
-make_do_loop(_scan_h32, PICOSCAN_PRE, PICOSCAN_POST, MD_LAYER_CODE_H32)
-make_do_loop(_scan_md, PICOSCAN_PRE, PICOSCAN_POST, MD_LAYER_CODE)
+make_do_loop(, , , , MD_LAYER_VEC_NONE)
+make_do_loop(_md, , , MD_LAYER_CODE, MD_LAYER_VEC)
+make_do_loop(_h32, , , MD_LAYER_CODE_H32, MD_LAYER_VEC_H32)
+make_do_loop(_scan, PICOSCAN_PRE, PICOSCAN_POST, , MD_LAYER_VEC_NONE)
+make_do_loop(_scan_h32, PICOSCAN_PRE, PICOSCAN_POST, MD_LAYER_CODE_H32, MD_LAYER_VEC_H32)
+make_do_loop(_scan_md, PICOSCAN_PRE, PICOSCAN_POST, MD_LAYER_CODE, MD_LAYER_VEC)
 
 typedef void (*do_loop_func)(unsigned short *dst, unsigned short *dram, unsigned lines, int mdbg);
 enum { DO_LOOP, DO_LOOP_H32, DO_LOOP_MD, DO_LOOP_SCAN, DO_LOOP_H32_SCAN, DO_LOOP_MD_SCAN };
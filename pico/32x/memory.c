@@ -60,6 +60,7 @@ static void (*m68k_write16_io)(u32 a, u32 d);
 
 // poll detection
 #define POLL_THRESHOLD 11  // Primal Rage speed, Blackthorne intro
+#define POLL_THRESHOLD_FAST 4 // POPT_FAST_IDLE
 
 static struct {
   u32 addr1, addr2, cycles;
@@ -75,7 +76,8 @@ static int m68k_poll_detect(u32 a, u32 cycles, u32 flags)
   if (match && CYCLES_GT(64, cycles - m68k_poll.cycles) && !SekNotPolling)
   {
     // detect split 32bit access by same cycle count, and ignore those
-    if (cycles != m68k_poll.cycles && ++m68k_poll.cnt >= POLL_THRESHOLD) {
+    if (cycles != m68k_poll.cycles && ++m68k_poll.cnt >= ((PicoIn.opt &
+          POPT_FAST_IDLE) ? POLL_THRESHOLD_FAST : POLL_THRESHOLD)) {
       if (!(Pico32x.emu_flags & flags)) {
         elprintf(EL_32X, "m68k poll addr %08x, cyc %u",
           a, cycles - m68k_poll.cycles);
@@ -121,6 +123,8 @@ void NOINLINE p32x_sh2_poll_detect(u32 a, SH2 *sh2, u32 flags, int maxcnt)
   u32 cycles_diff = cycles_done - sh2->poll_cycles;
 
   a &= ~0x20000000;
+  if (PicoIn.opt & POPT_FAST_IDLE)
+    maxcnt = (maxcnt + 1) >> 1;
   // reading 2 consecutive 16bit values is probably a 32bit access. detect this
   // by checking address (max 2 bytes away) and cycles (max 2 cycles later).
   // no polling if more than 20 cycles have passed since last detect call.
@@ -1737,6 +1741,8 @@ static void REGPARM(3) sh2_write8_sdram(u32 a, u32 d, SH2 *sh2)
   if (t)
     sh2_sdram_checks(a & ~1, ((u16 *)sh2->p_sdram)[a1 / 2], sh2, t);
 #endif
+  if (sh2_icache_ram[a1 >> SH2_ICACHE_PAGE_SHIFT])
+    sh2_icache_wcheck_ram(a, 1);
 }
 
 static void REGPARM(3) sh2_write8_da(u32 a, u32 d, SH2 *sh2)
@@ -1749,6 +1755,8 @@ static void REGPARM(3) sh2_write8_da(u32 a, u32 d, SH2 *sh2)
   if (t)
     sh2_da_checks(a, t, sh2);
 #endif
+  if (sh2_icache_da[sh2->is_slave][a1 >> SH2_ICACHE_PAGE_SHIFT])
+    sh2_icache_wcheck_da(a, 1, sh2);
 }
 #endif
 
@@ -1813,6 +1821,8 @@ static void REGPARM(3) sh2_write16_sdram(u32 a, u32 d, SH2 *sh2)
   if (t)
     sh2_sdram_checks(a, d, sh2, t);
 #endif
+  if (sh2_icache_ram[a1 >> SH2_ICACHE_PAGE_SHIFT])
+    sh2_icache_wcheck_ram(a, 2);
 }
 
 static void REGPARM(3) sh2_write16_da(u32 a, u32 d, SH2 *sh2)
@@ -1825,6 +1835,8 @@ static void REGPARM(3) sh2_write16_da(u32 a, u32 d, SH2 *sh2)
   if (t)
     sh2_da_checks(a, t, sh2);
 #endif
+  if (sh2_icache_da[sh2->is_slave][a1 >> SH2_ICACHE_PAGE_SHIFT])
+    sh2_icache_wcheck_da(a, 2, sh2);
 }
 #endif
 
@@ -1889,6 +1901,8 @@ static void REGPARM(3) sh2_write32_sdram(u32 a, u32 d, SH2 *sh2)
   if (t|(u<<16))
     sh2_sdram_checks_l(a, d, sh2, t|(u<<16));
 #endif
+  if (sh2_icache_ram[a1 >> SH2_ICACHE_PAGE_SHIFT])
+    sh2_icache_wcheck_ram(a, 4);
 }
 
 static void REGPARM(3) sh2_write32_da(u32 a, u32 d, SH2 *sh2)
@@ -1902,6 +1916,8 @@ static void REGPARM(3) sh2_write32_da(u32 a, u32 d, SH2 *sh2)
   if (t|(u<<16))
     sh2_da_checks_l(a, t|(u<<16), sh2);
 #endif
+  if (sh2_icache_da[sh2->is_slave][a1 >> SH2_ICACHE_PAGE_SHIFT])
+    sh2_icache_wcheck_da(a, 4, sh2);
 }
 #endif
 
@@ -2511,6 +2527,7 @@ void PicoMemSetup32x(void)
 
   sh2_drc_mem_setup(&msh2);
   sh2_drc_mem_setup(&ssh2);
+  sh2_icache_flush();
   memset(sh2_poll_rd, 0, sizeof(sh2_poll_rd));
   memset(sh2_poll_wr, 0, sizeof(sh2_poll_wr));
   memset(sh2_poll_fifo, -1, sizeof(sh2_poll_fifo));
@@ -2525,6 +2542,7 @@ void p32x_update_banks(void)
   bank_switch_rom_sh2();
   if (Pico32x.emu_flags & P32XF_DRC_ROM_C)
     sh2_drc_flush_all();
+  sh2_icache_flush();
 }
 
 void Pico32xMemStateLoaded(void)
@@ -2542,6 +2560,7 @@ void Pico32xMemStateLoaded(void)
   memset(sh2_poll_fifo, 0, sizeof(sh2_poll_fifo));
 
   sh2_drc_flush_all();
+  sh2_icache_flush();
 }
 
 // vim:shiftwidth=2:ts=2:expandtab
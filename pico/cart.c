@@ -19,6 +19,13 @@
 #include <unzip/unzip.h>
 #include <zlib.h>
 
+#ifdef USE_CD_CACHE
+#include <pthread.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 static int rom_alloc_size;
 static const char *rom_exts[] = { "bin", "gen", "smd", "md", "32x", "pco", "iso", "sms", "gg", "sg", "sc" };
 
@@ -119,6 +126,27 @@ struct chd_struct {
 };
 #endif
 
+// image in memory. With a background loader, data is only valid up to
+// 'loaded', reads beyond are done from the source stream
+struct mem_file {
+  pm_file file;
+  pm_file *src;
+  pm_type src_type;
+  u8 *data;
+  unsigned int pos;
+  unsigned int avail;   // copy of 'loaded' owned by the reading thread
+  int mapped;
+#ifdef USE_CD_CACHE
+  unsigned int loaded;
+  int done;
+  int loader;
+  volatile int want;    // reading thread waits for the lock
+  pthread_t thr;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+#endif
+};
+
 pm_file *pm_open(const char *path)
 {
   pm_file *file = NULL;
@@ -401,6 +429,201 @@ static size_t _pm_read_chd(void *ptr, size_t bytes, pm_file *stream, int is_audi
 }
 #endif
 
+#ifdef USE_CD_CACHE
+#define CSO_THREADS 8
+
+struct cso_job {
+  cso_struct *cso;
+  u8 *in, *out;
+  unsigned int in_pos;  // file position of in[0]
+  int block, count;
+  int err;
+};
+
+static void *cso_worker(void *arg)
+{
+  struct cso_job *j = arg;
+  cso_struct *cso = j->cso;
+  u8 *out = j->out;
+  int b;
+
+  for (b = j->block; b < j->block + j->count; b++, out += 2048) {
+    int index = cso->index[b], index_end = cso->index[b+1];
+    unsigned int pos = (index&0x7fffffff) << cso->header.align;
+    int len = (((index_end&0x7fffffff) << cso->header.align) - pos) & 0xfff;
+
+    if (index < 0)
+      memcpy(out, j->in + pos - j->in_pos, 2048);
+    else if (uncompress_buf(out, 2048, j->in + pos - j->in_pos, len) != 0) {
+      j->err = 1;
+      break;
+    }
+  }
+  return NULL;
+}
+
+// CSO blocks are compressed independently. Read the compressed data of a
+// batch of blocks at once and decompress it in parallel.
+// Returns the number of bytes done, the caller handles the rest.
+static size_t cso_read_mt(u8 *out, size_t bytes, pm_file *stream)
+{
+  static int cpus;
+  cso_struct *cso = stream->param;
+  struct cso_job jobs[CSO_THREADS];
+  pthread_t thr[CSO_THREADS];
+  int block = cso->fpos_out >> 11;
+  int count = bytes >> 11;
+  size_t ret = 0;
+  u8 *in;
+  int i, n;
+
+  if (cpus == 0) {
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus > CSO_THREADS) cpus = CSO_THREADS;
+    if (cpus < 1) cpus = 1;
+  }
+  if (count > (cso->header.total_bytes >> 11) - block)
+    count = (cso->header.total_bytes >> 11) - block;
+
+  while (cpus > 1 && count >= 16) {
+    int batch = count < 512 ? count : 512;
+    unsigned int start = (cso->index[block] & 0x7fffffff) << cso->header.align;
+    unsigned int end = (cso->index[block+batch] & 0x7fffffff) << cso->header.align;
+    int err = 0;
+
+    in = malloc(end - start);
+    if (in == NULL)
+      break;
+    if (fseek(stream->file, start, SEEK_SET) != 0 ||
+        fread(in, 1, end - start, stream->file) != end - start) {
+      cso->fpos_in = -1;
+      free(in);
+      break;
+    }
+    cso->fpos_in = end;
+
+    n = cpus;
+    for (i = 0; i < n; i++) {
+      jobs[i].cso = cso;
+      jobs[i].in = in;
+      jobs[i].in_pos = start;
+      jobs[i].block = block + batch * i / n;
+      jobs[i].count = block + batch * (i+1) / n - jobs[i].block;
+      jobs[i].out = out + (jobs[i].block - block) * 2048;
+      jobs[i].err = 0;
+    }
+    // the 1st job is done by this thread, others if no thread can be started
+    for (i = 1; i < n; i++)
+      if (pthread_create(&thr[i], NULL, cso_worker, &jobs[i]) != 0)
+        break;
+    n = i;
+    for (; i < cpus; i++)
+      cso_worker(&jobs[i]);
+    cso_worker(&jobs[0]);
+    for (i = 1; i < n; i++)
+      pthread_join(thr[i], NULL);
+    free(in);
+
+    for (i = 0; i < cpus; i++)
+      err |= jobs[i].err;
+    if (err)
+      break; // redone by the caller, which reports the error
+
+    block += batch, count -= batch;
+    out += batch * 2048;
+    ret += batch * 2048;
+    cso->fpos_out += batch * 2048;
+  }
+  return ret;
+}
+
+static void *mem_map(pm_file *stream)
+{
+  void *p;
+  int fd;
+
+#ifdef USE_LIBRETRO_VFS
+  // no file descriptor with VFS, map by path if it is a native file
+  const char *path = filestream_get_path(stream->file);
+  fd = path ? open(path, O_RDONLY) : -1;
+#else
+  fd = fileno(stream->file);
+#endif
+  if (fd < 0)
+    return NULL;
+  p = mmap(NULL, stream->size, PROT_READ, MAP_PRIVATE, fd, 0);
+#ifdef USE_LIBRETRO_VFS
+  close(fd);
+#endif
+  return p == MAP_FAILED ? NULL : p;
+}
+
+// read from a memory file which isn't fully loaded yet
+static size_t mem_read_src(struct mem_file *m, void *ptr, size_t bytes)
+{
+  size_t ret = 0;
+
+  m->want = 1;
+  pthread_mutex_lock(&m->mutex);
+  m->want = 0;
+  if (m->src_type == PMT_ZIP) {
+    // no random access, wait for the loader to get there
+    while (m->pos + bytes > m->loaded && !m->done)
+      pthread_cond_wait(&m->cond, &m->mutex);
+  }
+  m->avail = m->loaded;
+  if (m->pos + bytes <= m->avail) {
+    memcpy(ptr, m->data + m->pos, bytes);
+    ret = bytes;
+  } else if (m->src != NULL && pm_seek(m->src, m->pos, SEEK_SET) == m->pos)
+    ret = pm_read(ptr, bytes, m->src);
+  pthread_cond_broadcast(&m->cond);
+  pthread_mutex_unlock(&m->mutex);
+
+  m->pos += ret;
+  return ret;
+}
+
+static void *mem_loader(void *arg)
+{
+  struct mem_file *m = arg;
+  unsigned int pos = 0;
+  size_t len;
+
+  pthread_mutex_lock(&m->mutex);
+  while (pos < m->file.size && !m->done) {
+    len = m->file.size - pos;
+    if (len > 256*1024)
+      len = 256*1024;
+    // the reading thread may have moved the source
+    if (pm_seek(m->src, pos, SEEK_SET) != pos)
+      break;
+    len = pm_read(m->data + pos, len, m->src);
+    if (len == 0 || len == (size_t)-1)
+      break;
+    m->loaded = pos += len;
+    pthread_cond_broadcast(&m->cond);
+
+    while (m->want && !m->done)
+      pthread_cond_wait(&m->cond, &m->mutex);
+  }
+  if (pos >= m->file.size) {
+    elprintf(EL_STATUS, "cd: image preloaded");
+    pm_close(m->src);
+    m->src = NULL;
+  }
+  m->done = 1;
+  pthread_cond_broadcast(&m->cond);
+  pthread_mutex_unlock(&m->mutex);
+  return NULL;
+}
+#else
+static size_t mem_read_src(struct mem_file *m, void *ptr, size_t bytes)
+{
+  return 0; // always fully loaded
+}
+#endif
+
 size_t pm_read(void *ptr, size_t bytes, pm_file *stream)
 {
   int ret;
@@ -445,12 +668,20 @@ size_t pm_read(void *ptr, size_t bytes, pm_file *stream)
   {
     cso_struct *cso = stream->param;
     int read_pos, read_len, out_offs, rret;
-    int block = cso->fpos_out >> 11;
-    int index = cso->index[block];
-    int index_end = cso->index[block+1];
+    int block, index, index_end;
     unsigned char *out = ptr, *tmp_dst;
 
     ret = 0;
+#ifdef USE_CD_CACHE
+    if ((cso->fpos_out & 0x7ff) == 0 && bytes >= 16*2048) {
+      ret = cso_read_mt(out, bytes, stream);
+      out += ret;
+      bytes -= ret;
+    }
+#endif
+    block = cso->fpos_out >> 11;
+    index = cso->index[block];
+    index_end = cso->index[block+1];
     while (bytes != 0)
     {
       out_offs = cso->fpos_out&0x7ff;
@@ -509,6 +740,20 @@ size_t pm_read(void *ptr, size_t bytes, pm_file *stream)
     ret = _pm_read_chd(ptr, bytes, stream, 0);
   }
 #endif
+  else if (stream->type == PMT_MEM)
+  {
+    struct mem_file *m = stream->file;
+
+    if (m->pos >= stream->size)
+      return 0;
+    if (bytes > stream->size - m->pos)
+      bytes = stream->size - m->pos;
+    if (m->pos + bytes > m->avail)
+      return mem_read_src(m, ptr, bytes);
+    memcpy(ptr, m->data + m->pos, bytes);
+    m->pos += bytes;
+    ret = bytes;
+  }
   else
     ret = 0;
 
@@ -520,7 +765,8 @@ size_t pm_read_audio(void *ptr, size_t bytes, pm_file *stream)
   if (stream == NULL)
     return -1;
 #if !CPU_IS_LE
-  else if (stream->type == PMT_UNCOMPRESSED)
+  else if (stream->type == PMT_UNCOMPRESSED || (stream->type == PMT_MEM &&
+           ((struct mem_file *)stream->file)->src_type == PMT_UNCOMPRESSED))
   {
     // convert little endian audio samples from WAV file
     int ret = pm_read(ptr, bytes, stream);
@@ -620,6 +866,17 @@ int pm_seek(pm_file *stream, long offset, int whence)
     return chd->fpos;
   }
 #endif
+  else if (stream->type == PMT_MEM)
+  {
+    struct mem_file *m = stream->file;
+    switch (whence)
+    {
+      case SEEK_CUR: m->pos += offset; break;
+      case SEEK_SET: m->pos  = offset; break;
+      case SEEK_END: m->pos  = stream->size - offset; break;
+    }
+    return m->pos;
+  }
   else
     return -1;
 }
@@ -654,6 +911,27 @@ int pm_close(pm_file *fp)
       free(chd->hunk);
   }
 #endif
+  else if (fp->type == PMT_MEM)
+  {
+    struct mem_file *m = fp->file;
+#ifdef USE_CD_CACHE
+    if (m->loader) {
+      pthread_mutex_lock(&m->mutex);
+      m->done = 1;
+      pthread_cond_broadcast(&m->cond);
+      pthread_mutex_unlock(&m->mutex);
+      pthread_join(m->thr, NULL);
+      pthread_mutex_destroy(&m->mutex);
+      pthread_cond_destroy(&m->cond);
+    }
+    if (m->mapped)
+      munmap(m->data, fp->size);
+    else
+#endif
+      free(m->data);
+    if (m->src != NULL)
+      pm_close(m->src);
+  }
   else
     ret = EOF;
 
@@ -661,6 +939,76 @@ int pm_close(pm_file *fp)
   return ret;
 }
 
+// Serve a stream from memory to avoid file accesses while reading sectors.
+// Uncompressed files are mmapped if possible, else (or if preload is set)
+// the whole stream is read into RAM, by a background loader if available.
+// Returns the new stream, or the old one if this isn't possible.
+pm_file *pm_cache(pm_file *stream, int preload)
+{
+  struct mem_file *m;
+
+  if (stream == NULL || stream->size == 0 || stream->type == PMT_MEM)
+    return stream;
+  // CHD sector layout depends on the track type, it has its own hunk cache
+  if (stream->type == PMT_CHD || (stream->type != PMT_UNCOMPRESSED && !preload))
+    return stream;
+
+  m = calloc(1, sizeof(*m));
+  if (m == NULL)
+    return stream;
+  m->file = *stream;
+  m->file.file = m;
+  m->file.param = NULL;
+  m->file.type = PMT_MEM;
+  m->src_type = stream->type;
+
+#ifdef USE_CD_CACHE
+  if (stream->type == PMT_UNCOMPRESSED && !preload) {
+    m->data = mem_map(stream);
+    if (m->data == NULL)
+      goto fail;
+    m->mapped = 1;
+    m->avail = stream->size;
+    pm_close(stream); // the mapping stays valid
+    return &m->file;
+  }
+#else
+  if (!preload)
+    goto fail;
+#endif
+
+  m->data = malloc(stream->size);
+  if (m->data == NULL) {
+    elprintf(EL_STATUS, "cd: no memory to preload image");
+    goto fail;
+  }
+  m->src = stream;
+
+#ifdef USE_CD_CACHE
+  pthread_mutex_init(&m->mutex, NULL);
+  pthread_cond_init(&m->cond, NULL);
+  if (pthread_create(&m->thr, NULL, mem_loader, m) == 0) {
+    m->loader = 1;
+    return &m->file;
+  }
+  pthread_mutex_destroy(&m->mutex);
+  pthread_cond_destroy(&m->cond);
+#endif
+  if (pm_seek(stream, 0, SEEK_SET) != 0 ||
+      pm_read(m->data, stream->size, stream) != stream->size)
+    goto fail;
+  m->src = NULL;
+  m->avail = stream->size;
+  pm_close(stream);
+  return &m->file;
+
+fail:
+  pm_seek(stream, 0, SEEK_SET);
+  free(m->data);
+  free(m);
+  return stream;
+}
+
 // byteswap, data needs to be int aligned, src can match dst
 void Byteswap(void *dst, const void *src, int len)
 {
@@ -689,25 +1037,30 @@ static int InterleveBlock(unsigned char *dest,unsigned char *src)
   return 0;
 }
 
-// Decode a SMD file
-static int DecodeSmd(unsigned char *data,int len)
+// Decode a SMD file, starting at offset i. Returns the offset decoded up to
+static int DecodeSmd(unsigned char *data,int i,int len)
 {
   unsigned char *temp=NULL;
-  int i=0;
 
   temp=(unsigned char *)malloc(0x4000);
-  if (temp==NULL) return 1;
+  if (temp==NULL) return i;
   memset(temp,0,0x4000);
 
   // Interleve each 16k block and shift down by 0x200:
-  for (i=0; i+0x4200<=len; i+=0x4000)
+  for (; i+0x4200<=len; i+=0x4000)
   {
     InterleveBlock(temp,data+0x200+i); // Interleve 16k to temporary buffer
     memcpy(data+i,temp,0x4000); // Copy back in
   }
 
   free(temp);
-  return 0;
+  return i;
+}
+
+static int IsSmd(unsigned char *data,int size)
+{
+  return size >= 0x4200 && (size&0x3fff) == 0x200 &&
+    ((data[0x2280] == 'S' && data[0x280] == 'E') || (data[0x280] == 'S' && data[0x2281] == 'E'));
 }
 
 void *PicoCartAlloc(int filesize, int is_sms)
@@ -746,6 +1099,7 @@ int PicoCartLoad(pm_file *f, const unsigned char *rom, unsigned int romsize,
 {
   unsigned char *rom_data = NULL;
   int size, bytes_read;
+  int smd = -1, done = 0; // SMD format, decoded size
 
   if (!f && !rom)
     return 1;
@@ -766,25 +1120,33 @@ int PicoCartLoad(pm_file *f, const unsigned char *rom, unsigned int romsize,
   }
 
   if (!rom) {
-    if (PicoCartLoadProgressCB != NULL)
+    // read ROM in blocks, and decode what's read while it is in the cache
+    int ret;
+    unsigned char *p = rom_data;
+    bytes_read=0;
+    do
     {
-      // read ROM in blocks, just for fun
-      int ret;
-      unsigned char *p = rom_data;
-      bytes_read=0;
-      do
-      {
-        int todo = size - bytes_read;
-        if (todo > 256*1024) todo = 256*1024;
-        ret = pm_read(p,todo,f);
-        bytes_read += ret;
-        p += ret;
-        PicoCartLoadProgressCB(bytes_read * 100LL / size);
+      int todo = size - bytes_read;
+      if (todo > 256*1024) todo = 256*1024;
+      ret = pm_read(p,todo,f);
+      if (ret <= 0)
+        break;
+      bytes_read += ret;
+      p += ret;
+      if (!is_sms) {
+        if (smd < 0 && (bytes_read >= 0x4200 || bytes_read >= size))
+          smd = IsSmd(rom_data, size);
+        if (smd > 0)
+          done = DecodeSmd(rom_data, done, bytes_read);
+        else if (smd == 0) {
+          Byteswap(rom_data + done, rom_data + done, (bytes_read - done) & ~3);
+          done += (bytes_read - done) & ~3;
+        }
       }
-      while (ret > 0);
+      if (PicoCartLoadProgressCB != NULL)
+        PicoCartLoadProgressCB(bytes_read * 100LL / size);
     }
-    else
-      bytes_read = pm_read(rom_data,size,f); // Load up the rom
+    while (bytes_read < size);
 
     if (bytes_read <= 0) {
       elprintf(EL_STATUS, "read failed");
@@ -799,12 +1161,13 @@ int PicoCartLoad(pm_file *f, const unsigned char *rom, unsigned int romsize,
   if (!is_sms)
   {
     // Check for SMD:
-    if (size >= 0x4200 && (size&0x3fff) == 0x200 &&
-        ((rom_data[0x2280] == 'S' && rom_data[0x280] == 'E') || (rom_data[0x280] == 'S' && rom_data[0x2281] == 'E'))) {
+    if (smd < 0)
+      smd = IsSmd(rom_data, size);
+    if (smd) {
       elprintf(EL_STATUS, "SMD format detected.");
-      DecodeSmd(rom_data,size); size-=0x200; // Decode and byteswap SMD
+      DecodeSmd(rom_data,done,size); size-=0x200; // Decode and byteswap SMD
     }
-    else Byteswap(rom_data, rom_data, size); // Just byteswap
+    else Byteswap(rom_data + done, rom_data + done, size - done); // Just byteswap
   }
   else
   {
@@ -906,6 +1269,7 @@ void PicoCartUnload(void)
   }
 
   PicoUnload32x();
+  PicoMovieUnload();
 
   if (Pico.rom != NULL) {
     SekFinishIdleDet();
@@ -140,6 +140,7 @@ int load_cd_image(const char *cd_img_name, int *type)
       cdparse_destroy(cue_data);
     return -1;
   }
+  pmf = pm_cache(pmf, PicoIn.opt & POPT_EN_MCD_PRELOAD);
   tracks[0].fd = pmf;
   tracks[0].fname = strdup(cd_img_name);
   tracks[0].type = *type;
@@ -191,6 +192,7 @@ int load_cd_image(const char *cd_img_name, int *type)
         pm_file *f = pm_open(cue_data->tracks[n].fname);
         if (f != NULL)
         {
+          f = pm_cache(f, PicoIn.opt & POPT_EN_MCD_PRELOAD);
           // assume raw, ignore header for wav..
           tracks[index].fd = f;
           tracks[index].fname = strdup(cue_data->tracks[n].fname);
@@ -51,14 +51,13 @@ typedef struct
   uint16 bufferOffset;              /* image buffer column offset */
   uint32 bufferStart;               /* image buffer start index */
   uint32 y_step;                    /* pico: render line step */
-  uint8 lut_prio[4][0x10][0x10];    /* WORD-RAM data writes priority lookup table */
-  uint8 lut_pixel[0x200];           /* Graphics operation dot offset lookup table */
-  uint16 lut_cell2[0x80];           /* Graphics operation stamp offset lookup table */
-  uint16 lut_cell4[0x80];           /* Graphics operation stamp offset lookup table */
 } gfx_t;
 
 static gfx_t gfx;
 
+/* gfx_lut_prio, gfx_lut_pixel, gfx_lut_cell2, gfx_lut_cell4 */
+#include "gfx_tab.c"
+
 static void gfx_schedule(void);
 
 /***************************************************************/
@@ -67,65 +66,8 @@ static void gfx_schedule(void);
 
 void gfx_init(void)
 {
-  int i, j;
-  uint8 row, col, temp;
-
+  /* lookup tables are generated by tools/make_tables_c */
   memset(&gfx, 0, sizeof(gfx));
-
-  /* Initialize priority modes lookup table */
-  for (i = 0; i < 0x10; i++)
-  {
-    for (j = 0; j < 0x10; j++)
-    {
-      /* normal */
-      gfx.lut_prio[0][i][j] = j;
-      /* underwrite */
-      gfx.lut_prio[1][i][j] = i ? i : j;
-      /* overwrite */
-      gfx.lut_prio[2][i][j] = j ? j : i;
-      /* invalid */
-      gfx.lut_prio[3][i][j] = i;
-    }
-  }
-
-  /* Initialize cell lookup table             */
-  /* table entry = yyxxhrr (7 bits)           */
-  /* with: yy = cell row (0-3)                */
-  /*       xx = cell column (0-3)             */
-  /*      hrr = HFLIP & ROTATION bits         */
-  for (i=0; i<0x80; i++)
-  {
-    /* one stamp = 2x2 cells (16x16) or 4x4 cells (32x32) */
-    row = (i >> 5) & 3;
-    col = (i >> 3) & 3;
-
-    if (i & 4) { col = col ^ 3; }  /* HFLIP (always first)  */ 
-    if (i & 2) { col = col ^ 3; row = row ^ 3; }  /* ROLL1 */
-    if (i & 1) { temp = col; col = row ^ 3; row = temp; }  /* ROLL0  */
-
-    /* cell offset (0-3 or 0-15) */
-    gfx.lut_cell2[i] = ((row&1) + (col&1) * 2) << 6;
-    gfx.lut_cell4[i] = ((row&3) + (col&3) * 4) << 6;
-  }
-
-  /* Initialize pixel lookup table      */
-  /* table entry = yyyxxxhrr (9 bits)   */
-  /* with:  yyy = pixel row  (0-7)      */
-  /*        xxx = pixel column (0-7)    */
-  /*        hrr = HFLIP & ROTATION bits */
-  for (i=0; i<0x200; i++)
-  {
-    /* one cell = 8x8 pixels */
-    row = (i >> 6) & 7;
-    col = (i >> 3) & 7;
-
-    if (i & 4) { col = col ^ 7; }   /* HFLIP (always first) */ 
-    if (i & 2) { col = col ^ 7; row = row ^ 7; }  /* ROLL1 */
-    if (i & 1) { temp = col; col = row ^ 7; row = temp; } /* ROLL0 */
-
-    /* pixel offset (0-63) */
-    gfx.lut_pixel[i] = col + row * 8;
-  }
 }
 
 int gfx_context_save(uint8 *state)
@@ -178,7 +120,7 @@ int gfx_context_load(const uint8 *state)
   return bufferptr;
 }
 
-static inline int gfx_pixel(uint32 xpos, uint32 ypos, uint16 *lut_cell)
+static inline int gfx_pixel(uint32 xpos, uint32 ypos, const uint16 *lut_cell)
 {
   uint16 stamp_data;
   uint32 stamp_index;
@@ -215,7 +157,7 @@ static inline int gfx_pixel(uint32 xpos, uint32 ypos, uint16 *lut_cell)
       /* with: yyy = pixel row  (0-7) = (ypos >> 11) & 7   */
       /*       xxx = pixel column (0-7) = (xpos >> 11) & 7 */
       /*       hrr = HFLIP & ROTATION bits                 */
-      stamp_index |= gfx.lut_pixel[stamp_data | ((ypos >> 5) & 0x1c0) | ((xpos >> 8) & 0x38)];
+      stamp_index |= gfx_lut_pixel[stamp_data | ((ypos >> 5) & 0x1c0) | ((xpos >> 8) & 0x38)];
 
       /* read pixel pair (2 pixels/byte) */
       pixel_out = READ_BYTE(Pico_mcd->word_ram2M, stamp_index >> 1);
@@ -305,8 +247,8 @@ static void gfx_render(uint32 bufferIndex, uint32 width)
 {
   uint8 pixel_in, pixel_out;
   uint32 priority;
-  uint8 (*lut_prio)[0x10];
-  uint16 *lut_cell;
+  const uint8 (*lut_prio)[0x10];
+  const uint16 *lut_cell;
   uint32 mask;
 
   /* pixel map start position for current line (13.3 format converted to 13.11) */
@@ -319,9 +261,9 @@ static void gfx_render(uint32 bufferIndex, uint32 width)
 
   priority = (Pico_mcd->s68k_regs[2] << 8) | Pico_mcd->s68k_regs[3];
   priority = (priority >> 3) & 0x03;
-  lut_prio = gfx.lut_prio[priority];
+  lut_prio = gfx_lut_prio[priority];
 
-  lut_cell = (Pico_mcd->s68k_regs[0x58+1] & 0x02) ? gfx.lut_cell4 : gfx.lut_cell2;
+  lut_cell = (Pico_mcd->s68k_regs[0x58+1] & 0x02) ? gfx_lut_cell4 : gfx_lut_cell2;
 
   /* check if stamp map is repeated */
   mask = 0xffffff; /* 24-bit range */
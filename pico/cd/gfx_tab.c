@@ -0,0 +1,136 @@
+/* generated by tools/make_tables_c, do not modify */
+/* WORD-RAM data writes priority lookup table */
+static const uint8 gfx_lut_prio[4][0x10][0x10] = {
+{
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+},
+{
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+	{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+	{3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
+	{4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
+	{5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+	{6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+	{7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},
+	{8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8},
+	{9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9},
+	{10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+	{11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+	{12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+	{13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13},
+	{14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14},
+	{15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+},
+{
+	{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{2, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{3, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{4, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{5, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{6, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{7, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{8, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{11, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{12, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{13, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{14, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+	{15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+},
+{
+	{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+	{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+	{3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
+	{4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
+	{5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+	{6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+	{7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},
+	{8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8},
+	{9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9},
+	{10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+	{11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+	{12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+	{13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13},
+	{14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14},
+	{15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+},
+};
+
+/* Graphics operation dot offset lookup table */
+static const uint8 gfx_lut_pixel[0x200] = {
+	0, 7, 63, 56, 7, 63, 56, 0, 1, 15, 62, 48, 6, 55, 57, 8,
+	2, 23, 61, 40, 5, 47, 58, 16, 3, 31, 60, 32, 4, 39, 59, 24,
+	4, 39, 59, 24, 3, 31, 60, 32, 5, 47, 58, 16, 2, 23, 61, 40,
+	6, 55, 57, 8, 1, 15, 62, 48, 7, 63, 56, 0, 0, 7, 63, 56,
+	8, 6, 55, 57, 15, 62, 48, 1, 9, 14, 54, 49, 14, 54, 49, 9,
+	10, 22, 53, 41, 13, 46, 50, 17, 11, 30, 52, 33, 12, 38, 51, 25,
+	12, 38, 51, 25, 11, 30, 52, 33, 13, 46, 50, 17, 10, 22, 53, 41,
+	14, 54, 49, 9, 9, 14, 54, 49, 15, 62, 48, 1, 8, 6, 55, 57,
+	16, 5, 47, 58, 23, 61, 40, 2, 17, 13, 46, 50, 22, 53, 41, 10,
+	18, 21, 45, 42, 21, 45, 42, 18, 19, 29, 44, 34, 20, 37, 43, 26,
+	20, 37, 43, 26, 19, 29, 44, 34, 21, 45, 42, 18, 18, 21, 45, 42,
+	22, 53, 41, 10, 17, 13, 46, 50, 23, 61, 40, 2, 16, 5, 47, 58,
+	24, 4, 39, 59, 31, 60, 32, 3, 25, 12, 38, 51, 30, 52, 33, 11,
+	26, 20, 37, 43, 29, 44, 34, 19, 27, 28, 36, 35, 28, 36, 35, 27,
+	28, 36, 35, 27, 27, 28, 36, 35, 29, 44, 34, 19, 26, 20, 37, 43,
+	30, 52, 33, 11, 25, 12, 38, 51, 31, 60, 32, 3, 24, 4, 39, 59,
+	32, 3, 31, 60, 39, 59, 24, 4, 33, 11, 30, 52, 38, 51, 25, 12,
+	34, 19, 29, 44, 37, 43, 26, 20, 35, 27, 28, 36, 36, 35, 27, 28,
+	36, 35, 27, 28, 35, 27, 28, 36, 37, 43, 26, 20, 34, 19, 29, 44,
+	38, 51, 25, 12, 33, 11, 30, 52, 39, 59, 24, 4, 32, 3, 31, 60,
+	40, 2, 23, 61, 47, 58, 16, 5, 41, 10, 22, 53, 46, 50, 17, 13,
+	42, 18, 21, 45, 45, 42, 18, 21, 43, 26, 20, 37, 44, 34, 19, 29,
+	44, 34, 19, 29, 43, 26, 20, 37, 45, 42, 18, 21, 42, 18, 21, 45,
+	46, 50, 17, 13, 41, 10, 22, 53, 47, 58, 16, 5, 40, 2, 23, 61,
+	48, 1, 15, 62, 55, 57, 8, 6, 49, 9, 14, 54, 54, 49, 9, 14,
+	50, 17, 13, 46, 53, 41, 10, 22, 51, 25, 12, 38, 52, 33, 11, 30,
+	52, 33, 11, 30, 51, 25, 12, 38, 53, 41, 10, 22, 50, 17, 13, 46,
+	54, 49, 9, 14, 49, 9, 14, 54, 55, 57, 8, 6, 48, 1, 15, 62,
+	56, 0, 7, 63, 63, 56, 0, 7, 57, 8, 6, 55, 62, 48, 1, 15,
+	58, 16, 5, 47, 61, 40, 2, 23, 59, 24, 4, 39, 60, 32, 3, 31,
+	60, 32, 3, 31, 59, 24, 4, 39, 61, 40, 2, 23, 58, 16, 5, 47,
+	62, 48, 1, 15, 57, 8, 6, 55, 63, 56, 0, 7, 56, 0, 7, 63,
+};
+
+/* Graphics operation stamp offset lookup tables */
+static const uint16 gfx_lut_cell2[0x80] = {
+	0, 128, 192, 64, 128, 192, 64, 0, 128, 192, 64, 0, 0, 128, 192, 64,
+	0, 128, 192, 64, 128, 192, 64, 0, 128, 192, 64, 0, 0, 128, 192, 64,
+	64, 0, 128, 192, 192, 64, 0, 128, 192, 64, 0, 128, 64, 0, 128, 192,
+	64, 0, 128, 192, 192, 64, 0, 128, 192, 64, 0, 128, 64, 0, 128, 192,
+	0, 128, 192, 64, 128, 192, 64, 0, 128, 192, 64, 0, 0, 128, 192, 64,
+	0, 128, 192, 64, 128, 192, 64, 0, 128, 192, 64, 0, 0, 128, 192, 64,
+	64, 0, 128, 192, 192, 64, 0, 128, 192, 64, 0, 128, 64, 0, 128, 192,
+	64, 0, 128, 192, 192, 64, 0, 128, 192, 64, 0, 128, 64, 0, 128, 192,
+};
+
+static const uint16 gfx_lut_cell4[0x80] = {
+	0, 768, 960, 192, 768, 960, 192, 0, 256, 832, 704, 128, 512, 896, 448, 64,
+	512, 896, 448, 64, 256, 832, 704, 128, 768, 960, 192, 0, 0, 768, 960, 192,
+	64, 512, 896, 448, 832, 704, 128, 256, 320, 576, 640, 384, 576, 640, 384, 320,
+	576, 640, 384, 320, 320, 576, 640, 384, 832, 704, 128, 256, 64, 512, 896, 448,
+	128, 256, 832, 704, 896, 448, 64, 512, 384, 320, 576, 640, 640, 384, 320, 576,
+	640, 384, 320, 576, 384, 320, 576, 640, 896, 448, 64, 512, 128, 256, 832, 704,
+	192, 0, 768, 960, 960, 192, 0, 768, 448, 64, 512, 896, 704, 128, 256, 832,
+	704, 128, 256, 832, 448, 64, 512, 896, 960, 192, 0, 768, 192, 0, 768, 960,
+};
+
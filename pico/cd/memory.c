@@ -69,6 +69,7 @@ static void remap_word_ram(u32 r3);
 
 // poller detection
 #define POLL_LIMIT 16
+#define POLL_LIMIT_FAST 6 // POPT_FAST_IDLE
 #define POLL_CYCLES 52
 
 void m68k_comm_check(u32 a)
@@ -91,7 +92,8 @@ void m68k_comm_check(u32 a)
   }
   Pico_mcd->m.m68k_poll_cnt++;
   Pico_mcd->m.state_flags &= ~PCD_ST_M68K_POLL;
-  if (Pico_mcd->m.m68k_poll_cnt >= POLL_LIMIT) {
+  if (Pico_mcd->m.m68k_poll_cnt >= ((PicoIn.opt & POPT_FAST_IDLE) ?
+                                     POLL_LIMIT_FAST : POLL_LIMIT)) {
     Pico_mcd->m.state_flags |= PCD_ST_M68K_POLL;
     SekEndRun(8);
   }
@@ -405,7 +407,9 @@ void s68k_reg_write8(u32 a, u32 d)
       {
         if (!(dold & 4)) {
           elprintf(EL_CDREG3, "wram mode 2M->1M");
+          pprof_start(wram);
           wram_2M_to_1M(Pico_mcd->word_ram2M);
+          pprof_end(wram);
         }
 
         if ((d ^ dold) & 0x05)
@@ -415,7 +419,9 @@ void s68k_reg_write8(u32 a, u32 d)
       {
         if (dold & 4) {
           elprintf(EL_CDREG3, "wram mode 1M->2M");
+          pprof_start(wram);
           wram_1M_to_2M(Pico_mcd->word_ram2M);
+          pprof_end(wram);
         }
         d = (d & ~3) | Pico_mcd->m.dmna_ret_2m;
       }
@@ -1304,6 +1310,10 @@ PICO_INTERNAL void PicoMemSetupCD(void)
   PicoCpuFS68k.write_byte = (void *)s68k_write8;
   PicoCpuFS68k.write_word = (void *)s68k_write16;
   PicoCpuFS68k.write_long = (void *)s68k_write32;
+  PicoCpuFS68k.read8_map   = s68k_read8_map;
+  PicoCpuFS68k.read16_map  = s68k_read16_map;
+  PicoCpuFS68k.write8_map  = s68k_write8_map;
+  PicoCpuFS68k.write16_map = s68k_write16_map;
 #endif
 #ifdef EMU_M68K
   m68k_mem_setup_cd();
@@ -29,38 +29,71 @@ unsigned char formatted_bram[4*0x10] =
 // 128K |  bit ] | bank0  |
 // 256K | unused | bank1  |
 
+// a 2M long holds the 16 bit words at the same position in bank0 and bank1,
+// convert 2 longs at once to write full longs on the other side as well
+#if CPU_IS_LE
+#define WRAM_LO(a, b)	(((a) & 0xffff) | ((b) << 16))
+#define WRAM_HI(a, b)	(((a) >> 16) | ((b) & 0xffff0000))
+#else
+#define WRAM_LO(a, b)	(((a) & 0xffff0000) | ((b) >> 16))
+#define WRAM_HI(a, b)	(((a) << 16) | ((b) & 0xffff))
+#endif
+
 #ifndef _ASM_MISC_C
 PICO_INTERNAL_ASM void wram_2M_to_1M(unsigned char *m)
 {
-	unsigned short *m1M_b0, *m1M_b1;
-	unsigned int i, tmp, *m2M;
+	unsigned int *m1M_b0, *m1M_b1;
+	unsigned int i, t0, t1, *m2M;
 
 	m2M = (unsigned int *) (m + 0x40000);
-	m1M_b0 = (unsigned short *) m2M;
-	m1M_b1 = (unsigned short *) (m + 0x60000);
+	m1M_b0 = (unsigned int *) m2M;
+	m1M_b1 = (unsigned int *) (m + 0x60000);
 
-	for (i = 0x40000/4; i; i--)
+	for (i = 0x40000/8; i; i--)
 	{
-		tmp = *(--m2M);
-		*(--m1M_b0) = tmp;
-		*(--m1M_b1) = tmp >> 16;
+		t1 = *(--m2M);
+		t0 = *(--m2M);
+		*(--m1M_b0) = WRAM_LO(t0, t1);
+		*(--m1M_b1) = WRAM_HI(t0, t1);
 	}
 }
 
 PICO_INTERNAL_ASM void wram_1M_to_2M(unsigned char *m)
 {
-	unsigned short *m1M_b0, *m1M_b1;
-	unsigned int i, tmp, *m2M;
+	unsigned int *m1M_b0, *m1M_b1;
+	unsigned int i, t0, t1, *m2M;
 
 	m2M = (unsigned int *) m;
-	m1M_b0 = (unsigned short *) (m + 0x20000);
-	m1M_b1 = (unsigned short *) (m + 0x40000);
+	m1M_b0 = (unsigned int *) (m + 0x20000);
+	m1M_b1 = (unsigned int *) (m + 0x40000);
 
-	for (i = 0x40000/4; i; i--)
+	for (i = 0x40000/8; i; i--)
 	{
-		tmp = *m1M_b0++ | (*m1M_b1++ << 16);
-		*m2M++ = tmp;
+		t0 = *m1M_b0++;
+		t1 = *m1M_b1++;
+		*m2M++ = WRAM_LO(t0, t1);
+		*m2M++ = WRAM_HI(t0, t1);
 	}
 }
 #endif
 
+// convert len bytes at 2M offset offs from the 1M banks in m to d, leaving
+// word RAM untouched (for saving the 2M layout while in 1M mode)
+PICO_INTERNAL void wram_1M_to_2M_copy(unsigned char *d, const unsigned char *m, int offs, int len)
+{
+	const unsigned int *m1M_b0, *m1M_b1;
+	unsigned int i, t0, t1, *m2M;
+
+	m2M = (unsigned int *) d;
+	m1M_b0 = (const unsigned int *) (m + 0x20000 + offs/2);
+	m1M_b1 = (const unsigned int *) (m + 0x40000 + offs/2);
+
+	for (i = len/8; i; i--)
+	{
+		t0 = *m1M_b0++;
+		t1 = *m1M_b1++;
+		*m2M++ = WRAM_LO(t0, t1);
+		*m2M++ = WRAM_HI(t0, t1);
+	}
+}
+
@@ -63,9 +63,49 @@ static u32 HighCacheA[41*2+1]; // caches for high layers
 static u32 HighCacheB[41*2+1];
 static s32 HighPreSpr[128*2*2]; // slightly preprocessed sprites (2 banks a 128)
 static int HighPreSprBank;
+// sprite lines are parsed ahead up to this line while the SAT is unchanged
+static int HighLnSprParsed, HighLnSprMode; // with reg 12 H40 and S/H bits
+static int HighLnSprDirty; // SAT has been modified in this frame
 
 u32 VdpSATCache[2*128];  // VDP sprite cache (1st 32 sprite attr bits)
 
+// scanline cache. A line is only drawn if something it depends on has changed
+// since it was drawn the last time. Dependencies are the VRAM pages read for
+// the line (name table rows, tile patterns), and a hash of everything else
+// (VDP registers, scroll values, sprites on the line). The 8 bit line data is
+// cached before palette conversion, hence CRAM changes don't need a redraw.
+// VRAM pages get a stamp on writes, which is the number of the last line drawn.
+u32 VdpVRAMStamp[64], VdpLineStamp;
+unsigned int PicoDrawLinesCached, PicoDrawLinesDrawn;
+
+// output change tracking for PicoIn.frameChanged. The cache also keeps the
+// last output of lines not drawn through it, lines are compared against that.
+#define PCHG_IMAGE    (1<<0) // some line differs from the last frame
+#define PCHG_PAL      (1<<1) // palette modified in this frame
+#define PCHG_PAL_LAST (1<<2) // palette modified in the last frame
+static int rendchanged;
+
+#ifndef _ASM_DRAW_C
+#define LINE_CACHE
+static unsigned char LineCache[240][320];
+static u64 LineCacheKey[240], LineCacheDeps[240];
+static u32 LineCacheStamp[240]; // 0: invalid
+static u8 LineCacheOut[240];    // 1: LineCache has the line in the output buffer
+static u64 line_key, line_deps;
+
+#define LINE_DEP(a) line_deps |= 1ULL << (((a) >> 9) & 63) // VRAM word address
+#else
+#define LINE_DEP(a)
+#endif
+
+#ifndef _ASM_DRAW_C
+// decoded tile store, 8 pixels of a tile row per u64 (in memory order), also
+// horizontally flipped. Kept up to date per VRAM page with the page stamps.
+#define TILE_CACHE
+static u64 TileDecN[0x10000/4], TileDecF[0x10000/4];
+static u32 TileDecStamp[64]; // page valid if not written since this stamp
+#endif
+
 // NB don't change any defines without checking their usage in ASM
 
 #if defined(USE_BGR555)
@@ -200,6 +240,27 @@ TileFlipMaker_(pix_func,m)
 TileNormMaker(TileNorm, pix_just_write)
 TileFlipMaker(TileFlip, pix_just_write)
 
+#ifdef TILE_CACHE
+// same as above on a decoded row, all 8 pixels at once
+static void TileRow(unsigned char *pd, u64 pix, unsigned char pal)
+{
+  u64 d, m = (pix + 0x7f7f7f7f7f7f7f7fULL) & 0x8080808080808080ULL;
+
+  m |= m - (m >> 7); // 0xff for each non-transparent pixel
+  memcpy(&d, pd, 8);
+  d = (d & ~m) | ((pix | pal * 0x0101010101010101ULL) & m);
+  memcpy(pd, &d, 8);
+}
+
+#define TileRowDec(pd,pack,tad,flip,pal) \
+  TileRow(pd, (flip) ? TileDecF[(tad)>>1] : TileDecN[(tad)>>1], pal)
+#else
+#define TileRowDec(pd,pack,tad,flip,pal) { \
+  if (flip) TileFlip(pd, pack, pal); \
+  else      TileNorm(pd, pack, pal); \
+}
+#endif
+
 #ifndef _ASM_DRAW_C
 
 // draw low prio sprite non-s/h pixels in s/h mode
@@ -286,8 +347,10 @@ TileFlipMakerAS(TileFlipAS_onlymark, pix_sh_as_onlymark)
 #define pix_and(x) \
   pd[x] &= pal|t
 
+#ifndef TILE_CACHE
 TileNormMaker(TileNorm_and, pix_and)
 TileFlipMaker(TileFlip_and, pix_and)
+#endif
 
 // forced sprite draw (through debug reg)
 #define pix_sh_as_and(x) \
@@ -312,9 +375,11 @@ TileFlipMakerAS(TileFlipSH_AS_and, pix_sh_as_and)
       /* Get tile address/2: */						\
       u32 addr = ((code<<yshift)&0x7ff0) + ty;				\
       if (code & 0x1000) addr ^= ymask<<1; /* Y-flip */			\
+      LINE_DEP(addr);							\
 									\
       pal = ((code>>9)&0x30) | sh; /* shadow */				\
       pack = CPU_LE2(*(u32 *)(PicoMem.vram + addr));			\
+      tad = addr;							\
       if (!pack)							\
         blank = code;							\
     }									\
@@ -327,10 +392,12 @@ TileFlipMakerAS(TileFlipSH_AS_and, pix_sh_as_and)
     }									\
   } else {								\
     if (cache) lflags |= LF_LPRIO;					\
-    if (pack&mask) {							\
-      if (code & 0x0800) TileFlip(pd + dx, pack&mask, pal);		\
-      else               TileNorm(pd + dx, pack&mask, pal);		\
-    }									\
+    if ((mask) != ~0) {							\
+      if (!(pack&mask)) ;						\
+      else if (code & 0x0800) TileFlip(pd + dx, pack&mask, pal);	\
+      else                    TileNorm(pd + dx, pack&mask, pal);	\
+    } else if (pack)							\
+      TileRowDec(pd + dx, pack, tad, code & 0x0800, pal);		\
   }									\
 }
 
@@ -341,7 +408,7 @@ void funcname(struct TileStrip *ts, int lflags, int cellskip)		\
   u32 *hc = ts->hc;							\
   int tilex, dx, ty, cells;						\
   u32 code, oldcode = -1, blank = -1; /* The tile we know is blank */	\
-  u32 pal = 0, pack = 0, sh, mask = ~0;					\
+  u32 pal = 0, pack = 0, tad = 0, sh, mask = ~0;			\
 									\
   /* Draw tiles across screen: */					\
   sh = (lflags & LF_SH) << 6; /* shadow */				\
@@ -408,7 +475,7 @@ void funcname(struct TileStrip *ts, int lflags, int cellskip)		\
   u32 *hc = ts->hc;							\
   int tilex, dx, ty = 0, cell = 0, nametabadd = 0;			\
   u32 code, oldcode = -1, blank = -1; /* The tile we know is blank */	\
-  u32 pal = 0, pack = 0, sh, plane, mask;				\
+  u32 pal = 0, pack = 0, tad = 0, sh, plane, mask;			\
   int scan = Pico.est.DrawScanline<<(yshift-4);				\
 									\
   /* Draw tiles across screen: */					\
@@ -557,6 +624,7 @@ void funcname(int plane_sh, u32 *hcache, int cellskip, int maxcells, struct Pico
       /* Find the line in the name table */				\
       ts.line=(vscroll+est->DrawScanline)&ymask;			\
       ts.nametab+=(ts.line>>3)<<shift[width];				\
+      LINE_DEP(ts.nametab);						\
 									\
       drawstrip(&ts, plane_sh, cellskip);				\
     } else {								\
@@ -578,6 +646,9 @@ void funcname(int plane_sh, u32 *hcache, int cellskip, int maxcells, struct Pico
     plane_sh |= PicoMem.vsram[(pvid->reg[12]&1?0x00:0x20) + (plane_sh&LF_PLANE)] << 16; \
 									\
     if (likely((pvid->reg[12]&6) != 6)) {				\
+      int a, e = ts.nametab + (((ymask+1)>>3)<<shift[width]);		\
+      for (a = ts.nametab; a < e; a += 0x200) /* whole name table */	\
+        LINE_DEP(a);							\
       ts.line=ymask|(shift[width]<<24); /* save some stuff instead of line */ \
       drawstripvsram(&ts, plane_sh, cellskip);				\
     } else {								\
@@ -600,7 +671,7 @@ static void DrawWindow(int tstart, int tend, int prio, int sh,
   struct PicoVideo *pvid = &est->Pico->video;
   int tilex,ty,nametab,code,oldcode=-1,blank=-1; // The tile we know is blank
   int yshift,ymask;
-  u32 pack=0, pal=0;
+  u32 pack=0, pal=0, tad=0;
   u32 *hc=NULL, lflags=0; // referenced in DrawTile
 
   yshift = 4, ymask = 0x7;
@@ -619,6 +690,7 @@ static void DrawWindow(int tstart, int tend, int prio, int sh,
     nametab=(pvid->reg[3]&0x3e)<<9; // 32-cell mode
     nametab+=(est->DrawScanline>>(yshift-1))<<5;
   }
+  LINE_DEP(nametab);
 
   if (prio && !(est->rendstatus & PDRAW_WND_DIFF_PRIO)) {
     // all tiles processed in low prio pass
@@ -792,8 +864,23 @@ static void DrawSprite(s32 *sprite, int sh, int w)
     if(code&0x0800) fTileFunc=TileFlipNonSH;
     else            fTileFunc=TileNormNonSH;
   } else {
+#ifdef TILE_CACHE
+    // no s/h processing, use the decoded tiles
+    u64 *dec = (code&0x0800 ? TileDecF : TileDecN);
+
+    if (w) width = w; // tile limit
+    for (; width; width--,sx+=8,tile+=delta)
+    {
+      if(sx<=0)   continue;
+      if(sx>=328) break; // Offscreen
+
+      TileRow(pd + sx, dec[(tile & 0x7fff) >> 1], pal);
+    }
+    return;
+#else
     if(code&0x0800) fTileFunc=TileFlip;
     else            fTileFunc=TileNorm;
+#endif
   }
 
   if (w) width = w; // tile limit
@@ -1055,6 +1142,26 @@ static void DrawSpritesHiAS(unsigned char *sprited, int sh)
 #ifdef FORCE
 // NB lots of duplicate code, all for the sake of a small performance gain.
 
+#ifdef TILE_CACHE
+static void TileRowAnd(unsigned char *pd, u64 pix, unsigned char pal)
+{
+  u64 d;
+
+  memcpy(&d, pd, 8);
+  d &= pix | pal * 0x0101010101010101ULL;
+  memcpy(pd, &d, 8);
+}
+
+// pack isn't needed, the compiler drops its VRAM read
+#define TileRowDecAnd(pd,pack,tad,flip,pal) \
+  ((void)(pack), TileRowAnd(pd, (flip) ? TileDecF[(tad)>>1] : TileDecN[(tad)>>1], pal))
+#else
+#define TileRowDecAnd(pd,pack,tad,flip,pal) { \
+  if (flip) TileFlip_and(pd, pack, pal); \
+  else      TileNorm_and(pd, pack, pal); \
+}
+#endif
+
 // Forced tile drawing, without any masking and blank handling
 #define DrawTileForced(mask,yshift,ymask,hpcode,cache) {		\
     if (code!=oldcode) {						\
@@ -1068,9 +1175,9 @@ static void DrawSpritesHiAS(unsigned char *sprited, int sh)
       pal |= 0xc0; /* leave s/h bits untouched in pixel "and" */	\
 									\
       pack = CPU_LE2(*(u32 *)(PicoMem.vram + addr));			\
+      tad = addr;							\
     }									\
-    if (code & 0x0800) TileFlip_and(pd + dx, pack, pal);		\
-    else               TileNorm_and(pd + dx, pack, pal);		\
+    TileRowDecAnd(pd + dx, pack, tad, code & 0x0800, pal);		\
 }
 
 static DrawStripMaker(DrawStripForced, 4, 0x7, 0, DrawTileForced, 0);
@@ -1188,8 +1295,19 @@ static NOINLINE void ParseSprites(int max_lines, int limit)
   // SAT scanning is one line ahead, but don't overshoot. Technically, SAT
   // parsing for line 0 is on the last line of the previous frame.
   int first_line = est->DrawScanline + !!est->DrawScanline;
-  if (max_lines > rendlines-1)
+  // parse the whole rest of the frame, it won't change unless the SAT does.
+  // Limits only apply to the look-ahead line, don't parse beyond that then
+  if (!limit || max_lines > rendlines-1)
     max_lines = rendlines-1;
+  HighLnSprParsed = max_lines;
+  HighLnSprMode = pvid->reg[12] & 9;
+
+  // the current line may still be from an older parse, keep its sprite data
+  if (first_line && (HighLnSpr[first_line-1][0] & 0x7f) &&
+      (HighLnSpr[first_line-1][0] & 0x80) == HighPreSprBank) {
+    HighPreSprBank ^= 0x80;
+    pd = HighPreSpr + HighPreSprBank*2;
+  }
 
   // look-ahead SAT parsing for next line and sprite pixel fetching for current
   // line are limited if display was disabled during HBLANK before current line
@@ -1619,6 +1737,47 @@ static void (*FinalizeLine)(int sh, int line, struct PicoEState *est);
 
 // --------------------------------------------
 
+// advance the stamp for VRAM writes, see VdpVRAMStamp
+static void VdpStampNext(void)
+{
+  if (++VdpLineStamp == 0) {
+    // stamp wraparound, restart
+    memset(VdpVRAMStamp, 0, sizeof(VdpVRAMStamp));
+#ifdef LINE_CACHE
+    memset(LineCacheStamp, 0, sizeof(LineCacheStamp));
+#endif
+#ifdef TILE_CACHE
+    memset(TileDecStamp, 0, sizeof(TileDecStamp));
+#endif
+    VdpLineStamp = 1;
+  }
+}
+
+#ifdef TILE_CACHE
+// decode the VRAM pages written since they were decoded the last time
+static void TileDecUpdate(void)
+{
+  u32 stamp = VdpLineStamp + 1;
+  int p, r, i, upd = 0;
+
+  for (p = 0; p < 64; p++) {
+    if (VdpVRAMStamp[p] < TileDecStamp[p])
+      continue;
+    for (r = p << 8; r < (p + 1) << 8; r++) {
+      u32 pack = CPU_LE2(*(u32 *)(PicoMem.vram + r*2));
+      u8 *n = (u8 *)&TileDecN[r], *f = (u8 *)&TileDecF[r];
+      for (i = 0; i < 8; i++) // pixel order as in TileNorm
+        n[i] = f[7-i] = (pack >> (((i&3)^3)*4 + (i&4)*4)) & 0xf;
+    }
+    TileDecStamp[p] = stamp;
+    upd = 1;
+  }
+  // writes after this must get a newer stamp
+  if (upd)
+    VdpStampNext();
+}
+#endif
+
 static int DrawDisplay(int sh)
 {
   struct PicoEState *est=&Pico.est;
@@ -1627,6 +1786,9 @@ static int DrawDisplay(int sh)
   int win=0, edge=0, hvwind=0, lflags;
   int maxw, maxcells;
 
+#ifdef TILE_CACHE
+  TileDecUpdate();
+#endif
   est->rendstatus &= ~(PDRAW_SHHI_DONE|PDRAW_PLANE_HI_PRIO|PDRAW_WND_DIFF_PRIO);
   est->HighPreSpr = HighPreSpr + (sprited[0]&0x80)*2;
 
@@ -1735,12 +1897,145 @@ static int DrawDisplay(int sh)
   return 0;
 }
 
+#ifdef LINE_CACHE
+#define HASH(h,v) h = ((h) ^ (u32)(v)) * 0x100000001b3ULL // FNV-1a
+
+static u64 LineCacheHash(int sh, int bgc)
+{
+  struct PicoEState *est = &Pico.est;
+  struct PicoVideo *pvid = &est->Pico->video;
+  unsigned char *sprited = &HighLnSpr[est->DrawScanline][0];
+  u64 h = 0xcbf29ce484222325ULL;
+  int i, cnt, htab;
+
+  // registers used by DrawDisplay
+  HASH(h, pvid->reg[0] | (pvid->reg[1]<<8) | (pvid->reg[2]<<16) | (pvid->reg[3]<<24));
+  HASH(h, pvid->reg[4] | (bgc<<8) | (pvid->reg[11]<<16) | (pvid->reg[12]<<24));
+  HASH(h, pvid->reg[13] | (pvid->reg[16]<<8) | (pvid->reg[17]<<16) | (pvid->reg[18]<<24));
+  HASH(h, sh | (pvid->debug_p<<8) | (!!(*est->PicoOpt & POPT_ACC_SPRITES)<<16));
+
+  // scroll values
+  htab = pvid->reg[13]<<9;
+  switch (pvid->reg[11]&3) {
+    case 1: htab += (est->DrawScanline<<1) &  0x0f; break;
+    case 2: htab += (est->DrawScanline<<1) & ~0x0f; break;
+    case 3: htab += (est->DrawScanline<<1);         break;
+  }
+  HASH(h, PicoMem.vram[htab & 0x7fff] | (PicoMem.vram[(htab+1) & 0x7fff]<<16));
+  for (i = 0; i < (pvid->reg[11]&4 ? 0x28 : 2); i += 2)
+    HASH(h, PicoMem.vsram[i] | (PicoMem.vsram[i+1]<<16));
+
+  // sprites on the line. Tile patterns are added to the VRAM dependencies
+  cnt = sprited[0] & 0x7f;
+  HASH(h, cnt | (sprited[1]<<8) | (sprited[4+cnt]<<16));
+  for (i = 0; i < cnt; i++) {
+    s32 *sp = HighPreSpr + (sprited[0]&0x80)*2 + (sprited[4+i]&0x7f)*2;
+    int tile = sp[1] & 0x7ff, tiles = (sp[0]>>28) * ((sp[0]>>24)&7);
+    HASH(h, sprited[4+i]);
+    HASH(h, sp[0]);
+    HASH(h, sp[1]);
+    LINE_DEP(tile << 4);
+    LINE_DEP(((tile + tiles-1) & 0x7ff) << 4);
+  }
+  return h;
+}
+
+// restore a line from the cache if nothing it depends on has been changed
+static int LineCacheFetch(int line, int sh, int bgc)
+{
+  struct PicoEState *est = &Pico.est;
+  u32 stamp = LineCacheStamp[line];
+  u64 m;
+  int p;
+
+  line_deps = 0;
+  line_key = LineCacheHash(sh, bgc);
+  if (stamp == 0 || LineCacheKey[line] != line_key)
+    return 0;
+  for (m = LineCacheDeps[line], p = 0; m; m >>= 1, p++)
+    if ((m & 1) && VdpVRAMStamp[p] >= stamp)
+      return 0;
+
+  memcpy(est->HighCol+8, LineCache[line], 320);
+  if (est->Pico->m.dirtyPal)
+    rendchanged |= PCHG_PAL;
+  PicoDrawLinesCached++;
+  return 1;
+}
+
+// a line has been drawn, check if it differs from what is in the output buffer.
+// The line can't be restored from the cache since its dependencies are unknown
+void PicoDrawLineDone(int line)
+{
+  unsigned char *p = Pico.est.HighCol+8;
+
+  if (Pico.m.dirtyPal)
+    rendchanged |= PCHG_PAL;
+  if (!LineCacheOut[line] || memcmp(LineCache[line], p, 320)) {
+    memcpy(LineCache[line], p, 320);
+    LineCacheOut[line] = 1;
+    rendchanged |= PCHG_IMAGE;
+  }
+  LineCacheStamp[line] = 0;
+}
+
+static void LineCacheStore(int line)
+{
+  VdpStampNext();
+  PicoDrawLineDone(line);
+  LineCacheKey[line] = line_key;
+  LineCacheDeps[line] = line_deps;
+  LineCacheStamp[line] = VdpLineStamp;
+  PicoDrawLinesDrawn++;
+}
+
+// output buffer contents are unknown, e.g. after a mode change
+void PicoDrawInvalidate(void)
+{
+  memset(LineCacheStamp, 0, sizeof(LineCacheStamp));
+  memset(LineCacheOut, 0, sizeof(LineCacheOut));
+  rendchanged |= PCHG_IMAGE;
+}
+#else
+#define LineCacheFetch(line, sh, bgc) 0
+#define LineCacheStore(line) PicoDrawLineDone(line), PicoDrawLinesDrawn++
+
+void PicoDrawLineDone(int line)
+{
+  rendchanged |= PCHG_IMAGE | (Pico.m.dirtyPal ? PCHG_PAL : 0);
+}
+
+void PicoDrawInvalidate(void)
+{
+  rendchanged |= PCHG_IMAGE;
+}
+#endif
+
+// called at the end of each frame, find out if the output image has changed
+PICO_INTERNAL void PicoDrawFrameDone(void)
+{
+  // palette conversion may be done by the frontend, 32X layers aren't tracked
+  if (Pico.m.dirtyPal || (Pico.est.rendstatus & PDRAW_SONIC_MODE))
+    rendchanged |= PCHG_PAL;
+  if (PicoIn.AHW & PAHW_32X)
+    rendchanged |= PCHG_IMAGE;
+
+  if (PicoIn.skipFrame) {
+    // nothing output, keep collecting until the next rendered frame
+    PicoIn.frameChanged = 1;
+    return;
+  }
+  // mid-frame palette changes also affect the lines above in the next frame
+  PicoIn.frameChanged = (rendchanged != 0);
+  rendchanged = (rendchanged & PCHG_PAL ? PCHG_PAL_LAST : 0);
+}
+
 // MUST be called every frame
 PICO_INTERNAL void PicoFrameStart(void)
 {
   struct PicoEState *est = &Pico.est;
   int loffs = 8, lines = 224, coffs = 0, columns = 320;
-  int sprep = est->rendstatus & PDRAW_DIRTY_SPRITES;
+  int sprep = (est->rendstatus & PDRAW_DIRTY_SPRITES) | HighLnSprDirty;
   int skipped = est->rendstatus & PDRAW_SKIP_FRAME;
   int sync = est->rendstatus & (PDRAW_SYNC_NEEDED | PDRAW_SYNC_NEXT);
 
@@ -1779,6 +2074,7 @@ PICO_INTERNAL void PicoFrameStart(void)
     int rendstatus = est->rendstatus;
     emu_video_mode_change(loffs, lines, coffs, columns);
     rendstatus_old = rendstatus;
+    PicoDrawInvalidate();
     // mode_change() might clear buffers, redraw needed
     est->rendstatus |= PDRAW_SYNC_NEEDED;
   }
@@ -1794,6 +2090,8 @@ PICO_INTERNAL void PicoFrameStart(void)
   est->DrawLineDest = (char *)DrawLineDestBase + loffs * DrawLineDestIncrement;
   est->DrawScanline = 0;
   skip_next_line = 0;
+  HighLnSprParsed = -1;
+  HighLnSprDirty = 0;
 
   if (FinalizeLine == FinalizeLine8bit) {
     // make a backup of the current palette in case Sonic mode is detected later
@@ -1817,6 +2115,7 @@ static void DrawBlankedLine(int line, int offs, int sh, int bgc)
   }
 
   BackFill(bgc, sh, est);
+  PicoDrawLineDone(line);
 
   if (FinalizeLine != NULL)
     FinalizeLine(sh, line, est);
@@ -1832,6 +2131,8 @@ static void PicoLine(int line, int offs, int sh, int bgc, int off, int on)
 {
   struct PicoEState *est = &Pico.est;
   int skip = skip_next_line;
+  int cache = !(off|on) && (est->Pico->video.reg[1]&0x40) &&
+              !(est->rendstatus & PDRAW_INTERLACE);
 
   est->DrawScanline = line;
   if (PicoScanBegin != NULL && skip == 0)
@@ -1842,14 +2143,22 @@ static void PicoLine(int line, int offs, int sh, int bgc, int off, int on)
     return;
   }
 
-  if (est->Pico->video.debug_p & (PVD_FORCE_A | PVD_FORCE_B | PVD_FORCE_S))
+  if (est->Pico->video.debug_p & (PVD_FORCE_A | PVD_FORCE_B | PVD_FORCE_S)) {
     bgc = 0x3f;
+    cache = 0;
+  }
 
   // Draw screen:
-  BackFill(bgc, sh, est);
-  if (est->Pico->video.reg[1]&0x40) {
+  if (!(est->Pico->video.reg[1]&0x40))
+    BackFill(bgc, sh, est);
+  else {
     int width = (est->Pico->video.reg[12]&1) ? 320 : 256;
-    DrawDisplay(sh);
+    if (!cache || !LineCacheFetch(line, sh, bgc)) {
+      BackFill(bgc, sh, est);
+      DrawDisplay(sh);
+      if (cache)
+        LineCacheStore(line);
+    }
     // partial line blanking (display on or off inside the line)
     if (unlikely(off|on)) {
       if (off > 0)
@@ -1858,6 +2167,8 @@ static void PicoLine(int line, int offs, int sh, int bgc, int off, int on)
         memset(est->HighCol+8, bgc, on);
     }
   }
+  if (!cache)
+    PicoDrawLineDone(line);
 
   if (FinalizeLine != NULL)
     FinalizeLine(sh, line, est);
@@ -1883,9 +2194,18 @@ void PicoDrawSync(int to, int off, int on)
     to = rendlines-1;
 
   if (est->DrawScanline <= to &&
-                (est->rendstatus & (PDRAW_DIRTY_SPRITES|PDRAW_PARSE_SPRITES)))
-    ParseSprites(to + 1, on);
-  else if (!(est->rendstatus & PDRAW_SYNC_NEEDED)) {
+                (est->rendstatus & (PDRAW_DIRTY_SPRITES|PDRAW_PARSE_SPRITES))) {
+    // only parse again if the SAT or sprite mode was modified or if lines
+    // aren't parsed yet
+    if ((est->rendstatus & PDRAW_DIRTY_SPRITES) || to+1 > HighLnSprParsed ||
+        (est->Pico->video.reg[12] & 9) != HighLnSprMode || on) {
+      ParseSprites(to + 1, on);
+      if (est->rendstatus & PDRAW_DIRTY_SPRITES)
+        HighLnSprDirty = 1;
+      est->rendstatus &= ~PDRAW_DIRTY_SPRITES;
+      est->rendstatus |= PDRAW_PARSE_SPRITES;
+    }
+  } else if (!(est->rendstatus & PDRAW_SYNC_NEEDED)) {
     // nothing has changed in VDP/VRAM and buffer is the same -> no sync needed
     int count = to+1 - est->DrawScanline;
     est->HighCol += count*HighColIncrement;
@@ -2036,8 +2356,10 @@ void PicoDrawSetOutBufMD(void *dest, int increment)
     PicoDrawSetInternalBuf(dest, increment); // needed for SMS
     PicoDraw2SetOutBuf(dest, increment);
   } else if (dest != NULL) {
-    if (dest != DrawLineDestBase)
+    if (dest != DrawLineDestBase) {
       Pico.est.rendstatus |= PDRAW_SYNC_NEEDED;
+      PicoDrawInvalidate();
+    }
     DrawLineDestBase = dest;
     DrawLineDestIncrement = increment;
     Pico.est.DrawLineDest = (char *)DrawLineDestBase + Pico.est.DrawScanline * increment;
@@ -2060,8 +2382,10 @@ void PicoDrawSetOutBuf(void *dest, int increment)
 void PicoDrawSetInternalBuf(void *dest, int increment)
 {
   if (dest != NULL) {
-    if (dest != HighColBase)
+    if (dest != HighColBase) {
       Pico.est.rendstatus |= PDRAW_SYNC_NEEDED;
+      PicoDrawInvalidate();
+    }
     HighColBase = dest;
     HighColIncrement = increment;
     Pico.est.HighCol = HighColBase + Pico.est.DrawScanline * increment;
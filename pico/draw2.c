@@ -731,6 +731,9 @@ PICO_INTERNAL void PicoFrameFull(void)
 			memset32((int *)pd, 0xe0e0e0e0, 328/4);
 	}
 
+	// no change tracking here, assume the whole image has changed
+	PicoDrawInvalidate();
+
 	pprof_end(draw);
 }
 
@@ -793,6 +793,7 @@ void NOINLINE ctl_write_z80reset(u32 d)
         pprof_end_sub(m68k);
       }
       Pico.t.z80_busdelay &= 0xff; // also resets bus request
+      PsndSync();
       YM2612ResetChip();
       timers_reset();
     }
@@ -807,14 +808,12 @@ void NOINLINE ctl_write_z80reset(u32 d)
 
 static void psg_write_68k(u32 d)
 {
-  PsndDoPSG(z80_cycles_from_68k());
-  SN76496Write(d);
+  PsndWritePSG(z80_cycles_from_68k(), d);
 }
 
 static void psg_write_z80(u32 d)
 {
-  PsndDoPSG(z80_cyclesDone());
-  SN76496Write(d);
+  PsndWritePSG(z80_cyclesDone(), d);
 }
 
 // -----------------------------------------------------------------
@@ -1100,6 +1099,7 @@ void PicoWrite16_io(u32 a, u32 d)
 u32 PicoRead8_vdp(u32 a)
 {
   u32 d;
+  PicoSyncLines(0);
   if ((a & 0x00f0) == 0x0000) {
     switch (a & 0x0d)
     {
@@ -1122,6 +1122,7 @@ u32 PicoRead8_vdp(u32 a)
 
 static u32 PicoRead16_vdp(u32 a)
 {
+  PicoSyncLines(0);
   if ((a & 0x00e0) == 0x0000)
     return PicoVideoRead(a);
 
@@ -1137,6 +1138,7 @@ static void PicoWrite8_vdp(u32 a, u32 d)
   }
   if ((a & 0x00e0) == 0x0000) {
     d &= 0xff;
+    PicoSyncLines(1);
     PicoVideoWrite(a, d | (d << 8));
     return;
   }
@@ -1151,6 +1153,7 @@ static void PicoWrite16_vdp(u32 a, u32 d)
     return;
   }
   if ((a & 0x00e0) == 0x0000) {
+    PicoSyncLines(1);
     PicoVideoWrite(a, d);
     return;
   }
@@ -1267,6 +1270,10 @@ PICO_INTERNAL void PicoMemSetup(void)
   PicoCpuFM68k.write_byte = (void *)m68k_write8;
   PicoCpuFM68k.write_word = (void *)m68k_write16;
   PicoCpuFM68k.write_long = (void *)m68k_write32;
+  PicoCpuFM68k.read8_map   = m68k_read8_map;
+  PicoCpuFM68k.read16_map  = m68k_read16_map;
+  PicoCpuFM68k.write8_map  = m68k_write8_map;
+  PicoCpuFM68k.write16_map = m68k_write16_map;
 #endif
 #ifdef EMU_M68K
   m68k_mem_setup();
@@ -1459,9 +1466,6 @@ static int ym2612_write_local(u32 a, u32 d, int is_from_z80)
           elprintf(EL_YMTIMER, "st mode %02x", d);
           ym2612_sync_timers(cycles, old_mode, d);
 
-          if ((d ^ old_mode) & 0xc0)
-            break;
-
           /* reset Timer a flag */
           if (d & 0x10)
             ym2612.OPN.ST.status &= ~1;
@@ -1471,22 +1475,20 @@ static int ym2612_write_local(u32 a, u32 d, int is_from_z80)
             ym2612.OPN.ST.status &= ~2;
 
           ym2612.OPN.ST.mode = d;
+
+          // CSM/3 slot mode change also affects the synth
+          if ((d ^ old_mode) & 0xc0)
+            break;
           return 0;
         }
-        case 0x2a: { /* DAC data */
+        case 0x2a: /* DAC data */
           //elprintf(EL_STATUS, "%03i dac w %08x z80 %i", cycles, d, is_from_z80);
-          if (ym2612.dacen)
-            PsndDoDAC(cycles);
-          ym2612.dacout = ((int)d - 0x80) << DAC_SHIFT;
-          return 0;
-        }
-        case 0x2b: { /* DAC Sel  (YM2612) */
-          ym2612.dacen = d & 0x80;
+          return PsndWriteFM(cycles, addr, d);
+        case 0x2b: /* DAC Sel  (YM2612) */
 #ifdef __GP2X__
           if (PicoIn.opt & POPT_EXT_FM) YM2612Write_940(a, d, get_scanline(is_from_z80));
 #endif
-          return 0;
-        }
+          return PsndWriteFM(cycles, addr, d);
       }
       break;
   }
@@ -1495,8 +1497,7 @@ static int ym2612_write_local(u32 a, u32 d, int is_from_z80)
   if (PicoIn.opt & POPT_EXT_FM)
     return YM2612Write_940(a, d, get_scanline(is_from_z80));
 #endif
-  PsndDoFM(cycles);
-  return YM2612Write_(a, d);
+  return PsndWriteFM(cycles, addr, d);
 }
 
 
@@ -28,6 +28,25 @@ unsigned int sprites_status;
 int sprites_zoom; // latched sprite zoom flag
 int xscroll; // horizontal scroll
 
+// frame renderer: lines are drawn at the end of the frame or before the VDP
+// state they depend on is changed. Latched values and sprites are kept here.
+struct line_state {
+  u32 gen;        // VDP state generation when drawn, 0 if not drawn yet
+  u8 xscroll, zoom, sprites;
+  u8 c[32];
+  s16 x[32];
+  u16 addr[32];
+};
+static struct line_state lines_st[240];
+static int lines_first = -1, lines_last; // range of deferred lines
+static u32 vdp_gen = 1;
+static int frame_mode;
+
+// decoded tile rows for the frame renderer, 8 pixels per u64 in memory order,
+// also horizontally flipped. An entry is valid if the VRAM data is unchanged.
+static u64 tiles_dec_n[0x4000/4], tiles_dec_f[0x4000/4];
+static u32 tiles_raw[0x4000/4];
+
 /* sprite collision detection */
 static int CollisionDetect(u8 *mb, u16 sx, unsigned int pack, int zoomed)
 {
@@ -264,6 +283,23 @@ static void DrawStripM4(const u16 *nametab, int cells_dx, int tilex_ty)
   }
 }
 
+static void DrawForegroundM4(void)
+{
+  struct PicoVideo *pv = &Pico.video;
+  int dx, c;
+
+  // sprites
+  if (!(pv->debug_p & PVD_KILL_S_LO))
+    DrawSpritesM4();
+
+  if ((pv->reg[0] & 0x20) && !(Pico.m.hardware & PMS_HW_LCD)) {
+    // first column masked with background, caculate offset to start of line
+    dx = line_offset / 4;
+    c = ((pv->reg[7]&0x0f)|0x10) * 0x01010101;
+    ((u32 *)Pico.est.HighCol)[dx] = ((u32 *)Pico.est.HighCol)[dx+1] = c;
+  }
+}
+
 static void DrawDisplayM4(int scanline)
 {
   struct PicoVideo *pv = &Pico.video;
@@ -316,15 +352,57 @@ static void DrawDisplayM4(int scanline)
       DrawStripM4(nametab ,  dx    | ( cells    << 16), tilex    | (ty  << 16));
   }
 
-  // sprites
-  if (!(pv->debug_p & PVD_KILL_S_LO))
-    DrawSpritesM4();
+  DrawForegroundM4();
+}
 
-  if ((pv->reg[0] & 0x20) && !(Pico.m.hardware & PMS_HW_LCD)) {
-    // first column masked with background, caculate offset to start of line
-    dx = line_offset / 4;
-    ty = ((pv->reg[7]&0x0f)|0x10) * 0x01010101;
-    ((u32 *)Pico.est.HighCol)[dx] = ((u32 *)Pico.est.HighCol)[dx+1] = ty;
+static void TileDecodeM4(int row, u32 raw)
+{
+  u8 *n = (u8 *)&tiles_dec_n[row], *f = (u8 *)&tiles_dec_f[row];
+  unsigned int pack = CPU_LE2(raw);
+  u32 t;
+  int i;
+
+  for (i = 0; i < 8; i++) {
+    t = (pack>>(7-i)) & 0x01010101;
+    n[i] = f[7-i] = (t*0x10204080) >> 28;
+  }
+  tiles_raw[row] = raw;
+}
+
+// as DrawStripM4, but for several consecutive lines in the same tile row
+static void DrawStripRowsM4(const u16 *nametab, int cells_dx, int tilex_ty, int rows)
+{
+  u8 *pd = Pico.est.HighCol;
+  u64 *dec = tiles_dec_n, pal = 0;
+  int oldcode = -1;
+  int addr = 0, yflip = 0;
+  int ty = tilex_ty >> 16;
+
+  for (; cells_dx >= 0; cells_dx += 8, tilex_ty++, cells_dx -= 0x10000)
+  {
+    unsigned code;
+    int r, sx;
+
+    code = nametab[tilex_ty & 0x1f];
+
+    if (code != oldcode) {
+      oldcode = code;
+      addr = (code & 0x1ff) << 4;
+      yflip = (code & 0x0400 ? 0xe : 0);
+      dec = (code & 0x0200 ? tiles_dec_f : tiles_dec_n);
+      pal = ((code>>7) & 0x30) * 0x0101010101010101ULL;  // prio | palette
+    }
+
+    for (r = 0, sx = (u16)cells_dx; r < rows; r++, sx += HighColIncrement) {
+      int a = addr + ((ty + 2*r) ^ yflip);
+      u32 raw = *(u32 *)(PicoMem.vram + a);
+      u64 pix;
+
+      if (tiles_raw[a >> 1] != raw)
+        TileDecodeM4(a >> 1, raw);
+      pix = dec[a >> 1] | pal;
+      memcpy(pd + sx, &pix, 8);
+    }
   }
 }
 
@@ -721,16 +799,187 @@ static void DrawDisplayM0(int scanline)
 }
 
 
-/* Common/global */
-/*===============*/
-
 static void FinalizeLineRGB555SMS(int line);
 static void FinalizeLine8bitSMS(int line);
 
+// draw a line with the current VDP state
+static void DrawLineSMS(int line)
+{
+  unsigned bgcolor;
+
+  bgcolor = (Pico.video.reg[7] & 0x0f) | ((Pico.video.reg[0] & 0x04) << 2);
+  BackFill(bgcolor, 0, &Pico.est); // bgcolor is from 2nd palette in mode 4
+  if (Pico.video.reg[1] & 0x40) {
+    if      (Pico.video.reg[0] & 0x04) DrawDisplayM4(line); // also M4+M3
+    else if (Pico.video.reg[1] & 0x08) DrawDisplayM2(line); // also M2+M3
+    else if (Pico.video.reg[1] & 0x10) DrawDisplayM1(line); // also M1+M3
+    else if (Pico.video.reg[0] & 0x02) DrawDisplayM3(line);
+    else                               DrawDisplayM0(line);
+  }
+}
+
+/* Frame renderer */
+/*================*/
+
+// Used with the fast renderer. Drawing is deferred until the end of the frame
+// or until a VDP write is about to change something. Mode 4 lines in the same
+// tile row are then drawn together, and lines which haven't changed since the
+// last frame are left alone.
+
+static void DeferLineSMS(int line)
+{
+  struct line_state *ls = &lines_st[line];
+  int i, changed;
+
+  changed = ls->gen != vdp_gen || ls->xscroll != xscroll ||
+            ls->zoom != sprites_zoom || ls->sprites != sprites;
+  ls->xscroll = xscroll, ls->zoom = sprites_zoom, ls->sprites = sprites;
+  for (i = 0; i < sprites; i++) {
+    changed |= ls->x[i] != sprites_x[i] || ls->addr[i] != sprites_addr[i] ||
+               ls->c[i] != sprites_c[i];
+    ls->x[i] = sprites_x[i], ls->addr[i] = sprites_addr[i], ls->c[i] = sprites_c[i];
+  }
+
+  if (changed) {
+    ls->gen = 0;
+    if (lines_first < 0)
+      lines_first = line;
+    lines_last = line+1;
+  }
+}
+
+static void LoadLineSMS(int line)
+{
+  struct line_state *ls = &lines_st[line];
+  int i;
+
+  xscroll = ls->xscroll, sprites_zoom = ls->zoom, sprites = ls->sprites;
+  for (i = 0; i < sprites; i++)
+    sprites_x[i] = ls->x[i], sprites_addr[i] = ls->addr[i], sprites_c[i] = ls->c[i];
+}
+
+static int HScrollM4(int scanline, int dx)
+{
+  if (scanline < 16 && (Pico.video.reg[0] & 0x40))
+    dx = 0; // hscroll disabled for top 2 rows
+  return dx;
+}
+
+// draw all deferred lines in a tile row having the same hscroll in one go,
+// returns the number of lines drawn
+static int DrawBlockM4(int scanline)
+{
+  struct PicoVideo *pv = &Pico.video;
+  struct line_state *ls;
+  u8 *col = Pico.est.HighCol;
+  u16 *nametab;
+  int line, tilex, dx, ty, n, i;
+  int cells = 31;
+
+  // Find the line in the name table, see DrawDisplayM4
+  line = pv->reg[9] + scanline;
+  nametab = PicoMem.vram;
+  if ((pv->reg[0] & 6) == 6 && (pv->reg[1] & 0x18)) {
+    line &= 0xff;
+    nametab += ((pv->reg[2] & 0x0c) << (10-1)) + (0x700 >> 1);
+  } else {
+    while (line >= 224) line -= 224;
+    nametab += (pv->reg[2] & 0x0e) << (10-1);
+  }
+  nametab += (line>>3) << (6-1);
+
+  dx = HScrollM4(scanline, lines_st[scanline].xscroll);
+  for (n = 1; n < 8 - (line & 7) && scanline+n < lines_last; n++) {
+    ls = &lines_st[scanline+n];
+    if (ls->gen || HScrollM4(scanline+n, ls->xscroll) != dx)
+      break;
+  }
+
+  tilex = (32 - (dx >> 3)) & 0x1f;
+  ty = (line & 7) << 1;
+  dx = (dx & 7) + line_offset;
+
+  for (i = 0; i < n; i++, Pico.est.HighCol += HighColIncrement)
+    BackFill((pv->reg[7] & 0x0f) | 0x10, 0, &Pico.est);
+  Pico.est.HighCol = col;
+
+  if (!(pv->debug_p & PVD_KILL_B)) {
+    if (Pico.m.hardware & PMS_HW_LCD)
+      DrawStripRowsM4(nametab, (dx-8) | ((cells-11)<< 16), (tilex+5) | (ty << 16), n);
+    else
+      DrawStripRowsM4(nametab,  dx    | ( cells    << 16),  tilex    | (ty << 16), n);
+  }
+
+  for (i = 0; i < n; i++, Pico.est.HighCol += HighColIncrement) {
+    LoadLineSMS(scanline+i);
+    DrawForegroundM4();
+    lines_st[scanline+i].gen = vdp_gen;
+    PicoDrawLineDone(scanline+i);
+  }
+  return n;
+}
+
+static void DrawLinesSMS(void)
+{
+  struct PicoVideo *pv = &Pico.video;
+  u8 *col = Pico.est.HighCol;
+  int xs = xscroll, zoom = sprites_zoom, cnt = sprites;
+  int x[32], addr[32];
+  u8 c[32];
+  int y, n;
+
+  // the sprites of the next line may already be parsed, keep them
+  memcpy(x, sprites_x, sizeof(x));
+  memcpy(addr, sprites_addr, sizeof(addr));
+  memcpy(c, sprites_c, sizeof(c));
+
+  for (y = lines_first; y < lines_last; y += n) {
+    n = 1;
+    if (lines_st[y].gen)
+      continue; // unchanged since last drawn
+    Pico.est.HighCol = HighColBase + (screen_offset + y) * HighColIncrement;
+    if ((pv->reg[0] & 0x84) == 0x04 && (pv->reg[1] & 0x40))
+      n = DrawBlockM4(y);
+    else {
+      // other modes and vscroll lock are drawn line by line
+      LoadLineSMS(y);
+      DrawLineSMS(y);
+      lines_st[y].gen = vdp_gen;
+      PicoDrawLineDone(y);
+    }
+  }
+
+  Pico.est.HighCol = col;
+  xscroll = xs, sprites_zoom = zoom, sprites = cnt;
+  memcpy(sprites_x, x, sizeof(x));
+  memcpy(sprites_addr, addr, sizeof(addr));
+  memcpy(sprites_c, c, sizeof(c));
+  lines_first = -1;
+}
+
+// VDP state is about to change, draw the deferred lines with the old state
+void PicoDrawSyncSMS(void)
+{
+  if (lines_first >= 0)
+    DrawLinesSMS();
+  if (++vdp_gen == 0)
+    vdp_gen = 1;
+}
+
+void PicoFrameEndSMS(void)
+{
+  if (lines_first >= 0)
+    DrawLinesSMS();
+}
+
+/* Common/global */
+/*===============*/
+
 void PicoFrameStartSMS(void)
 {
   struct PicoEState *est = &Pico.est;
   int lines = 192, columns = 256, loffs, coffs;
+  int fmode;
 
   skip_next_line = 0;
   loffs = screen_offset = 24; // 192 lines is really 224 with top/bottom bars
@@ -799,8 +1048,18 @@ void PicoFrameStartSMS(void)
     rendstatus_old = rendstatus;
     rendlines = lines;
     sprites = 0;
+    PicoDrawInvalidate();
+    PicoDrawSyncSMS();
   }
 
+  // frame renderer only with the fast renderer, which draws to Draw2FB
+  fmode = (PicoIn.opt & POPT_ALT_RENDERER) && FinalizeLineSMS == NULL &&
+          PicoScanBegin == NULL && PicoScanEnd == NULL;
+  if (fmode != frame_mode)
+    PicoDrawSyncSMS(); // line states aren't maintained by the line renderer
+  frame_mode = fmode;
+  lines_first = -1;
+
   est->HighCol = HighColBase + screen_offset * HighColIncrement;
   est->DrawLineDest = (char *)DrawLineDestBase + screen_offset * DrawLineDestIncrement;
 
@@ -820,7 +1079,6 @@ void PicoParseSATSMS(int line)
 void PicoLineSMS(int line)
 {
   int skip = skip_next_line;
-  unsigned bgcolor;
   int first = 48 - screen_offset;
 
   // GG LCD, render only visible part of screen
@@ -836,22 +1094,20 @@ void PicoLineSMS(int line)
   }
 
   // Draw screen:
-  bgcolor = (Pico.video.reg[7] & 0x0f) | ((Pico.video.reg[0] & 0x04) << 2);
-  BackFill(bgcolor, 0, &Pico.est); // bgcolor is from 2nd palette in mode 4
-  if (Pico.video.reg[1] & 0x40) {
-    if      (Pico.video.reg[0] & 0x04) DrawDisplayM4(line); // also M4+M3
-    else if (Pico.video.reg[1] & 0x08) DrawDisplayM2(line); // also M2+M3
-    else if (Pico.video.reg[1] & 0x10) DrawDisplayM1(line); // also M1+M3
-    else if (Pico.video.reg[0] & 0x02) DrawDisplayM3(line);
-    else                               DrawDisplayM0(line);
-  }
+  if (frame_mode)
+    DeferLineSMS(line);
+  else
+    DrawLineSMS(line);
 
   // latch current register values (may be overwritten by VDP reg writes later)
   sprites_zoom = (Pico.video.reg[1] & 0x3) | (Pico.video.reg[0] & 0x8);
   xscroll = Pico.video.reg[8];
 
-  if (FinalizeLineSMS != NULL)
-    FinalizeLineSMS(line);
+  if (!frame_mode) {
+    PicoDrawLineDone(line);
+    if (FinalizeLineSMS != NULL)
+      FinalizeLineSMS(line);
+  }
 
   if (PicoScanEnd != NULL)
     skip_next_line = PicoScanEnd(line + screen_offset);
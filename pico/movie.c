@@ -0,0 +1,399 @@
+/*
+ * PicoDrive
+ * input movies: per frame input recording and playback
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ *
+ * .pmv layout, all values little endian:
+ *  0  "PMV\x1a"
+ *  4  u16 version, u16 header size
+ *  8  u32 PicoIn.opt
+ * 12  u16 regionOverride, u16 autoRgnOrder
+ * 16  u32 hwSelect
+ * 20  u32 mapper
+ * 24  u16 overclockM68k, u16 0
+ * 28  u8 input device for ports 0-2, u8 0
+ * 32  u32 sndRate
+ * 36  u32 crc32 of the loaded ROM
+ * 40  u32 frame count
+ * 44  u32 savestate size
+ * 48  savestate, then per frame: u16 pad[4], u16 kbd, s16 mouse[4]
+ *
+ * Gens .gmv movies (3 byte frames, starting from power on) can be played too.
+ */
+
+#include <string.h>
+#include <zlib.h>
+#include "pico_int.h"
+#include "state.h"
+
+#define PMV_VERSION	1
+#define PMV_HDR_SIZE	48
+#define PMV_FRAME_SIZE	18
+
+// options affecting the emulation itself, restored on playback
+#define PMV_OPT_MASK	(POPT_EN_Z80|POPT_EN_MCD_GFX|POPT_EN_MCD_RAMCART| \
+	POPT_DIS_VDP_FIFO|POPT_EN_DRC|POPT_DIS_SPRITE_LIM|POPT_DIS_IDLE_DET| \
+	POPT_EN_32X|POPT_EN_PWM|POPT_PWM_IRQ_OPT|POPT_EN_KBD|POPT_FAST_IDLE)
+
+enum { MOVIE_NONE, MOVIE_PLAY, MOVIE_RECORD };
+
+static struct {
+  int mode;
+  int started;		// header and state are processed on the 1st frame
+  int gmv;
+  void *file;		// recording
+  u8 *data;		// playback, whole file
+  size_t size, pos;	// playback data, or state save buffer
+  u32 frame, frames;
+  u32 opt, hw_select, mapper, snd_rate, crc;
+  u16 region, rgn_order, overclock;
+  u8 dev[3];
+} movie;
+
+static u32 get_u16(const u8 *p) { return p[0] | (p[1] << 8); }
+static u32 get_u32(const u8 *p) { return get_u16(p) | (get_u16(p + 2) << 16); }
+static void put_u16(u8 *p, u32 v) { p[0] = v; p[1] = v >> 8; }
+static void put_u32(u8 *p, u32 v) { put_u16(p, v); put_u16(p + 2, v >> 16); }
+
+static u32 movie_rom_crc(void)
+{
+  return Pico.rom ? crc32(0, Pico.rom, Pico.romsize) : 0;
+}
+
+// savestate access to the in memory movie data
+static size_t state_read(void *p, size_t size, size_t n, void *file)
+{
+  size_t len = size * n;
+
+  if (len > movie.size - movie.pos)
+    len = movie.size - movie.pos;
+  memcpy(p, movie.data + movie.pos, len);
+  movie.pos += len;
+  return len;
+}
+
+static size_t state_write(void *p, size_t size, size_t n, void *file)
+{
+  size_t len = size * n;
+  u8 *tmp;
+
+  if (movie.pos + len > movie.size) {
+    movie.size = (movie.pos + len) * 2;
+    tmp = realloc(movie.data, movie.size);
+    if (tmp == NULL)
+      return 0;
+    movie.data = tmp;
+  }
+  memcpy(movie.data + movie.pos, p, len);
+  movie.pos += len;
+  return len;
+}
+
+static size_t state_eof(void *file)
+{
+  return movie.pos >= movie.size;
+}
+
+static int state_seek(void *file, long offset, int whence)
+{
+  switch (whence) {
+  case SEEK_SET: movie.pos = offset; break;
+  case SEEK_CUR: movie.pos += offset; break;
+  case SEEK_END: movie.pos = movie.size + offset; break;
+  }
+  return 0;
+}
+
+// convert a GMV to an in memory movie without state
+static int gmv_convert(const u8 *gmv, size_t size)
+{
+  u32 i, frames = (size - 0x40) / 3;
+  u8 *p;
+
+  movie.data = calloc(frames, PMV_FRAME_SIZE);
+  if (movie.data == NULL)
+    return -1;
+
+  movie.gmv = 1;
+  movie.frames = frames;
+  movie.opt = PicoIn.opt | POPT_DIS_VDP_FIFO; // no VDP fifo timing
+  movie.dev[0] = movie.dev[1] = gmv[0x14] == '6' ?
+    PICO_INPUT_PAD_6BTN : PICO_INPUT_PAD_3BTN;
+  movie.dev[2] = PICO_INPUT_NOTHING;
+  movie.region = PicoIn.regionOverride;
+  if (gmv[0xf] >= 'A')
+    movie.region = gmv[0x16] & 0x80 ? 8 : 4; // TODO: bits 6 & 5
+
+  for (i = 0, p = movie.data; i < frames; i++, p += PMV_FRAME_SIZE) {
+    const u8 *f = gmv + 0x40 + i*3;
+    u32 pad0, pad1;
+
+    // MXYZ SACB RLDU
+    pad0 = ~f[0] & 0x8f; // ! SCBA RLDU
+    if (!(f[0] & 0x10)) pad0 |= 0x40; // C
+    if (!(f[0] & 0x20)) pad0 |= 0x10; // A
+    if (!(f[0] & 0x40)) pad0 |= 0x20; // B
+    pad1 = ~f[1] & 0x8f;
+    if (!(f[1] & 0x10)) pad1 |= 0x40;
+    if (!(f[1] & 0x20)) pad1 |= 0x10;
+    if (!(f[1] & 0x40)) pad1 |= 0x20;
+    pad0 |= (~f[2] & 0x0a) << 8; // ! MZYX
+    if (!(f[2] & 0x01)) pad0 |= 0x0400; // X
+    if (!(f[2] & 0x04)) pad0 |= 0x0100; // Z
+    pad1 |= (~f[2] & 0xa0) << 4;
+    if (!(f[2] & 0x10)) pad1 |= 0x0400;
+    if (!(f[2] & 0x40)) pad1 |= 0x0100;
+    put_u16(p + 0, pad0);
+    put_u16(p + 2, pad1);
+  }
+  movie.size = frames * PMV_FRAME_SIZE;
+  movie.pos = 0;
+
+  elprintf(EL_STATUS, "gmv: %.30s", (const char *)gmv + 0x18);
+  return 0;
+}
+
+// open a movie for playback and set the options it was recorded with.
+// The media has to be loaded after this, the movie starts with the 1st frame
+int PicoMoviePlay(const char *fname)
+{
+  u8 *data = NULL;
+  size_t size;
+  FILE *f;
+
+  PicoMovieStop();
+
+  f = fopen(fname, "rb");
+  if (f == NULL) {
+    elprintf(EL_STATUS, "movie: can't open %s", fname);
+    return -1;
+  }
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  if (size >= PMV_HDR_SIZE)
+    data = malloc(size);
+  if (data == NULL || fread(data, 1, size, f) != size)
+    goto fail;
+  fclose(f);
+  f = NULL;
+
+  if (size >= 0x40 + 3 && memcmp(data, "Gens Movie TEST", 15) == 0) {
+    if (gmv_convert(data, size) != 0)
+      goto fail;
+    free(data);
+  }
+  else {
+    if (memcmp(data, "PMV\x1a", 4) != 0 || get_u16(data + 4) > PMV_VERSION
+        || get_u16(data + 6) < PMV_HDR_SIZE)
+      goto fail;
+    movie.opt = get_u32(data + 8);
+    movie.region = get_u16(data + 12);
+    movie.rgn_order = get_u16(data + 14);
+    movie.hw_select = get_u32(data + 16);
+    movie.mapper = get_u32(data + 20);
+    movie.overclock = get_u16(data + 24);
+    memcpy(movie.dev, data + 28, 3);
+    movie.snd_rate = get_u32(data + 32);
+    movie.frames = get_u32(data + 40);
+    movie.pos = get_u16(data + 6);
+    movie.size = movie.pos + get_u32(data + 44);
+    if (movie.size > size || (size - movie.size) / PMV_FRAME_SIZE < movie.frames)
+      goto fail;
+    movie.data = data;
+    movie.crc = get_u32(data + 36);
+  }
+
+  PicoIn.opt = (PicoIn.opt & ~PMV_OPT_MASK) | (movie.opt & PMV_OPT_MASK);
+  PicoIn.regionOverride = movie.region;
+  if (!movie.gmv) {
+    PicoIn.autoRgnOrder = movie.rgn_order;
+    PicoIn.hwSelect = movie.hw_select;
+    PicoIn.mapper = movie.mapper;
+    PicoIn.sndRate = movie.snd_rate;
+  }
+
+  movie.mode = MOVIE_PLAY;
+  movie.started = 0;
+  movie.frame = 0;
+  elprintf(EL_STATUS, "movie: %u frames", movie.frames);
+  return 0;
+
+fail:
+  elprintf(EL_STATUS, "movie: bad file %s", fname);
+  if (f != NULL)
+    fclose(f);
+  free(data);
+  memset(&movie, 0, sizeof(movie));
+  return -1;
+}
+
+// record from the next frame on, starting with the machine state at that time
+int PicoMovieRecord(const char *fname)
+{
+  PicoMovieStop();
+
+  movie.file = fopen(fname, "wb");
+  if (movie.file == NULL) {
+    elprintf(EL_STATUS, "movie: can't create %s", fname);
+    return -1;
+  }
+  movie.mode = MOVIE_RECORD;
+  movie.started = 0;
+  movie.frame = 0;
+  return 0;
+}
+
+static int movie_start(void)
+{
+  u8 hdr[PMV_HDR_SIZE];
+  int i, ret;
+
+  if (movie.mode == MOVIE_RECORD) {
+    memset(hdr, 0, sizeof(hdr));
+    memcpy(hdr, "PMV\x1a", 4);
+    put_u16(hdr + 4, PMV_VERSION);
+    put_u16(hdr + 6, PMV_HDR_SIZE);
+    movie.opt = PicoIn.opt;
+    put_u32(hdr + 8, movie.opt);
+    put_u16(hdr + 12, PicoIn.regionOverride);
+    put_u16(hdr + 14, PicoIn.autoRgnOrder);
+    put_u32(hdr + 16, PicoIn.hwSelect);
+    put_u32(hdr + 20, PicoIn.mapper);
+    put_u16(hdr + 24, PicoIn.overclockM68k);
+    for (i = 0; i < 3; i++)
+      hdr[28 + i] = port_type[i];
+    put_u32(hdr + 32, PicoIn.sndRate);
+    put_u32(hdr + 36, movie_rom_crc());
+    if (fwrite(hdr, 1, sizeof(hdr), movie.file) != sizeof(hdr))
+      return -1;
+
+    // the state size is fixed in the header when done
+    movie.pos = 0;
+    ret = PicoStateFP(NULL, 1, NULL, state_write, NULL, NULL);
+    movie.size = movie.pos;
+    if (ret != 0 || fwrite(movie.data, 1, movie.size, movie.file) != movie.size)
+      return -1;
+
+    // a loaded state isn't exactly like a continued run in all details,
+    // so continue from the saved state like playback will do
+    movie.pos = 0;
+    ret = PicoStateFP(NULL, 0, state_read, NULL, state_eof, state_seek);
+    free(movie.data);
+    movie.data = NULL;
+    return ret;
+  }
+
+  if (!movie.gmv && movie.crc != movie_rom_crc())
+    elprintf(EL_STATUS, "movie: ROM crc mismatch, may desync");
+
+  PicoIn.opt = (PicoIn.opt & ~PMV_OPT_MASK) | (movie.opt & PMV_OPT_MASK);
+  for (i = 0; i < 3; i++)
+    PicoSetInputDevice(i, movie.dev[i]);
+
+  if (movie.gmv) {
+    // the region is taken from the movie, detect again
+    if (PicoIn.regionOverride != movie.region) {
+      PicoIn.regionOverride = movie.region;
+      PicoReset();
+    }
+    return 0;
+  }
+
+  PicoIn.overclockM68k = movie.overclock;
+  ret = PicoStateFP(NULL, 0, state_read, NULL, state_eof, state_seek);
+  movie.pos = movie.size;
+  return ret;
+}
+
+// stop, fixing the header of a recording
+void PicoMovieStop(void)
+{
+  u8 buf[8];
+
+  if (movie.mode == MOVIE_RECORD && movie.started) {
+    put_u32(buf + 0, movie.frames);
+    put_u32(buf + 4, movie.size);
+    fseek(movie.file, 40, SEEK_SET);
+    fwrite(buf, 1, sizeof(buf), movie.file);
+  }
+  if (movie.file != NULL)
+    fclose(movie.file);
+  free(movie.data);
+  memset(&movie, 0, sizeof(movie));
+}
+
+// the media is going away, end a movie in progress
+void PicoMovieUnload(void)
+{
+  if (movie.started)
+    PicoMovieStop();
+}
+
+// call once per frame before PicoFrame(), after the frontend input update.
+// Playback overwrites, recording stores the input in PicoIn.
+// returns 1 if a movie is active, 0 if not, -1 if it just ended
+int PicoMovieFrame(void)
+{
+  u8 buf[PMV_FRAME_SIZE], *p;
+  int i;
+
+  if (movie.mode == MOVIE_NONE)
+    return 0;
+
+  if (!movie.started) {
+    if (movie_start() != 0) {
+      elprintf(EL_STATUS, "movie: can't start");
+      PicoMovieStop();
+      return -1;
+    }
+    movie.started = 1;
+  }
+
+  // the frontend may have changed options (e.g. fast forward), keep the
+  // ones affecting emulation as they were when recording
+  PicoIn.opt = (PicoIn.opt & ~PMV_OPT_MASK) | (movie.opt & PMV_OPT_MASK);
+
+  if (movie.mode == MOVIE_RECORD) {
+    for (i = 0; i < 4; i++)
+      put_u16(buf + i*2, PicoIn.pad[i]);
+    put_u16(buf + 8, PicoIn.kbd);
+    for (i = 0; i < 4; i++)
+      put_u16(buf + 10 + i*2, PicoIn.mouse[i]);
+    if (fwrite(buf, 1, sizeof(buf), movie.file) != sizeof(buf)) {
+      elprintf(EL_STATUS, "movie: write error");
+      PicoMovieStop();
+      return -1;
+    }
+    movie.frames = ++movie.frame;
+    return 1;
+  }
+
+  if (movie.frame >= movie.frames) {
+    PicoMovieStop();
+    return -1;
+  }
+  p = movie.data + movie.pos + movie.frame++ * PMV_FRAME_SIZE;
+  for (i = 0; i < 4; i++)
+    PicoIn.pad[i] = get_u16(p + i*2);
+  if (!movie.gmv) {
+    PicoIn.kbd = get_u16(p + 8);
+    for (i = 0; i < 4; i++)
+      PicoIn.mouse[i] = (s16)get_u16(p + 10 + i*2);
+  }
+  return 1;
+}
+
+// current frame and frame count of the active movie
+int PicoMovieStatus(unsigned int *frame, unsigned int *frames)
+{
+  if (frame)
+    *frame = movie.frame;
+  if (frames)
+    *frames = movie.frames;
+  return movie.mode;
+}
+
+// vim:shiftwidth=2:ts=2:expandtab
@@ -35,6 +35,14 @@ struct patch
 struct patch_inst *PicoPatches = NULL;
 int PicoPatchCount = 0;
 
+/* RAM patches are frozen by intercepting the writes to RAM in the memory map
+ * instead of rewriting them every frame. */
+static u8 patch_frz[0x10000 >> 3]; // frozen RAM bytes
+static int patch_frz_cnt;
+static uptr patch_z80_saved[0x10000 >> Z80_MEM_SHIFT];
+
+#define patch_frozen(a) (patch_frz[(a) >> 3] & (1 << ((a) & 7)))
+
 static char genie_chars_md[] = "AaBbCcDdEeFfGgHhJjKkLlMmNnPpRrSsTtVvWwXxYyZz0O1I2233445566778899";
 
 /* genie_decode
@@ -355,8 +363,119 @@ void decode(const char* code, struct patch* result)
   return;
 }
 
+static void patch_write8_ram(u32 a, u32 d)
+{
+   a &= 0xffff;
+   if (!patch_frozen(a))
+      PicoMem.ram[MEM_BE2(a)] = d;
+}
+
+static void patch_write16_ram(u32 a, u32 d)
+{
+   a &= 0xfffe;
+   if (!patch_frozen(a))
+      ((u16 *)PicoMem.ram)[a >> 1] = d;
+}
+
+static void patch_write_zram(unsigned int a, unsigned char d)
+{
+   uptr v = patch_z80_saved[(a & 0xffff) >> Z80_MEM_SHIFT];
+   u8 o = PicoMem.zram[a & 0x1fff];
+
+   if (!map_flag_set(v)) {
+      if (!patch_frozen(a & 0x1fff))
+         *(u8 *)((v << 1) + a) = d;
+      return;
+   }
+   // handlers may also do mapper writes, so let them see it
+   ((z80_write_f *)map_to_function(v))(a, d);
+   if (patch_frozen(a & 0x1fff))
+      PicoMem.zram[a & 0x1fff] = o;
+}
+
+static int patch_hooked(uptr v, const void *f)
+{
+   return map_flag_set(v) && map_to_function(v) == (uptr)f;
+}
+
+static void patch_hook_ram(int on)
+{
+   u32 a;
+
+   if (!(PicoIn.AHW & PAHW_SMS)) {
+      // 68k RAM and its mirrors
+      if (on == patch_hooked(m68k_write8_map[0xff], patch_write8_ram))
+         return;
+      for (a = 0xe00000; a < 0x1000000; a += 0x010000) {
+         if (on) {
+            cpu68k_map_set(m68k_write8_map,  a, a + 0xffff, patch_write8_ram, 1);
+            cpu68k_map_set(m68k_write16_map, a, a + 0xffff, patch_write16_ram, 1);
+         } else {
+            cpu68k_map_set(m68k_write8_map,  a, a + 0xffff, PicoMem.ram, 0);
+            cpu68k_map_set(m68k_write16_map, a, a + 0xffff, PicoMem.ram, 0);
+         }
+      }
+      return;
+   }
+
+   // Z80 RAM, only hook the pages with frozen bytes
+   for (a = 0xc000; a < 0x10000; a += 1 << Z80_MEM_SHIFT) {
+      uptr *m = &z80_write_map[a >> Z80_MEM_SHIFT];
+      int i, frz = 0;
+
+      for (i = 0; on && i < (1 << Z80_MEM_SHIFT) >> 3; i++)
+         frz |= patch_frz[((a & 0x1fff) >> 3) + i];
+      if (patch_hooked(*m, patch_write_zram)) {
+         if (!frz)
+            *m = patch_z80_saved[a >> Z80_MEM_SHIFT];
+      } else if (frz) {
+         patch_z80_saved[a >> Z80_MEM_SHIFT] = *m;
+         z80_map_set(z80_write_map, a, a + (1 << Z80_MEM_SHIFT) - 1, patch_write_zram, 1);
+      }
+   }
+}
+
+/* write the RAM patches and freeze them */
+static void patch_update_ram(void)
+{
+   int i;
+
+   memset(patch_frz, 0, sizeof(patch_frz));
+   patch_frz_cnt = 0;
+
+   for (i = 0; i < PicoPatchCount; i++)
+   {
+      unsigned int addr = PicoPatches[i].addr;
+
+      if (addr < Pico.romsize || !PicoPatches[i].active)
+         continue;
+      if (PicoIn.AHW & PAHW_SMS) {
+         addr &= 0x1fff;
+         PicoMem.zram[addr] = PicoPatches[i].data;
+         patch_frz[addr >> 3] |= 1 << (addr & 7);
+      } else if ((addr & 0xffffff) >= 0xe00000) {
+         addr &= 0xfffe;
+         ((u16 *)PicoMem.ram)[addr >> 1] = PicoPatches[i].data;
+         patch_frz[addr >> 3] |= 3 << (addr & 7);
+      } else {
+         // not RAM, only write once
+         m68k_write16(addr, PicoPatches[i].data);
+         continue;
+      }
+      patch_frz_cnt++;
+   }
+
+   patch_hook_ram(patch_frz_cnt > 0);
+}
+
 void PicoPatchUnload(void)
 {
+   if (patch_frz_cnt)
+   {
+      memset(patch_frz, 0, sizeof(patch_frz));
+      patch_frz_cnt = 0;
+      patch_hook_ram(0);
+   }
    if (PicoPatches != NULL)
    {
       free(PicoPatches);
@@ -455,6 +574,7 @@ void PicoPatchPrepare(void)
    }
 }
 
+/* to be called when the patch list or the active flags have changed */
 void PicoPatchApply(void)
 {
    int i, u;
@@ -489,29 +609,15 @@ void PicoPatchApply(void)
       // fprintf(stderr, "patched %i: %06x:%04x\n", PicoPatches[i].active, addr,
       // *(u16 *)(Pico.rom + addr));
       }
-      else
-      {
-         if (PicoPatches[i].active)
-         {
-            if (!(PicoIn.AHW & PAHW_SMS))
-              m68k_write16(addr,PicoPatches[i].data);
-            else
-              ;// wrong: PicoWrite8_z80(addr,PicoPatches[i].data);
-         }
-         else
-         {
-            // if current addr is not patched by older patch, write back original val
-            for (u = 0; u < i; u++)
-               if (PicoPatches[u].addr == addr) break;
-            if (u == i)
-            {
-              if (!(PicoIn.AHW & PAHW_SMS))
-                 m68k_write16(PicoPatches[i].addr,PicoPatches[i].data_old);
-              else
-                ;// wrong: PicoWrite8_z80(PicoPatches[i].addr,PicoPatches[i].data_old);
-            }
-         }
-      }
    }
+
+   patch_update_ram();
+}
+
+/* RAM may have been overwritten or remapped by a reset or state load */
+void PicoPatchRefresh(void)
+{
+   if (patch_frz_cnt)
+      patch_update_ram();
 }
 
@@ -23,6 +23,7 @@ int  PicoPatchLoad(const char *fname);
 void PicoPatchUnload(void);
 void PicoPatchPrepare(void);
 void PicoPatchApply(void);
+void PicoPatchRefresh(void);
 
 
 #ifdef __cplusplus
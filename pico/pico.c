@@ -11,6 +11,7 @@
 #include "pico_int.h"
 #include "sound/ym2612.h"
 #include "sound/vgm.h"
+#include "patch.h"
 
 struct Pico Pico;
 struct PicoMem PicoMem;
@@ -178,6 +179,7 @@ int PicoReset(void)
   z80_reset();
   if (PicoIn.AHW & PAHW_SMS) {
     PicoResetMS();
+    PicoPatchRefresh();
     return 0;
   }
 
@@ -209,6 +211,7 @@ int PicoReset(void)
     vgm_reset();
   if (PicoIn.AHW & PAHW_MCD) {
     PicoResetMCD();
+    PicoPatchRefresh();
     return 0;
   }
 
@@ -225,6 +228,7 @@ int PicoReset(void)
     elprintf(EL_STATUS, "sram: %06x - %06x; eeprom: %i", Pico.sv.start, Pico.sv.end,
       !!(Pico.sv.flags & SRF_EEPROM));
 
+  PicoPatchRefresh();
   return 0;
 }
 
@@ -266,6 +270,8 @@ PICO_INTERNAL void PicoSyncZ80(unsigned int m68k_cycles_done)
   int m68k_cnt;
   int cnt;
 
+  PicoSyncLines(0);
+
   m68k_cnt = m68k_cycles_done - Pico.t.m68c_frame_start;
   Pico.t.z80c_aim = cycles_68k_to_z80(m68k_cnt);
   cnt = Pico.t.z80c_aim - Pico.t.z80c_cnt;
@@ -282,6 +288,38 @@ PICO_INTERNAL void PicoSyncZ80(unsigned int m68k_cycles_done)
   pprof_end(z80);
 }
 
+/* sync line state to 68k while running a timeslice over several lines.
+ * If the timeslice must be ended after the current line, set end. */
+PICO_INTERNAL void PicoSyncLines(int end)
+{
+  struct PicoVideo *pv = &Pico.video;
+  int y = Pico.m.scanline;
+  int delay;
+
+  if (likely(Pico.t.m68c_lines <= 1))
+    return;
+
+  while (Pico.t.m68c_lines > 1 &&
+      SekCyclesDone() - Pico.t.m68c_line_start >= CYCLES_M68K_LINE + (y&1)) {
+    Pico.t.m68c_line_start += CYCLES_M68K_LINE + (y&1);
+    Pico.t.m68c_lines --;
+    y++;
+    // refresh slowdown at the start of the new line, see SekRunM68k
+    delay = (Pico.t.refresh_delay += CYCLES_M68K_LINE*0x108) >> 14;
+    Pico.t.refresh_delay -= delay << 14;
+    SekCyclesBurnRun(delay);
+  }
+
+  Pico.m.scanline = y;
+  pv->v_counter = PicoVideoGetV(y, 1);
+
+  if (end && Pico.t.m68c_lines > 1) {
+    // VDP state changes; continue with per-line processing after this line
+    Pico.t.m68c_aim = Pico.t.m68c_line_start + CYCLES_M68K_LINE + (y&1);
+    Pico.t.m68c_lines = 1;
+    SekEndRun(0);
+  }
+}
 
 void PicoFrame(void)
 {
@@ -313,6 +351,7 @@ void PicoFrame(void)
   PicoFrameHints();
 
 end:
+  PicoDrawFrameDone();
   pprof_end(frame);
 }
 
@@ -324,6 +363,7 @@ void PicoFrameDrawOnly(void)
   } else {
     PicoFrameDrawOnlyMS();
   }
+  PicoDrawFrameDone();
 }
 
 void PicoGetInternal(pint_t which, pint_ret_t *r)
@@ -83,6 +83,9 @@ extern void *p32x_bios_g, *p32x_bios_m, *p32x_bios_s;
 #define POPT_EN_FM_FILTER   (1<<25)
 #define POPT_EN_KBD         (1<<26)
 #define POPT_H32_LAYER_32X  (1<<27)
+#define POPT_EN_SND_THREAD  (1<<28)
+#define POPT_EN_MCD_PRELOAD (1<<29)
+#define POPT_FAST_IDLE      (1<<30) // fast forward: assume polling sooner
 
 #define PAHW_MCD    (1<<0)
 #define PAHW_32X    (1<<1)
@@ -129,6 +132,8 @@ typedef struct PicoInterface
 	unsigned short filter;         // softscale filter type
 
 	unsigned short skipFrame;      // skip rendering frame, but still do sound (if enabled) and emulation stuff
+	                               // 2: also skip sound output, only advance the sound chips
+	unsigned short frameChanged;   // set by PicoFrame if the image differs from the last rendered one
 	unsigned short regionOverride; // override the region detection 0: auto, 1: Japan NTSC, 2: Japan PAL, 4: US, 8: Europe
 	unsigned short autoRgnOrder;   // packed priority list of regions, for example 0x148 means this detection order: EUR, USA, JAP
 	unsigned int hwSelect;         // hardware preselected via option menu
@@ -210,6 +215,13 @@ void *PicoTmpStateSave(void);
 void  PicoTmpStateRestore(void *data);
 extern void (*PicoStateProgressCB)(const char *str);
 
+// movie.c
+int  PicoMoviePlay(const char *fname);   // .pmv or .gmv, before media load
+int  PicoMovieRecord(const char *fname); // starts with the next frame
+int  PicoMovieFrame(void);               // each frame before PicoFrame()
+int  PicoMovieStatus(unsigned int *frame, unsigned int *frames);
+void PicoMovieStop(void);
+
 // cd/cdd.c
 int cdd_load(const char *filename, int type);
 int cdd_unload(void);
@@ -220,7 +232,8 @@ typedef enum
 	PMT_UNCOMPRESSED = 0,
 	PMT_ZIP,
 	PMT_CSO,
-	PMT_CHD
+	PMT_CHD,
+	PMT_MEM		/* mmapped or preloaded into RAM, see pm_cache */
 } pm_type;
 typedef struct
 {
@@ -236,6 +249,7 @@ size_t   pm_read(void *ptr, size_t bytes, pm_file *stream);
 size_t   pm_read_audio(void *ptr, size_t bytes, pm_file *stream);
 int      pm_seek(pm_file *stream, long offset, int whence);
 int      pm_close(pm_file *fp);
+pm_file *pm_cache(pm_file *stream, int preload);
 int PicoCartLoad(pm_file *f, const unsigned char *rom, unsigned int romsize,
   unsigned char **prom, unsigned int *psize, int is_sms);
 int PicoCartInsert(unsigned char *rom, unsigned int romsize, const char *carthw_cfg);
@@ -256,6 +270,8 @@ typedef enum
 void PicoDrawSetOutFormat(pdso_t which, int use_32x_line_mode);
 void PicoDrawSetOutBuf(void *dest, int increment);
 void PicoDrawSetCallbacks(int (*begin)(unsigned int num), int (*end)(unsigned int num));
+// line renderer statistics: lines taken from the scanline cache / drawn
+extern unsigned int PicoDrawLinesCached, PicoDrawLinesDrawn;
 // utility
 #ifdef _ASM_DRAW_C
 void vidConvCpyRGB565(void *to, void *from, int pixels);
@@ -310,6 +326,8 @@ void Pico32xSetClocks(int msh2_hz, int ssh2_hz);
 // sound.c
 extern void (*PsndMix_32_to_16)(s16 *dest, s32 *src, int count);
 void PsndRerate(int preserve_state);
+void PsndSetRateAdjust(int ppm);
+void PsndSync(void);
 
 // media.c
 enum media_type_e {
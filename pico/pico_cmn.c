@@ -128,6 +128,40 @@ static void do_timing_hacks_start(struct PicoVideo *pv)
   Pico.t.m68c_aim += Pico.m.scanline&1; // add 1 every 2 lines for 488.5 cycles
 }
 
+#ifndef PICO_CD
+// run several lines in one timeslice, line state is synced on VDP access
+static void SekRunM68kLines(int lines)
+{
+  int y = Pico.m.scanline;
+
+  Pico.t.m68c_lines = lines;
+  // refresh slowdown for the 1st line, the others are done in PicoSyncLines
+  SekAimM68k(CYCLES_M68K_LINE, 0x108);
+  // add 1 every 2 lines for 488.5 cycles, as in do_timing_hacks_start
+  Pico.t.m68c_aim += (lines-1) * CYCLES_M68K_LINE + ((y+lines)>>1) - ((y+1)>>1);
+  SekSyncM68k(0);
+
+  // advance line state to the last line run
+  PicoSyncLines(0);
+  Pico.t.m68c_cnt -= SekCyclesLeft; // refresh burnt outside of CPU run
+  SekCyclesLeft = 0;
+  Pico.t.m68c_lines = 0;
+}
+
+// check if the next lines have no events needing per-line processing
+static int vblank_lines_idle(struct PicoVideo *pv)
+{
+  if (PicoIn.AHW || PicoLineHook || port_lightgun ||
+      (pv->status & PVS_ACTIVE) || !PicoVideoFIFOIdle())
+    return 0;
+
+  // Z80 only runs after the timeslice, which doesn't work with bus stealing
+  if (Pico.m.z80Run && !Pico.m.z80_reset && (PicoIn.opt&POPT_EN_Z80))
+    PicoSyncZ80(Pico.t.m68c_aim);
+  return (Pico.t.z80_buscycles >> 4) == 0;
+}
+#endif
+
 static int PicoFrameHints(void)
 {
   struct PicoVideo *pv = &Pico.video;
@@ -291,9 +325,15 @@ static int PicoFrameHints(void)
       do_hint(pv);
     }
 
-    // Run scanline:
+    // Run scanline, or all lines up to the next event if there are none:
     Pico.t.m68c_line_start = Pico.t.m68c_aim;
     do_timing_hacks_start(pv);
+#ifndef PICO_CD
+    if (lines - 1 - y > 1 && vblank_lines_idle(pv)) {
+      SekRunM68kLines(lines - 1 - y);
+      y = Pico.m.scanline;
+    } else
+#endif
     CPUS_RUN(CYCLES_M68K_LINE);
     do_timing_hacks_end(pv);
 
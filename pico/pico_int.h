@@ -455,6 +455,7 @@ struct PicoTiming
   unsigned int m68c_aim;
   unsigned int m68c_frame_start;        // m68k cycles
   unsigned int m68c_line_start;
+  int m68c_lines;                       // #lines in multi-line timeslice
   int refresh_delay;
 
   unsigned int z80c_cnt;                // z80 cycles done (this frame)
@@ -730,6 +731,9 @@ void BackFill(int reg7, int sh, struct PicoEState *est);
 void FinalizeLine555(int sh, int line, struct PicoEState *est);
 void FinalizeLine8bit(int sh, int line, struct PicoEState *est);
 void PicoDrawSetOutBufMD(void *dest, int increment);
+void PicoDrawLineDone(int line);
+void PicoDrawInvalidate(void);
+PICO_INTERNAL void PicoDrawFrameDone(void);
 extern int (*PicoScanBegin)(unsigned int num);
 extern int (*PicoScanEnd)(unsigned int num);
 #define MAX_LINE_SPRITES 27	// +1 last sprite width, +4 hdr; total 32
@@ -739,6 +743,7 @@ extern int HighColIncrement;
 extern void *DrawLineDestBase;
 extern int DrawLineDestIncrement;
 extern u32 VdpSATCache[2*128];
+extern u32 VdpVRAMStamp[64], VdpLineStamp;
 
 // draw2.c
 void PicoDraw2SetOutBuf(void *dest, int incr);
@@ -749,6 +754,8 @@ PICO_INTERNAL void PicoFrameFull(void);
 void PicoFrameStartSMS(void);
 void PicoParseSATSMS(int line);
 void PicoLineSMS(int line);
+void PicoDrawSyncSMS(void);
+void PicoFrameEndSMS(void);
 void PicoDoHighPal555SMS(void);
 void PicoDrawSetOutputSMS(pdso_t which);
 
@@ -774,6 +781,9 @@ extern int port_lightgun;
 // pico/memory.c
 PICO_INTERNAL void PicoMemSetupPico(void);
 
+// movie.c
+void PicoMovieUnload(void);
+
 // cd/cdc.c
 void cdc_init(void);
 void cdc_reset(void);
@@ -827,6 +837,7 @@ extern void (*PicoLineHook)(void);
 PICO_INTERNAL int  CheckDMA(int cycles);
 PICO_INTERNAL void PicoDetectRegion(void);
 PICO_INTERNAL void PicoSyncZ80(unsigned int m68k_cycles_done);
+PICO_INTERNAL void PicoSyncLines(int end);
 
 // cd/mcd.c
 #define PCDS_IEN1     (1<<1)
@@ -915,6 +926,12 @@ extern short cdda_out_buffer[2*1152];
 
 void cdda_start_play(int lba_base, int lba_offset, int lb_len);
 void cdda_stop_play(void);
+void cdda_ahead_start(int (*open)(void *f, int pos), int (*decode)(void),
+                     void *file, int pos);
+void cdda_ahead_stop(void);
+void cdda_ahead_wait(void);
+short *cdda_ahead_next(void);
+int  cdda_ahead_eof(void);
 
 #define YM2612_NATIVE_RATE() (((Pico.m.pal?OSC_PAL:OSC_NTSC)/7 + 3*24) / (6*24))
 
@@ -953,6 +970,9 @@ void ym2612_unpack_state_old(void);
 
 // videoport.c
 extern u32 SATaddr, SATmask;
+// mark a 1KB VRAM page as written for the scanline cache in draw.c
+#define VideoDirtyVRAM(a) \
+  VdpVRAMStamp[(u16)(a) >> 10] = VdpLineStamp
 static __inline void UpdateSAT(u32 a, u32 d)
 {
   unsigned num = (a^SATaddr) >> 3;
@@ -963,6 +983,7 @@ static __inline void UpdateSAT(u32 a, u32 d)
 static __inline void VideoWriteVRAM(u32 a, u16 d)
 {
   PicoMem.vram [(u16)a >> 1] = d;
+  VideoDirtyVRAM(a);
 
   if (((a^SATaddr) & SATmask) == 0)
     UpdateSAT(a, d);
@@ -986,6 +1007,7 @@ unsigned char PicoVideoRead8HV_L(int is_from_z80);
 extern int (*PicoDmaHook)(u32 source, int len, unsigned short **base, u32 *mask);
 void PicoVideoFIFOSync(int cycles);
 int PicoVideoFIFOHint(void);
+int PicoVideoFIFOIdle(void);
 void PicoVideoFIFOMode(int active, int h40);
 int PicoVideoFIFOWrite(int count, int byte_p, unsigned sr_mask, unsigned sr_flags);
 void PicoVideoInit(void);
@@ -1016,6 +1038,7 @@ PICO_INTERNAL void z80_exit(void);
 // cd/misc.c
 PICO_INTERNAL_ASM void wram_2M_to_1M(unsigned char *m);
 PICO_INTERNAL_ASM void wram_1M_to_2M(unsigned char *m);
+PICO_INTERNAL void wram_1M_to_2M_copy(unsigned char *d, const unsigned char *m, int offs, int len);
 
 // sound/sound.c
 PICO_INTERNAL void PsndInit(void);
@@ -1028,6 +1051,8 @@ PICO_INTERNAL void PsndDoYM2413(int cyc_to);
 PICO_INTERNAL void PsndDoFM(int cyc_to);
 PICO_INTERNAL void PsndDoSMSFM(int cyc_to);
 PICO_INTERNAL void PsndDoPCM(int cyc_to);
+PICO_INTERNAL int  PsndWriteFM(int cyc, int addr, int d);
+PICO_INTERNAL void PsndWritePSG(int cyc, int d);
 PICO_INTERNAL void PsndClear(void);
 PICO_INTERNAL void PsndGetSamples(int y);
 PICO_INTERNAL void PsndGetSamplesMS(int y);
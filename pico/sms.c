@@ -74,7 +74,8 @@ static void vdp_data_write(unsigned char d)
       if (PicoMem.cram[a] != (c | (c>>2))) Pico.m.dirtyPal = 1;
       PicoMem.cram[a] = PicoMem.cram[a+0x20] = c | (c>>2);
     }
-  } else {
+  } else if (PicoMem.vramb[MEM_LE2(pv->addr)] != d) {
+    PicoDrawSyncSMS();
     PicoMem.vramb[MEM_LE2(pv->addr)] = d;
   }
   pv->addr = (pv->addr + 1) & 0x3fff;
@@ -104,6 +105,9 @@ static NOINLINE void vdp_reg_write(struct PicoVideo *pv, u8 a, u8 d)
 {
   int l;
 
+  // hscroll is latched per line, the hint counter doesn't affect the image
+  if (a != 8 && a != 10)
+    PicoDrawSyncSMS();
   pv->reg[a] = d;
   switch (a) {
   case 0: // mode control 1
@@ -1103,6 +1107,7 @@ void PicoPowerMS(void)
   memset(&PicoMem,0,sizeof(PicoMem));
   memset(&Pico.video,0,sizeof(Pico.video));
   memset(&Pico.m,0,sizeof(Pico.m));
+  PicoDrawSyncSMS();
 
   // calculate a mask for bank writes.
   // ROM loader has aligned the size for us, so this is safe.
@@ -1235,6 +1240,7 @@ void PicoStateLoadedMS(void)
   }
   memcpy(PicoMem.zram+0x1ff0, zram_dff0, 16);
   memcpy(Pico.ms.carthw, carthw, 16);
+  PicoDrawSyncSMS(); // VRAM and registers have been reloaded
 }
 
 void PicoPrepareMS(void)
@@ -1333,6 +1339,7 @@ void PicoFrameMS(void)
 
     z80_exec(Pico.t.z80c_line_start + cycles_line);
   }
+  PicoFrameEndSMS();
 
   // end of frame updates
   tape_update(Pico.t.z80c_aim);
@@ -1358,6 +1365,7 @@ void PicoFrameDrawOnlyMS(void)
     PicoParseSATSMS(y-1);
     PicoLineSMS(y);
   }
+  PicoFrameEndSMS();
 }
 
 // open tape file for reading (WAV and bitstream files)
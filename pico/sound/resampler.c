@@ -219,6 +219,27 @@ void resampler_update(resampler_t *rs, s32 *buffer, int length,
   }
   p = rs->buffer + (rs->buffer_idx<<spf);
 
+  /* no output buffer: only advance the input and the filter position. The
+   * last :taps input samples are generated nonetheless, since they are the
+   * filter history for the next output */
+  if (!buffer) {
+    if (inlen > 0) {
+      n = inlen - rs->taps;
+      if (n > 0)
+        get_samples(NULL, n, rs->stereo);
+      else
+        n = 0;
+      get_samples(p + ((rs->taps+n)<<spf), inlen-n, rs->stereo);
+    }
+    while (--length >= 0) {
+      rs->phase -= rs->decimation;
+      rs->phase += rs->ratio_int*rs->interpolation, rs->buffer_idx += rs->ratio_int;
+      if (rs->phase < 0)
+        { rs->phase += rs->interpolation, rs->buffer_idx ++; }
+    }
+    return;
+  }
+
   /* generate input samples */
   if (inlen > 0)
     get_samples(p + (rs->taps<<spf), inlen, rs->stereo);
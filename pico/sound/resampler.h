@@ -38,7 +38,9 @@ void resampler_free(resampler_t *r);
 resampler_t *resampler_new(unsigned taps, unsigned interpolation, unsigned decimation,
        double cutoff, double beta, unsigned max_input, int stereo);
 /* Obtain :length resampled audio frames in :buffer. Use :get_samples to obtain
- * the needed amount of input samples */
+ * the needed amount of input samples. If :buffer is NULL, only the resampler
+ * position is advanced, and :get_samples is called with NULL for all input
+ * except the last :taps samples needed as filter history */
 void resampler_update(resampler_t *r, s32 *buffer, int length,
        void (*generate_samples)(s32 *buffer, int length, int stereo));
 
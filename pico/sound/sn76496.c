@@ -20,6 +20,7 @@
 #pragma warning (disable:4244)
 #endif
 
+#include <string.h>
 #include "sn76496.h"
 
 #define MAX_OUTPUT 0x4800 // was 0x7fff
@@ -126,58 +127,45 @@ WRITE8_HANDLER( SN76496_3_w ) {	SN76496Write(3,data); }
 WRITE8_HANDLER( SN76496_4_w ) {	SN76496Write(4,data); }
 */
 
-//static
-void SN76496Update(short *buffer, int length, int stereo)
+/* advance the generators by length samples without producing output */
+static void SN76496Skip(struct SN76496 *R, int length)
 {
-	int i;
-	struct SN76496 *R = &ono_sn;
+	int i, c, k;
 
-	while (length > 0)
+	for (i = 0;i < 3;i++)
 	{
-		int vol[4];
-		int left;
-
-
-		/* vol[] keeps track of how long each square wave stays */
-		/* in the 1 position during the sample period. */
-		vol[0] = vol[1] = vol[2] = vol[3] = 0;
-
-		for (i = 0;i < 3;i++)
-		{
-			if (R->Output[i]) vol[i] += R->Count[i];
-			R->Count[i] -= STEP;
-			/* Period[i] is the half period of the square wave. Here, in each */
-			/* loop I add Period[i] twice, so that at the end of the loop the */
-			/* square wave is in the same status (0 or 1) it was at the start. */
-			/* vol[i] is also incremented by Period[i], since the wave has been 1 */
-			/* exactly half of the time, regardless of the initial position. */
-			/* If we exit the loop in the middle, Output[i] has to be inverted */
-			/* and vol[i] incremented only if the exit status of the square */
-			/* wave is 1. */
-			if (R->Count[i] < -2*R->Period[i] || R->Volume[i] == 0) {
-				/* Cut off anything above the Nyquist frequency. */
-				/* It will only create aliasing anyway. This is actually an */
-				/* ideal lowpass filter with Nyquist corner frequency. */
-				vol[i] += STEP/2; // mean value
-				R->Count[i] = R->Output[i] = 0;
-			}
-			while (R->Count[i] < 0)
-			{
-				R->Count[i] += R->Period[i];
-				if (R->Count[i] >= 0)
-				{
+		if (R->Volume[i] == 0) {
+			R->Count[i] = R->Output[i] = 0;
+			continue;
+		}
+		if (STEP > 2*R->Period[i]) {
+			/* possible Nyquist cut, do it the slow way */
+			for (k = length; k > 0; k--) {
+				R->Count[i] -= STEP;
+				if (R->Count[i] < -2*R->Period[i]) {
+					R->Count[i] = R->Output[i] = 0;
+					continue;
+				}
+				while (R->Count[i] < 0) {
+					R->Count[i] += R->Period[i];
 					R->Output[i] ^= 1;
-					if (R->Output[i]) vol[i] += R->Period[i];
-					break;
 				}
-				R->Count[i] += R->Period[i];
-				vol[i] += R->Period[i];
 			}
-			if (R->Output[i]) vol[i] -= R->Count[i];
+			continue;
 		}
+		/* no cut possible, the square wave toggles once every Period */
+		c = R->Count[i] - length*STEP;
+		if (c < 0) {
+			k = (R->Period[i] - 1 - c) / R->Period[i];
+			R->Count[i] = c + k*R->Period[i];
+			R->Output[i] ^= k & 1;
+		} else
+			R->Count[i] = c;
+	}
 
-		left = STEP;
-		if (R->Output[3]) vol[3] += R->Count[3];
+	for (; length > 0; length--)
+	{
+		int left = STEP;
 		do
 		{
 			int nextevent;
@@ -191,44 +179,174 @@ void SN76496Update(short *buffer, int length, int stereo)
 				R->Output[3] = R->RNG & 1;
 				R->RNG >>= 1;
 				if (R->Output[3])
-				{
 					R->RNG ^= R->NoiseFB;
-					vol[3] += R->Period[3];
-				}
 				R->Count[3] += R->Period[3];
 			}
 
 			left -= nextevent;
 		} while (left > 0 && R->Volume[3]);
-		if (R->Output[3]) vol[3] -= R->Count[3];
+	}
+}
+
+/* high time of a tone channel during one sample, in STEP units */
+static inline int SN76496ToneStep(struct SN76496 *R, int i)
+{
+	int vol = 0;
+
+	if (R->Output[i]) vol += R->Count[i];
+	R->Count[i] -= STEP;
+	/* Period[i] is the half period of the square wave. Here, in each */
+	/* loop I add Period[i] twice, so that at the end of the loop the */
+	/* square wave is in the same status (0 or 1) it was at the start. */
+	/* vol[i] is also incremented by Period[i], since the wave has been 1 */
+	/* exactly half of the time, regardless of the initial position. */
+	/* If we exit the loop in the middle, Output[i] has to be inverted */
+	/* and vol[i] incremented only if the exit status of the square */
+	/* wave is 1. */
+	if (R->Count[i] < -2*R->Period[i] || R->Volume[i] == 0) {
+		/* Cut off anything above the Nyquist frequency. */
+		/* It will only create aliasing anyway. This is actually an */
+		/* ideal lowpass filter with Nyquist corner frequency. */
+		vol += STEP/2; // mean value
+		R->Count[i] = R->Output[i] = 0;
+	}
+	while (R->Count[i] < 0)
+	{
+		R->Count[i] += R->Period[i];
+		if (R->Count[i] >= 0)
+		{
+			R->Output[i] ^= 1;
+			if (R->Output[i]) vol += R->Period[i];
+			break;
+		}
+		R->Count[i] += R->Period[i];
+		vol += R->Period[i];
+	}
+	if (R->Output[i]) vol -= R->Count[i];
+	return vol;
+}
+
+/* high time of the noise channel during one sample, in STEP units */
+static inline int SN76496NoiseStep(struct SN76496 *R)
+{
+	int vol = 0, left = STEP;
+
+	if (R->Output[3]) vol += R->Count[3];
+	do
+	{
+		int nextevent;
+
+		if (R->Count[3] < left) nextevent = R->Count[3];
+		else nextevent = left;
+
+		R->Count[3] -= nextevent;
+		if (R->Count[3] <= 0)
+		{
+			R->Output[3] = R->RNG & 1;
+			R->RNG >>= 1;
+			if (R->Output[3])
+			{
+				R->RNG ^= R->NoiseFB;
+				vol += R->Period[3];
+			}
+			R->Count[3] += R->Period[3];
+		}
+
+		left -= nextevent;
+	} while (left > 0 && R->Volume[3]);
+	if (R->Output[3]) vol -= R->Count[3];
+	return vol;
+}
+
+/* add the output of channel i for length samples to the mix buffer(s). */
+/* Between edges the output is constant for Count/STEP samples, so runs */
+/* are filled at once and only samples containing an edge are stepped. */
+static void SN76496Channel(struct SN76496 *R, int i,
+	unsigned int *l, unsigned int *r, int length)
+{
+	unsigned int v = l ? R->Volume[i] : 0;
+	int k, j, n;
+
+	if (R->Volume[i] == 0 && i < 3) {
+		/* silenced tone channels are kept at reset */
+		R->Count[i] = R->Output[i] = 0;
+		return;
+	}
+
+	for (k = 0; k < length; k += n)
+	{
+		/* the noise shifts if the count reaches 0 within the sample */
+		n = (i < 3 ? R->Count[i] : R->Count[i] - 1) / STEP;
+		if (n > 0) {
+			if (n > length - k) n = length - k;
+			R->Count[i] -= n * STEP;
+			if (R->Output[i] && v) {
+				unsigned int o = v * STEP;
+				for (j = k; j < k + n; j++) l[j] += o;
+				if (r) for (j = k; j < k + n; j++) r[j] += o;
+			}
+		} else {
+			unsigned int o = (i < 3 ? SN76496ToneStep(R, i) : SN76496NoiseStep(R)) * v;
+			if (v) {
+				l[k] += o;
+				if (r) r[k] += o;
+			}
+			n = 1;
+		}
+	}
+}
+
+#define BLOCK 256
+
+//static
+void SN76496Update(short *buffer, int length, int stereo)
+{
+	struct SN76496 *R = &ono_sn;
+	unsigned int outl[BLOCK], outr[BLOCK];
+	int i, j, n;
+
+	if (!buffer) {
+		SN76496Skip(R, length);
+		return;
+	}
+
+	for (; length > 0; length -= n)
+	{
+		n = length < BLOCK ? length : BLOCK;
+		memset(outl, 0, n * sizeof(outl[0]));
 
-		length--;
 		if (R->Panning == 0xff || !stereo) {
-			unsigned int out =
-				vol[0] * R->Volume[0] + vol[1] * R->Volume[1] +
-				vol[2] * R->Volume[2] + vol[3] * R->Volume[3];
+			for (i = 0; i < 4; i++)
+				SN76496Channel(R, i, outl, NULL, n);
 
-			if (out > MAX_OUTPUT * STEP) out = MAX_OUTPUT * STEP;
+			for (j = 0; j < n; j++) {
+				unsigned int out = outl[j];
+				if (out > MAX_OUTPUT * STEP) out = MAX_OUTPUT * STEP;
 
-			out /= STEP; // will be optimized to shift; max 0x4800 = 18432
-			*buffer++ += out;
-			if (stereo) *buffer++ += out;
+				out /= STEP; // will be optimized to shift; max 0x4800 = 18432
+				*buffer++ += out;
+				if (stereo) *buffer++ += out;
+			}
 		} else {
-#define P(n) !!(R->Panning & (1<<(n)))
-			unsigned int outl =
-				vol[0] * R->Volume[0] * P(4) + vol[1] * R->Volume[1] * P(5) +
-				vol[2] * R->Volume[2] * P(6) + vol[3] * R->Volume[3] * P(7);
-			unsigned int outr =
-				vol[0] * R->Volume[0] * P(0) + vol[1] * R->Volume[1] * P(1) +
-				vol[2] * R->Volume[2] * P(2) + vol[3] * R->Volume[3] * P(3);
-#undef P
-			if (outl > MAX_OUTPUT * STEP) outl = MAX_OUTPUT * STEP;
-			if (outr > MAX_OUTPUT * STEP) outr = MAX_OUTPUT * STEP;
-
-			outl /= STEP; // will be optimized to shift; max 0x4800 = 18432
-			outr /= STEP; // will be optimized to shift; max 0x4800 = 18432
-			*buffer++ += outl;
-			*buffer++ += outr;
+			memset(outr, 0, n * sizeof(outr[0]));
+			for (i = 0; i < 4; i++) {
+				int pl = R->Panning & (0x10 << i), pr = R->Panning & (1 << i);
+				if (pl)
+					SN76496Channel(R, i, outl, pr ? outr : NULL, n);
+				else if (pr)
+					SN76496Channel(R, i, outr, NULL, n);
+				else
+					SN76496Channel(R, i, NULL, NULL, n);
+			}
+
+			for (j = 0; j < n; j++) {
+				unsigned int l = outl[j], r = outr[j];
+				if (l > MAX_OUTPUT * STEP) l = MAX_OUTPUT * STEP;
+				if (r > MAX_OUTPUT * STEP) r = MAX_OUTPUT * STEP;
+
+				*buffer++ += l / STEP;
+				*buffer++ += r / STEP;
+			}
 		}
 	}
 }
@@ -16,23 +16,48 @@
 #include "../cd/megasd.h"
 #include "resampler.h"
 #include "mix.h"
+#ifdef USE_SND_THREAD
+#include <pthread.h>
+#endif
 
 #define YM2612_CH6PAN   0x1b6   // panning register for channel 6 (used for DAC)
 
+// chip writes are logged for the sound thread (see PsndWriteFM)
+static int slog_on;
+
+// ch6 panning for the DAC. The sound thread must use the synth state since
+// REGS is already ahead, while OPN.pan isn't maintained if FM is on the 940
+#define DAC_PAN() \
+  (slog_on ? (ym2612.OPN.pan >> 4) & 0xc0 : ym2612.REGS[YM2612_CH6PAN])
+
 void (*PsndMix_32_to_16)(s16 *dest, s32 *src, int count) = mix_32_to_16_stereo;
 
 // master int buffer to mix to
 // +1 for a fill triggered by an instruction overhanging into the next scanline
-static s32 PsndBuffer[2*(54000+100)/50+2];
+// +0.5% for the output rate adjustment (see PsndSetRateAdjust)
+static s32 PsndBuffer[2*(54000+270+100)/50+2];
 
 // cdda output buffer
 s16 cdda_out_buffer[2*1152];
+// uncompressed tracks, cdda_out_buffer may still be used by the decode thread
+static s16 cdda_raw_buffer[2*1152];
 
 // FM resampling polyphase FIR
 static resampler_t *ym2612_resampler;
 static resampler_t *ym2413_resampler;
 static int (*PsndFMUpdate)(s32 *buffer, int length, int stereo, int is_buf_empty);
 
+// frame skipped without sound, advance the chips but don't produce output.
+// latched at frame start, or when passing the frame to the sound thread
+static int psnd_silent;
+#define PsndSilent()  (psnd_silent)
+
+static int sthr_start(void);
+static void sthr_stop(void);
+static void slog_submit(int len);
+static void slog_flush_out(void);
+static void cthr_exit(void);
+
 PICO_INTERNAL void PsndInit(void)
 {
   opll = OPLL_new(OSC_NTSC/15, OSC_NTSC/15/72);
@@ -42,6 +67,11 @@ PICO_INTERNAL void PsndInit(void)
 
 PICO_INTERNAL void PsndExit(void)
 {
+  PsndSync();
+  slog_on = 0;
+  sthr_stop();
+  cthr_exit();
+
   if (opll)
     OPLL_delete(opll);
   opll = NULL;
@@ -76,6 +106,11 @@ static int YM2612UpdateFIR(s32 *buffer, int length, int stereo, int is_buf_empty
 // resample SMS FM from its native 49716Hz/49262Hz with polyphase FIR filter
 static void YM2413Update(s32 *buffer, int length, int stereo)
 {
+  if (!buffer) {
+    while (length-- > 0)
+      OPLL_calc(opll);
+    return;
+  }
   while (length-- > 0) {
     int16_t getdata = OPLL_calc(opll) * 3;
     *buffer++ = getdata;
@@ -85,7 +120,7 @@ static void YM2413Update(s32 *buffer, int length, int stereo)
 
 static int YM2413UpdateFIR(s32 *buffer, int length, int stereo, int is_buf_empty)
 {
-  if (!is_buf_empty) memset(buffer, 0, (length << stereo) * sizeof(*buffer));
+  if (buffer && !is_buf_empty) memset(buffer, 0, (length << stereo) * sizeof(*buffer));
   resampler_update(ym2413_resampler, buffer, length, YM2413Update);
   return 0;
 }
@@ -125,12 +160,48 @@ static int ymclock;
 static int ymrate;
 static int ymopts;
 
+// output rate deviation in ppm, for drift compensation by the frontend
+#define RATE_ADJ_MAX  5000
+static int rate_adj;
+
+// output sample timing. Only the amount of samples per frame is adjusted, the
+// chips keep running at the nominal rate, so the pitch change is unnoticeable
+static void PsndSetTiming(void)
+{
+  int target_fps = Pico.m.pal ? 50 : 60;
+  int target_lines = Pico.m.pal ? 313 : 262;
+  // output rate in Q16
+  long long rate = ((long long)PicoIn.sndRate << 16) * (1000000 + rate_adj) / 1000000;
+
+  // calculate Pico.snd.len
+  Pico.snd.len = rate / target_fps >> 16;
+  Pico.snd.len_e_add = rate / target_fps & 0xffff;
+
+  // samples per line (Q16)
+  Pico.snd.smpl_mult = rate / (target_fps*target_lines);
+  // samples per z80 clock (Q20)
+  Pico.snd.clkz_mult = 16 * Pico.snd.smpl_mult * 15/7 / 488.5;
+  // samples per 44.1 KHz sample (Q16)
+  Pico.snd.cdda_mult = (65536LL * 44100 << 16) / rate;
+  Pico.snd.cdda_div  = rate / 44100;
+}
+
+// nudge the output rate by ppm, to keep an output buffer at its fill level.
+// Takes effect with the next frame, without disturbing the sound state
+void PsndSetRateAdjust(int ppm)
+{
+  if (ppm > RATE_ADJ_MAX) ppm = RATE_ADJ_MAX;
+  if (ppm < -RATE_ADJ_MAX) ppm = -RATE_ADJ_MAX;
+  if (ppm != rate_adj) {
+    rate_adj = ppm;
+    PsndSetTiming();
+  }
+}
+
 // to be called after changing sound rate or chips
 void PsndRerate(int preserve_state)
 {
   void *state = NULL;
-  int target_fps = Pico.m.pal ? 50 : 60;
-  int target_lines = Pico.m.pal ? 313 : 262;
   int sms_clock = Pico.m.pal ? OSC_PAL/15 : OSC_NTSC/15;
   int ym2413_rate = (sms_clock + 36) / 72;
   int ym2612_clock = Pico.m.pal ? OSC_PAL/7 : OSC_NTSC/7;
@@ -138,6 +209,9 @@ void PsndRerate(int preserve_state)
   int ym2612_init = !preserve_state;
   int state_size = 4096;
 
+  PsndSync();
+  psnd_silent = PicoIn.skipFrame == 2;
+
   // don't init YM2612 if preserve_state and no parameter changes
   ym2612_init |= ymclock != ym2612_clock || ymopts != (PicoIn.opt & (POPT_DIS_FM_SSGEG|POPT_FM_YM2612));
   ym2612_init |= ymrate != (PicoIn.opt & POPT_EN_FM_FILTER ? ym2612_rate : PicoIn.sndRate);
@@ -188,19 +262,9 @@ void PsndRerate(int preserve_state)
   else
     SN76496_init(Pico.m.pal ? OSC_PAL/15 : OSC_NTSC/15, PicoIn.sndRate);
 
-  // calculate Pico.snd.len
-  Pico.snd.len = PicoIn.sndRate / target_fps;
-  Pico.snd.len_e_add = ((PicoIn.sndRate - Pico.snd.len * target_fps) << 16) / target_fps;
+  PsndSetTiming();
   Pico.snd.len_e_cnt = 0; // Q16
 
-  // samples per line (Q16)
-  Pico.snd.smpl_mult = 65536LL * PicoIn.sndRate / (target_fps*target_lines);
-  // samples per z80 clock (Q20)
-  Pico.snd.clkz_mult = 16 * Pico.snd.smpl_mult * 15/7 / 488.5;
-  // samples per 44.1 KHz sample (Q16)
-  Pico.snd.cdda_mult = 65536LL * 44100 / PicoIn.sndRate;
-  Pico.snd.cdda_div  = 65536LL * PicoIn.sndRate / 44100;
-
   // clear all buffers
   memset32(PsndBuffer, 0, sizeof(PsndBuffer)/4);
   memset(cdda_out_buffer, 0, sizeof(cdda_out_buffer));
@@ -218,6 +282,23 @@ void PsndRerate(int preserve_state)
 
 PICO_INTERNAL void PsndStartFrame(void)
 {
+  // only chips having all state in the sound code can be run in the thread
+  int log = (PicoIn.opt & POPT_EN_SND_THREAD) && PicoIn.sndOut &&
+      !(PicoIn.opt & POPT_EXT_FM) &&
+      !(PicoIn.AHW & (PAHW_MCD|PAHW_32X|PAHW_PICO|PAHW_8BIT|PAHW_VGM));
+
+  if (log != slog_on) {
+    if (log)
+      slog_on = sthr_start();
+    else {
+      PsndSync();
+      slog_flush_out();
+      slog_on = 0;
+    }
+  }
+  if (!slog_on)
+    psnd_silent = PicoIn.skipFrame == 2;
+
   // compensate for float part of Pico.snd.len
   Pico.snd.len_use = Pico.snd.len;
   Pico.snd.len_e_cnt += Pico.snd.len_e_add;
@@ -248,13 +329,15 @@ PICO_INTERNAL void PsndDoDAC(int cyc_to)
     len = 1, Pico.snd.dac_pos += 0x80000;
   if (len <= 0)
     return;
+  if (PsndSilent())
+    goto out;
 
   // fill buffer, applying a rather weak order 1 bessel IIR on the way
   // y[n] = (x[n] + x[n-1])*(1/2) (3dB cutoff at 11025 Hz, no gain)
   // 1 sample delay for correct IIR filtering over audio frame boundaries
   if (PicoIn.opt & POPT_EN_STEREO) {
     s16 *d = PicoIn.sndOut + pos*2;
-    int pan = ym2612.REGS[YM2612_CH6PAN];
+    int pan = DAC_PAN();
     int l = pan & 0x80 ? Pico.snd.dac_val : 0;
     int r = pan & 0x40 ? Pico.snd.dac_val : 0;
     *d++ += pan & 0x80 ? Pico.snd.dac_val2 : 0;
@@ -265,6 +348,7 @@ PICO_INTERNAL void PsndDoDAC(int cyc_to)
     *d++ += Pico.snd.dac_val2;
     while (--len) *d++ += Pico.snd.dac_val;
   }
+out:
   Pico.snd.dac_val2 = (Pico.snd.dac_val + dout) >> 1;
   Pico.snd.dac_val = dout;
 }
@@ -294,7 +378,7 @@ PICO_INTERNAL void PsndDoPSG(int cyc_to)
     stereo = 1;
     pos <<= 1;
   }
-  SN76496Update(PicoIn.sndOut + pos, len, stereo);
+  SN76496Update(PsndSilent() ? NULL : PicoIn.sndOut + pos, len, stereo);
 }
 
 PICO_INTERNAL void PsndDoSMSFM(int cyc_to)
@@ -325,7 +409,9 @@ PICO_INTERNAL void PsndDoSMSFM(int cyc_to)
     pos <<= 1;
   }
 
-  if (Pico.m.hardware & PMS_HW_FMUSED) {
+  if ((Pico.m.hardware & PMS_HW_FMUSED) && PsndSilent())
+    YM2413UpdateFIR(NULL, len, 0, 0);
+  else if (Pico.m.hardware & PMS_HW_FMUSED) {
     buf += pos;
     YM2413UpdateFIR(buf32, len, 0, 0);
     if (stereo) 
@@ -364,7 +450,7 @@ PICO_INTERNAL void PsndDoFM(int cyc_to)
     pos <<= 1;
   }
   if (PicoIn.opt & POPT_EN_FM)
-    PsndFMUpdate(PsndBuffer + pos, len, stereo, 1);
+    PsndFMUpdate(PsndSilent() ? NULL : PsndBuffer + pos, len, stereo, 1);
 }
 
 PICO_INTERNAL void PsndDoPCM(int cyc_to)
@@ -390,7 +476,7 @@ PICO_INTERNAL void PsndDoPCM(int cyc_to)
     stereo = 1;
     pos <<= 1;
   }
-  PicoPicoPCMUpdate(PicoIn.sndOut + pos, len, stereo);
+  PicoPicoPCMUpdate(PsndSilent() ? NULL : PicoIn.sndOut + pos, len, stereo);
 }
 
 // cdda
@@ -411,20 +497,20 @@ static void cdda_raw_update(s32 *buffer, int length, int stereo)
   while (Pico_mcd->m.cdda_lba_offset >= 2352/4)
     Pico_mcd->m.cdda_lba_offset -= 2352/4;
 
-  ret = pm_read_audio(cdda_out_buffer, cdda_bytes, Pico_mcd->cdda_stream);
+  ret = pm_read_audio(cdda_raw_buffer, cdda_bytes, Pico_mcd->cdda_stream);
   if (ret < cdda_bytes) {
-    memset((char *)cdda_out_buffer + ret, 0, cdda_bytes - ret);
+    memset((char *)cdda_raw_buffer + ret, 0, cdda_bytes - ret);
     Pico_mcd->cdda_stream = NULL;
   }
 
   // now mix
   if (stereo) switch (Pico.snd.cdda_mult) {
-    case 0x10000: mix_16h_to_32(buffer, cdda_out_buffer, length*2);     break;
-    case 0x20000: mix_16h_to_32_s1(buffer, cdda_out_buffer, length*2);  break;
-    case 0x40000: mix_16h_to_32_s2(buffer, cdda_out_buffer, length*2);  break;
-    default: mix_16h_to_32_resample_stereo(buffer, cdda_out_buffer, length, Pico.snd.cdda_mult);
+    case 0x10000: mix_16h_to_32(buffer, cdda_raw_buffer, length*2);     break;
+    case 0x20000: mix_16h_to_32_s1(buffer, cdda_raw_buffer, length*2);  break;
+    case 0x40000: mix_16h_to_32_s2(buffer, cdda_raw_buffer, length*2);  break;
+    default: mix_16h_to_32_resample_stereo(buffer, cdda_raw_buffer, length, Pico.snd.cdda_mult);
   } else
-    mix_16h_to_32_resample_mono(buffer, cdda_out_buffer, length, Pico.snd.cdda_mult);
+    mix_16h_to_32_resample_mono(buffer, cdda_raw_buffer, length, Pico.snd.cdda_mult);
 }
 
 void cdda_start_play(int lba_base, int lba_offset, int lb_len)
@@ -456,11 +542,225 @@ void cdda_start_play(int lba_base, int lba_offset, int lb_len)
 
 void cdda_stop_play(void)
 {
+  // the track files are closed after this
+  cdda_ahead_stop();
+  cdda_ahead_wait();
   if (Pico_mcd->cdda_type == CT_OGG)
     ogg_stop_play();
   Pico_mcd->cdda_stream = NULL;
 }
 
+// decode-ahead for compressed cdda tracks. The decoder open and decode
+// callbacks are run by a worker thread, which keeps a ring of decoded blocks
+// (1152 stereo samples each) filled. Opening and seeking a track thus doesn't
+// block the emulation, and if the decoder doesn't keep up silence is mixed.
+// Requests are tagged with a generation, and the worker discards results of
+// requests which have been superseded while it was busy with them.
+// Without the thread, blocks are decoded on demand to cdda_out_buffer.
+#define CDDA_BLOCKS 8
+
+static int (*cdda_open)(void *f, int pos), (*cdda_decode)(void);
+static void *cdda_file;
+static int cdda_pos;
+static int cdda_threaded, cdda_eof;
+
+#ifdef USE_SND_THREAD
+static s16 cdda_ring[CDDA_BLOCKS][2*1152];
+static unsigned int cdda_rd, cdda_wr; // block counters, cdda_rd is mixed
+static unsigned int cdda_gen; // request generation
+static int cdda_held, cdda_busy;
+
+static pthread_t cthr;
+static pthread_mutex_t cthr_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cthr_cond = PTHREAD_COND_INITIALIZER;
+static enum { CA_NONE, CA_IDLE, CA_OPEN, CA_RUN, CA_EXIT } cthr_state;
+
+static void *cthr_main(void *arg)
+{
+  int (*open)(void *f, int pos), (*decode)(void);
+  unsigned int gen, slot;
+  void *file;
+  int pos, ret;
+
+  pthread_mutex_lock(&cthr_mutex);
+  for (;;) {
+    while (cthr_state == CA_IDLE || (cthr_state == CA_RUN &&
+           (cdda_eof || cdda_wr - cdda_rd >= CDDA_BLOCKS)))
+      pthread_cond_wait(&cthr_cond, &cthr_mutex);
+    if (cthr_state == CA_EXIT)
+      break;
+    // take the request, the mixer may replace it meanwhile
+    open = (cthr_state == CA_OPEN ? cdda_open : NULL);
+    decode = cdda_decode;
+    file = cdda_file, pos = cdda_pos;
+    gen = cdda_gen;
+    slot = cdda_wr % CDDA_BLOCKS;
+    cthr_state = CA_RUN;
+    cdda_busy = 1;
+    pthread_mutex_unlock(&cthr_mutex);
+
+    // the slot at cdda_wr isn't visible to the mixer until cdda_wr is bumped
+    if (open)
+      ret = open(file, pos);
+    else if ((ret = decode()) == 0)
+      memcpy(cdda_ring[slot], cdda_out_buffer, sizeof(cdda_ring[0]));
+
+    pthread_mutex_lock(&cthr_mutex);
+    cdda_busy = 0;
+    if (gen != cdda_gen)
+      ; // superseded, drop the result
+    else if (ret)
+      cdda_eof = 1;
+    else if (!open)
+      cdda_wr++;
+    pthread_cond_broadcast(&cthr_cond);
+  }
+  pthread_mutex_unlock(&cthr_mutex);
+  return NULL;
+}
+
+static int cthr_start(int (*open)(void *f, int pos), int (*decode)(void),
+                      void *file, int pos)
+{
+  if (cthr_state == CA_NONE) {
+    cthr_state = CA_IDLE;
+    if (pthread_create(&cthr, NULL, cthr_main, NULL) != 0) {
+      elprintf(EL_STATUS, "failed to create cdda thread");
+      cthr_state = CA_NONE;
+      return 0;
+    }
+  }
+
+  pthread_mutex_lock(&cthr_mutex);
+  cdda_open = open, cdda_decode = decode;
+  cdda_file = file, cdda_pos = pos;
+  cdda_rd = cdda_wr = cdda_held = cdda_eof = 0;
+  cdda_gen++;
+  cthr_state = CA_OPEN;
+  pthread_cond_broadcast(&cthr_cond);
+  pthread_mutex_unlock(&cthr_mutex);
+  return 1;
+}
+
+static void cthr_stop(void)
+{
+  pthread_mutex_lock(&cthr_mutex);
+  cdda_rd = cdda_wr = cdda_held = 0;
+  cdda_eof = 1;
+  cdda_gen++;
+  cthr_state = CA_IDLE;
+  pthread_mutex_unlock(&cthr_mutex);
+}
+
+static void cthr_wait(void)
+{
+  pthread_mutex_lock(&cthr_mutex);
+  while (cdda_busy)
+    pthread_cond_wait(&cthr_cond, &cthr_mutex);
+  pthread_mutex_unlock(&cthr_mutex);
+}
+
+static s16 *cthr_next(void)
+{
+  s16 *blk = NULL;
+
+  pthread_mutex_lock(&cthr_mutex);
+  // release the block mixed last and take the next one, if there is one
+  cdda_rd += cdda_held;
+  cdda_held = 0;
+  pthread_cond_broadcast(&cthr_cond);
+  if (cdda_wr != cdda_rd) {
+    blk = cdda_ring[cdda_rd % CDDA_BLOCKS];
+    cdda_held = 1;
+  }
+  pthread_mutex_unlock(&cthr_mutex);
+  return blk;
+}
+
+static int cthr_eof(void)
+{
+  int ret;
+
+  pthread_mutex_lock(&cthr_mutex);
+  ret = cdda_eof && cdda_wr == cdda_rd;
+  pthread_mutex_unlock(&cthr_mutex);
+  return ret;
+}
+
+static void cthr_exit(void)
+{
+  if (cthr_state == CA_NONE)
+    return;
+
+  cdda_ahead_stop();
+  pthread_mutex_lock(&cthr_mutex);
+  cthr_state = CA_EXIT;
+  pthread_cond_broadcast(&cthr_cond);
+  pthread_mutex_unlock(&cthr_mutex);
+  pthread_join(cthr, NULL);
+  cthr_state = CA_NONE;
+}
+#else
+static int cthr_start(int (*open)(void *f, int pos), int (*decode)(void),
+                      void *file, int pos) { return 0; }
+static void cthr_stop(void) { }
+static void cthr_wait(void) { }
+static s16 *cthr_next(void) { return NULL; }
+static int cthr_eof(void) { return 1; }
+static void cthr_exit(void) { }
+#endif
+
+// start decoding a track. All decoder state must be set up by open, since
+// a worker may still be busy with a previous track when this returns
+void cdda_ahead_start(int (*open)(void *f, int pos), int (*decode)(void),
+                     void *file, int pos)
+{
+  cdda_ahead_stop();
+
+  if ((PicoIn.opt & POPT_EN_SND_THREAD) &&
+      cthr_start(open, decode, file, pos)) {
+    cdda_threaded = 1;
+    return;
+  }
+  // the thread may have been used for the previous track
+  cthr_wait();
+  cdda_threaded = 0;
+  cdda_open = open, cdda_decode = decode;
+  cdda_eof = (open(file, pos) != 0);
+}
+
+// stop decoding, doesn't wait for a decoder call in progress
+void cdda_ahead_stop(void)
+{
+  if (cdda_threaded)
+    cthr_stop();
+  else
+    cdda_eof = 1;
+}
+
+// wait until the decoder is idle, e.g. before the track files are closed
+void cdda_ahead_wait(void)
+{
+  cthr_wait();
+}
+
+// next decoded block, NULL if there is none (yet, if not cdda_ahead_eof())
+s16 *cdda_ahead_next(void)
+{
+  if (cdda_threaded)
+    return cthr_next();
+
+  if (!cdda_eof && cdda_decode != NULL && cdda_decode() == 0)
+    return cdda_out_buffer;
+  cdda_eof = 1;
+  return NULL;
+}
+
+int cdda_ahead_eof(void)
+{
+  return cdda_threaded ? cthr_eof() : cdda_eof;
+}
+
 
 PICO_INTERNAL void PsndClear(void)
 {
@@ -471,6 +771,12 @@ PICO_INTERNAL void PsndClear(void)
   Pico.snd.dac_pos = Pico.snd.fm_pos = Pico.snd.psg_pos = Pico.snd.ym2413_pos = Pico.snd.pcm_pos = 0;
   if (!PicoIn.sndOut) return;
 
+  // nothing has been written to the output in a silent frame
+  if (PsndSilent()) {
+    memset32(PsndBuffer, 0, PicoIn.opt & POPT_EN_STEREO ? len*2 : len);
+    return;
+  }
+
   if (PicoIn.opt & POPT_EN_STEREO)
     memset32((int *) PicoIn.sndOut, 0, len); // assume PicoIn.sndOut to be aligned
   else {
@@ -492,6 +798,7 @@ static int PsndRender(int offset, int length)
   int daclen = ((Pico.snd.dac_pos+0x80000) >> 20);
   int psglen = ((Pico.snd.psg_pos+0x80000) >> 20);
   int pcmlen = ((Pico.snd.pcm_pos+0x80000) >> 20);
+  int silent = PsndSilent();
 
   buf32 = PsndBuffer+(offset<<stereo);
 
@@ -499,7 +806,7 @@ static int PsndRender(int offset, int length)
 
   // Add in parts of the PSG output not yet done
   if (length-psglen > 0 && PicoIn.sndOut) {
-    s16 *psgbuf = PicoIn.sndOut + (psglen << stereo);
+    s16 *psgbuf = silent ? NULL : PicoIn.sndOut + (psglen << stereo);
     Pico.snd.psg_pos += (length-psglen) << 20;
     if (PicoIn.opt & POPT_EN_PSG)
       SN76496Update(psgbuf, length-psglen, stereo);
@@ -507,17 +814,20 @@ static int PsndRender(int offset, int length)
 
   if (PicoIn.AHW & PAHW_PICO) {
     // always need to render sound for interrupts
-    s16 *buf16 = PicoIn.sndOut ? PicoIn.sndOut + (pcmlen<<stereo) : NULL;
+    s16 *buf16 = PicoIn.sndOut && !silent ? PicoIn.sndOut + (pcmlen<<stereo) : NULL;
     PicoPicoPCMUpdate(buf16, length-pcmlen, stereo);
     return length;
   }
 
   // Fill up DAC output in case of missing samples (Q rounding errors)
-  if (length-daclen > 0 && PicoIn.sndOut) {
+  if (length-daclen > 0 && PicoIn.sndOut && silent) {
+    Pico.snd.dac_pos += (length-daclen) << 20;
+    Pico.snd.dac_val2 = Pico.snd.dac_val;
+  } else if (length-daclen > 0 && PicoIn.sndOut) {
     Pico.snd.dac_pos += (length-daclen) << 20;
     if (PicoIn.opt & POPT_EN_STEREO) {
       s16 *d = PicoIn.sndOut + daclen*2;
-      int pan = ym2612.REGS[YM2612_CH6PAN];
+      int pan = DAC_PAN();
       int l = pan & 0x80 ? Pico.snd.dac_val : 0;
       int r = pan & 0x40 ? Pico.snd.dac_val : 0;
       *d++ += pan & 0x80 ? Pico.snd.dac_val2 : 0;
@@ -535,7 +845,7 @@ static int PsndRender(int offset, int length)
 
   // Add in parts of the FM buffer not yet done
   if (length-fmlen > 0 && PicoIn.sndOut) {
-    s32 *fmbuf = buf32 + ((fmlen-offset) << stereo);
+    s32 *fmbuf = silent ? NULL : buf32 + ((fmlen-offset) << stereo);
     Pico.snd.fm_pos += (length-fmlen) << 20;
     if (PicoIn.opt & POPT_EN_FM)
       PsndFMUpdate(fmbuf, length-fmlen, stereo, 1);
@@ -543,7 +853,7 @@ static int PsndRender(int offset, int length)
 
   // CD: PCM sound
   if (PicoIn.AHW & PAHW_MCD) {
-    pcd_pcm_update(buf32, length-offset, stereo);
+    pcd_pcm_update(silent ? NULL : buf32, length-offset, stereo);
   }
 
   // CD: CDDA audio
@@ -564,7 +874,7 @@ static int PsndRender(int offset, int length)
     p32x_pwm_update(buf32, length-offset, stereo);
 
   // convert + limit to normal 16bit output
-  if (PicoIn.sndOut)
+  if (PicoIn.sndOut && !silent)
     PsndMix_32_to_16(PicoIn.sndOut+(offset<<stereo), buf32, length-offset);
 
   pprof_end(sound);
@@ -576,9 +886,14 @@ PICO_INTERNAL void PsndGetSamples(int y)
 {
   static int curr_pos = 0;
 
+  if (slog_on) {
+    slog_submit(Pico.snd.len_use);
+    return;
+  }
+
   curr_pos  = PsndRender(0, Pico.snd.len_use);
 
-  if (PicoIn.writeSound && PicoIn.sndOut)
+  if (PicoIn.writeSound && PicoIn.sndOut && !PsndSilent())
     PicoIn.writeSound(curr_pos * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2));
   // clear sound buffer
   PsndClear();
@@ -590,6 +905,7 @@ static int PsndRenderMS(int offset, int length)
   int stereo = (PicoIn.opt & 8) >> 3;
   int psglen = ((Pico.snd.psg_pos+0x80000) >> 20);
   int ym2413len = ((Pico.snd.ym2413_pos+0x80000) >> 20);
+  int silent = PsndSilent();
 
   if (!PicoIn.sndOut)
     return length;
@@ -598,7 +914,7 @@ static int PsndRenderMS(int offset, int length)
 
   // Add in parts of the PSG output not yet done
   if (length-psglen > 0) {
-    s16 *psgbuf = PicoIn.sndOut + (psglen << stereo);
+    s16 *psgbuf = silent ? NULL : PicoIn.sndOut + (psglen << stereo);
     Pico.snd.psg_pos += (length-psglen) << 20;
     if (PicoIn.opt & POPT_EN_PSG)
       SN76496Update(psgbuf, length-psglen, stereo);
@@ -608,7 +924,9 @@ static int PsndRenderMS(int offset, int length)
     s16 *ym2413buf = PicoIn.sndOut + (ym2413len << stereo);
     Pico.snd.ym2413_pos += (length-ym2413len) << 20;
     int len = (length-ym2413len);
-    if (Pico.m.hardware & PMS_HW_FMUSED) {
+    if ((Pico.m.hardware & PMS_HW_FMUSED) && silent)
+      PsndFMUpdate(NULL, len, 0, 0);
+    else if (Pico.m.hardware & PMS_HW_FMUSED) {
       PsndFMUpdate(buf32, len, 0, 0);
       if (stereo)
         while (len--) {
@@ -633,9 +951,236 @@ PICO_INTERNAL void PsndGetSamplesMS(int y)
 
   curr_pos  = PsndRenderMS(0, Pico.snd.len_use);
 
-  if (PicoIn.writeSound != NULL && PicoIn.sndOut)
+  if (PicoIn.writeSound != NULL && PicoIn.sndOut && !PsndSilent())
     PicoIn.writeSound(curr_pos * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2));
   PsndClear();
 }
 
+// chip write log. With the sound thread on, the emulation only records chip
+// writes with their z80 cycle stamp. At frame end the log is passed to the
+// thread, which replays it into the chips and renders the frame while the
+// next frame is emulated. Output is passed on with one frame delay.
+// Only the log owner accesses the sound chips and buffers, the emulation
+// waits for the thread before it touches them (PsndSync()). Timers and status
+// are handled on the emulation side, see ym2612_write_local().
+#define SLOG_SIZE 4096
+
+enum { SLOG_FM, SLOG_PSG };
+
+struct slog_entry {
+  u32 cyc;          // z80 cycles in frame
+  u16 addr;
+  u8  chip;
+  u8  data;
+};
+
+static struct slog_entry slog[2][SLOG_SIZE];
+static int slog_cnt[2];
+static int slog_cur;    // log written by the emulation
+static int slog_pend;   // frame rendered by the thread, not yet passed on:
+                        // 1: in PicoIn.sndOut, 2: moved to slog_hold
+static int slog_out;    // output size of that frame in bytes
+static s16 slog_hold[2*(54000+270+100)/50+2];
+static s16 slog_part[2*(54000+270+100)/50+2];
+
+static int psnd_fm_write(int cyc, int addr, int d)
+{
+  if (addr == 0x2a) {
+    if (ym2612.dacen)
+      PsndDoDAC(cyc);
+  } else if (addr != 0x2b)
+    PsndDoFM(cyc);
+  return YM2612WriteReg_(addr, d);
+}
+
+static void slog_replay(int n)
+{
+  struct slog_entry *e = slog[n], *end = e + slog_cnt[n];
+
+  for (; e < end; e++) {
+    if (e->chip == SLOG_PSG) {
+      PsndDoPSG(e->cyc);
+      SN76496Write(e->data);
+    } else
+      psnd_fm_write(e->cyc, e->addr, e->data);
+  }
+  slog_cnt[n] = 0;
+}
+
+static void slog_render(int n, int len)
+{
+  slog_replay(n);
+  PsndRender(0, len);
+}
+
+static void slog_add(int cyc, int chip, int addr, int d)
+{
+  struct slog_entry *e;
+
+  if (slog_cnt[slog_cur] == SLOG_SIZE)
+    PsndSync();
+  e = &slog[slog_cur][slog_cnt[slog_cur]++];
+  e->cyc = cyc;
+  e->addr = addr;
+  e->chip = chip;
+  e->data = d;
+}
+
+#ifdef USE_SND_THREAD
+static pthread_t sthr;
+static pthread_mutex_t sthr_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sthr_cond = PTHREAD_COND_INITIALIZER;
+static enum { ST_NONE, ST_IDLE, ST_BUSY, ST_EXIT } sthr_state;
+static int sthr_log, sthr_len;
+
+static void *sthr_main(void *arg)
+{
+  pthread_mutex_lock(&sthr_mutex);
+  for (;;) {
+    while (sthr_state == ST_IDLE)
+      pthread_cond_wait(&sthr_cond, &sthr_mutex);
+    if (sthr_state == ST_EXIT)
+      break;
+    pthread_mutex_unlock(&sthr_mutex);
+
+    slog_render(sthr_log, sthr_len);
+
+    pthread_mutex_lock(&sthr_mutex);
+    sthr_state = ST_IDLE;
+    pthread_cond_broadcast(&sthr_cond);
+  }
+  pthread_mutex_unlock(&sthr_mutex);
+  return NULL;
+}
+
+static int sthr_start(void)
+{
+  if (sthr_state != ST_NONE)
+    return 1;
+
+  sthr_state = ST_IDLE;
+  if (pthread_create(&sthr, NULL, sthr_main, NULL) != 0) {
+    elprintf(EL_STATUS, "failed to create sound thread");
+    sthr_state = ST_NONE;
+    return 0;
+  }
+  return 1;
+}
+
+static void sthr_wait(void)
+{
+  pthread_mutex_lock(&sthr_mutex);
+  while (sthr_state == ST_BUSY)
+    pthread_cond_wait(&sthr_cond, &sthr_mutex);
+  pthread_mutex_unlock(&sthr_mutex);
+}
+
+static void sthr_post(int n, int len)
+{
+  pthread_mutex_lock(&sthr_mutex);
+  sthr_log = n;
+  sthr_len = len;
+  sthr_state = ST_BUSY;
+  pthread_cond_broadcast(&sthr_cond);
+  pthread_mutex_unlock(&sthr_mutex);
+}
+
+static void sthr_stop(void)
+{
+  if (sthr_state == ST_NONE)
+    return;
+
+  sthr_wait();
+  pthread_mutex_lock(&sthr_mutex);
+  sthr_state = ST_EXIT;
+  pthread_cond_broadcast(&sthr_cond);
+  pthread_mutex_unlock(&sthr_mutex);
+  pthread_join(sthr, NULL);
+  sthr_state = ST_NONE;
+}
+#else
+static int sthr_start(void) { return 0; }
+static void sthr_wait(void) { }
+static void sthr_post(int n, int len) { slog_render(n, len); }
+static void sthr_stop(void) { }
+#endif
+
+// pass the frame rendered by the thread on. Only done at frame end, since
+// writeSound must not be called from outside of PicoFrame
+static void slog_flush_out(void)
+{
+  int part;
+
+  if (slog_pend == 1) {
+    if (slog_out && PicoIn.writeSound)
+      PicoIn.writeSound(slog_out);
+    PsndClear();
+  } else if (slog_pend == 2 && slog_out && PicoIn.writeSound && PicoIn.sndOut) {
+    // the current frame has partly been rendered since, keep it aside
+    part = (Pico.snd.len_use + 1) * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2);
+    memcpy(slog_part, PicoIn.sndOut, part);
+    memcpy(PicoIn.sndOut, slog_hold, slog_out);
+    PicoIn.writeSound(slog_out);
+    memcpy(PicoIn.sndOut, slog_part, part);
+  }
+  slog_pend = 0;
+}
+
+// move the pending output out of the way for rendering the current frame
+static void slog_hold_out(void)
+{
+  if (slog_pend != 1)
+    return;
+
+  if (slog_out && PicoIn.sndOut)
+    memcpy(slog_hold, PicoIn.sndOut, slog_out);
+  PsndClear();
+  slog_pend = 2;
+}
+
+// pass the frame log to the sound thread
+static void slog_submit(int len)
+{
+  sthr_wait();
+  slog_flush_out();
+
+  psnd_silent = PicoIn.skipFrame == 2;
+  slog_out = psnd_silent ? 0 : len * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2);
+  slog_pend = 1;
+  sthr_post(slog_cur, len);
+  slog_cur ^= 1;
+}
+
+// wait for the sound thread and bring the chips up to date with the emulation
+void PsndSync(void)
+{
+  if (!slog_on)
+    return;
+
+  sthr_wait();
+  slog_hold_out();
+
+  psnd_silent = PicoIn.skipFrame == 2;
+  slog_replay(slog_cur);
+}
+
+PICO_INTERNAL int PsndWriteFM(int cyc, int addr, int d)
+{
+  if (slog_on) {
+    slog_add(cyc, SLOG_FM, addr, d);
+    return 0;
+  }
+  return psnd_fm_write(cyc, addr, d);
+}
+
+PICO_INTERNAL void PsndWritePSG(int cyc, int d)
+{
+  if (slog_on) {
+    slog_add(cyc, SLOG_PSG, 0, d);
+    return;
+  }
+  PsndDoPSG(cyc);
+  SN76496Write(d);
+}
+
 // vim:shiftwidth=2:ts=2:expandtab
@@ -184,18 +184,9 @@ void memset32(void *dest, int c, int count);
 */
 //#define TL_TAB_LEN (13*2*TL_RES_LEN)
 #define TL_TAB_LEN (13*TL_RES_LEN*256/8) // 106496*2
-UINT16 ym_tl_tab[TL_TAB_LEN];
-
-/* ~3K wasted but oh well */
-UINT16 ym_tl_tab2[13*TL_RES_LEN];
 
 #define ENV_QUIET		(2*13*TL_RES_LEN/8)
 
-/* sin waveform table in 'decibel' scale (use only period/4 values) */
-static UINT16 ym_sin_tab[256];
-
-static int ym_init_tab;
-
 /* sustain level table (3dB per step) */
 /* bit0, bit1, bit2, bit3, bit4, bit5, bit6 */
 /* 1,    2,    4,    8,    16,   32,   64   (value)*/
@@ -425,11 +416,11 @@ static const UINT8 lfo_ams_depth_shift[4] = {8, 3, 1, 0};
   Modulation level at each depth depends on F-NUMBER bits: 4,5,6,7,8,9,10
   (bits 8,9,10 = FNUM MSB from OCT/FNUM register)
 
-  Here we store only first quarter (positive one) of full waveform.
-  Full table (lfo_pm_table) containing all 128 waveforms is build
-  at run (init) time.
+  Only the first quarter (positive one) of full waveform is specified,
+  in the lfo_pm_output table in tools/make_tables_c.c. Full table
+  (lfo_pm_table) containing all 128 waveforms is generated from it.
 
-  One value in table below represents 4 (four) basic LFO steps
+  One value in lfo_pm_output represents 4 (four) basic LFO steps
   (1 PM step = 4 AM steps).
 
   For example:
@@ -437,83 +428,10 @@ static const UINT8 lfo_ams_depth_shift[4] = {8, 3, 1, 0};
    one value from "lfo_pm_output" table lasts for 432 consecutive
    samples (4*108=432) and one full LFO waveform cycle lasts for 13824
    samples (32*432=13824; 32 because we store only a quarter of whole
-            waveform in the table below)
+            waveform in lfo_pm_output)
 */
-static const UINT8 lfo_pm_output[7*8][8]={ /* 7 bits meaningful (of F-NUMBER), 8 LFO output levels per one depth (out of 32), 8 LFO depths */
-/* FNUM BIT 4: 000 0001xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 6 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 7 */ {0,   0,   0,   0,   1,   1,   1,   1},
-
-/* FNUM BIT 5: 000 0010xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 6 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 7 */ {0,   0,   1,   1,   2,   2,   2,   3},
-
-/* FNUM BIT 6: 000 0100xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   1},
-/* DEPTH 5 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 6 */ {0,   0,   1,   1,   2,   2,   2,   3},
-/* DEPTH 7 */ {0,   0,   2,   3,   4,   4,   5,   6},
-
-/* FNUM BIT 7: 000 1000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   1,   1},
-/* DEPTH 3 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 4 */ {0,   0,   0,   1,   1,   1,   1,   2},
-/* DEPTH 5 */ {0,   0,   1,   1,   2,   2,   2,   3},
-/* DEPTH 6 */ {0,   0,   2,   3,   4,   4,   5,   6},
-/* DEPTH 7 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
-
-/* FNUM BIT 8: 001 0000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 2 */ {0,   0,   0,   1,   1,   1,   2,   2},
-/* DEPTH 3 */ {0,   0,   1,   1,   2,   2,   3,   3},
-/* DEPTH 4 */ {0,   0,   1,   2,   2,   2,   3,   4},
-/* DEPTH 5 */ {0,   0,   2,   3,   4,   4,   5,   6},
-/* DEPTH 6 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
-/* DEPTH 7 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
-
-/* FNUM BIT 9: 010 0000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   2,   2,   2,   2},
-/* DEPTH 2 */ {0,   0,   0,   2,   2,   2,   4,   4},
-/* DEPTH 3 */ {0,   0,   2,   2,   4,   4,   6,   6},
-/* DEPTH 4 */ {0,   0,   2,   4,   4,   4,   6,   8},
-/* DEPTH 5 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
-/* DEPTH 6 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
-/* DEPTH 7 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
-
-/* FNUM BIT10: 100 0000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   4,   4,   4,   4},
-/* DEPTH 2 */ {0,   0,   0,   4,   4,   4,   8,   8},
-/* DEPTH 3 */ {0,   0,   4,   4,   8,   8, 0xc, 0xc},
-/* DEPTH 4 */ {0,   0,   4,   8,   8,   8, 0xc,0x10},
-/* DEPTH 5 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
-/* DEPTH 6 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
-/* DEPTH 7 */ {0,   0,0x20,0x30,0x40,0x40,0x50,0x60},
-
-};
-
-/* all 128 LFO PM waveforms */
-static INT32 lfo_pm_table[128*8*32]; /* 128 combinations of 7 bits meaningful (of F-NUMBER), 8 LFO depths, 32 LFO output levels per one depth */
+/* ym_tl_tab, lfo_pm_table */
+#include "ym2612_tab.c"
 
 /* register number to channel number , slot offset */
 #define OPN_CHAN(N) (N&3)
@@ -526,11 +444,19 @@ static INT32 lfo_pm_table[128*8*32]; /* 128 combinations of 7 bits meaningful (o
 #define SLOT4 3
 
 
+/* OPN Mode Register Write, synth part */
+static INLINE void set_mode( int v )
+{
+	if ((ym2612.OPN.ST.fm_mode ^ v) & 0xc0)
+		ym2612.CH[2].SLOT[SLOT1].Incr = -1;
+
+	ym2612.OPN.ST.fm_mode = v & 0xc0;
+}
+
 /* OPN Mode Register Write */
 static INLINE void set_timers( int v )
 {
-	if ((ym2612.OPN.ST.mode ^ v) & 0xc0)
-		ym2612.CH[2].SLOT[SLOT1].Incr = -1;
+	set_mode( v );
 
 	/* b7 = CSM MODE */
 	/* b6 = 3 slot mode */
@@ -726,7 +652,6 @@ static INLINE signed int op_calc1(UINT32 phase, unsigned int env, signed int pm)
 	return neg ? -ret : ret;
 }
 
-#if !defined(_ASM_YM2612_C) || defined(EXTERNAL_YM2612)
 /* advance LFO to next sample */
 static INLINE int advance_lfo(int lfo_ampm, UINT32 lfo_cnt_old, UINT32 lfo_cnt)
 {
@@ -766,6 +691,7 @@ static INLINE int advance_lfo(int lfo_ampm, UINT32 lfo_cnt_old, UINT32 lfo_cnt)
 	return lfo_ampm;
 }
 
+#if !defined(_ASM_YM2612_C) || defined(EXTERNAL_YM2612)
 static INLINE void update_eg_phase(FM_SLOT *SLOT, UINT32 eg_cnt, UINT32 ssg_en)
 {
 	INT32 volume = SLOT->volume;
@@ -1161,6 +1087,8 @@ static void chan_render_loop(chan_rend_context *ct, s32 *buffer, int length)
 		ct->vol_out4 =  ct->CH->SLOT[SLOT4].vol_out;
 
 		if (ct->pack & 4) goto disabled; /* output disabled */
+		/* no output, but op1 depends on all its previous outputs if it has feedback */
+		if (!buffer && !(ct->pack & 0xf000)) goto disabled;
 
 		if (ct->pack & 8) { /* LFO enabled ? (test Earthworm Jim in between demo 1 and 2) */
 			ct->pack = (ct->pack&0xffff) | (advance_lfo(ct->pack >> 16, ct->lfo_cnt, ct->lfo_cnt + ct->lfo_inc) << 16);
@@ -1182,6 +1110,7 @@ static void chan_render_loop(chan_rend_context *ct, s32 *buffer, int length)
 		} else {
 			ct->op1_out <<= 16; /* op1_out0 = op1_out1; op1_out1 = 0; */
 		}
+		if (!buffer) goto disabled;
 
 		eg_out  = ct->vol_out3; // volume_calc(&CH->SLOT[SLOT3]);
 		eg_out2 = ct->vol_out2; // volume_calc(&CH->SLOT[SLOT2]);
@@ -1316,7 +1245,7 @@ static int chan_render(s32 *buffer, int length, int c, UINT32 flags) // flags: s
 
 	if (crct.CH->pms) {
 		UINT32 block_fnum = crct.CH->block_fnum, kcode = crct.CH->kcode;
-		if ((ym2612.OPN.ST.mode & 0xC0) && c == 2) {
+		if ((ym2612.OPN.ST.fm_mode & 0xC0) && c == 2) {
 			/* 3 slot mode */
 			const FM_3SLOT *SL3 = &ym2612.OPN.SL3;
 			crct.incr1 = update_lfo_phase(&crct.CH->SLOT[SLOT1], freqbase, SL3->block_fnum[1], SL3->kcode[1]);
@@ -1436,6 +1365,7 @@ static void reset_channels(FM_CH *CH)
 	int c,s;
 
 	ym2612.OPN.ST.mode   = 0;	/* normal mode */
+	ym2612.OPN.ST.fm_mode = 0;
 	ym2612.OPN.ST.TA     = 0;
 	//ym2612.OPN.ST.TAC    = 0;
 	ym2612.OPN.ST.TB     = 0;
@@ -1457,114 +1387,6 @@ static void reset_channels(FM_CH *CH)
 	ym2612.ssg_mask = 0;
 }
 
-/* initialize generic tables */
-static void init_tables(void)
-{
-	signed int i,x,y,p;
-	signed int n;
-	double o,m;
-
-	if (ym_init_tab) return;
-	ym_init_tab = 1;
-
-	for (i=0; i < 256; i++)
-	{
-		/* non-standard sinus */
-		m = sin( ((i*2)+1) * M_PI / SIN_LEN ); /* checked against the real chip */
-
-		/* we never reach zero here due to ((i*2)+1) */
-
-		if (m>0.0)
-			o = 8*log(1.0/m)/log(2);	/* convert to 'decibels' */
-		else
-			o = 8*log(-1.0/m)/log(2);	/* convert to 'decibels' */
-
-		o = o / (ENV_STEP/4);
-
-		n = (int)(2.0*o);
-		if (n&1)						/* round to nearest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-
-		ym_sin_tab[ i ] = n;
-		//dprintf("FM.C: sin [%4i]= %4i", i, ym_sin_tab[i]);
-	}
-
-	//dprintf("FM.C: ENV_QUIET= %08x", ENV_QUIET );
-
-
-	for (x=0; x < TL_RES_LEN; x++)
-	{
-		m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
-		m = floor(m);
-
-		/* we never reach (1<<16) here due to the (x+1) */
-		/* result fits within 16 bits at maximum */
-
-		n = (int)m;		/* 16 bits here */
-		n >>= 4;		/* 12 bits here */
-		if (n&1)		/* round to nearest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-						/* 11 bits here (rounded) */
-		n <<= 2;		/* 13 bits here (as in real chip) */
-		ym_tl_tab2[ x ] = n;
-
-		for (i=1; i < 13; i++)
-		{
-			ym_tl_tab2[ x + i*TL_RES_LEN ] = n >> i;
-		}
-	}
-
-	for (x=0; x < 256; x++)
-	{
-		int sin = ym_sin_tab[ x ];
-
-		for (y=0; y < 2*13*TL_RES_LEN/8; y+=2)
-		{
-			p = (y<<2) + sin;
-			if (p >= 13*TL_RES_LEN)
-				 ym_tl_tab[(y<<7) | x] = 0;
-			else ym_tl_tab[(y<<7) | x] = ym_tl_tab2[p];
-		}
-	}
-
-
-	/* build LFO PM modulation table */
-	for(i = 0; i < 8; i++) /* 8 PM depths */
-	{
-		UINT8 fnum;
-		for (fnum=0; fnum<128; fnum++) /* 7 bits meaningful of F-NUMBER */
-		{
-			UINT8 value;
-			UINT8 step;
-			UINT32 offset_depth = i;
-			UINT32 offset_fnum_bit;
-			UINT32 bit_tmp;
-
-			for (step=0; step<8; step++)
-			{
-				value = 0;
-				for (bit_tmp=0; bit_tmp<7; bit_tmp++) /* 7 bits */
-				{
-					if (fnum & (1<<bit_tmp)) /* only if bit "bit_tmp" is set */
-					{
-						offset_fnum_bit = bit_tmp * 8;
-						value += lfo_pm_output[offset_fnum_bit + offset_depth][step];
-					}
-				}
-				lfo_pm_table[(fnum*32*8) + (i*32) + step   + 0] = value;
-				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+ 8] = value;
-				lfo_pm_table[(fnum*32*8) + (i*32) + step   +16] = -value;
-				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+24] = -value;
-			}
-		}
-	}
-}
-
-
 /* CSM Key Controll */
 #if 0
 INLINE void CSMKeyControll(FM_CH *CH)
@@ -1739,8 +1561,7 @@ static int OPNWriteReg(int r, int v)
 /*      YM2612 local section                                                   */
 /*******************************************************************************/
 
-/* Generate samples for YM2612 */
-int YM2612UpdateOne_(s32 *buffer, int length, int stereo, int is_buf_empty)
+static int ym2612_update(s32 *buffer, int length, int stereo, int is_buf_empty)
 {
 	UINT32 freqbase = ym2612.OPN.ST.freqbase_ui;
 	int pan;
@@ -1748,7 +1569,11 @@ int YM2612UpdateOne_(s32 *buffer, int length, int stereo, int is_buf_empty)
 	int flags = stereo ? 1:0;
 
 	// if !is_buf_empty, it means it has valid samples to mix with, else it may contain trash
-	if (is_buf_empty) memset32(buffer, 0, length<<stereo);
+	// no buffer: only advance the chip state (e.g. for skipped frames)
+#if defined(_ASM_YM2612_C) && !defined(EXTERNAL_YM2612)
+	if (!buffer) flags |= 4; // the asm loop has no mode for this, render disabled
+#endif
+	if (buffer && is_buf_empty) memset32(buffer, 0, length<<stereo);
 
 /*
 	{
@@ -1771,7 +1596,7 @@ int YM2612UpdateOne_(s32 *buffer, int length, int stereo, int is_buf_empty)
 	/* refresh PG and EG */
 	refresh_fc_eg_chan(&ym2612.CH[0], freqbase);
 	refresh_fc_eg_chan(&ym2612.CH[1], freqbase);
-	if( (ym2612.OPN.ST.mode & 0xc0) )
+	if( (ym2612.OPN.ST.fm_mode & 0xc0) )
 		/* 3SLOT MODE */
 		refresh_fc_eg_chan_sl3(&ym2612.CH[2], &ym2612.OPN.SL3, freqbase);
 	else
@@ -1800,17 +1625,37 @@ int YM2612UpdateOne_(s32 *buffer, int length, int stereo, int is_buf_empty)
 	BIT_IF(flags, 1, (ym2612.ssg_mask & 0xf00000) && (ym2612.OPN.ST.flags & 1));
 	if (ym2612.slot_mask & 0xf00000) active_chs |= chan_render(buffer, length, 5, flags|((pan&0xc00)>>6)|(!!ym2612.dacen<<2)) << 5;
 #undef	BIT_IF
+	if (!buffer && crct.lfo_inc) // channels without output don't advance the LFO
+		ym2612.OPN.lfo_ampm = advance_lfo(crct.lfo_init_sft16 >> 16,
+			ym2612.OPN.lfo_cnt, ym2612.OPN.lfo_cnt + crct.lfo_inc*length);
 	chan_render_finish(buffer, length, active_chs);
 
 	return active_chs; // 1 if buffer updated
 }
 
+/* Generate samples for YM2612 */
+int YM2612UpdateOne_(s32 *buffer, int length, int stereo, int is_buf_empty)
+{
+	s32 tail[2*2];
+	int active_chs = 0;
+
+	if (buffer)
+		return ym2612_update(buffer, length, stereo, is_buf_empty);
+
+	// no buffer: the last 2 samples are rendered nonetheless, so that op1_out
+	// and the delay memory are exact when output is resumed
+	if (length > 2)
+		active_chs = ym2612_update(NULL, length-2, stereo, 1);
+	if (length > 0)
+		active_chs |= ym2612_update(tail, length < 2 ? length : 2, stereo, 1);
+	return active_chs;
+}
+
 
 /* initialize YM2612 emulator */
 void YM2612Init_(int clock, int rate, int flags)
 {
 	memset(&ym2612, 0, sizeof(ym2612));
-	init_tables();
 
 	ym2612.OPN.ST.clock = clock;
 	ym2612.OPN.ST.rate = rate;
@@ -1861,6 +1706,103 @@ void YM2612ResetChip_(void)
 }
 
 
+/* YM2612 register write, without address latch and timer handling */
+/* addr = register (9 bits) */
+/* v = value   */
+/* returns 1 if sample affecting state changed */
+int YM2612WriteReg_(unsigned int addr, unsigned int v)
+{
+	int ret=1;
+
+	v &= 0xff;	/* adjust to 8 bit bus */
+
+	switch( addr & 0x1f0 )
+	{
+	case 0x20:	/* 0x20-0x2f Mode */
+		switch( addr )
+		{
+		case 0x22:	/* LFO FREQ (YM2608/YM2610/YM2610B/YM2612) */
+			if (v&0x08) /* LFO enabled ? */
+			{
+				ym2612.OPN.lfo_inc = ym2612.OPN.lfo_freq[v&7];
+			}
+			else
+			{
+				ym2612.OPN.lfo_inc = 0;
+				ym2612.OPN.lfo_cnt = 0;
+				ym2612.OPN.lfo_ampm = 126 << 8;
+			}
+			break;
+#if 0 // handled elsewhere
+		case 0x24: { // timer A High 8
+				int TAnew = (ym2612.OPN.ST.TA & 0x03)|(((int)v)<<2);
+				if(ym2612.OPN.ST.TA != TAnew) {
+					// we should reset ticker only if new value is written. Outrun requires this.
+					ym2612.OPN.ST.TA = TAnew;
+					ym2612.OPN.ST.TAC = (1024-TAnew)*18;
+					ym2612.OPN.ST.TAT = 0;
+				}
+			}
+			ret=0;
+			break;
+		case 0x25: { // timer A Low 2
+				int TAnew = (ym2612.OPN.ST.TA & 0x3fc)|(v&3);
+				if(ym2612.OPN.ST.TA != TAnew) {
+					ym2612.OPN.ST.TA = TAnew;
+					ym2612.OPN.ST.TAC = (1024-TAnew)*18;
+					ym2612.OPN.ST.TAT = 0;
+				}
+			}
+			ret=0;
+			break;
+		case 0x26: // timer B
+			if(ym2612.OPN.ST.TB != v) {
+				ym2612.OPN.ST.TB = v;
+				ym2612.OPN.ST.TBC  = (256-v)<<4;
+				ym2612.OPN.ST.TBC *= 18;
+				ym2612.OPN.ST.TBT  = 0;
+			}
+			ret=0;
+			break;
+#endif
+		case 0x27:	/* mode, CSM/3 slot part only */
+			set_mode( v );
+			ret=0;
+			break;
+		case 0x28:	/* key on / off */
+			{
+				UINT8 c;
+
+				c = v & 0x03;
+				if( c == 3 ) { ret=0; break; }
+				if( v&0x04 ) c+=3;
+				if(v&0x10) FM_KEYON(c,SLOT1); else FM_KEYOFF(c,SLOT1);
+				if(v&0x20) FM_KEYON(c,SLOT2); else FM_KEYOFF(c,SLOT2);
+				if(v&0x40) FM_KEYON(c,SLOT3); else FM_KEYOFF(c,SLOT3);
+				if(v&0x80) FM_KEYON(c,SLOT4); else FM_KEYOFF(c,SLOT4);
+				break;
+			}
+		case 0x2a:	/* DAC data (YM2612) */
+			ym2612.dacout = ((int)v - 0x80) << DAC_SHIFT;
+			ret=0;
+			break;
+		case 0x2b:	/* DAC Sel  (YM2612) */
+			/* b7 = dac enable */
+			ym2612.dacen = v & 0x80;
+			ret=0;
+			break;
+		default:
+			break;
+		}
+		break;
+	default:	/* 0x30-0xff OPN section */
+		/* write register */
+		ret = OPNWriteReg(addr,v);
+	}
+
+	return ret;
+}
+
 /* YM2612 write */
 /* a = address */
 /* v = value   */
@@ -1884,89 +1826,11 @@ int YM2612Write_(unsigned int a, unsigned int v)
 	case 3:	/* data port */
 		addr = ym2612.OPN.ST.address | ((int)ym2612.addr_A1 << 8);
 
-		switch( addr & 0x1f0 )
-		{
-		case 0x20:	/* 0x20-0x2f Mode */
-			switch( addr )
-			{
-			case 0x22:	/* LFO FREQ (YM2608/YM2610/YM2610B/YM2612) */
-				if (v&0x08) /* LFO enabled ? */
-				{
-					ym2612.OPN.lfo_inc = ym2612.OPN.lfo_freq[v&7];
-				}
-				else
-				{
-					ym2612.OPN.lfo_inc = 0;
-					ym2612.OPN.lfo_cnt = 0;
-					ym2612.OPN.lfo_ampm = 126 << 8;
-				}
-				break;
-#if 0 // handled elsewhere
-			case 0x24: { // timer A High 8
-					int TAnew = (ym2612.OPN.ST.TA & 0x03)|(((int)v)<<2);
-					if(ym2612.OPN.ST.TA != TAnew) {
-						// we should reset ticker only if new value is written. Outrun requires this.
-						ym2612.OPN.ST.TA = TAnew;
-						ym2612.OPN.ST.TAC = (1024-TAnew)*18;
-						ym2612.OPN.ST.TAT = 0;
-					}
-				}
-				ret=0;
-				break;
-			case 0x25: { // timer A Low 2
-					int TAnew = (ym2612.OPN.ST.TA & 0x3fc)|(v&3);
-					if(ym2612.OPN.ST.TA != TAnew) {
-						ym2612.OPN.ST.TA = TAnew;
-						ym2612.OPN.ST.TAC = (1024-TAnew)*18;
-						ym2612.OPN.ST.TAT = 0;
-					}
-				}
-				ret=0;
-				break;
-			case 0x26: // timer B
-				if(ym2612.OPN.ST.TB != v) {
-					ym2612.OPN.ST.TB = v;
-					ym2612.OPN.ST.TBC  = (256-v)<<4;
-					ym2612.OPN.ST.TBC *= 18;
-					ym2612.OPN.ST.TBT  = 0;
-				}
-				ret=0;
-				break;
-#endif
-			case 0x27:	/* mode, timer control */
-				set_timers( v );
-				ret=0;
-				break;
-			case 0x28:	/* key on / off */
-				{
-					UINT8 c;
-
-					c = v & 0x03;
-					if( c == 3 ) { ret=0; break; }
-					if( v&0x04 ) c+=3;
-					if(v&0x10) FM_KEYON(c,SLOT1); else FM_KEYOFF(c,SLOT1);
-					if(v&0x20) FM_KEYON(c,SLOT2); else FM_KEYOFF(c,SLOT2);
-					if(v&0x40) FM_KEYON(c,SLOT3); else FM_KEYOFF(c,SLOT3);
-					if(v&0x80) FM_KEYON(c,SLOT4); else FM_KEYOFF(c,SLOT4);
-					break;
-				}
-			case 0x2a:	/* DAC data (YM2612) */
-				ym2612.dacout = ((int)v - 0x80) << DAC_SHIFT;
-				ret=0;
-				break;
-			case 0x2b:	/* DAC Sel  (YM2612) */
-				/* b7 = dac enable */
-				ym2612.dacen = v & 0x80;
-				ret=0;
-				break;
-			default:
-				break;
-			}
-			break;
-		default:	/* 0x30-0xff OPN section */
-			/* write register */
-			ret = OPNWriteReg(addr,v);
-		}
+		if (addr == 0x27) {	/* mode, timer control */
+			set_timers( v );
+			ret = 0;
+		} else
+			ret = YM2612WriteReg_(addr, v);
 		break;
 	}
 
@@ -2407,6 +2271,7 @@ void YM2612PicoStateLoad3(const void *buf_, size_t size)
 	ym2612.OPN.ST.address = load_u8_(buf, &b);
 	ym2612.OPN.ST.status  = load_u8_(buf, &b);
 	ym2612.OPN.ST.mode    = load_u8_(buf, &b);
+	ym2612.OPN.ST.fm_mode = ym2612.OPN.ST.mode & 0xc0;
 	/*ym2612.OPN.ST.flags*/ load_u8_(buf, &b); // comes from UI options
 	ym2612.OPN.ST.fn_h    = load_u8_(buf, &b);
 	ym2612.OPN.SL3.fn_h   = load_u8_(buf, &b);
@@ -110,7 +110,7 @@ typedef struct
 	UINT8	TB;			/* timer b              */
 	UINT8   fn_h;		/* freq latch           */
 	UINT8	status_latch;	/* status latch by last read */
-	UINT8	pad2[1];
+	UINT8	fm_mode;	/* CSM / 3SLOT bits as seen by the synth */
 	//int		TBC;		/* timer b maxval       */
 	//int		TBT;		/* timer b ticker | need_save */
 } FM_ST;
@@ -177,6 +177,7 @@ void YM2612ResetChip_(void);
 int  YM2612UpdateOne_(s32 *buffer, int length, int stereo, int is_buf_empty);
 
 int  YM2612Write_(unsigned int a, unsigned int v);
+int  YM2612WriteReg_(unsigned int addr, unsigned int v);
 //unsigned char YM2612Read_(void);
 
 int  YM2612PicoTick_(int n);
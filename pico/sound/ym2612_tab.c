@@ -0,0 +1,4361 @@
+/* generated by tools/make_tables_c, do not modify */
+/* TL table in 'decibel' scale, indexed by sin | (env<<7) */
+const UINT16 ym_tl_tab[TL_TAB_LEN] = {
+	25, 75, 125, 175, 225, 275, 325, 376, 426, 476, 526, 577, 625, 676, 726, 777, 827, 875, 926, 975, 1024, 1075, 1126, 1172, 1224, 1272, 1324, 1372, 1421, 1472, 1520, 1571,
+	1618, 1667, 1717, 1765, 1813, 1863, 1914, 1961, 2010, 2060, 2104, 2156, 2204, 2252, 2300, 2344, 2396, 2442, 2488, 2536, 2584, 2634, 2684, 2728, 2774, 2826, 2872, 2920, 2960, 3008, 3058, 3100,
+	3150, 3192, 3246, 3290, 3334, 3380, 3426, 3472, 3520, 3558, 3606, 3656, 3696, 3736, 3786, 3828, 3870, 3922, 3966, 4008, 4052, 4096, 4140, 4176, 4220, 4264, 4312, 4348, 4396, 4432, 4480, 4516,
+	4564, 4600, 4640, 4688, 4728, 4768, 4804, 4844, 4884, 4924, 4964, 5004, 5044, 5088, 5128, 5168, 5200, 5240, 5284, 5312, 5356, 5400, 5428, 5472, 5504, 5548, 5576, 5624, 5652, 5684, 5732, 5760,
+	5792, 5824, 5872, 5904, 5936, 5968, 6000, 6032, 6064, 6100, 6132, 6164, 6200, 6232, 6264, 6300, 6336, 6368, 6384, 6420, 6456, 6492, 6524, 6544, 6580, 6616, 6632, 6668, 6688, 6724, 6760, 6776,
+	6816, 6832, 6868, 6888, 6908, 6944, 6964, 7000, 7020, 7040, 7076, 7096, 7116, 7156, 7176, 7192, 7212, 7232, 7272, 7292, 7312, 7332, 7352, 7372, 7392, 7412, 7432, 7452, 7472, 7492, 7512, 7532,
+	7552, 7572, 7592, 7616, 7636, 7656, 7676, 7676, 7696, 7720, 7740, 7740, 7760, 7780, 7804, 7804, 7824, 7844, 7844, 7864, 7888, 7888, 7908, 7908, 7932, 7952, 7952, 7972, 7972, 7996, 7996, 8016,
+	8016, 8016, 8040, 8040, 8060, 8060, 8060, 8080, 8080, 8080, 8104, 8104, 8104, 8124, 8124, 8124, 8124, 8148, 8148, 8148, 8148, 8148, 8148, 8148, 8168, 8168, 8168, 8168, 8168, 8168, 8168, 8168,
+	24, 73, 122, 171, 220, 269, 318, 368, 416, 465, 515, 564, 612, 662, 710, 760, 809, 856, 906, 954, 1002, 1052, 1102, 1147, 1198, 1244, 1296, 1342, 1391, 1440, 1488, 1537,
+	1584, 1631, 1681, 1727, 1774, 1823, 1873, 1919, 1966, 2015, 2060, 2110, 2156, 2204, 2252, 2294, 2344, 2390, 2436, 2482, 2530, 2578, 2628, 2670, 2714, 2766, 2812, 2858, 2896, 2944, 2992, 3032,
+	3082, 3124, 3176, 3218, 3262, 3308, 3352, 3398, 3444, 3482, 3530, 3578, 3616, 3656, 3706, 3746, 3786, 3838, 3880, 3922, 3966, 4008, 4052, 4084, 4128, 4176, 4220, 4256, 4300, 4336, 4384, 4420,
+	4468, 4504, 4540, 4588, 4628, 4664, 4704, 4740, 4780, 4820, 4856, 4896, 4936, 4976, 5020, 5060, 5088, 5128, 5168, 5200, 5240, 5284, 5312, 5356, 5384, 5428, 5456, 5504, 5532, 5564, 5608, 5636,
+	5668, 5700, 5744, 5776, 5808, 5840, 5872, 5904, 5936, 5968, 6000, 6032, 6064, 6100, 6132, 6164, 6200, 6232, 6248, 6284, 6316, 6352, 6384, 6404, 6436, 6472, 6492, 6524, 6544, 6580, 6616, 6632,
+	6668, 6688, 6724, 6740, 6760, 6796, 6816, 6852, 6868, 6888, 6928, 6944, 6964, 7000, 7020, 7040, 7060, 7076, 7116, 7136, 7156, 7176, 7192, 7212, 7232, 7252, 7272, 7292, 7312, 7332, 7352, 7372,
+	7392, 7412, 7432, 7452, 7472, 7492, 7512, 7512, 7532, 7552, 7572, 7572, 7592, 7616, 7636, 7636, 7656, 7676, 7676, 7696, 7720, 7720, 7740, 7740, 7760, 7780, 7780, 7804, 7804, 7824, 7824, 7844,
+	7844, 7844, 7864, 7864, 7888, 7888, 7888, 7908, 7908, 7908, 7932, 7932, 7932, 7952, 7952, 7952, 7952, 7972, 7972, 7972, 7972, 7972, 7972, 7972, 7996, 7996, 7996, 7996, 7996, 7996, 7996, 7996,
+	24, 72, 119, 167, 215, 263, 312, 360, 407, 455, 503, 552, 599, 648, 695, 744, 792, 838, 887, 934, 980, 1030, 1078, 1123, 1172, 1218, 1268, 1314, 1361, 1409, 1456, 1504,
+	1550, 1596, 1645, 1690, 1736, 1784, 1833, 1878, 1924, 1972, 2015, 2064, 2110, 2156, 2204, 2246, 2294, 2338, 2384, 2428, 2476, 2522, 2572, 2614, 2656, 2706, 2752, 2796, 2834, 2880, 2928, 2968,
+	3016, 3058, 3108, 3150, 3192, 3236, 3280, 3326, 3370, 3408, 3454, 3500, 3538, 3578, 3626, 3666, 3706, 3756, 3796, 3838, 3880, 3922, 3966, 3998, 4040, 4084, 4128, 4164, 4208, 4244, 4288, 4324,
+	4372, 4408, 4444, 4492, 4528, 4564, 4600, 4640, 4676, 4716, 4752, 4792, 4832, 4872, 4912, 4952, 4976, 5020, 5060, 5088, 5128, 5168, 5200, 5240, 5268, 5312, 5340, 5384, 5412, 5444, 5488, 5516,
+	5548, 5576, 5624, 5652, 5684, 5716, 5744, 5776, 5808, 5840, 5872, 5904, 5936, 5968, 6000, 6032, 6064, 6100, 6116, 6148, 6180, 6216, 6248, 6264, 6300, 6336, 6352, 6384, 6404, 6436, 6472, 6492,
+	6524, 6544, 6580, 6596, 6616, 6652, 6668, 6704, 6724, 6740, 6776, 6796, 6816, 6852, 6868, 6888, 6908, 6928, 6964, 6984, 7000, 7020, 7040, 7060, 7076, 7096, 7116, 7136, 7156, 7176, 7192, 7212,
+	7232, 7252, 7272, 7292, 7312, 7332, 7352, 7352, 7372, 7392, 7412, 7412, 7432, 7452, 7472, 7472, 7492, 7512, 7512, 7532, 7552, 7552, 7572, 7572, 7592, 7616, 7616, 7636, 7636, 7656, 7656, 7676,
+	7676, 7676, 7696, 7696, 7720, 7720, 7720, 7740, 7740, 7740, 7760, 7760, 7760, 7780, 7780, 7780, 7780, 7804, 7804, 7804, 7804, 7804, 7804, 7804, 7824, 7824, 7824, 7824, 7824, 7824, 7824, 7824,
+	23, 70, 117, 164, 211, 258, 305, 352, 399, 446, 493, 540, 586, 634, 680, 728, 775, 820, 868, 914, 959, 1007, 1055, 1099, 1147, 1192, 1241, 1286, 1332, 1379, 1425, 1472,
+	1516, 1562, 1609, 1654, 1699, 1746, 1794, 1838, 1883, 1930, 1972, 2020, 2064, 2110, 2156, 2198, 2246, 2288, 2332, 2376, 2422, 2468, 2516, 2558, 2600, 2648, 2692, 2736, 2774, 2818, 2866, 2904,
+	2952, 2992, 3040, 3082, 3124, 3168, 3210, 3254, 3298, 3334, 3380, 3426, 3464, 3500, 3548, 3588, 3626, 3676, 3716, 3756, 3796, 3838, 3880, 3912, 3954, 3998, 4040, 4074, 4120, 4152, 4196, 4232,
+	4276, 4312, 4348, 4396, 4432, 4468, 4504, 4540, 4576, 4616, 4652, 4688, 4728, 4768, 4804, 4844, 4872, 4912, 4952, 4976, 5020, 5060, 5088, 5128, 5156, 5200, 5228, 5268, 5296, 5328, 5368, 5400,
+	5428, 5456, 5504, 5532, 5564, 5592, 5624, 5652, 5684, 5716, 5744, 5776, 5808, 5840, 5872, 5904, 5936, 5968, 5984, 6016, 6048, 6080, 6116, 6132, 6164, 6200, 6216, 6248, 6264, 6300, 6336, 6352,
+	6384, 6404, 6436, 6456, 6472, 6508, 6524, 6560, 6580, 6596, 6632, 6652, 6668, 6704, 6724, 6740, 6760, 6776, 6816, 6832, 6852, 6868, 6888, 6908, 6928, 6944, 6964, 6984, 7000, 7020, 7040, 7060,
+	7076, 7096, 7116, 7136, 7156, 7176, 7192, 7192, 7212, 7232, 7252, 7252, 7272, 7292, 7312, 7312, 7332, 7352, 7352, 7372, 7392, 7392, 7412, 7412, 7432, 7452, 7452, 7472, 7472, 7492, 7492, 7512,
+	7512, 7512, 7532, 7532, 7552, 7552, 7552, 7572, 7572, 7572, 7592, 7592, 7592, 7616, 7616, 7616, 7616, 7636, 7636, 7636, 7636, 7636, 7636, 7636, 7656, 7656, 7656, 7656, 7656, 7656, 7656, 7656,
+	23, 69, 114, 160, 206, 252, 298, 344, 390, 436, 482, 529, 573, 620, 666, 712, 758, 802, 849, 894, 939, 986, 1032, 1075, 1123, 1166, 1214, 1258, 1303, 1350, 1394, 1440,
+	1484, 1529, 1575, 1618, 1663, 1708, 1755, 1798, 1843, 1888, 1930, 1977, 2020, 2064, 2110, 2150, 2198, 2240, 2282, 2326, 2370, 2416, 2462, 2502, 2544, 2592, 2634, 2678, 2714, 2758, 2804, 2842,
+	2888, 2928, 2976, 3016, 3058, 3100, 3142, 3184, 3228, 3262, 3308, 3352, 3388, 3426, 3472, 3510, 3548, 3596, 3636, 3676, 3716, 3756, 3796, 3828, 3870, 3912, 3954, 3986, 4030, 4062, 4108, 4140,
+	4184, 4220, 4256, 4300, 4336, 4372, 4408, 4444, 4480, 4516, 4552, 4588, 4628, 4664, 4704, 4740, 4768, 4804, 4844, 4872, 4912, 4952, 4976, 5020, 5044, 5088, 5116, 5156, 5184, 5212, 5256, 5284,
+	5312, 5340, 5384, 5412, 5444, 5472, 5504, 5532, 5564, 5592, 5624, 5652, 5684, 5716, 5744, 5776, 5808, 5840, 5856, 5888, 5920, 5952, 5984, 6000, 6032, 6064, 6080, 6116, 6132, 6164, 6200, 6216,
+	6248, 6264, 6300, 6316, 6336, 6368, 6384, 6420, 6436, 6456, 6492, 6508, 6524, 6560, 6580, 6596, 6616, 6632, 6668, 6688, 6704, 6724, 6740, 6760, 6776, 6796, 6816, 6832, 6852, 6868, 6888, 6908,
+	6928, 6944, 6964, 6984, 7000, 7020, 7040, 7040, 7060, 7076, 7096, 7096, 7116, 7136, 7156, 7156, 7176, 7192, 7192, 7212, 7232, 7232, 7252, 7252, 7272, 7292, 7292, 7312, 7312, 7332, 7332, 7352,
+	7352, 7352, 7372, 7372, 7392, 7392, 7392, 7412, 7412, 7412, 7432, 7432, 7432, 7452, 7452, 7452, 7452, 7472, 7472, 7472, 7472, 7472, 7472, 7472, 7492, 7492, 7492, 7492, 7492, 7492, 7492, 7492,
+	22, 67, 112, 157, 202, 247, 292, 337, 382, 427, 472, 517, 561, 607, 651, 697, 742, 785, 831, 875, 919, 965, 1010, 1052, 1099, 1141, 1188, 1231, 1275, 1321, 1364, 1409,
+	1452, 1496, 1541, 1584, 1627, 1672, 1717, 1760, 1803, 1848, 1888, 1935, 1977, 2020, 2064, 2104, 2150, 2192, 2234, 2276, 2320, 2364, 2410, 2448, 2488, 2536, 2578, 2620, 2656, 2700, 2744, 2782,
+	2826, 2866, 2912, 2952, 2992, 3032, 3074, 3116, 3158, 3192, 3236, 3280, 3316, 3352, 3398, 3434, 3472, 3520, 3558, 3596, 3636, 3676, 3716, 3746, 3786, 3828, 3870, 3902, 3944, 3976, 4020, 4052,
+	4096, 4128, 4164, 4208, 4244, 4276, 4312, 4348, 4384, 4420, 4456, 4492, 4528, 4564, 4600, 4640, 4664, 4704, 4740, 4768, 4804, 4844, 4872, 4912, 4936, 4976, 5004, 5044, 5072, 5100, 5144, 5168,
+	5200, 5228, 5268, 5296, 5328, 5356, 5384, 5412, 5444, 5472, 5504, 5532, 5564, 5592, 5624, 5652, 5684, 5716, 5732, 5760, 5792, 5824, 5856, 5872, 5904, 5936, 5952, 5984, 6000, 6032, 6064, 6080,
+	6116, 6132, 6164, 6180, 6200, 6232, 6248, 6284, 6300, 6316, 6352, 6368, 6384, 6420, 6436, 6456, 6472, 6492, 6524, 6544, 6560, 6580, 6596, 6616, 6632, 6652, 6668, 6688, 6704, 6724, 6740, 6760,
+	6776, 6796, 6816, 6832, 6852, 6868, 6888, 6888, 6908, 6928, 6944, 6944, 6964, 6984, 7000, 7000, 7020, 7040, 7040, 7060, 7076, 7076, 7096, 7096, 7116, 7136, 7136, 7156, 7156, 7176, 7176, 7192,
+	7192, 7192, 7212, 7212, 7232, 7232, 7232, 7252, 7252, 7252, 7272, 7272, 7272, 7292, 7292, 7292, 7292, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7332, 7332, 7332, 7332, 7332, 7332, 7332, 7332,
+	22, 66, 110, 153, 198, 241, 286, 330, 374, 418, 462, 506, 549, 594, 637, 682, 726, 768, 813, 856, 899, 944, 988, 1030, 1075, 1117, 1163, 1205, 1248, 1292, 1335, 1379,
+	1421, 1464, 1508, 1550, 1592, 1636, 1681, 1722, 1765, 1808, 1848, 1893, 1935, 1977, 2020, 2060, 2104, 2144, 2186, 2228, 2270, 2314, 2358, 2396, 2436, 2482, 2522, 2564, 2600, 2642, 2684, 2722,
+	2766, 2804, 2850, 2888, 2928, 2968, 3008, 3050, 3090, 3124, 3168, 3210, 3246, 3280, 3326, 3362, 3398, 3444, 3482, 3520, 3558, 3596, 3636, 3666, 3706, 3746, 3786, 3818, 3860, 3890, 3932, 3966,
+	4008, 4040, 4074, 4120, 4152, 4184, 4220, 4256, 4288, 4324, 4360, 4396, 4432, 4468, 4504, 4540, 4564, 4600, 4640, 4664, 4704, 4740, 4768, 4804, 4832, 4872, 4896, 4936, 4964, 4992, 5032, 5060,
+	5088, 5116, 5156, 5184, 5212, 5240, 5268, 5296, 5328, 5356, 5384, 5412, 5444, 5472, 5504, 5532, 5564, 5592, 5608, 5636, 5668, 5700, 5732, 5744, 5776, 5808, 5824, 5856, 5872, 5904, 5936, 5952,
+	5984, 6000, 6032, 6048, 6064, 6100, 6116, 6148, 6164, 6180, 6216, 6232, 6248, 6284, 6300, 6316, 6336, 6352, 6384, 6404, 6420, 6436, 6456, 6472, 6492, 6508, 6524, 6544, 6560, 6580, 6596, 6616,
+	6632, 6652, 6668, 6688, 6704, 6724, 6740, 6740, 6760, 6776, 6796, 6796, 6816, 6832, 6852, 6852, 6868, 6888, 6888, 6908, 6928, 6928, 6944, 6944, 6964, 6984, 6984, 7000, 7000, 7020, 7020, 7040,
+	7040, 7040, 7060, 7060, 7076, 7076, 7076, 7096, 7096, 7096, 7116, 7116, 7116, 7136, 7136, 7136, 7136, 7156, 7156, 7156, 7156, 7156, 7156, 7156, 7176, 7176, 7176, 7176, 7176, 7176, 7176, 7176,
+	21, 64, 107, 150, 193, 236, 280, 323, 366, 409, 452, 495, 537, 581, 624, 667, 710, 752, 796, 838, 880, 924, 967, 1007, 1052, 1093, 1138, 1179, 1221, 1265, 1307, 1350,
+	1391, 1433, 1476, 1516, 1558, 1601, 1645, 1685, 1727, 1769, 1808, 1853, 1893, 1935, 1977, 2015, 2060, 2098, 2138, 2180, 2222, 2264, 2308, 2344, 2384, 2428, 2468, 2510, 2544, 2584, 2628, 2664,
+	2706, 2744, 2788, 2826, 2866, 2904, 2944, 2984, 3024, 3058, 3100, 3142, 3176, 3210, 3254, 3290, 3326, 3370, 3408, 3444, 3482, 3520, 3558, 3588, 3626, 3666, 3706, 3736, 3776, 3808, 3848, 3880,
+	3922, 3954, 3986, 4030, 4062, 4096, 4128, 4164, 4196, 4232, 4264, 4300, 4336, 4372, 4408, 4444, 4468, 4504, 4540, 4564, 4600, 4640, 4664, 4704, 4728, 4768, 4792, 4832, 4856, 4884, 4924, 4952,
+	4976, 5004, 5044, 5072, 5100, 5128, 5156, 5184, 5212, 5240, 5268, 5296, 5328, 5356, 5384, 5412, 5444, 5472, 5488, 5516, 5548, 5576, 5608, 5624, 5652, 5684, 5700, 5732, 5744, 5776, 5808, 5824,
+	5856, 5872, 5904, 5920, 5936, 5968, 5984, 6016, 6032, 6048, 6080, 6100, 6116, 6148, 6164, 6180, 6200, 6216, 6248, 6264, 6284, 6300, 6316, 6336, 6352, 6368, 6384, 6404, 6420, 6436, 6456, 6472,
+	6492, 6508, 6524, 6544, 6560, 6580, 6596, 6596, 6616, 6632, 6652, 6652, 6668, 6688, 6704, 6704, 6724, 6740, 6740, 6760, 6776, 6776, 6796, 6796, 6816, 6832, 6832, 6852, 6852, 6868, 6868, 6888,
+	6888, 6888, 6908, 6908, 6928, 6928, 6928, 6944, 6944, 6944, 6964, 6964, 6964, 6984, 6984, 6984, 6984, 7000, 7000, 7000, 7000, 7000, 7000, 7000, 7020, 7020, 7020, 7020, 7020, 7020, 7020, 7020,
+	21, 63, 105, 147, 189, 231, 274, 316, 358, 400, 442, 485, 526, 569, 610, 653, 695, 736, 779, 820, 861, 904, 946, 986, 1030, 1069, 1114, 1154, 1195, 1238, 1279, 1321,
+	1361, 1402, 1444, 1484, 1525, 1566, 1609, 1649, 1690, 1732, 1769, 1813, 1853, 1893, 1935, 1972, 2015, 2054, 2092, 2132, 2174, 2216, 2258, 2294, 2332, 2376, 2416, 2456, 2488, 2530, 2572, 2606,
+	2648, 2684, 2728, 2766, 2804, 2842, 2880, 2920, 2960, 2992, 3032, 3074, 3108, 3142, 3184, 3218, 3254, 3298, 3334, 3370, 3408, 3444, 3482, 3510, 3548, 3588, 3626, 3656, 3696, 3726, 3766, 3796,
+	3838, 3870, 3902, 3944, 3976, 4008, 4040, 4074, 4108, 4140, 4176, 4208, 4244, 4276, 4312, 4348, 4372, 4408, 4444, 4468, 4504, 4540, 4564, 4600, 4628, 4664, 4688, 4728, 4752, 4780, 4820, 4844,
+	4872, 4896, 4936, 4964, 4992, 5020, 5044, 5072, 5100, 5128, 5156, 5184, 5212, 5240, 5268, 5296, 5328, 5356, 5368, 5400, 5428, 5456, 5488, 5504, 5532, 5564, 5576, 5608, 5624, 5652, 5684, 5700,
+	5732, 5744, 5776, 5792, 5808, 5840, 5856, 5888, 5904, 5920, 5952, 5968, 5984, 6016, 6032, 6048, 6064, 6080, 6116, 6132, 6148, 6164, 6180, 6200, 6216, 6232, 6248, 6264, 6284, 6300, 6316, 6336,
+	6352, 6368, 6384, 6404, 6420, 6436, 6456, 6456, 6472, 6492, 6508, 6508, 6524, 6544, 6560, 6560, 6580, 6596, 6596, 6616, 6632, 6632, 6652, 6652, 6668, 6688, 6688, 6704, 6704, 6724, 6724, 6740,
+	6740, 6740, 6760, 6760, 6776, 6776, 6776, 6796, 6796, 6796, 6816, 6816, 6816, 6832, 6832, 6832, 6832, 6852, 6852, 6852, 6852, 6852, 6852, 6852, 6868, 6868, 6868, 6868, 6868, 6868, 6868, 6868,
+	20, 61, 103, 144, 185, 226, 268, 309, 350, 391, 433, 474, 515, 557, 597, 639, 680, 720, 762, 802, 842, 884, 926, 965, 1007, 1046, 1090, 1129, 1169, 1211, 1251, 1292,
+	1332, 1372, 1413, 1452, 1492, 1533, 1575, 1614, 1654, 1694, 1732, 1774, 1813, 1853, 1893, 1930, 1972, 2010, 2048, 2088, 2128, 2168, 2210, 2246, 2282, 2326, 2364, 2402, 2436, 2476, 2516, 2550,
+	2592, 2628, 2670, 2706, 2744, 2782, 2818, 2858, 2896, 2928, 2968, 3008, 3040, 3074, 3116, 3150, 3184, 3228, 3262, 3298, 3334, 3370, 3408, 3434, 3472, 3510, 3548, 3578, 3616, 3646, 3686, 3716,
+	3756, 3786, 3818, 3860, 3890, 3922, 3954, 3986, 4020, 4052, 4084, 4120, 4152, 4184, 4220, 4256, 4276, 4312, 4348, 4372, 4408, 4444, 4468, 4504, 4528, 4564, 4588, 4628, 4652, 4676, 4716, 4740,
+	4768, 4792, 4832, 4856, 4884, 4912, 4936, 4964, 4992, 5020, 5044, 5072, 5100, 5128, 5156, 5184, 5212, 5240, 5256, 5284, 5312, 5340, 5368, 5384, 5412, 5444, 5456, 5488, 5504, 5532, 5564, 5576,
+	5608, 5624, 5652, 5668, 5684, 5716, 5732, 5760, 5776, 5792, 5824, 5840, 5856, 5888, 5904, 5920, 5936, 5952, 5984, 6000, 6016, 6032, 6048, 6064, 6080, 6100, 6116, 6132, 6148, 6164, 6180, 6200,
+	6216, 6232, 6248, 6264, 6284, 6300, 6316, 6316, 6336, 6352, 6368, 6368, 6384, 6404, 6420, 6420, 6436, 6456, 6456, 6472, 6492, 6492, 6508, 6508, 6524, 6544, 6544, 6560, 6560, 6580, 6580, 6596,
+	6596, 6596, 6616, 6616, 6632, 6632, 6632, 6652, 6652, 6652, 6668, 6668, 6668, 6688, 6688, 6688, 6688, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6724, 6724, 6724, 6724, 6724, 6724, 6724, 6724,
+	20, 60, 100, 141, 181, 221, 262, 302, 343, 383, 423, 464, 503, 545, 584, 625, 666, 704, 746, 785, 824, 866, 906, 944, 986, 1024, 1066, 1105, 1144, 1185, 1224, 1265,
+	1303, 1342, 1383, 1421, 1460, 1500, 1541, 1579, 1618, 1658, 1694, 1736, 1774, 1813, 1853, 1888, 1930, 1966, 2004, 2042, 2082, 2122, 2162, 2198, 2234, 2276, 2314, 2352, 2384, 2422, 2462, 2496,
+	2536, 2572, 2614, 2648, 2684, 2722, 2758, 2796, 2834, 2866, 2904, 2944, 2976, 3008, 3050, 3082, 3116, 3158, 3192, 3228, 3262, 3298, 3334, 3362, 3398, 3434, 3472, 3500, 3538, 3568, 3606, 3636,
+	3676, 3706, 3736, 3776, 3808, 3838, 3870, 3902, 3932, 3966, 3998, 4030, 4062, 4096, 4128, 4164, 4184, 4220, 4256, 4276, 4312, 4348, 4372, 4408, 4432, 4468, 4492, 4528, 4552, 4576, 4616, 4640,
+	4664, 4688, 4728, 4752, 4780, 4804, 4832, 4856, 4884, 4912, 4936, 4964, 4992, 5020, 5044, 5072, 5100, 5128, 5144, 5168, 5200, 5228, 5256, 5268, 5296, 5328, 5340, 5368, 5384, 5412, 5444, 5456,
+	5488, 5504, 5532, 5548, 5564, 5592, 5608, 5636, 5652, 5668, 5700, 5716, 5732, 5760, 5776, 5792, 5808, 5824, 5856, 5872, 5888, 5904, 5920, 5936, 5952, 5968, 5984, 6000, 6016, 6032, 6048, 6064,
+	6080, 6100, 6116, 6132, 6148, 6164, 6180, 6180, 6200, 6216, 6232, 6232, 6248, 6264, 6284, 6284, 6300, 6316, 6316, 6336, 6352, 6352, 6368, 6368, 6384, 6404, 6404, 6420, 6420, 6436, 6436, 6456,
+	6456, 6456, 6472, 6472, 6492, 6492, 6492, 6508, 6508, 6508, 6524, 6524, 6524, 6544, 6544, 6544, 6544, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6580, 6580, 6580, 6580, 6580, 6580, 6580, 6580,
+	19, 59, 98, 138, 177, 217, 256, 296, 335, 375, 414, 454, 493, 533, 572, 612, 651, 689, 730, 768, 807, 847, 887, 924, 965, 1002, 1044, 1081, 1120, 1160, 1198, 1238,
+	1275, 1314, 1353, 1391, 1429, 1468, 1508, 1545, 1584, 1623, 1658, 1699, 1736, 1774, 1813, 1848, 1888, 1924, 1961, 1999, 2037, 2076, 2116, 2150, 2186, 2228, 2264, 2300, 2332, 2370, 2410, 2442,
+	2482, 2516, 2558, 2592, 2628, 2664, 2700, 2736, 2774, 2804, 2842, 2880, 2912, 2944, 2984, 3016, 3050, 3090, 3124, 3158, 3192, 3228, 3262, 3290, 3326, 3362, 3398, 3426, 3464, 3492, 3530, 3558,
+	3596, 3626, 3656, 3696, 3726, 3756, 3786, 3818, 3848, 3880, 3912, 3944, 3976, 4008, 4040, 4074, 4096, 4128, 4164, 4184, 4220, 4256, 4276, 4312, 4336, 4372, 4396, 4432, 4456, 4480, 4516, 4540,
+	4564, 4588, 4628, 4652, 4676, 4704, 4728, 4752, 4780, 4804, 4832, 4856, 4884, 4912, 4936, 4964, 4992, 5020, 5032, 5060, 5088, 5116, 5144, 5156, 5184, 5212, 5228, 5256, 5268, 5296, 5328, 5340,
+	5368, 5384, 5412, 5428, 5444, 5472, 5488, 5516, 5532, 5548, 5576, 5592, 5608, 5636, 5652, 5668, 5684, 5700, 5732, 5744, 5760, 5776, 5792, 5808, 5824, 5840, 5856, 5872, 5888, 5904, 5920, 5936,
+	5952, 5968, 5984, 6000, 6016, 6032, 6048, 6048, 6064, 6080, 6100, 6100, 6116, 6132, 6148, 6148, 6164, 6180, 6180, 6200, 6216, 6216, 6232, 6232, 6248, 6264, 6264, 6284, 6284, 6300, 6300, 6316,
+	6316, 6316, 6336, 6336, 6352, 6352, 6352, 6368, 6368, 6368, 6384, 6384, 6384, 6404, 6404, 6404, 6404, 6420, 6420, 6420, 6420, 6420, 6420, 6420, 6436, 6436, 6436, 6436, 6436, 6436, 6436, 6436,
+	19, 58, 96, 135, 173, 212, 251, 290, 328, 367, 405, 444, 482, 522, 560, 599, 637, 675, 714, 752, 789, 829, 868, 904, 944, 980, 1021, 1058, 1096, 1135, 1172, 1211,
+	1248, 1286, 1324, 1361, 1398, 1436, 1476, 1512, 1550, 1588, 1623, 1663, 1699, 1736, 1774, 1808, 1848, 1883, 1919, 1956, 1993, 2031, 2070, 2104, 2138, 2180, 2216, 2252, 2282, 2320, 2358, 2390,
+	2428, 2462, 2502, 2536, 2572, 2606, 2642, 2678, 2714, 2744, 2782, 2818, 2850, 2880, 2920, 2952, 2984, 3024, 3058, 3090, 3124, 3158, 3192, 3218, 3254, 3290, 3326, 3352, 3388, 3416, 3454, 3482,
+	3520, 3548, 3578, 3616, 3646, 3676, 3706, 3736, 3766, 3796, 3828, 3860, 3890, 3922, 3954, 3986, 4008, 4040, 4074, 4096, 4128, 4164, 4184, 4220, 4244, 4276, 4300, 4336, 4360, 4384, 4420, 4444,
+	4468, 4492, 4528, 4552, 4576, 4600, 4628, 4652, 4676, 4704, 4728, 4752, 4780, 4804, 4832, 4856, 4884, 4912, 4924, 4952, 4976, 5004, 5032, 5044, 5072, 5100, 5116, 5144, 5156, 5184, 5212, 5228,
+	5256, 5268, 5296, 5312, 5328, 5356, 5368, 5400, 5412, 5428, 5456, 5472, 5488, 5516, 5532, 5548, 5564, 5576, 5608, 5624, 5636, 5652, 5668, 5684, 5700, 5716, 5732, 5744, 5760, 5776, 5792, 5808,
+	5824, 5840, 5856, 5872, 5888, 5904, 5920, 5920, 5936, 5952, 5968, 5968, 5984, 6000, 6016, 6016, 6032, 6048, 6048, 6064, 6080, 6080, 6100, 6100, 6116, 6132, 6132, 6148, 6148, 6164, 6164, 6180,
+	6180, 6180, 6200, 6200, 6216, 6216, 6216, 6232, 6232, 6232, 6248, 6248, 6248, 6264, 6264, 6264, 6264, 6284, 6284, 6284, 6284, 6284, 6284, 6284, 6300, 6300, 6300, 6300, 6300, 6300, 6300, 6300,
+	18, 56, 94, 132, 170, 207, 245, 283, 321, 359, 397, 435, 472, 510, 548, 586, 624, 660, 699, 736, 772, 811, 849, 884, 924, 959, 999, 1035, 1072, 1111, 1147, 1185,
+	1221, 1258, 1296, 1332, 1368, 1406, 1444, 1480, 1516, 1554, 1588, 1627, 1663, 1699, 1736, 1769, 1808, 1843, 1878, 1914, 1951, 1988, 2026, 2060, 2092, 2132, 2168, 2204, 2234, 2270, 2308, 2338,
+	2376, 2410, 2448, 2482, 2516, 2550, 2584, 2620, 2656, 2684, 2722, 2758, 2788, 2818, 2858, 2888, 2920, 2960, 2992, 3024, 3058, 3090, 3124, 3150, 3184, 3218, 3254, 3280, 3316, 3344, 3380, 3408,
+	3444, 3472, 3500, 3538, 3568, 3596, 3626, 3656, 3686, 3716, 3746, 3776, 3808, 3838, 3870, 3902, 3922, 3954, 3986, 4008, 4040, 4074, 4096, 4128, 4152, 4184, 4208, 4244, 4264, 4288, 4324, 4348,
+	4372, 4396, 4432, 4456, 4480, 4504, 4528, 4552, 4576, 4600, 4628, 4652, 4676, 4704, 4728, 4752, 4780, 4804, 4820, 4844, 4872, 4896, 4924, 4936, 4964, 4992, 5004, 5032, 5044, 5072, 5100, 5116,
+	5144, 5156, 5184, 5200, 5212, 5240, 5256, 5284, 5296, 5312, 5340, 5356, 5368, 5400, 5412, 5428, 5444, 5456, 5488, 5504, 5516, 5532, 5548, 5564, 5576, 5592, 5608, 5624, 5636, 5652, 5668, 5684,
+	5700, 5716, 5732, 5744, 5760, 5776, 5792, 5792, 5808, 5824, 5840, 5840, 5856, 5872, 5888, 5888, 5904, 5920, 5920, 5936, 5952, 5952, 5968, 5968, 5984, 6000, 6000, 6016, 6016, 6032, 6032, 6048,
+	6048, 6048, 6064, 6064, 6080, 6080, 6080, 6100, 6100, 6100, 6116, 6116, 6116, 6132, 6132, 6132, 6132, 6148, 6148, 6148, 6148, 6148, 6148, 6148, 6164, 6164, 6164, 6164, 6164, 6164, 6164, 6164,
+	18, 55, 92, 129, 166, 203, 240, 277, 314, 351, 388, 426, 462, 499, 536, 573, 610, 646, 684, 720, 756, 794, 831, 866, 904, 939, 978, 1013, 1049, 1087, 1123, 1160,
+	1195, 1231, 1268, 1303, 1339, 1376, 1413, 1448, 1484, 1520, 1554, 1592, 1627, 1663, 1699, 1732, 1769, 1803, 1838, 1873, 1909, 1945, 1983, 2015, 2048, 2088, 2122, 2156, 2186, 2222, 2258, 2288,
+	2326, 2358, 2396, 2428, 2462, 2496, 2530, 2564, 2600, 2628, 2664, 2700, 2728, 2758, 2796, 2826, 2858, 2896, 2928, 2960, 2992, 3024, 3058, 3082, 3116, 3150, 3184, 3210, 3246, 3272, 3308, 3334,
+	3370, 3398, 3426, 3464, 3492, 3520, 3548, 3578, 3606, 3636, 3666, 3696, 3726, 3756, 3786, 3818, 3838, 3870, 3902, 3922, 3954, 3986, 4008, 4040, 4062, 4096, 4120, 4152, 4176, 4196, 4232, 4256,
+	4276, 4300, 4336, 4360, 4384, 4408, 4432, 4456, 4480, 4504, 4528, 4552, 4576, 4600, 4628, 4652, 4676, 4704, 4716, 4740, 4768, 4792, 4820, 4832, 4856, 4884, 4896, 4924, 4936, 4964, 4992, 5004,
+	5032, 5044, 5072, 5088, 5100, 5128, 5144, 5168, 5184, 5200, 5228, 5240, 5256, 5284, 5296, 5312, 5328, 5340, 5368, 5384, 5400, 5412, 5428, 5444, 5456, 5472, 5488, 5504, 5516, 5532, 5548, 5564,
+	5576, 5592, 5608, 5624, 5636, 5652, 5668, 5668, 5684, 5700, 5716, 5716, 5732, 5744, 5760, 5760, 5776, 5792, 5792, 5808, 5824, 5824, 5840, 5840, 5856, 5872, 5872, 5888, 5888, 5904, 5904, 5920,
+	5920, 5920, 5936, 5936, 5952, 5952, 5952, 5968, 5968, 5968, 5984, 5984, 5984, 6000, 6000, 6000, 6000, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6032, 6032, 6032, 6032, 6032, 6032, 6032, 6032,
+	18, 54, 90, 126, 162, 199, 235, 271, 307, 344, 380, 416, 452, 489, 524, 561, 597, 632, 669, 704, 740, 777, 813, 847, 884, 919, 957, 991, 1027, 1064, 1099, 1135,
+	1169, 1205, 1241, 1275, 1310, 1346, 1383, 1417, 1452, 1488, 1520, 1558, 1592, 1627, 1663, 1694, 1732, 1765, 1798, 1833, 1868, 1904, 1940, 1972, 2004, 2042, 2076, 2110, 2138, 2174, 2210, 2240,
+	2276, 2308, 2344, 2376, 2410, 2442, 2476, 2510, 2544, 2572, 2606, 2642, 2670, 2700, 2736, 2766, 2796, 2834, 2866, 2896, 2928, 2960, 2992, 3016, 3050, 3082, 3116, 3142, 3176, 3202, 3236, 3262,
+	3298, 3326, 3352, 3388, 3416, 3444, 3472, 3500, 3530, 3558, 3588, 3616, 3646, 3676, 3706, 3736, 3756, 3786, 3818, 3838, 3870, 3902, 3922, 3954, 3976, 4008, 4030, 4062, 4084, 4108, 4140, 4164,
+	4184, 4208, 4244, 4264, 4288, 4312, 4336, 4360, 4384, 4408, 4432, 4456, 4480, 4504, 4528, 4552, 4576, 4600, 4616, 4640, 4664, 4688, 4716, 4728, 4752, 4780, 4792, 4820, 4832, 4856, 4884, 4896,
+	4924, 4936, 4964, 4976, 4992, 5020, 5032, 5060, 5072, 5088, 5116, 5128, 5144, 5168, 5184, 5200, 5212, 5228, 5256, 5268, 5284, 5296, 5312, 5328, 5340, 5356, 5368, 5384, 5400, 5412, 5428, 5444,
+	5456, 5472, 5488, 5504, 5516, 5532, 5548, 5548, 5564, 5576, 5592, 5592, 5608, 5624, 5636, 5636, 5652, 5668, 5668, 5684, 5700, 5700, 5716, 5716, 5732, 5744, 5744, 5760, 5760, 5776, 5776, 5792,
+	5792, 5792, 5808, 5808, 5824, 5824, 5824, 5840, 5840, 5840, 5856, 5856, 5856, 5872, 5872, 5872, 5872, 5888, 5888, 5888, 5888, 5888, 5888, 5888, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904,
+	17, 53, 88, 123, 159, 194, 230, 266, 301, 336, 372, 407, 442, 478, 513, 549, 584, 619, 655, 689, 724, 760, 796, 829, 866, 899, 936, 970, 1005, 1041, 1075, 1111,
+	1144, 1179, 1214, 1248, 1282, 1317, 1353, 1387, 1421, 1456, 1488, 1525, 1558, 1592, 1627, 1658, 1694, 1727, 1760, 1794, 1828, 1863, 1898, 1930, 1961, 1999, 2031, 2064, 2092, 2128, 2162, 2192,
+	2228, 2258, 2294, 2326, 2358, 2390, 2422, 2456, 2488, 2516, 2550, 2584, 2614, 2642, 2678, 2706, 2736, 2774, 2804, 2834, 2866, 2896, 2928, 2952, 2984, 3016, 3050, 3074, 3108, 3132, 3168, 3192,
+	3228, 3254, 3280, 3316, 3344, 3370, 3398, 3426, 3454, 3482, 3510, 3538, 3568, 3596, 3626, 3656, 3676, 3706, 3736, 3756, 3786, 3818, 3838, 3870, 3890, 3922, 3944, 3976, 3998, 4020, 4052, 4074,
+	4096, 4120, 4152, 4176, 4196, 4220, 4244, 4264, 4288, 4312, 4336, 4360, 4384, 4408, 4432, 4456, 4480, 4504, 4516, 4540, 4564, 4588, 4616, 4628, 4652, 4676, 4688, 4716, 4728, 4752, 4780, 4792,
+	4820, 4832, 4856, 4872, 4884, 4912, 4924, 4952, 4964, 4976, 5004, 5020, 5032, 5060, 5072, 5088, 5100, 5116, 5144, 5156, 5168, 5184, 5200, 5212, 5228, 5240, 5256, 5268, 5284, 5296, 5312, 5328,
+	5340, 5356, 5368, 5384, 5400, 5412, 5428, 5428, 5444, 5456, 5472, 5472, 5488, 5504, 5516, 5516, 5532, 5548, 5548, 5564, 5576, 5576, 5592, 5592, 5608, 5624, 5624, 5636, 5636, 5652, 5652, 5668,
+	5668, 5668, 5684, 5684, 5700, 5700, 5700, 5716, 5716, 5716, 5732, 5732, 5732, 5744, 5744, 5744, 5744, 5760, 5760, 5760, 5760, 5760, 5760, 5760, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776,
+	17, 52, 86, 121, 156, 190, 225, 260, 294, 329, 364, 399, 433, 468, 502, 537, 572, 605, 641, 675, 708, 744, 779, 811, 847, 880, 916, 949, 983, 1018, 1052, 1087,
+	1120, 1154, 1188, 1221, 1255, 1289, 1324, 1357, 1391, 1425, 1456, 1492, 1525, 1558, 1592, 1623, 1658, 1690, 1722, 1755, 1789, 1823, 1858, 1888, 1919, 1956, 1988, 2020, 2048, 2082, 2116, 2144,
+	2180, 2210, 2246, 2276, 2308, 2338, 2370, 2402, 2436, 2462, 2496, 2530, 2558, 2584, 2620, 2648, 2678, 2714, 2744, 2774, 2804, 2834, 2866, 2888, 2920, 2952, 2984, 3008, 3040, 3066, 3100, 3124,
+	3158, 3184, 3210, 3246, 3272, 3298, 3326, 3352, 3380, 3408, 3434, 3464, 3492, 3520, 3548, 3578, 3596, 3626, 3656, 3676, 3706, 3736, 3756, 3786, 3808, 3838, 3860, 3890, 3912, 3932, 3966, 3986,
+	4008, 4030, 4062, 4084, 4108, 4128, 4152, 4176, 4196, 4220, 4244, 4264, 4288, 4312, 4336, 4360, 4384, 4408, 4420, 4444, 4468, 4492, 4516, 4528, 4552, 4576, 4588, 4616, 4628, 4652, 4676, 4688,
+	4716, 4728, 4752, 4768, 4780, 4804, 4820, 4844, 4856, 4872, 4896, 4912, 4924, 4952, 4964, 4976, 4992, 5004, 5032, 5044, 5060, 5072, 5088, 5100, 5116, 5128, 5144, 5156, 5168, 5184, 5200, 5212,
+	5228, 5240, 5256, 5268, 5284, 5296, 5312, 5312, 5328, 5340, 5356, 5356, 5368, 5384, 5400, 5400, 5412, 5428, 5428, 5444, 5456, 5456, 5472, 5472, 5488, 5504, 5504, 5516, 5516, 5532, 5532, 5548,
+	5548, 5548, 5564, 5564, 5576, 5576, 5576, 5592, 5592, 5592, 5608, 5608, 5608, 5624, 5624, 5624, 5624, 5636, 5636, 5636, 5636, 5636, 5636, 5636, 5652, 5652, 5652, 5652, 5652, 5652, 5652, 5652,
+	16, 50, 84, 118, 152, 186, 220, 254, 288, 322, 356, 390, 423, 458, 491, 526, 560, 592, 627, 660, 693, 728, 762, 794, 829, 861, 897, 929, 962, 996, 1030, 1064,
+	1096, 1129, 1163, 1195, 1228, 1261, 1296, 1328, 1361, 1394, 1425, 1460, 1492, 1525, 1558, 1588, 1623, 1654, 1685, 1717, 1750, 1784, 1818, 1848, 1878, 1914, 1945, 1977, 2004, 2037, 2070, 2098,
+	2132, 2162, 2198, 2228, 2258, 2288, 2320, 2352, 2384, 2410, 2442, 2476, 2502, 2530, 2564, 2592, 2620, 2656, 2684, 2714, 2744, 2774, 2804, 2826, 2858, 2888, 2920, 2944, 2976, 3000, 3032, 3058,
+	3090, 3116, 3142, 3176, 3202, 3228, 3254, 3280, 3308, 3334, 3362, 3388, 3416, 3444, 3472, 3500, 3520, 3548, 3578, 3596, 3626, 3656, 3676, 3706, 3726, 3756, 3776, 3808, 3828, 3848, 3880, 3902,
+	3922, 3944, 3976, 3998, 4020, 4040, 4062, 4084, 4108, 4128, 4152, 4176, 4196, 4220, 4244, 4264, 4288, 4312, 4324, 4348, 4372, 4396, 4420, 4432, 4456, 4480, 4492, 4516, 4528, 4552, 4576, 4588,
+	4616, 4628, 4652, 4664, 4676, 4704, 4716, 4740, 4752, 4768, 4792, 4804, 4820, 4844, 4856, 4872, 4884, 4896, 4924, 4936, 4952, 4964, 4976, 4992, 5004, 5020, 5032, 5044, 5060, 5072, 5088, 5100,
+	5116, 5128, 5144, 5156, 5168, 5184, 5200, 5200, 5212, 5228, 5240, 5240, 5256, 5268, 5284, 5284, 5296, 5312, 5312, 5328, 5340, 5340, 5356, 5356, 5368, 5384, 5384, 5400, 5400, 5412, 5412, 5428,
+	5428, 5428, 5444, 5444, 5456, 5456, 5456, 5472, 5472, 5472, 5488, 5488, 5488, 5504, 5504, 5504, 5504, 5516, 5516, 5516, 5516, 5516, 5516, 5516, 5532, 5532, 5532, 5532, 5532, 5532, 5532, 5532,
+	16, 49, 83, 116, 149, 182, 215, 249, 282, 315, 348, 382, 414, 448, 481, 515, 548, 580, 614, 646, 678, 712, 746, 777, 811, 842, 877, 909, 941, 975, 1007, 1041,
+	1072, 1105, 1138, 1169, 1201, 1234, 1268, 1300, 1332, 1364, 1394, 1429, 1460, 1492, 1525, 1554, 1588, 1618, 1649, 1681, 1713, 1746, 1779, 1808, 1838, 1873, 1904, 1935, 1961, 1993, 2026, 2054,
+	2088, 2116, 2150, 2180, 2210, 2240, 2270, 2300, 2332, 2358, 2390, 2422, 2448, 2476, 2510, 2536, 2564, 2600, 2628, 2656, 2684, 2714, 2744, 2766, 2796, 2826, 2858, 2880, 2912, 2936, 2968, 2992,
+	3024, 3050, 3074, 3108, 3132, 3158, 3184, 3210, 3236, 3262, 3290, 3316, 3344, 3370, 3398, 3426, 3444, 3472, 3500, 3520, 3548, 3578, 3596, 3626, 3646, 3676, 3696, 3726, 3746, 3766, 3796, 3818,
+	3838, 3860, 3890, 3912, 3932, 3954, 3976, 3998, 4020, 4040, 4062, 4084, 4108, 4128, 4152, 4176, 4196, 4220, 4232, 4256, 4276, 4300, 4324, 4336, 4360, 4384, 4396, 4420, 4432, 4456, 4480, 4492,
+	4516, 4528, 4552, 4564, 4576, 4600, 4616, 4640, 4652, 4664, 4688, 4704, 4716, 4740, 4752, 4768, 4780, 4792, 4820, 4832, 4844, 4856, 4872, 4884, 4896, 4912, 4924, 4936, 4952, 4964, 4976, 4992,
+	5004, 5020, 5032, 5044, 5060, 5072, 5088, 5088, 5100, 5116, 5128, 5128, 5144, 5156, 5168, 5168, 5184, 5200, 5200, 5212, 5228, 5228, 5240, 5240, 5256, 5268, 5268, 5284, 5284, 5296, 5296, 5312,
+	5312, 5312, 5328, 5328, 5340, 5340, 5340, 5356, 5356, 5356, 5368, 5368, 5368, 5384, 5384, 5384, 5384, 5400, 5400, 5400, 5400, 5400, 5400, 5400, 5412, 5412, 5412, 5412, 5412, 5412, 5412, 5412,
+	16, 48, 81, 113, 146, 178, 211, 243, 276, 308, 341, 374, 405, 438, 470, 503, 536, 567, 600, 632, 664, 697, 730, 760, 794, 824, 858, 889, 921, 954, 986, 1018,
+	1049, 1081, 1114, 1144, 1176, 1208, 1241, 1272, 1303, 1335, 1364, 1398, 1429, 1460, 1492, 1520, 1554, 1584, 1614, 1645, 1676, 1708, 1741, 1769, 1798, 1833, 1863, 1893, 1919, 1951, 1983, 2010,
+	2042, 2070, 2104, 2132, 2162, 2192, 2222, 2252, 2282, 2308, 2338, 2370, 2396, 2422, 2456, 2482, 2510, 2544, 2572, 2600, 2628, 2656, 2684, 2706, 2736, 2766, 2796, 2818, 2850, 2872, 2904, 2928,
+	2960, 2984, 3008, 3040, 3066, 3090, 3116, 3142, 3168, 3192, 3218, 3246, 3272, 3298, 3326, 3352, 3370, 3398, 3426, 3444, 3472, 3500, 3520, 3548, 3568, 3596, 3616, 3646, 3666, 3686, 3716, 3736,
+	3756, 3776, 3808, 3828, 3848, 3870, 3890, 3912, 3932, 3954, 3976, 3998, 4020, 4040, 4062, 4084, 4108, 4128, 4140, 4164, 4184, 4208, 4232, 4244, 4264, 4288, 4300, 4324, 4336, 4360, 4384, 4396,
+	4420, 4432, 4456, 4468, 4480, 4504, 4516, 4540, 4552, 4564, 4588, 4600, 4616, 4640, 4652, 4664, 4676, 4688, 4716, 4728, 4740, 4752, 4768, 4780, 4792, 4804, 4820, 4832, 4844, 4856, 4872, 4884,
+	4896, 4912, 4924, 4936, 4952, 4964, 4976, 4976, 4992, 5004, 5020, 5020, 5032, 5044, 5060, 5060, 5072, 5088, 5088, 5100, 5116, 5116, 5128, 5128, 5144, 5156, 5156, 5168, 5168, 5184, 5184, 5200,
+	5200, 5200, 5212, 5212, 5228, 5228, 5228, 5240, 5240, 5240, 5256, 5256, 5256, 5268, 5268, 5268, 5268, 5284, 5284, 5284, 5284, 5284, 5284, 5284, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296,
+	15, 47, 79, 111, 143, 174, 206, 238, 270, 302, 333, 366, 397, 429, 460, 493, 524, 555, 588, 619, 650, 682, 714, 744, 777, 807, 840, 870, 901, 934, 965, 996,
+	1027, 1058, 1090, 1120, 1150, 1182, 1214, 1244, 1275, 1307, 1335, 1368, 1398, 1429, 1460, 1488, 1520, 1550, 1579, 1609, 1640, 1672, 1704, 1732, 1760, 1794, 1823, 1853, 1878, 1909, 1940, 1966,
+	1999, 2026, 2060, 2088, 2116, 2144, 2174, 2204, 2234, 2258, 2288, 2320, 2344, 2370, 2402, 2428, 2456, 2488, 2516, 2544, 2572, 2600, 2628, 2648, 2678, 2706, 2736, 2758, 2788, 2812, 2842, 2866,
+	2896, 2920, 2944, 2976, 3000, 3024, 3050, 3074, 3100, 3124, 3150, 3176, 3202, 3228, 3254, 3280, 3298, 3326, 3352, 3370, 3398, 3426, 3444, 3472, 3492, 3520, 3538, 3568, 3588, 3606, 3636, 3656,
+	3676, 3696, 3726, 3746, 3766, 3786, 3808, 3828, 3848, 3870, 3890, 3912, 3932, 3954, 3976, 3998, 4020, 4040, 4052, 4074, 4096, 4120, 4140, 4152, 4176, 4196, 4208, 4232, 4244, 4264, 4288, 4300,
+	4324, 4336, 4360, 4372, 4384, 4408, 4420, 4444, 4456, 4468, 4492, 4504, 4516, 4540, 4552, 4564, 4576, 4588, 4616, 4628, 4640, 4652, 4664, 4676, 4688, 4704, 4716, 4728, 4740, 4752, 4768, 4780,
+	4792, 4804, 4820, 4832, 4844, 4856, 4872, 4872, 4884, 4896, 4912, 4912, 4924, 4936, 4952, 4952, 4964, 4976, 4976, 4992, 5004, 5004, 5020, 5020, 5032, 5044, 5044, 5060, 5060, 5072, 5072, 5088,
+	5088, 5088, 5100, 5100, 5116, 5116, 5116, 5128, 5128, 5128, 5144, 5144, 5144, 5156, 5156, 5156, 5156, 5168, 5168, 5168, 5168, 5168, 5168, 5168, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184,
+	15, 46, 77, 108, 140, 171, 202, 233, 264, 295, 326, 358, 388, 420, 450, 482, 513, 543, 575, 605, 636, 667, 699, 728, 760, 789, 822, 852, 882, 914, 944, 975,
+	1005, 1035, 1066, 1096, 1126, 1157, 1188, 1218, 1248, 1279, 1307, 1339, 1368, 1398, 1429, 1456, 1488, 1516, 1545, 1575, 1605, 1636, 1667, 1694, 1722, 1755, 1784, 1813, 1838, 1868, 1898, 1924,
+	1956, 1983, 2015, 2042, 2070, 2098, 2128, 2156, 2186, 2210, 2240, 2270, 2294, 2320, 2352, 2376, 2402, 2436, 2462, 2488, 2516, 2544, 2572, 2592, 2620, 2648, 2678, 2700, 2728, 2752, 2782, 2804,
+	2834, 2858, 2880, 2912, 2936, 2960, 2984, 3008, 3032, 3058, 3082, 3108, 3132, 3158, 3184, 3210, 3228, 3254, 3280, 3298, 3326, 3352, 3370, 3398, 3416, 3444, 3464, 3492, 3510, 3530, 3558, 3578,
+	3596, 3616, 3646, 3666, 3686, 3706, 3726, 3746, 3766, 3786, 3808, 3828, 3848, 3870, 3890, 3912, 3932, 3954, 3966, 3986, 4008, 4030, 4052, 4062, 4084, 4108, 4120, 4140, 4152, 4176, 4196, 4208,
+	4232, 4244, 4264, 4276, 4288, 4312, 4324, 4348, 4360, 4372, 4396, 4408, 4420, 4444, 4456, 4468, 4480, 4492, 4516, 4528, 4540, 4552, 4564, 4576, 4588, 4600, 4616, 4628, 4640, 4652, 4664, 4676,
+	4688, 4704, 4716, 4728, 4740, 4752, 4768, 4768, 4780, 4792, 4804, 4804, 4820, 4832, 4844, 4844, 4856, 4872, 4872, 4884, 4896, 4896, 4912, 4912, 4924, 4936, 4936, 4952, 4952, 4964, 4964, 4976,
+	4976, 4976, 4992, 4992, 5004, 5004, 5004, 5020, 5020, 5020, 5032, 5032, 5032, 5044, 5044, 5044, 5044, 5060, 5060, 5060, 5060, 5060, 5060, 5060, 5072, 5072, 5072, 5072, 5072, 5072, 5072, 5072,
+	15, 45, 76, 106, 137, 167, 198, 228, 258, 289, 319, 350, 380, 411, 441, 472, 502, 532, 563, 592, 622, 653, 684, 712, 744, 772, 804, 833, 863, 894, 924, 954,
+	983, 1013, 1044, 1072, 1102, 1132, 1163, 1192, 1221, 1251, 1279, 1310, 1339, 1368, 1398, 1425, 1456, 1484, 1512, 1541, 1571, 1601, 1631, 1658, 1685, 1717, 1746, 1774, 1798, 1828, 1858, 1883,
+	1914, 1940, 1972, 1999, 2026, 2054, 2082, 2110, 2138, 2162, 2192, 2222, 2246, 2270, 2300, 2326, 2352, 2384, 2410, 2436, 2462, 2488, 2516, 2536, 2564, 2592, 2620, 2642, 2670, 2692, 2722, 2744,
+	2774, 2796, 2818, 2850, 2872, 2896, 2920, 2944, 2968, 2992, 3016, 3040, 3066, 3090, 3116, 3142, 3158, 3184, 3210, 3228, 3254, 3280, 3298, 3326, 3344, 3370, 3388, 3416, 3434, 3454, 3482, 3500,
+	3520, 3538, 3568, 3588, 3606, 3626, 3646, 3666, 3686, 3706, 3726, 3746, 3766, 3786, 3808, 3828, 3848, 3870, 3880, 3902, 3922, 3944, 3966, 3976, 3998, 4020, 4030, 4052, 4062, 4084, 4108, 4120,
+	4140, 4152, 4176, 4184, 4196, 4220, 4232, 4256, 4264, 4276, 4300, 4312, 4324, 4348, 4360, 4372, 4384, 4396, 4420, 4432, 4444, 4456, 4468, 4480, 4492, 4504, 4516, 4528, 4540, 4552, 4564, 4576,
+	4588, 4600, 4616, 4628, 4640, 4652, 4664, 4664, 4676, 4688, 4704, 4704, 4716, 4728, 4740, 4740, 4752, 4768, 4768, 4780, 4792, 4792, 4804, 4804, 4820, 4832, 4832, 4844, 4844, 4856, 4856, 4872,
+	4872, 4872, 4884, 4884, 4896, 4896, 4896, 4912, 4912, 4912, 4924, 4924, 4924, 4936, 4936, 4936, 4936, 4952, 4952, 4952, 4952, 4952, 4952, 4952, 4964, 4964, 4964, 4964, 4964, 4964, 4964, 4964,
+	14, 44, 74, 104, 134, 163, 193, 223, 253, 283, 312, 343, 372, 402, 431, 462, 491, 520, 551, 580, 609, 639, 669, 697, 728, 756, 787, 815, 845, 875, 904, 934,
+	962, 991, 1021, 1049, 1078, 1108, 1138, 1166, 1195, 1224, 1251, 1282, 1310, 1339, 1368, 1394, 1425, 1452, 1480, 1508, 1537, 1566, 1596, 1623, 1649, 1681, 1708, 1736, 1760, 1789, 1818, 1843,
+	1873, 1898, 1930, 1956, 1983, 2010, 2037, 2064, 2092, 2116, 2144, 2174, 2198, 2222, 2252, 2276, 2300, 2332, 2358, 2384, 2410, 2436, 2462, 2482, 2510, 2536, 2564, 2584, 2614, 2634, 2664, 2684,
+	2714, 2736, 2758, 2788, 2812, 2834, 2858, 2880, 2904, 2928, 2952, 2976, 3000, 3024, 3050, 3074, 3090, 3116, 3142, 3158, 3184, 3210, 3228, 3254, 3272, 3298, 3316, 3344, 3362, 3380, 3408, 3426,
+	3444, 3464, 3492, 3510, 3530, 3548, 3568, 3588, 3606, 3626, 3646, 3666, 3686, 3706, 3726, 3746, 3766, 3786, 3796, 3818, 3838, 3860, 3880, 3890, 3912, 3932, 3944, 3966, 3976, 3998, 4020, 4030,
+	4052, 4062, 4084, 4096, 4108, 4128, 4140, 4164, 4176, 4184, 4208, 4220, 4232, 4256, 4264, 4276, 4288, 4300, 4324, 4336, 4348, 4360, 4372, 4384, 4396, 4408, 4420, 4432, 4444, 4456, 4468, 4480,
+	4492, 4504, 4516, 4528, 4540, 4552, 4564, 4564, 4576, 4588, 4600, 4600, 4616, 4628, 4640, 4640, 4652, 4664, 4664, 4676, 4688, 4688, 4704, 4704, 4716, 4728, 4728, 4740, 4740, 4752, 4752, 4768,
+	4768, 4768, 4780, 4780, 4792, 4792, 4792, 4804, 4804, 4804, 4820, 4820, 4820, 4832, 4832, 4832, 4832, 4844, 4844, 4844, 4844, 4844, 4844, 4844, 4856, 4856, 4856, 4856, 4856, 4856, 4856, 4856,
+	14, 43, 72, 101, 131, 160, 189, 218, 247, 277, 306, 335, 364, 393, 422, 452, 481, 509, 539, 567, 596, 625, 655, 682, 712, 740, 770, 798, 827, 856, 884, 914,
+	941, 970, 999, 1027, 1055, 1084, 1114, 1141, 1169, 1198, 1224, 1255, 1282, 1310, 1339, 1364, 1394, 1421, 1448, 1476, 1504, 1533, 1562, 1588, 1614, 1645, 1672, 1699, 1722, 1750, 1779, 1803,
+	1833, 1858, 1888, 1914, 1940, 1966, 1993, 2020, 2048, 2070, 2098, 2128, 2150, 2174, 2204, 2228, 2252, 2282, 2308, 2332, 2358, 2384, 2410, 2428, 2456, 2482, 2510, 2530, 2558, 2578, 2606, 2628,
+	2656, 2678, 2700, 2728, 2752, 2774, 2796, 2818, 2842, 2866, 2888, 2912, 2936, 2960, 2984, 3008, 3024, 3050, 3074, 3090, 3116, 3142, 3158, 3184, 3202, 3228, 3246, 3272, 3290, 3308, 3334, 3352,
+	3370, 3388, 3416, 3434, 3454, 3472, 3492, 3510, 3530, 3548, 3568, 3588, 3606, 3626, 3646, 3666, 3686, 3706, 3716, 3736, 3756, 3776, 3796, 3808, 3828, 3848, 3860, 3880, 3890, 3912, 3932, 3944,
+	3966, 3976, 3998, 4008, 4020, 4040, 4052, 4074, 4084, 4096, 4120, 4128, 4140, 4164, 4176, 4184, 4196, 4208, 4232, 4244, 4256, 4264, 4276, 4288, 4300, 4312, 4324, 4336, 4348, 4360, 4372, 4384,
+	4396, 4408, 4420, 4432, 4444, 4456, 4468, 4468, 4480, 4492, 4504, 4504, 4516, 4528, 4540, 4540, 4552, 4564, 4564, 4576, 4588, 4588, 4600, 4600, 4616, 4628, 4628, 4640, 4640, 4652, 4652, 4664,
+	4664, 4664, 4676, 4676, 4688, 4688, 4688, 4704, 4704, 4704, 4716, 4716, 4716, 4728, 4728, 4728, 4728, 4740, 4740, 4740, 4740, 4740, 4740, 4740, 4752, 4752, 4752, 4752, 4752, 4752, 4752, 4752,
+	14, 42, 71, 99, 128, 156, 185, 214, 242, 271, 299, 328, 356, 385, 413, 442, 470, 498, 527, 555, 583, 612, 641, 667, 697, 724, 754, 781, 809, 838, 866, 894,
+	921, 949, 978, 1005, 1032, 1061, 1090, 1117, 1144, 1172, 1198, 1228, 1255, 1282, 1310, 1335, 1364, 1391, 1417, 1444, 1472, 1500, 1529, 1554, 1579, 1609, 1636, 1663, 1685, 1713, 1741, 1765,
+	1794, 1818, 1848, 1873, 1898, 1924, 1951, 1977, 2004, 2026, 2054, 2082, 2104, 2128, 2156, 2180, 2204, 2234, 2258, 2282, 2308, 2332, 2358, 2376, 2402, 2428, 2456, 2476, 2502, 2522, 2550, 2572,
+	2600, 2620, 2642, 2670, 2692, 2714, 2736, 2758, 2782, 2804, 2826, 2850, 2872, 2896, 2920, 2944, 2960, 2984, 3008, 3024, 3050, 3074, 3090, 3116, 3132, 3158, 3176, 3202, 3218, 3236, 3262, 3280,
+	3298, 3316, 3344, 3362, 3380, 3398, 3416, 3434, 3454, 3472, 3492, 3510, 3530, 3548, 3568, 3588, 3606, 3626, 3636, 3656, 3676, 3696, 3716, 3726, 3746, 3766, 3776, 3796, 3808, 3828, 3848, 3860,
+	3880, 3890, 3912, 3922, 3932, 3954, 3966, 3986, 3998, 4008, 4030, 4040, 4052, 4074, 4084, 4096, 4108, 4120, 4140, 4152, 4164, 4176, 4184, 4196, 4208, 4220, 4232, 4244, 4256, 4264, 4276, 4288,
+	4300, 4312, 4324, 4336, 4348, 4360, 4372, 4372, 4384, 4396, 4408, 4408, 4420, 4432, 4444, 4444, 4456, 4468, 4468, 4480, 4492, 4492, 4504, 4504, 4516, 4528, 4528, 4540, 4540, 4552, 4552, 4564,
+	4564, 4564, 4576, 4576, 4588, 4588, 4588, 4600, 4600, 4600, 4616, 4616, 4616, 4628, 4628, 4628, 4628, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4652, 4652, 4652, 4652, 4652, 4652, 4652, 4652,
+	13, 41, 69, 97, 125, 153, 181, 209, 237, 265, 293, 321, 348, 377, 404, 433, 460, 487, 516, 543, 570, 599, 627, 653, 682, 708, 738, 764, 792, 820, 847, 875,
+	901, 929, 957, 983, 1010, 1038, 1066, 1093, 1120, 1147, 1172, 1201, 1228, 1255, 1282, 1307, 1335, 1361, 1387, 1413, 1440, 1468, 1496, 1520, 1545, 1575, 1601, 1627, 1649, 1676, 1704, 1727,
+	1755, 1779, 1808, 1833, 1858, 1883, 1909, 1935, 1961, 1983, 2010, 2037, 2060, 2082, 2110, 2132, 2156, 2186, 2210, 2234, 2258, 2282, 2308, 2326, 2352, 2376, 2402, 2422, 2448, 2468, 2496, 2516,
+	2544, 2564, 2584, 2614, 2634, 2656, 2678, 2700, 2722, 2744, 2766, 2788, 2812, 2834, 2858, 2880, 2896, 2920, 2944, 2960, 2984, 3008, 3024, 3050, 3066, 3090, 3108, 3132, 3150, 3168, 3192, 3210,
+	3228, 3246, 3272, 3290, 3308, 3326, 3344, 3362, 3380, 3398, 3416, 3434, 3454, 3472, 3492, 3510, 3530, 3548, 3558, 3578, 3596, 3616, 3636, 3646, 3666, 3686, 3696, 3716, 3726, 3746, 3766, 3776,
+	3796, 3808, 3828, 3838, 3848, 3870, 3880, 3902, 3912, 3922, 3944, 3954, 3966, 3986, 3998, 4008, 4020, 4030, 4052, 4062, 4074, 4084, 4096, 4108, 4120, 4128, 4140, 4152, 4164, 4176, 4184, 4196,
+	4208, 4220, 4232, 4244, 4256, 4264, 4276, 4276, 4288, 4300, 4312, 4312, 4324, 4336, 4348, 4348, 4360, 4372, 4372, 4384, 4396, 4396, 4408, 4408, 4420, 4432, 4432, 4444, 4444, 4456, 4456, 4468,
+	4468, 4468, 4480, 4480, 4492, 4492, 4492, 4504, 4504, 4504, 4516, 4516, 4516, 4528, 4528, 4528, 4528, 4540, 4540, 4540, 4540, 4540, 4540, 4540, 4552, 4552, 4552, 4552, 4552, 4552, 4552, 4552,
+	13, 41, 68, 95, 122, 150, 177, 205, 232, 259, 286, 314, 341, 369, 396, 423, 450, 477, 505, 532, 558, 586, 614, 639, 667, 693, 722, 748, 775, 802, 829, 856,
+	882, 909, 936, 962, 988, 1015, 1044, 1069, 1096, 1123, 1147, 1176, 1201, 1228, 1255, 1279, 1307, 1332, 1357, 1383, 1409, 1436, 1464, 1488, 1512, 1541, 1566, 1592, 1614, 1640, 1667, 1690,
+	1717, 1741, 1769, 1794, 1818, 1843, 1868, 1893, 1919, 1940, 1966, 1993, 2015, 2037, 2064, 2088, 2110, 2138, 2162, 2186, 2210, 2234, 2258, 2276, 2300, 2326, 2352, 2370, 2396, 2416, 2442, 2462,
+	2488, 2510, 2530, 2558, 2578, 2600, 2620, 2642, 2664, 2684, 2706, 2728, 2752, 2774, 2796, 2818, 2834, 2858, 2880, 2896, 2920, 2944, 2960, 2984, 3000, 3024, 3040, 3066, 3082, 3100, 3124, 3142,
+	3158, 3176, 3202, 3218, 3236, 3254, 3272, 3290, 3308, 3326, 3344, 3362, 3380, 3398, 3416, 3434, 3454, 3472, 3482, 3500, 3520, 3538, 3558, 3568, 3588, 3606, 3616, 3636, 3646, 3666, 3686, 3696,
+	3716, 3726, 3746, 3756, 3766, 3786, 3796, 3818, 3828, 3838, 3860, 3870, 3880, 3902, 3912, 3922, 3932, 3944, 3966, 3976, 3986, 3998, 4008, 4020, 4030, 4040, 4052, 4062, 4074, 4084, 4096, 4108,
+	4120, 4128, 4140, 4152, 4164, 4176, 4184, 4184, 4196, 4208, 4220, 4220, 4232, 4244, 4256, 4256, 4264, 4276, 4276, 4288, 4300, 4300, 4312, 4312, 4324, 4336, 4336, 4348, 4348, 4360, 4360, 4372,
+	4372, 4372, 4384, 4384, 4396, 4396, 4396, 4408, 4408, 4408, 4420, 4420, 4420, 4432, 4432, 4432, 4432, 4444, 4444, 4444, 4444, 4444, 4444, 4444, 4456, 4456, 4456, 4456, 4456, 4456, 4456, 4456,
+	13, 40, 66, 93, 120, 147, 173, 200, 227, 253, 280, 307, 333, 361, 387, 414, 441, 467, 494, 520, 546, 573, 600, 625, 653, 678, 706, 732, 758, 785, 811, 838,
+	863, 889, 916, 941, 967, 994, 1021, 1046, 1072, 1099, 1123, 1150, 1176, 1201, 1228, 1251, 1279, 1303, 1328, 1353, 1379, 1406, 1433, 1456, 1480, 1508, 1533, 1558, 1579, 1605, 1631, 1654,
+	1681, 1704, 1732, 1755, 1779, 1803, 1828, 1853, 1878, 1898, 1924, 1951, 1972, 1993, 2020, 2042, 2064, 2092, 2116, 2138, 2162, 2186, 2210, 2228, 2252, 2276, 2300, 2320, 2344, 2364, 2390, 2410,
+	2436, 2456, 2476, 2502, 2522, 2544, 2564, 2584, 2606, 2628, 2648, 2670, 2692, 2714, 2736, 2758, 2774, 2796, 2818, 2834, 2858, 2880, 2896, 2920, 2936, 2960, 2976, 3000, 3016, 3032, 3058, 3074,
+	3090, 3108, 3132, 3150, 3168, 3184, 3202, 3218, 3236, 3254, 3272, 3290, 3308, 3326, 3344, 3362, 3380, 3398, 3408, 3426, 3444, 3464, 3482, 3492, 3510, 3530, 3538, 3558, 3568, 3588, 3606, 3616,
+	3636, 3646, 3666, 3676, 3686, 3706, 3716, 3736, 3746, 3756, 3776, 3786, 3796, 3818, 3828, 3838, 3848, 3860, 3880, 3890, 3902, 3912, 3922, 3932, 3944, 3954, 3966, 3976, 3986, 3998, 4008, 4020,
+	4030, 4040, 4052, 4062, 4074, 4084, 4096, 4096, 4108, 4120, 4128, 4128, 4140, 4152, 4164, 4164, 4176, 4184, 4184, 4196, 4208, 4208, 4220, 4220, 4232, 4244, 4244, 4256, 4256, 4264, 4264, 4276,
+	4276, 4276, 4288, 4288, 4300, 4300, 4300, 4312, 4312, 4312, 4324, 4324, 4324, 4336, 4336, 4336, 4336, 4348, 4348, 4348, 4348, 4348, 4348, 4348, 4360, 4360, 4360, 4360, 4360, 4360, 4360, 4360,
+	13, 39, 65, 91, 117, 143, 170, 196, 222, 248, 274, 301, 326, 353, 379, 405, 431, 457, 483, 509, 534, 561, 588, 612, 639, 664, 691, 716, 742, 768, 794, 820,
+	845, 870, 897, 921, 946, 972, 999, 1024, 1049, 1075, 1099, 1126, 1150, 1176, 1201, 1224, 1251, 1275, 1300, 1324, 1350, 1376, 1402, 1425, 1448, 1476, 1500, 1525, 1545, 1571, 1596, 1618,
+	1645, 1667, 1694, 1717, 1741, 1765, 1789, 1813, 1838, 1858, 1883, 1909, 1930, 1951, 1977, 1999, 2020, 2048, 2070, 2092, 2116, 2138, 2162, 2180, 2204, 2228, 2252, 2270, 2294, 2314, 2338, 2358,
+	2384, 2402, 2422, 2448, 2468, 2488, 2510, 2530, 2550, 2572, 2592, 2614, 2634, 2656, 2678, 2700, 2714, 2736, 2758, 2774, 2796, 2818, 2834, 2858, 2872, 2896, 2912, 2936, 2952, 2968, 2992, 3008,
+	3024, 3040, 3066, 3082, 3100, 3116, 3132, 3150, 3168, 3184, 3202, 3218, 3236, 3254, 3272, 3290, 3308, 3326, 3334, 3352, 3370, 3388, 3408, 3416, 3434, 3454, 3464, 3482, 3492, 3510, 3530, 3538,
+	3558, 3568, 3588, 3596, 3606, 3626, 3636, 3656, 3666, 3676, 3696, 3706, 3716, 3736, 3746, 3756, 3766, 3776, 3796, 3808, 3818, 3828, 3838, 3848, 3860, 3870, 3880, 3890, 3902, 3912, 3922, 3932,
+	3944, 3954, 3966, 3976, 3986, 3998, 4008, 4008, 4020, 4030, 4040, 4040, 4052, 4062, 4074, 4074, 4084, 4096, 4096, 4108, 4120, 4120, 4128, 4128, 4140, 4152, 4152, 4164, 4164, 4176, 4176, 4184,
+	4184, 4184, 4196, 4196, 4208, 4208, 4208, 4220, 4220, 4220, 4232, 4232, 4232, 4244, 4244, 4244, 4244, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4264, 4264, 4264, 4264, 4264, 4264, 4264, 4264,
+	12, 38, 64, 89, 115, 140, 166, 192, 217, 243, 268, 294, 319, 345, 371, 397, 422, 447, 473, 498, 523, 549, 575, 599, 625, 650, 676, 701, 726, 752, 777, 802,
+	827, 852, 877, 901, 926, 952, 978, 1002, 1027, 1052, 1075, 1102, 1126, 1150, 1176, 1198, 1224, 1248, 1272, 1296, 1321, 1346, 1372, 1394, 1417, 1444, 1468, 1492, 1512, 1537, 1562, 1584,
+	1609, 1631, 1658, 1681, 1704, 1727, 1750, 1774, 1798, 1818, 1843, 1868, 1888, 1909, 1935, 1956, 1977, 2004, 2026, 2048, 2070, 2092, 2116, 2132, 2156, 2180, 2204, 2222, 2246, 2264, 2288, 2308,
+	2332, 2352, 2370, 2396, 2416, 2436, 2456, 2476, 2496, 2516, 2536, 2558, 2578, 2600, 2620, 2642, 2656, 2678, 2700, 2714, 2736, 2758, 2774, 2796, 2812, 2834, 2850, 2872, 2888, 2904, 2928, 2944,
+	2960, 2976, 3000, 3016, 3032, 3050, 3066, 3082, 3100, 3116, 3132, 3150, 3168, 3184, 3202, 3218, 3236, 3254, 3262, 3280, 3298, 3316, 3334, 3344, 3362, 3380, 3388, 3408, 3416, 3434, 3454, 3464,
+	3482, 3492, 3510, 3520, 3530, 3548, 3558, 3578, 3588, 3596, 3616, 3626, 3636, 3656, 3666, 3676, 3686, 3696, 3716, 3726, 3736, 3746, 3756, 3766, 3776, 3786, 3796, 3808, 3818, 3828, 3838, 3848,
+	3860, 3870, 3880, 3890, 3902, 3912, 3922, 3922, 3932, 3944, 3954, 3954, 3966, 3976, 3986, 3986, 3998, 4008, 4008, 4020, 4030, 4030, 4040, 4040, 4052, 4062, 4062, 4074, 4074, 4084, 4084, 4096,
+	4096, 4096, 4108, 4108, 4120, 4120, 4120, 4128, 4128, 4128, 4140, 4140, 4140, 4152, 4152, 4152, 4152, 4164, 4164, 4164, 4164, 4164, 4164, 4164, 4176, 4176, 4176, 4176, 4176, 4176, 4176, 4176,
+	12, 37, 62, 87, 112, 137, 162, 188, 213, 238, 263, 288, 312, 338, 363, 388, 413, 437, 463, 487, 512, 537, 563, 586, 612, 636, 662, 686, 710, 736, 760, 785,
+	809, 833, 858, 882, 906, 931, 957, 980, 1005, 1030, 1052, 1078, 1102, 1126, 1150, 1172, 1198, 1221, 1244, 1268, 1292, 1317, 1342, 1364, 1387, 1413, 1436, 1460, 1480, 1504, 1529, 1550,
+	1575, 1596, 1623, 1645, 1667, 1690, 1713, 1736, 1760, 1779, 1803, 1828, 1848, 1868, 1893, 1914, 1935, 1961, 1983, 2004, 2026, 2048, 2070, 2088, 2110, 2132, 2156, 2174, 2198, 2216, 2240, 2258,
+	2282, 2300, 2320, 2344, 2364, 2384, 2402, 2422, 2442, 2462, 2482, 2502, 2522, 2544, 2564, 2584, 2600, 2620, 2642, 2656, 2678, 2700, 2714, 2736, 2752, 2774, 2788, 2812, 2826, 2842, 2866, 2880,
+	2896, 2912, 2936, 2952, 2968, 2984, 3000, 3016, 3032, 3050, 3066, 3082, 3100, 3116, 3132, 3150, 3168, 3184, 3192, 3210, 3228, 3246, 3262, 3272, 3290, 3308, 3316, 3334, 3344, 3362, 3380, 3388,
+	3408, 3416, 3434, 3444, 3454, 3472, 3482, 3500, 3510, 3520, 3538, 3548, 3558, 3578, 3588, 3596, 3606, 3616, 3636, 3646, 3656, 3666, 3676, 3686, 3696, 3706, 3716, 3726, 3736, 3746, 3756, 3766,
+	3776, 3786, 3796, 3808, 3818, 3828, 3838, 3838, 3848, 3860, 3870, 3870, 3880, 3890, 3902, 3902, 3912, 3922, 3922, 3932, 3944, 3944, 3954, 3954, 3966, 3976, 3976, 3986, 3986, 3998, 3998, 4008,
+	4008, 4008, 4020, 4020, 4030, 4030, 4030, 4040, 4040, 4040, 4052, 4052, 4052, 4062, 4062, 4062, 4062, 4074, 4074, 4074, 4074, 4074, 4074, 4074, 4084, 4084, 4084, 4084, 4084, 4084, 4084, 4084,
+	12, 36, 61, 85, 110, 134, 159, 184, 208, 232, 257, 282, 306, 331, 355, 380, 404, 428, 453, 477, 501, 526, 551, 573, 599, 622, 648, 671, 695, 720, 744, 768,
+	792, 815, 840, 863, 887, 911, 936, 959, 983, 1007, 1030, 1055, 1078, 1102, 1126, 1147, 1172, 1195, 1218, 1241, 1265, 1289, 1314, 1335, 1357, 1383, 1406, 1429, 1448, 1472, 1496, 1516,
+	1541, 1562, 1588, 1609, 1631, 1654, 1676, 1699, 1722, 1741, 1765, 1789, 1808, 1828, 1853, 1873, 1893, 1919, 1940, 1961, 1983, 2004, 2026, 2042, 2064, 2088, 2110, 2128, 2150, 2168, 2192, 2210,
+	2234, 2252, 2270, 2294, 2314, 2332, 2352, 2370, 2390, 2410, 2428, 2448, 2468, 2488, 2510, 2530, 2544, 2564, 2584, 2600, 2620, 2642, 2656, 2678, 2692, 2714, 2728, 2752, 2766, 2782, 2804, 2818,
+	2834, 2850, 2872, 2888, 2904, 2920, 2936, 2952, 2968, 2984, 3000, 3016, 3032, 3050, 3066, 3082, 3100, 3116, 3124, 3142, 3158, 3176, 3192, 3202, 3218, 3236, 3246, 3262, 3272, 3290, 3308, 3316,
+	3334, 3344, 3362, 3370, 3380, 3398, 3408, 3426, 3434, 3444, 3464, 3472, 3482, 3500, 3510, 3520, 3530, 3538, 3558, 3568, 3578, 3588, 3596, 3606, 3616, 3626, 3636, 3646, 3656, 3666, 3676, 3686,
+	3696, 3706, 3716, 3726, 3736, 3746, 3756, 3756, 3766, 3776, 3786, 3786, 3796, 3808, 3818, 3818, 3828, 3838, 3838, 3848, 3860, 3860, 3870, 3870, 3880, 3890, 3890, 3902, 3902, 3912, 3912, 3922,
+	3922, 3922, 3932, 3932, 3944, 3944, 3944, 3954, 3954, 3954, 3966, 3966, 3966, 3976, 3976, 3976, 3976, 3986, 3986, 3986, 3986, 3986, 3986, 3986, 3998, 3998, 3998, 3998, 3998, 3998, 3998, 3998,
+	12, 36, 59, 83, 107, 131, 156, 180, 203, 227, 251, 276, 299, 324, 347, 372, 396, 419, 443, 467, 490, 515, 539, 561, 586, 609, 634, 657, 680, 704, 728, 752,
+	775, 798, 822, 845, 868, 892, 916, 939, 962, 986, 1007, 1032, 1055, 1078, 1102, 1123, 1147, 1169, 1192, 1214, 1238, 1261, 1286, 1307, 1328, 1353, 1376, 1398, 1417, 1440, 1464, 1484,
+	1508, 1529, 1554, 1575, 1596, 1618, 1640, 1663, 1685, 1704, 1727, 1750, 1769, 1789, 1813, 1833, 1853, 1878, 1898, 1919, 1940, 1961, 1983, 1999, 2020, 2042, 2064, 2082, 2104, 2122, 2144, 2162,
+	2186, 2204, 2222, 2246, 2264, 2282, 2300, 2320, 2338, 2358, 2376, 2396, 2416, 2436, 2456, 2476, 2488, 2510, 2530, 2544, 2564, 2584, 2600, 2620, 2634, 2656, 2670, 2692, 2706, 2722, 2744, 2758,
+	2774, 2788, 2812, 2826, 2842, 2858, 2872, 2888, 2904, 2920, 2936, 2952, 2968, 2984, 3000, 3016, 3032, 3050, 3058, 3074, 3090, 3108, 3124, 3132, 3150, 3168, 3176, 3192, 3202, 3218, 3236, 3246,
+	3262, 3272, 3290, 3298, 3308, 3326, 3334, 3352, 3362, 3370, 3388, 3398, 3408, 3426, 3434, 3444, 3454, 3464, 3482, 3492, 3500, 3510, 3520, 3530, 3538, 3548, 3558, 3568, 3578, 3588, 3596, 3606,
+	3616, 3626, 3636, 3646, 3656, 3666, 3676, 3676, 3686, 3696, 3706, 3706, 3716, 3726, 3736, 3736, 3746, 3756, 3756, 3766, 3776, 3776, 3786, 3786, 3796, 3808, 3808, 3818, 3818, 3828, 3828, 3838,
+	3838, 3838, 3848, 3848, 3860, 3860, 3860, 3870, 3870, 3870, 3880, 3880, 3880, 3890, 3890, 3890, 3890, 3902, 3902, 3902, 3902, 3902, 3902, 3902, 3912, 3912, 3912, 3912, 3912, 3912, 3912, 3912,
+	11, 35, 58, 82, 105, 129, 152, 176, 199, 223, 246, 270, 293, 317, 340, 364, 387, 410, 434, 457, 479, 503, 527, 549, 573, 596, 620, 643, 666, 689, 712, 736,
+	758, 781, 804, 827, 849, 873, 897, 919, 941, 965, 986, 1010, 1032, 1055, 1078, 1099, 1123, 1144, 1166, 1188, 1211, 1234, 1258, 1279, 1300, 1324, 1346, 1368, 1387, 1409, 1433, 1452,
+	1476, 1496, 1520, 1541, 1562, 1584, 1605, 1627, 1649, 1667, 1690, 1713, 1732, 1750, 1774, 1794, 1813, 1838, 1858, 1878, 1898, 1919, 1940, 1956, 1977, 1999, 2020, 2037, 2060, 2076, 2098, 2116,
+	2138, 2156, 2174, 2198, 2216, 2234, 2252, 2270, 2288, 2308, 2326, 2344, 2364, 2384, 2402, 2422, 2436, 2456, 2476, 2488, 2510, 2530, 2544, 2564, 2578, 2600, 2614, 2634, 2648, 2664, 2684, 2700,
+	2714, 2728, 2752, 2766, 2782, 2796, 2812, 2826, 2842, 2858, 2872, 2888, 2904, 2920, 2936, 2952, 2968, 2984, 2992, 3008, 3024, 3040, 3058, 3066, 3082, 3100, 3108, 3124, 3132, 3150, 3168, 3176,
+	3192, 3202, 3218, 3228, 3236, 3254, 3262, 3280, 3290, 3298, 3316, 3326, 3334, 3352, 3362, 3370, 3380, 3388, 3408, 3416, 3426, 3434, 3444, 3454, 3464, 3472, 3482, 3492, 3500, 3510, 3520, 3530,
+	3538, 3548, 3558, 3568, 3578, 3588, 3596, 3596, 3606, 3616, 3626, 3626, 3636, 3646, 3656, 3656, 3666, 3676, 3676, 3686, 3696, 3696, 3706, 3706, 3716, 3726, 3726, 3736, 3736, 3746, 3746, 3756,
+	3756, 3756, 3766, 3766, 3776, 3776, 3776, 3786, 3786, 3786, 3796, 3796, 3796, 3808, 3808, 3808, 3808, 3818, 3818, 3818, 3818, 3818, 3818, 3818, 3828, 3828, 3828, 3828, 3828, 3828, 3828, 3828,
+	11, 34, 57, 80, 103, 126, 149, 172, 195, 218, 241, 264, 286, 310, 333, 356, 379, 401, 424, 447, 469, 493, 516, 537, 561, 583, 607, 629, 651, 675, 697, 720,
+	742, 764, 787, 809, 831, 854, 877, 899, 921, 944, 965, 988, 1010, 1032, 1055, 1075, 1099, 1120, 1141, 1163, 1185, 1208, 1231, 1251, 1272, 1296, 1317, 1339, 1357, 1379, 1402, 1421,
+	1444, 1464, 1488, 1508, 1529, 1550, 1571, 1592, 1614, 1631, 1654, 1676, 1694, 1713, 1736, 1755, 1774, 1798, 1818, 1838, 1858, 1878, 1898, 1914, 1935, 1956, 1977, 1993, 2015, 2031, 2054, 2070,
+	2092, 2110, 2128, 2150, 2168, 2186, 2204, 2222, 2240, 2258, 2276, 2294, 2314, 2332, 2352, 2370, 2384, 2402, 2422, 2436, 2456, 2476, 2488, 2510, 2522, 2544, 2558, 2578, 2592, 2606, 2628, 2642,
+	2656, 2670, 2692, 2706, 2722, 2736, 2752, 2766, 2782, 2796, 2812, 2826, 2842, 2858, 2872, 2888, 2904, 2920, 2928, 2944, 2960, 2976, 2992, 3000, 3016, 3032, 3040, 3058, 3066, 3082, 3100, 3108,
+	3124, 3132, 3150, 3158, 3168, 3184, 3192, 3210, 3218, 3228, 3246, 3254, 3262, 3280, 3290, 3298, 3308, 3316, 3334, 3344, 3352, 3362, 3370, 3380, 3388, 3398, 3408, 3416, 3426, 3434, 3444, 3454,
+	3464, 3472, 3482, 3492, 3500, 3510, 3520, 3520, 3530, 3538, 3548, 3548, 3558, 3568, 3578, 3578, 3588, 3596, 3596, 3606, 3616, 3616, 3626, 3626, 3636, 3646, 3646, 3656, 3656, 3666, 3666, 3676,
+	3676, 3676, 3686, 3686, 3696, 3696, 3696, 3706, 3706, 3706, 3716, 3716, 3716, 3726, 3726, 3726, 3726, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3746, 3746, 3746, 3746, 3746, 3746, 3746, 3746,
+	11, 33, 56, 78, 101, 123, 146, 168, 191, 213, 236, 258, 280, 303, 325, 348, 371, 392, 415, 437, 459, 482, 505, 526, 549, 570, 594, 615, 637, 660, 682, 704,
+	726, 748, 770, 792, 813, 836, 858, 880, 901, 924, 944, 967, 988, 1010, 1032, 1052, 1075, 1096, 1117, 1138, 1160, 1182, 1205, 1224, 1244, 1268, 1289, 1310, 1328, 1350, 1372, 1391,
+	1413, 1433, 1456, 1476, 1496, 1516, 1537, 1558, 1579, 1596, 1618, 1640, 1658, 1676, 1699, 1717, 1736, 1760, 1779, 1798, 1818, 1838, 1858, 1873, 1893, 1914, 1935, 1951, 1972, 1988, 2010, 2026,
+	2048, 2064, 2082, 2104, 2122, 2138, 2156, 2174, 2192, 2210, 2228, 2246, 2264, 2282, 2300, 2320, 2332, 2352, 2370, 2384, 2402, 2422, 2436, 2456, 2468, 2488, 2502, 2522, 2536, 2550, 2572, 2584,
+	2600, 2614, 2634, 2648, 2664, 2678, 2692, 2706, 2722, 2736, 2752, 2766, 2782, 2796, 2812, 2826, 2842, 2858, 2866, 2880, 2896, 2912, 2928, 2936, 2952, 2968, 2976, 2992, 3000, 3016, 3032, 3040,
+	3058, 3066, 3082, 3090, 3100, 3116, 3124, 3142, 3150, 3158, 3176, 3184, 3192, 3210, 3218, 3228, 3236, 3246, 3262, 3272, 3280, 3290, 3298, 3308, 3316, 3326, 3334, 3344, 3352, 3362, 3370, 3380,
+	3388, 3398, 3408, 3416, 3426, 3434, 3444, 3444, 3454, 3464, 3472, 3472, 3482, 3492, 3500, 3500, 3510, 3520, 3520, 3530, 3538, 3538, 3548, 3548, 3558, 3568, 3568, 3578, 3578, 3588, 3588, 3596,
+	3596, 3596, 3606, 3606, 3616, 3616, 3616, 3626, 3626, 3626, 3636, 3636, 3636, 3646, 3646, 3646, 3646, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3666, 3666, 3666, 3666, 3666, 3666, 3666, 3666,
+	11, 33, 55, 76, 99, 120, 143, 165, 187, 209, 231, 253, 274, 297, 318, 341, 363, 384, 406, 428, 449, 472, 494, 515, 537, 558, 581, 602, 624, 646, 667, 689,
+	710, 732, 754, 775, 796, 818, 840, 861, 882, 904, 924, 946, 967, 988, 1010, 1030, 1052, 1072, 1093, 1114, 1135, 1157, 1179, 1198, 1218, 1241, 1261, 1282, 1300, 1321, 1342, 1361,
+	1383, 1402, 1425, 1444, 1464, 1484, 1504, 1525, 1545, 1562, 1584, 1605, 1623, 1640, 1663, 1681, 1699, 1722, 1741, 1760, 1779, 1798, 1818, 1833, 1853, 1873, 1893, 1909, 1930, 1945, 1966, 1983,
+	2004, 2020, 2037, 2060, 2076, 2092, 2110, 2128, 2144, 2162, 2180, 2198, 2216, 2234, 2252, 2270, 2282, 2300, 2320, 2332, 2352, 2370, 2384, 2402, 2416, 2436, 2448, 2468, 2482, 2496, 2516, 2530,
+	2544, 2558, 2578, 2592, 2606, 2620, 2634, 2648, 2664, 2678, 2692, 2706, 2722, 2736, 2752, 2766, 2782, 2796, 2804, 2818, 2834, 2850, 2866, 2872, 2888, 2904, 2912, 2928, 2936, 2952, 2968, 2976,
+	2992, 3000, 3016, 3024, 3032, 3050, 3058, 3074, 3082, 3090, 3108, 3116, 3124, 3142, 3150, 3158, 3168, 3176, 3192, 3202, 3210, 3218, 3228, 3236, 3246, 3254, 3262, 3272, 3280, 3290, 3298, 3308,
+	3316, 3326, 3334, 3344, 3352, 3362, 3370, 3370, 3380, 3388, 3398, 3398, 3408, 3416, 3426, 3426, 3434, 3444, 3444, 3454, 3464, 3464, 3472, 3472, 3482, 3492, 3492, 3500, 3500, 3510, 3510, 3520,
+	3520, 3520, 3530, 3530, 3538, 3538, 3538, 3548, 3548, 3548, 3558, 3558, 3558, 3568, 3568, 3568, 3568, 3578, 3578, 3578, 3578, 3578, 3578, 3578, 3588, 3588, 3588, 3588, 3588, 3588, 3588, 3588,
+	10, 32, 53, 75, 96, 118, 140, 161, 183, 204, 226, 247, 268, 290, 312, 333, 355, 376, 398, 419, 440, 462, 483, 503, 526, 546, 569, 589, 610, 632, 653, 675,
+	695, 716, 738, 758, 779, 800, 822, 842, 863, 884, 904, 926, 946, 967, 988, 1007, 1030, 1049, 1069, 1090, 1111, 1132, 1154, 1172, 1192, 1214, 1234, 1255, 1272, 1292, 1314, 1332,
+	1353, 1372, 1394, 1413, 1433, 1452, 1472, 1492, 1512, 1529, 1550, 1571, 1588, 1605, 1627, 1645, 1663, 1685, 1704, 1722, 1741, 1760, 1779, 1794, 1813, 1833, 1853, 1868, 1888, 1904, 1924, 1940,
+	1961, 1977, 1993, 2015, 2031, 2048, 2064, 2082, 2098, 2116, 2132, 2150, 2168, 2186, 2204, 2222, 2234, 2252, 2270, 2282, 2300, 2320, 2332, 2352, 2364, 2384, 2396, 2416, 2428, 2442, 2462, 2476,
+	2488, 2502, 2522, 2536, 2550, 2564, 2578, 2592, 2606, 2620, 2634, 2648, 2664, 2678, 2692, 2706, 2722, 2736, 2744, 2758, 2774, 2788, 2804, 2812, 2826, 2842, 2850, 2866, 2872, 2888, 2904, 2912,
+	2928, 2936, 2952, 2960, 2968, 2984, 2992, 3008, 3016, 3024, 3040, 3050, 3058, 3074, 3082, 3090, 3100, 3108, 3124, 3132, 3142, 3150, 3158, 3168, 3176, 3184, 3192, 3202, 3210, 3218, 3228, 3236,
+	3246, 3254, 3262, 3272, 3280, 3290, 3298, 3298, 3308, 3316, 3326, 3326, 3334, 3344, 3352, 3352, 3362, 3370, 3370, 3380, 3388, 3388, 3398, 3398, 3408, 3416, 3416, 3426, 3426, 3434, 3434, 3444,
+	3444, 3444, 3454, 3454, 3464, 3464, 3464, 3472, 3472, 3472, 3482, 3482, 3482, 3492, 3492, 3492, 3492, 3500, 3500, 3500, 3500, 3500, 3500, 3500, 3510, 3510, 3510, 3510, 3510, 3510, 3510, 3510,
+	10, 31, 52, 73, 94, 115, 137, 158, 179, 200, 221, 242, 263, 284, 305, 326, 347, 368, 389, 410, 430, 452, 473, 493, 515, 534, 557, 577, 597, 619, 639, 660,
+	680, 701, 722, 742, 762, 783, 804, 824, 845, 866, 884, 906, 926, 946, 967, 986, 1007, 1027, 1046, 1066, 1087, 1108, 1129, 1147, 1166, 1188, 1208, 1228, 1244, 1265, 1286, 1303,
+	1324, 1342, 1364, 1383, 1402, 1421, 1440, 1460, 1480, 1496, 1516, 1537, 1554, 1571, 1592, 1609, 1627, 1649, 1667, 1685, 1704, 1722, 1741, 1755, 1774, 1794, 1813, 1828, 1848, 1863, 1883, 1898,
+	1919, 1935, 1951, 1972, 1988, 2004, 2020, 2037, 2054, 2070, 2088, 2104, 2122, 2138, 2156, 2174, 2186, 2204, 2222, 2234, 2252, 2270, 2282, 2300, 2314, 2332, 2344, 2364, 2376, 2390, 2410, 2422,
+	2436, 2448, 2468, 2482, 2496, 2510, 2522, 2536, 2550, 2564, 2578, 2592, 2606, 2620, 2634, 2648, 2664, 2678, 2684, 2700, 2714, 2728, 2744, 2752, 2766, 2782, 2788, 2804, 2812, 2826, 2842, 2850,
+	2866, 2872, 2888, 2896, 2904, 2920, 2928, 2944, 2952, 2960, 2976, 2984, 2992, 3008, 3016, 3024, 3032, 3040, 3058, 3066, 3074, 3082, 3090, 3100, 3108, 3116, 3124, 3132, 3142, 3150, 3158, 3168,
+	3176, 3184, 3192, 3202, 3210, 3218, 3228, 3228, 3236, 3246, 3254, 3254, 3262, 3272, 3280, 3280, 3290, 3298, 3298, 3308, 3316, 3316, 3326, 3326, 3334, 3344, 3344, 3352, 3352, 3362, 3362, 3370,
+	3370, 3370, 3380, 3380, 3388, 3388, 3388, 3398, 3398, 3398, 3408, 3408, 3408, 3416, 3416, 3416, 3416, 3426, 3426, 3426, 3426, 3426, 3426, 3426, 3434, 3434, 3434, 3434, 3434, 3434, 3434, 3434,
+	10, 30, 51, 72, 92, 113, 134, 154, 175, 195, 216, 237, 257, 278, 298, 319, 340, 360, 381, 401, 421, 442, 463, 482, 503, 523, 545, 564, 584, 605, 625, 646,
+	666, 686, 706, 726, 746, 766, 787, 807, 827, 847, 866, 887, 906, 926, 946, 965, 986, 1005, 1024, 1044, 1064, 1084, 1105, 1123, 1141, 1163, 1182, 1201, 1218, 1238, 1258, 1275,
+	1296, 1314, 1335, 1353, 1372, 1391, 1409, 1429, 1448, 1464, 1484, 1504, 1520, 1537, 1558, 1575, 1592, 1614, 1631, 1649, 1667, 1685, 1704, 1717, 1736, 1755, 1774, 1789, 1808, 1823, 1843, 1858,
+	1878, 1893, 1909, 1930, 1945, 1961, 1977, 1993, 2010, 2026, 2042, 2060, 2076, 2092, 2110, 2128, 2138, 2156, 2174, 2186, 2204, 2222, 2234, 2252, 2264, 2282, 2294, 2314, 2326, 2338, 2358, 2370,
+	2384, 2396, 2416, 2428, 2442, 2456, 2468, 2482, 2496, 2510, 2522, 2536, 2550, 2564, 2578, 2592, 2606, 2620, 2628, 2642, 2656, 2670, 2684, 2692, 2706, 2722, 2728, 2744, 2752, 2766, 2782, 2788,
+	2804, 2812, 2826, 2834, 2842, 2858, 2866, 2880, 2888, 2896, 2912, 2920, 2928, 2944, 2952, 2960, 2968, 2976, 2992, 3000, 3008, 3016, 3024, 3032, 3040, 3050, 3058, 3066, 3074, 3082, 3090, 3100,
+	3108, 3116, 3124, 3132, 3142, 3150, 3158, 3158, 3168, 3176, 3184, 3184, 3192, 3202, 3210, 3210, 3218, 3228, 3228, 3236, 3246, 3246, 3254, 3254, 3262, 3272, 3272, 3280, 3280, 3290, 3290, 3298,
+	3298, 3298, 3308, 3308, 3316, 3316, 3316, 3326, 3326, 3326, 3334, 3334, 3334, 3344, 3344, 3344, 3344, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3362, 3362, 3362, 3362, 3362, 3362, 3362, 3362,
+	10, 30, 50, 70, 90, 110, 131, 151, 171, 191, 211, 232, 251, 272, 292, 312, 333, 352, 373, 392, 412, 433, 453, 472, 493, 512, 533, 552, 572, 592, 612, 632,
+	651, 671, 691, 710, 730, 750, 770, 789, 809, 829, 847, 868, 887, 906, 926, 944, 965, 983, 1002, 1021, 1041, 1061, 1081, 1099, 1117, 1138, 1157, 1176, 1192, 1211, 1231, 1248,
+	1268, 1286, 1307, 1324, 1342, 1361, 1379, 1398, 1417, 1433, 1452, 1472, 1488, 1504, 1525, 1541, 1558, 1579, 1596, 1614, 1631, 1649, 1667, 1681, 1699, 1717, 1736, 1750, 1769, 1784, 1803, 1818,
+	1838, 1853, 1868, 1888, 1904, 1919, 1935, 1951, 1966, 1983, 1999, 2015, 2031, 2048, 2064, 2082, 2092, 2110, 2128, 2138, 2156, 2174, 2186, 2204, 2216, 2234, 2246, 2264, 2276, 2288, 2308, 2320,
+	2332, 2344, 2364, 2376, 2390, 2402, 2416, 2428, 2442, 2456, 2468, 2482, 2496, 2510, 2522, 2536, 2550, 2564, 2572, 2584, 2600, 2614, 2628, 2634, 2648, 2664, 2670, 2684, 2692, 2706, 2722, 2728,
+	2744, 2752, 2766, 2774, 2782, 2796, 2804, 2818, 2826, 2834, 2850, 2858, 2866, 2880, 2888, 2896, 2904, 2912, 2928, 2936, 2944, 2952, 2960, 2968, 2976, 2984, 2992, 3000, 3008, 3016, 3024, 3032,
+	3040, 3050, 3058, 3066, 3074, 3082, 3090, 3090, 3100, 3108, 3116, 3116, 3124, 3132, 3142, 3142, 3150, 3158, 3158, 3168, 3176, 3176, 3184, 3184, 3192, 3202, 3202, 3210, 3210, 3218, 3218, 3228,
+	3228, 3228, 3236, 3236, 3246, 3246, 3246, 3254, 3254, 3254, 3262, 3262, 3262, 3272, 3272, 3272, 3272, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3290, 3290, 3290, 3290, 3290, 3290, 3290, 3290,
+	9, 29, 49, 69, 88, 108, 128, 148, 167, 187, 207, 227, 246, 266, 286, 306, 325, 344, 365, 384, 403, 423, 443, 462, 482, 501, 522, 540, 560, 580, 599, 619,
+	637, 657, 676, 695, 714, 734, 754, 772, 792, 811, 829, 849, 868, 887, 906, 924, 944, 962, 980, 999, 1018, 1038, 1058, 1075, 1093, 1114, 1132, 1150, 1166, 1185, 1205, 1221,
+	1241, 1258, 1279, 1296, 1314, 1332, 1350, 1368, 1387, 1402, 1421, 1440, 1456, 1472, 1492, 1508, 1525, 1545, 1562, 1579, 1596, 1614, 1631, 1645, 1663, 1681, 1699, 1713, 1732, 1746, 1765, 1779,
+	1798, 1813, 1828, 1848, 1863, 1878, 1893, 1909, 1924, 1940, 1956, 1972, 1988, 2004, 2020, 2037, 2048, 2064, 2082, 2092, 2110, 2128, 2138, 2156, 2168, 2186, 2198, 2216, 2228, 2240, 2258, 2270,
+	2282, 2294, 2314, 2326, 2338, 2352, 2364, 2376, 2390, 2402, 2416, 2428, 2442, 2456, 2468, 2482, 2496, 2510, 2516, 2530, 2544, 2558, 2572, 2578, 2592, 2606, 2614, 2628, 2634, 2648, 2664, 2670,
+	2684, 2692, 2706, 2714, 2722, 2736, 2744, 2758, 2766, 2774, 2788, 2796, 2804, 2818, 2826, 2834, 2842, 2850, 2866, 2872, 2880, 2888, 2896, 2904, 2912, 2920, 2928, 2936, 2944, 2952, 2960, 2968,
+	2976, 2984, 2992, 3000, 3008, 3016, 3024, 3024, 3032, 3040, 3050, 3050, 3058, 3066, 3074, 3074, 3082, 3090, 3090, 3100, 3108, 3108, 3116, 3116, 3124, 3132, 3132, 3142, 3142, 3150, 3150, 3158,
+	3158, 3158, 3168, 3168, 3176, 3176, 3176, 3184, 3184, 3184, 3192, 3192, 3192, 3202, 3202, 3202, 3202, 3210, 3210, 3210, 3210, 3210, 3210, 3210, 3218, 3218, 3218, 3218, 3218, 3218, 3218, 3218,
+	9, 29, 48, 67, 86, 106, 125, 145, 164, 183, 202, 222, 241, 261, 280, 299, 318, 337, 357, 376, 394, 414, 434, 452, 472, 490, 510, 529, 548, 567, 586, 605,
+	624, 643, 662, 680, 699, 718, 738, 756, 775, 794, 811, 831, 849, 868, 887, 904, 924, 941, 959, 978, 996, 1015, 1035, 1052, 1069, 1090, 1108, 1126, 1141, 1160, 1179, 1195,
+	1214, 1231, 1251, 1268, 1286, 1303, 1321, 1339, 1357, 1372, 1391, 1409, 1425, 1440, 1460, 1476, 1492, 1512, 1529, 1545, 1562, 1579, 1596, 1609, 1627, 1645, 1663, 1676, 1694, 1708, 1727, 1741,
+	1760, 1774, 1789, 1808, 1823, 1838, 1853, 1868, 1883, 1898, 1914, 1930, 1945, 1961, 1977, 1993, 2004, 2020, 2037, 2048, 2064, 2082, 2092, 2110, 2122, 2138, 2150, 2168, 2180, 2192, 2210, 2222,
+	2234, 2246, 2264, 2276, 2288, 2300, 2314, 2326, 2338, 2352, 2364, 2376, 2390, 2402, 2416, 2428, 2442, 2456, 2462, 2476, 2488, 2502, 2516, 2522, 2536, 2550, 2558, 2572, 2578, 2592, 2606, 2614,
+	2628, 2634, 2648, 2656, 2664, 2678, 2684, 2700, 2706, 2714, 2728, 2736, 2744, 2758, 2766, 2774, 2782, 2788, 2804, 2812, 2818, 2826, 2834, 2842, 2850, 2858, 2866, 2872, 2880, 2888, 2896, 2904,
+	2912, 2920, 2928, 2936, 2944, 2952, 2960, 2960, 2968, 2976, 2984, 2984, 2992, 3000, 3008, 3008, 3016, 3024, 3024, 3032, 3040, 3040, 3050, 3050, 3058, 3066, 3066, 3074, 3074, 3082, 3082, 3090,
+	3090, 3090, 3100, 3100, 3108, 3108, 3108, 3116, 3116, 3116, 3124, 3124, 3124, 3132, 3132, 3132, 3132, 3142, 3142, 3142, 3142, 3142, 3142, 3142, 3150, 3150, 3150, 3150, 3150, 3150, 3150, 3150,
+	9, 28, 47, 66, 85, 103, 122, 141, 160, 179, 198, 217, 236, 255, 274, 293, 312, 330, 349, 368, 386, 405, 424, 442, 462, 479, 499, 517, 536, 555, 573, 592,
+	610, 629, 648, 666, 684, 703, 722, 740, 758, 777, 794, 813, 831, 849, 868, 884, 904, 921, 939, 957, 975, 994, 1013, 1030, 1046, 1066, 1084, 1102, 1117, 1135, 1154, 1169,
+	1188, 1205, 1224, 1241, 1258, 1275, 1292, 1310, 1328, 1342, 1361, 1379, 1394, 1409, 1429, 1444, 1460, 1480, 1496, 1512, 1529, 1545, 1562, 1575, 1592, 1609, 1627, 1640, 1658, 1672, 1690, 1704,
+	1722, 1736, 1750, 1769, 1784, 1798, 1813, 1828, 1843, 1858, 1873, 1888, 1904, 1919, 1935, 1951, 1961, 1977, 1993, 2004, 2020, 2037, 2048, 2064, 2076, 2092, 2104, 2122, 2132, 2144, 2162, 2174,
+	2186, 2198, 2216, 2228, 2240, 2252, 2264, 2276, 2288, 2300, 2314, 2326, 2338, 2352, 2364, 2376, 2390, 2402, 2410, 2422, 2436, 2448, 2462, 2468, 2482, 2496, 2502, 2516, 2522, 2536, 2550, 2558,
+	2572, 2578, 2592, 2600, 2606, 2620, 2628, 2642, 2648, 2656, 2670, 2678, 2684, 2700, 2706, 2714, 2722, 2728, 2744, 2752, 2758, 2766, 2774, 2782, 2788, 2796, 2804, 2812, 2818, 2826, 2834, 2842,
+	2850, 2858, 2866, 2872, 2880, 2888, 2896, 2896, 2904, 2912, 2920, 2920, 2928, 2936, 2944, 2944, 2952, 2960, 2960, 2968, 2976, 2976, 2984, 2984, 2992, 3000, 3000, 3008, 3008, 3016, 3016, 3024,
+	3024, 3024, 3032, 3032, 3040, 3040, 3040, 3050, 3050, 3050, 3058, 3058, 3058, 3066, 3066, 3066, 3066, 3074, 3074, 3074, 3074, 3074, 3074, 3074, 3082, 3082, 3082, 3082, 3082, 3082, 3082, 3082,
+	9, 27, 46, 64, 83, 101, 120, 138, 157, 175, 194, 213, 231, 249, 268, 286, 305, 323, 342, 360, 378, 397, 415, 433, 452, 469, 489, 506, 524, 543, 561, 580,
+	597, 615, 634, 651, 669, 688, 706, 724, 742, 760, 777, 796, 813, 831, 849, 866, 884, 901, 919, 936, 954, 972, 991, 1007, 1024, 1044, 1061, 1078, 1093, 1111, 1129, 1144,
+	1163, 1179, 1198, 1214, 1231, 1248, 1265, 1282, 1300, 1314, 1332, 1350, 1364, 1379, 1398, 1413, 1429, 1448, 1464, 1480, 1496, 1512, 1529, 1541, 1558, 1575, 1592, 1605, 1623, 1636, 1654, 1667,
+	1685, 1699, 1713, 1732, 1746, 1760, 1774, 1789, 1803, 1818, 1833, 1848, 1863, 1878, 1893, 1909, 1919, 1935, 1951, 1961, 1977, 1993, 2004, 2020, 2031, 2048, 2060, 2076, 2088, 2098, 2116, 2128,
+	2138, 2150, 2168, 2180, 2192, 2204, 2216, 2228, 2240, 2252, 2264, 2276, 2288, 2300, 2314, 2326, 2338, 2352, 2358, 2370, 2384, 2396, 2410, 2416, 2428, 2442, 2448, 2462, 2468, 2482, 2496, 2502,
+	2516, 2522, 2536, 2544, 2550, 2564, 2572, 2584, 2592, 2600, 2614, 2620, 2628, 2642, 2648, 2656, 2664, 2670, 2684, 2692, 2700, 2706, 2714, 2722, 2728, 2736, 2744, 2752, 2758, 2766, 2774, 2782,
+	2788, 2796, 2804, 2812, 2818, 2826, 2834, 2834, 2842, 2850, 2858, 2858, 2866, 2872, 2880, 2880, 2888, 2896, 2896, 2904, 2912, 2912, 2920, 2920, 2928, 2936, 2936, 2944, 2944, 2952, 2952, 2960,
+	2960, 2960, 2968, 2968, 2976, 2976, 2976, 2984, 2984, 2984, 2992, 2992, 2992, 3000, 3000, 3000, 3000, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3016, 3016, 3016, 3016, 3016, 3016, 3016, 3016,
+	9, 27, 45, 63, 81, 99, 117, 135, 153, 172, 190, 208, 226, 244, 262, 280, 298, 316, 334, 352, 370, 388, 406, 423, 442, 459, 478, 495, 513, 532, 549, 567,
+	584, 602, 620, 637, 655, 673, 691, 708, 726, 744, 760, 779, 796, 813, 831, 847, 866, 882, 899, 916, 934, 952, 970, 986, 1002, 1021, 1038, 1055, 1069, 1087, 1105, 1120,
+	1138, 1154, 1172, 1188, 1205, 1221, 1238, 1255, 1272, 1286, 1303, 1321, 1335, 1350, 1368, 1383, 1398, 1417, 1433, 1448, 1464, 1480, 1496, 1508, 1525, 1541, 1558, 1571, 1588, 1601, 1618, 1631,
+	1649, 1663, 1676, 1694, 1708, 1722, 1736, 1750, 1765, 1779, 1794, 1808, 1823, 1838, 1853, 1868, 1878, 1893, 1909, 1919, 1935, 1951, 1961, 1977, 1988, 2004, 2015, 2031, 2042, 2054, 2070, 2082,
+	2092, 2104, 2122, 2132, 2144, 2156, 2168, 2180, 2192, 2204, 2216, 2228, 2240, 2252, 2264, 2276, 2288, 2300, 2308, 2320, 2332, 2344, 2358, 2364, 2376, 2390, 2396, 2410, 2416, 2428, 2442, 2448,
+	2462, 2468, 2482, 2488, 2496, 2510, 2516, 2530, 2536, 2544, 2558, 2564, 2572, 2584, 2592, 2600, 2606, 2614, 2628, 2634, 2642, 2648, 2656, 2664, 2670, 2678, 2684, 2692, 2700, 2706, 2714, 2722,
+	2728, 2736, 2744, 2752, 2758, 2766, 2774, 2774, 2782, 2788, 2796, 2796, 2804, 2812, 2818, 2818, 2826, 2834, 2834, 2842, 2850, 2850, 2858, 2858, 2866, 2872, 2872, 2880, 2880, 2888, 2888, 2896,
+	2896, 2896, 2904, 2904, 2912, 2912, 2912, 2920, 2920, 2920, 2928, 2928, 2928, 2936, 2936, 2936, 2936, 2944, 2944, 2944, 2944, 2944, 2944, 2944, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952,
+	8, 26, 44, 61, 79, 97, 115, 133, 150, 168, 186, 203, 221, 239, 256, 274, 292, 309, 327, 344, 362, 380, 398, 414, 433, 449, 468, 485, 502, 520, 537, 555,
+	572, 589, 607, 624, 641, 658, 676, 693, 710, 728, 744, 762, 779, 796, 813, 829, 847, 863, 880, 897, 914, 931, 949, 965, 980, 999, 1015, 1032, 1046, 1064, 1081, 1096,
+	1114, 1129, 1147, 1163, 1179, 1195, 1211, 1228, 1244, 1258, 1275, 1292, 1307, 1321, 1339, 1353, 1368, 1387, 1402, 1417, 1433, 1448, 1464, 1476, 1492, 1508, 1525, 1537, 1554, 1566, 1584, 1596,
+	1614, 1627, 1640, 1658, 1672, 1685, 1699, 1713, 1727, 1741, 1755, 1769, 1784, 1798, 1813, 1828, 1838, 1853, 1868, 1878, 1893, 1909, 1919, 1935, 1945, 1961, 1972, 1988, 1999, 2010, 2026, 2037,
+	2048, 2060, 2076, 2088, 2098, 2110, 2122, 2132, 2144, 2156, 2168, 2180, 2192, 2204, 2216, 2228, 2240, 2252, 2258, 2270, 2282, 2294, 2308, 2314, 2326, 2338, 2344, 2358, 2364, 2376, 2390, 2396,
+	2410, 2416, 2428, 2436, 2442, 2456, 2462, 2476, 2482, 2488, 2502, 2510, 2516, 2530, 2536, 2544, 2550, 2558, 2572, 2578, 2584, 2592, 2600, 2606, 2614, 2620, 2628, 2634, 2642, 2648, 2656, 2664,
+	2670, 2678, 2684, 2692, 2700, 2706, 2714, 2714, 2722, 2728, 2736, 2736, 2744, 2752, 2758, 2758, 2766, 2774, 2774, 2782, 2788, 2788, 2796, 2796, 2804, 2812, 2812, 2818, 2818, 2826, 2826, 2834,
+	2834, 2834, 2842, 2842, 2850, 2850, 2850, 2858, 2858, 2858, 2866, 2866, 2866, 2872, 2872, 2872, 2872, 2880, 2880, 2880, 2880, 2880, 2880, 2880, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888,
+	8, 26, 43, 60, 78, 95, 112, 130, 147, 164, 182, 199, 216, 234, 251, 268, 286, 302, 320, 337, 354, 372, 389, 405, 423, 440, 458, 474, 491, 509, 526, 543,
+	560, 577, 594, 610, 627, 644, 662, 678, 695, 712, 728, 746, 762, 779, 796, 811, 829, 845, 861, 877, 894, 911, 929, 944, 959, 978, 994, 1010, 1024, 1041, 1058, 1072,
+	1090, 1105, 1123, 1138, 1154, 1169, 1185, 1201, 1218, 1231, 1248, 1265, 1279, 1292, 1310, 1324, 1339, 1357, 1372, 1387, 1402, 1417, 1433, 1444, 1460, 1476, 1492, 1504, 1520, 1533, 1550, 1562,
+	1579, 1592, 1605, 1623, 1636, 1649, 1663, 1676, 1690, 1704, 1717, 1732, 1746, 1760, 1774, 1789, 1798, 1813, 1828, 1838, 1853, 1868, 1878, 1893, 1904, 1919, 1930, 1945, 1956, 1966, 1983, 1993,
+	2004, 2015, 2031, 2042, 2054, 2064, 2076, 2088, 2098, 2110, 2122, 2132, 2144, 2156, 2168, 2180, 2192, 2204, 2210, 2222, 2234, 2246, 2258, 2264, 2276, 2288, 2294, 2308, 2314, 2326, 2338, 2344,
+	2358, 2364, 2376, 2384, 2390, 2402, 2410, 2422, 2428, 2436, 2448, 2456, 2462, 2476, 2482, 2488, 2496, 2502, 2516, 2522, 2530, 2536, 2544, 2550, 2558, 2564, 2572, 2578, 2584, 2592, 2600, 2606,
+	2614, 2620, 2628, 2634, 2642, 2648, 2656, 2656, 2664, 2670, 2678, 2678, 2684, 2692, 2700, 2700, 2706, 2714, 2714, 2722, 2728, 2728, 2736, 2736, 2744, 2752, 2752, 2758, 2758, 2766, 2766, 2774,
+	2774, 2774, 2782, 2782, 2788, 2788, 2788, 2796, 2796, 2796, 2804, 2804, 2804, 2812, 2812, 2812, 2812, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826,
+	8, 25, 42, 59, 76, 93, 110, 127, 144, 161, 178, 195, 211, 229, 245, 263, 280, 296, 313, 330, 346, 364, 381, 397, 414, 430, 448, 464, 481, 498, 515, 532,
+	548, 564, 581, 597, 614, 630, 648, 664, 680, 697, 712, 730, 746, 762, 779, 794, 811, 827, 842, 858, 875, 892, 909, 924, 939, 957, 972, 988, 1002, 1018, 1035, 1049,
+	1066, 1081, 1099, 1114, 1129, 1144, 1160, 1176, 1192, 1205, 1221, 1238, 1251, 1265, 1282, 1296, 1310, 1328, 1342, 1357, 1372, 1387, 1402, 1413, 1429, 1444, 1460, 1472, 1488, 1500, 1516, 1529,
+	1545, 1558, 1571, 1588, 1601, 1614, 1627, 1640, 1654, 1667, 1681, 1694, 1708, 1722, 1736, 1750, 1760, 1774, 1789, 1798, 1813, 1828, 1838, 1853, 1863, 1878, 1888, 1904, 1914, 1924, 1940, 1951,
+	1961, 1972, 1988, 1999, 2010, 2020, 2031, 2042, 2054, 2064, 2076, 2088, 2098, 2110, 2122, 2132, 2144, 2156, 2162, 2174, 2186, 2198, 2210, 2216, 2228, 2240, 2246, 2258, 2264, 2276, 2288, 2294,
+	2308, 2314, 2326, 2332, 2338, 2352, 2358, 2370, 2376, 2384, 2396, 2402, 2410, 2422, 2428, 2436, 2442, 2448, 2462, 2468, 2476, 2482, 2488, 2496, 2502, 2510, 2516, 2522, 2530, 2536, 2544, 2550,
+	2558, 2564, 2572, 2578, 2584, 2592, 2600, 2600, 2606, 2614, 2620, 2620, 2628, 2634, 2642, 2642, 2648, 2656, 2656, 2664, 2670, 2670, 2678, 2678, 2684, 2692, 2692, 2700, 2700, 2706, 2706, 2714,
+	2714, 2714, 2722, 2722, 2728, 2728, 2728, 2736, 2736, 2736, 2744, 2744, 2744, 2752, 2752, 2752, 2752, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2766, 2766, 2766, 2766, 2766, 2766, 2766, 2766,
+	8, 24, 41, 58, 74, 91, 107, 124, 141, 157, 174, 191, 207, 224, 240, 257, 274, 290, 307, 323, 339, 356, 373, 388, 405, 421, 438, 454, 470, 487, 503, 520,
+	536, 552, 569, 584, 600, 617, 634, 650, 666, 682, 697, 714, 730, 746, 762, 777, 794, 809, 824, 840, 856, 873, 889, 904, 919, 936, 952, 967, 980, 996, 1013, 1027,
+	1044, 1058, 1075, 1090, 1105, 1120, 1135, 1150, 1166, 1179, 1195, 1211, 1224, 1238, 1255, 1268, 1282, 1300, 1314, 1328, 1342, 1357, 1372, 1383, 1398, 1413, 1429, 1440, 1456, 1468, 1484, 1496,
+	1512, 1525, 1537, 1554, 1566, 1579, 1592, 1605, 1618, 1631, 1645, 1658, 1672, 1685, 1699, 1713, 1722, 1736, 1750, 1760, 1774, 1789, 1798, 1813, 1823, 1838, 1848, 1863, 1873, 1883, 1898, 1909,
+	1919, 1930, 1945, 1956, 1966, 1977, 1988, 1999, 2010, 2020, 2031, 2042, 2054, 2064, 2076, 2088, 2098, 2110, 2116, 2128, 2138, 2150, 2162, 2168, 2180, 2192, 2198, 2210, 2216, 2228, 2240, 2246,
+	2258, 2264, 2276, 2282, 2288, 2300, 2308, 2320, 2326, 2332, 2344, 2352, 2358, 2370, 2376, 2384, 2390, 2396, 2410, 2416, 2422, 2428, 2436, 2442, 2448, 2456, 2462, 2468, 2476, 2482, 2488, 2496,
+	2502, 2510, 2516, 2522, 2530, 2536, 2544, 2544, 2550, 2558, 2564, 2564, 2572, 2578, 2584, 2584, 2592, 2600, 2600, 2606, 2614, 2614, 2620, 2620, 2628, 2634, 2634, 2642, 2642, 2648, 2648, 2656,
+	2656, 2656, 2664, 2664, 2670, 2670, 2670, 2678, 2678, 2678, 2684, 2684, 2684, 2692, 2692, 2692, 2692, 2700, 2700, 2700, 2700, 2700, 2700, 2700, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706,
+	8, 24, 40, 56, 73, 89, 105, 121, 138, 154, 170, 187, 202, 219, 235, 251, 268, 283, 300, 316, 332, 348, 365, 380, 397, 412, 429, 444, 460, 477, 493, 509,
+	524, 540, 557, 572, 588, 604, 620, 636, 651, 667, 682, 699, 714, 730, 746, 760, 777, 792, 807, 822, 838, 854, 870, 884, 899, 916, 931, 946, 959, 975, 991, 1005,
+	1021, 1035, 1052, 1066, 1081, 1096, 1111, 1126, 1141, 1154, 1169, 1185, 1198, 1211, 1228, 1241, 1255, 1272, 1286, 1300, 1314, 1328, 1342, 1353, 1368, 1383, 1398, 1409, 1425, 1436, 1452, 1464,
+	1480, 1492, 1504, 1520, 1533, 1545, 1558, 1571, 1584, 1596, 1609, 1623, 1636, 1649, 1663, 1676, 1685, 1699, 1713, 1722, 1736, 1750, 1760, 1774, 1784, 1798, 1808, 1823, 1833, 1843, 1858, 1868,
+	1878, 1888, 1904, 1914, 1924, 1935, 1945, 1956, 1966, 1977, 1988, 1999, 2010, 2020, 2031, 2042, 2054, 2064, 2070, 2082, 2092, 2104, 2116, 2122, 2132, 2144, 2150, 2162, 2168, 2180, 2192, 2198,
+	2210, 2216, 2228, 2234, 2240, 2252, 2258, 2270, 2276, 2282, 2294, 2300, 2308, 2320, 2326, 2332, 2338, 2344, 2358, 2364, 2370, 2376, 2384, 2390, 2396, 2402, 2410, 2416, 2422, 2428, 2436, 2442,
+	2448, 2456, 2462, 2468, 2476, 2482, 2488, 2488, 2496, 2502, 2510, 2510, 2516, 2522, 2530, 2530, 2536, 2544, 2544, 2550, 2558, 2558, 2564, 2564, 2572, 2578, 2578, 2584, 2584, 2592, 2592, 2600,
+	2600, 2600, 2606, 2606, 2614, 2614, 2614, 2620, 2620, 2620, 2628, 2628, 2628, 2634, 2634, 2634, 2634, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648,
+	7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 166, 183, 198, 214, 230, 246, 262, 277, 294, 309, 325, 341, 357, 372, 388, 403, 420, 435, 450, 467, 482, 498,
+	513, 529, 545, 560, 575, 591, 607, 622, 637, 653, 667, 684, 699, 714, 730, 744, 760, 775, 789, 804, 820, 836, 852, 866, 880, 897, 911, 926, 939, 954, 970, 983,
+	999, 1013, 1030, 1044, 1058, 1072, 1087, 1102, 1117, 1129, 1144, 1160, 1172, 1185, 1201, 1214, 1228, 1244, 1258, 1272, 1286, 1300, 1314, 1324, 1339, 1353, 1368, 1379, 1394, 1406, 1421, 1433,
+	1448, 1460, 1472, 1488, 1500, 1512, 1525, 1537, 1550, 1562, 1575, 1588, 1601, 1614, 1627, 1640, 1649, 1663, 1676, 1685, 1699, 1713, 1722, 1736, 1746, 1760, 1769, 1784, 1794, 1803, 1818, 1828,
+	1838, 1848, 1863, 1873, 1883, 1893, 1904, 1914, 1924, 1935, 1945, 1956, 1966, 1977, 1988, 1999, 2010, 2020, 2026, 2037, 2048, 2060, 2070, 2076, 2088, 2098, 2104, 2116, 2122, 2132, 2144, 2150,
+	2162, 2168, 2180, 2186, 2192, 2204, 2210, 2222, 2228, 2234, 2246, 2252, 2258, 2270, 2276, 2282, 2288, 2294, 2308, 2314, 2320, 2326, 2332, 2338, 2344, 2352, 2358, 2364, 2370, 2376, 2384, 2390,
+	2396, 2402, 2410, 2416, 2422, 2428, 2436, 2436, 2442, 2448, 2456, 2456, 2462, 2468, 2476, 2476, 2482, 2488, 2488, 2496, 2502, 2502, 2510, 2510, 2516, 2522, 2522, 2530, 2530, 2536, 2536, 2544,
+	2544, 2544, 2550, 2550, 2558, 2558, 2558, 2564, 2564, 2564, 2572, 2572, 2572, 2578, 2578, 2578, 2578, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592,
+	7, 23, 38, 54, 70, 85, 101, 116, 132, 147, 163, 179, 194, 210, 225, 241, 256, 271, 287, 302, 318, 333, 349, 364, 380, 394, 411, 426, 441, 457, 472, 487,
+	502, 517, 533, 548, 563, 578, 594, 609, 624, 639, 653, 669, 684, 699, 714, 728, 744, 758, 772, 787, 802, 818, 833, 847, 861, 877, 892, 906, 919, 934, 949, 962,
+	978, 991, 1007, 1021, 1035, 1049, 1064, 1078, 1093, 1105, 1120, 1135, 1147, 1160, 1176, 1188, 1201, 1218, 1231, 1244, 1258, 1272, 1286, 1296, 1310, 1324, 1339, 1350, 1364, 1376, 1391, 1402,
+	1417, 1429, 1440, 1456, 1468, 1480, 1492, 1504, 1516, 1529, 1541, 1554, 1566, 1579, 1592, 1605, 1614, 1627, 1640, 1649, 1663, 1676, 1685, 1699, 1708, 1722, 1732, 1746, 1755, 1765, 1779, 1789,
+	1798, 1808, 1823, 1833, 1843, 1853, 1863, 1873, 1883, 1893, 1904, 1914, 1924, 1935, 1945, 1956, 1966, 1977, 1983, 1993, 2004, 2015, 2026, 2031, 2042, 2054, 2060, 2070, 2076, 2088, 2098, 2104,
+	2116, 2122, 2132, 2138, 2144, 2156, 2162, 2174, 2180, 2186, 2198, 2204, 2210, 2222, 2228, 2234, 2240, 2246, 2258, 2264, 2270, 2276, 2282, 2288, 2294, 2300, 2308, 2314, 2320, 2326, 2332, 2338,
+	2344, 2352, 2358, 2364, 2370, 2376, 2384, 2384, 2390, 2396, 2402, 2402, 2410, 2416, 2422, 2422, 2428, 2436, 2436, 2442, 2448, 2448, 2456, 2456, 2462, 2468, 2468, 2476, 2476, 2482, 2482, 2488,
+	2488, 2488, 2496, 2496, 2502, 2502, 2502, 2510, 2510, 2510, 2516, 2516, 2516, 2522, 2522, 2522, 2522, 2530, 2530, 2530, 2530, 2530, 2530, 2530, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536,
+	7, 22, 38, 53, 68, 83, 99, 114, 129, 144, 159, 175, 190, 205, 220, 236, 251, 266, 281, 296, 311, 326, 342, 356, 372, 386, 402, 416, 431, 447, 462, 477,
+	491, 506, 522, 536, 551, 566, 581, 596, 610, 625, 639, 655, 669, 684, 699, 712, 728, 742, 756, 770, 785, 800, 815, 829, 842, 858, 873, 887, 899, 914, 929, 941,
+	957, 970, 986, 999, 1013, 1027, 1041, 1055, 1069, 1081, 1096, 1111, 1123, 1135, 1150, 1163, 1176, 1192, 1205, 1218, 1231, 1244, 1258, 1268, 1282, 1296, 1310, 1321, 1335, 1346, 1361, 1372,
+	1387, 1398, 1409, 1425, 1436, 1448, 1460, 1472, 1484, 1496, 1508, 1520, 1533, 1545, 1558, 1571, 1579, 1592, 1605, 1614, 1627, 1640, 1649, 1663, 1672, 1685, 1694, 1708, 1717, 1727, 1741, 1750,
+	1760, 1769, 1784, 1794, 1803, 1813, 1823, 1833, 1843, 1853, 1863, 1873, 1883, 1893, 1904, 1914, 1924, 1935, 1940, 1951, 1961, 1972, 1983, 1988, 1999, 2010, 2015, 2026, 2031, 2042, 2054, 2060,
+	2070, 2076, 2088, 2092, 2098, 2110, 2116, 2128, 2132, 2138, 2150, 2156, 2162, 2174, 2180, 2186, 2192, 2198, 2210, 2216, 2222, 2228, 2234, 2240, 2246, 2252, 2258, 2264, 2270, 2276, 2282, 2288,
+	2294, 2300, 2308, 2314, 2320, 2326, 2332, 2332, 2338, 2344, 2352, 2352, 2358, 2364, 2370, 2370, 2376, 2384, 2384, 2390, 2396, 2396, 2402, 2402, 2410, 2416, 2416, 2422, 2422, 2428, 2428, 2436,
+	2436, 2436, 2442, 2442, 2448, 2448, 2448, 2456, 2456, 2456, 2462, 2462, 2462, 2468, 2468, 2468, 2468, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2482, 2482, 2482, 2482, 2482, 2482, 2482, 2482,
+	7, 22, 37, 52, 67, 81, 96, 111, 126, 141, 156, 171, 186, 201, 215, 231, 245, 260, 275, 290, 304, 319, 334, 348, 364, 378, 393, 407, 422, 437, 452, 467,
+	481, 495, 510, 524, 539, 554, 569, 583, 597, 612, 625, 641, 655, 669, 684, 697, 712, 726, 740, 754, 768, 783, 798, 811, 824, 840, 854, 868, 880, 894, 909, 921,
+	936, 949, 965, 978, 991, 1005, 1018, 1032, 1046, 1058, 1072, 1087, 1099, 1111, 1126, 1138, 1150, 1166, 1179, 1192, 1205, 1218, 1231, 1241, 1255, 1268, 1282, 1292, 1307, 1317, 1332, 1342,
+	1357, 1368, 1379, 1394, 1406, 1417, 1429, 1440, 1452, 1464, 1476, 1488, 1500, 1512, 1525, 1537, 1545, 1558, 1571, 1579, 1592, 1605, 1614, 1627, 1636, 1649, 1658, 1672, 1681, 1690, 1704, 1713,
+	1722, 1732, 1746, 1755, 1765, 1774, 1784, 1794, 1803, 1813, 1823, 1833, 1843, 1853, 1863, 1873, 1883, 1893, 1898, 1909, 1919, 1930, 1940, 1945, 1956, 1966, 1972, 1983, 1988, 1999, 2010, 2015,
+	2026, 2031, 2042, 2048, 2054, 2064, 2070, 2082, 2088, 2092, 2104, 2110, 2116, 2128, 2132, 2138, 2144, 2150, 2162, 2168, 2174, 2180, 2186, 2192, 2198, 2204, 2210, 2216, 2222, 2228, 2234, 2240,
+	2246, 2252, 2258, 2264, 2270, 2276, 2282, 2282, 2288, 2294, 2300, 2300, 2308, 2314, 2320, 2320, 2326, 2332, 2332, 2338, 2344, 2344, 2352, 2352, 2358, 2364, 2364, 2370, 2370, 2376, 2376, 2384,
+	2384, 2384, 2390, 2390, 2396, 2396, 2396, 2402, 2402, 2402, 2410, 2410, 2410, 2416, 2416, 2416, 2416, 2422, 2422, 2422, 2422, 2422, 2422, 2422, 2428, 2428, 2428, 2428, 2428, 2428, 2428, 2428,
+	7, 21, 36, 50, 65, 80, 94, 109, 123, 138, 153, 167, 182, 196, 211, 226, 240, 254, 269, 283, 298, 312, 327, 341, 356, 370, 385, 399, 413, 428, 442, 457,
+	470, 485, 499, 513, 527, 542, 557, 570, 584, 599, 612, 627, 641, 655, 669, 682, 697, 710, 724, 738, 752, 766, 781, 794, 807, 822, 836, 849, 861, 875, 889, 901,
+	916, 929, 944, 957, 970, 983, 996, 1010, 1024, 1035, 1049, 1064, 1075, 1087, 1102, 1114, 1126, 1141, 1154, 1166, 1179, 1192, 1205, 1214, 1228, 1241, 1255, 1265, 1279, 1289, 1303, 1314,
+	1328, 1339, 1350, 1364, 1376, 1387, 1398, 1409, 1421, 1433, 1444, 1456, 1468, 1480, 1492, 1504, 1512, 1525, 1537, 1545, 1558, 1571, 1579, 1592, 1601, 1614, 1623, 1636, 1645, 1654, 1667, 1676,
+	1685, 1694, 1708, 1717, 1727, 1736, 1746, 1755, 1765, 1774, 1784, 1794, 1803, 1813, 1823, 1833, 1843, 1853, 1858, 1868, 1878, 1888, 1898, 1904, 1914, 1924, 1930, 1940, 1945, 1956, 1966, 1972,
+	1983, 1988, 1999, 2004, 2010, 2020, 2026, 2037, 2042, 2048, 2060, 2064, 2070, 2082, 2088, 2092, 2098, 2104, 2116, 2122, 2128, 2132, 2138, 2144, 2150, 2156, 2162, 2168, 2174, 2180, 2186, 2192,
+	2198, 2204, 2210, 2216, 2222, 2228, 2234, 2234, 2240, 2246, 2252, 2252, 2258, 2264, 2270, 2270, 2276, 2282, 2282, 2288, 2294, 2294, 2300, 2300, 2308, 2314, 2314, 2320, 2320, 2326, 2326, 2332,
+	2332, 2332, 2338, 2338, 2344, 2344, 2344, 2352, 2352, 2352, 2358, 2358, 2358, 2364, 2364, 2364, 2364, 2370, 2370, 2370, 2370, 2370, 2370, 2370, 2376, 2376, 2376, 2376, 2376, 2376, 2376, 2376,
+	7, 21, 35, 49, 64, 78, 92, 107, 121, 135, 149, 164, 178, 192, 206, 221, 235, 249, 263, 277, 291, 306, 320, 333, 348, 362, 377, 390, 404, 419, 433, 447,
+	460, 474, 489, 502, 516, 530, 545, 558, 572, 586, 599, 614, 627, 641, 655, 667, 682, 695, 708, 722, 736, 750, 764, 777, 789, 804, 818, 831, 842, 856, 870, 882,
+	897, 909, 924, 936, 949, 962, 975, 988, 1002, 1013, 1027, 1041, 1052, 1064, 1078, 1090, 1102, 1117, 1129, 1141, 1154, 1166, 1179, 1188, 1201, 1214, 1228, 1238, 1251, 1261, 1275, 1286,
+	1300, 1310, 1321, 1335, 1346, 1357, 1368, 1379, 1391, 1402, 1413, 1425, 1436, 1448, 1460, 1472, 1480, 1492, 1504, 1512, 1525, 1537, 1545, 1558, 1566, 1579, 1588, 1601, 1609, 1618, 1631, 1640,
+	1649, 1658, 1672, 1681, 1690, 1699, 1708, 1717, 1727, 1736, 1746, 1755, 1765, 1774, 1784, 1794, 1803, 1813, 1818, 1828, 1838, 1848, 1858, 1863, 1873, 1883, 1888, 1898, 1904, 1914, 1924, 1930,
+	1940, 1945, 1956, 1961, 1966, 1977, 1983, 1993, 1999, 2004, 2015, 2020, 2026, 2037, 2042, 2048, 2054, 2060, 2070, 2076, 2082, 2088, 2092, 2098, 2104, 2110, 2116, 2122, 2128, 2132, 2138, 2144,
+	2150, 2156, 2162, 2168, 2174, 2180, 2186, 2186, 2192, 2198, 2204, 2204, 2210, 2216, 2222, 2222, 2228, 2234, 2234, 2240, 2246, 2246, 2252, 2252, 2258, 2264, 2264, 2270, 2270, 2276, 2276, 2282,
+	2282, 2282, 2288, 2288, 2294, 2294, 2294, 2300, 2300, 2300, 2308, 2308, 2308, 2314, 2314, 2314, 2314, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2326, 2326, 2326, 2326, 2326, 2326, 2326, 2326,
+	6, 20, 34, 48, 62, 76, 90, 104, 118, 132, 146, 160, 174, 188, 202, 216, 230, 243, 258, 271, 285, 299, 313, 326, 341, 354, 369, 382, 396, 410, 423, 437,
+	450, 464, 478, 491, 505, 519, 533, 546, 560, 573, 586, 600, 614, 627, 641, 653, 667, 680, 693, 706, 720, 734, 748, 760, 772, 787, 800, 813, 824, 838, 852, 863,
+	877, 889, 904, 916, 929, 941, 954, 967, 980, 991, 1005, 1018, 1030, 1041, 1055, 1066, 1078, 1093, 1105, 1117, 1129, 1141, 1154, 1163, 1176, 1188, 1201, 1211, 1224, 1234, 1248, 1258,
+	1272, 1282, 1292, 1307, 1317, 1328, 1339, 1350, 1361, 1372, 1383, 1394, 1406, 1417, 1429, 1440, 1448, 1460, 1472, 1480, 1492, 1504, 1512, 1525, 1533, 1545, 1554, 1566, 1575, 1584, 1596, 1605,
+	1614, 1623, 1636, 1645, 1654, 1663, 1672, 1681, 1690, 1699, 1708, 1717, 1727, 1736, 1746, 1755, 1765, 1774, 1779, 1789, 1798, 1808, 1818, 1823, 1833, 1843, 1848, 1858, 1863, 1873, 1883, 1888,
+	1898, 1904, 1914, 1919, 1924, 1935, 1940, 1951, 1956, 1961, 1972, 1977, 1983, 1993, 1999, 2004, 2010, 2015, 2026, 2031, 2037, 2042, 2048, 2054, 2060, 2064, 2070, 2076, 2082, 2088, 2092, 2098,
+	2104, 2110, 2116, 2122, 2128, 2132, 2138, 2138, 2144, 2150, 2156, 2156, 2162, 2168, 2174, 2174, 2180, 2186, 2186, 2192, 2198, 2198, 2204, 2204, 2210, 2216, 2216, 2222, 2222, 2228, 2228, 2234,
+	2234, 2234, 2240, 2240, 2246, 2246, 2246, 2252, 2252, 2252, 2258, 2258, 2258, 2264, 2264, 2264, 2264, 2270, 2270, 2270, 2270, 2270, 2270, 2270, 2276, 2276, 2276, 2276, 2276, 2276, 2276, 2276,
+	6, 20, 34, 47, 61, 75, 88, 102, 116, 129, 143, 157, 170, 184, 198, 211, 225, 238, 252, 266, 279, 293, 307, 319, 333, 346, 361, 374, 387, 401, 414, 428,
+	441, 454, 468, 481, 494, 507, 522, 534, 548, 561, 573, 588, 600, 614, 627, 639, 653, 666, 678, 691, 704, 718, 732, 744, 756, 770, 783, 796, 807, 820, 833, 845,
+	858, 870, 884, 897, 909, 921, 934, 946, 959, 970, 983, 996, 1007, 1018, 1032, 1044, 1055, 1069, 1081, 1093, 1105, 1117, 1129, 1138, 1150, 1163, 1176, 1185, 1198, 1208, 1221, 1231,
+	1244, 1255, 1265, 1279, 1289, 1300, 1310, 1321, 1332, 1342, 1353, 1364, 1376, 1387, 1398, 1409, 1417, 1429, 1440, 1448, 1460, 1472, 1480, 1492, 1500, 1512, 1520, 1533, 1541, 1550, 1562, 1571,
+	1579, 1588, 1601, 1609, 1618, 1627, 1636, 1645, 1654, 1663, 1672, 1681, 1690, 1699, 1708, 1717, 1727, 1736, 1741, 1750, 1760, 1769, 1779, 1784, 1794, 1803, 1808, 1818, 1823, 1833, 1843, 1848,
+	1858, 1863, 1873, 1878, 1883, 1893, 1898, 1909, 1914, 1919, 1930, 1935, 1940, 1951, 1956, 1961, 1966, 1972, 1983, 1988, 1993, 1999, 2004, 2010, 2015, 2020, 2026, 2031, 2037, 2042, 2048, 2054,
+	2060, 2064, 2070, 2076, 2082, 2088, 2092, 2092, 2098, 2104, 2110, 2110, 2116, 2122, 2128, 2128, 2132, 2138, 2138, 2144, 2150, 2150, 2156, 2156, 2162, 2168, 2168, 2174, 2174, 2180, 2180, 2186,
+	2186, 2186, 2192, 2192, 2198, 2198, 2198, 2204, 2204, 2204, 2210, 2210, 2210, 2216, 2216, 2216, 2216, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228,
+	6, 20, 33, 46, 60, 73, 86, 100, 113, 126, 140, 153, 166, 180, 193, 207, 220, 233, 247, 260, 273, 286, 300, 312, 326, 339, 353, 366, 379, 392, 405, 419,
+	431, 444, 458, 470, 483, 497, 510, 523, 536, 549, 561, 575, 588, 600, 614, 625, 639, 651, 664, 676, 689, 703, 716, 728, 740, 754, 766, 779, 789, 802, 815, 827,
+	840, 852, 866, 877, 889, 901, 914, 926, 939, 949, 962, 975, 986, 996, 1010, 1021, 1032, 1046, 1058, 1069, 1081, 1093, 1105, 1114, 1126, 1138, 1150, 1160, 1172, 1182, 1195, 1205,
+	1218, 1228, 1238, 1251, 1261, 1272, 1282, 1292, 1303, 1314, 1324, 1335, 1346, 1357, 1368, 1379, 1387, 1398, 1409, 1417, 1429, 1440, 1448, 1460, 1468, 1480, 1488, 1500, 1508, 1516, 1529, 1537,
+	1545, 1554, 1566, 1575, 1584, 1592, 1601, 1609, 1618, 1627, 1636, 1645, 1654, 1663, 1672, 1681, 1690, 1699, 1704, 1713, 1722, 1732, 1741, 1746, 1755, 1765, 1769, 1779, 1784, 1794, 1803, 1808,
+	1818, 1823, 1833, 1838, 1843, 1853, 1858, 1868, 1873, 1878, 1888, 1893, 1898, 1909, 1914, 1919, 1924, 1930, 1940, 1945, 1951, 1956, 1961, 1966, 1972, 1977, 1983, 1988, 1993, 1999, 2004, 2010,
+	2015, 2020, 2026, 2031, 2037, 2042, 2048, 2048, 2054, 2060, 2064, 2064, 2070, 2076, 2082, 2082, 2088, 2092, 2092, 2098, 2104, 2104, 2110, 2110, 2116, 2122, 2122, 2128, 2128, 2132, 2132, 2138,
+	2138, 2138, 2144, 2144, 2150, 2150, 2150, 2156, 2156, 2156, 2162, 2162, 2162, 2168, 2168, 2168, 2168, 2174, 2174, 2174, 2174, 2174, 2174, 2174, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180,
+	6, 19, 32, 45, 58, 71, 85, 98, 111, 124, 137, 150, 163, 176, 189, 202, 215, 228, 241, 254, 267, 280, 294, 306, 319, 332, 345, 358, 371, 384, 397, 410,
+	422, 435, 448, 460, 473, 486, 499, 512, 524, 537, 549, 563, 575, 588, 600, 612, 625, 637, 650, 662, 675, 688, 701, 712, 724, 738, 750, 762, 772, 785, 798, 809,
+	822, 833, 847, 858, 870, 882, 894, 906, 919, 929, 941, 954, 965, 975, 988, 999, 1010, 1024, 1035, 1046, 1058, 1069, 1081, 1090, 1102, 1114, 1126, 1135, 1147, 1157, 1169, 1179,
+	1192, 1201, 1211, 1224, 1234, 1244, 1255, 1265, 1275, 1286, 1296, 1307, 1317, 1328, 1339, 1350, 1357, 1368, 1379, 1387, 1398, 1409, 1417, 1429, 1436, 1448, 1456, 1468, 1476, 1484, 1496, 1504,
+	1512, 1520, 1533, 1541, 1550, 1558, 1566, 1575, 1584, 1592, 1601, 1609, 1618, 1627, 1636, 1645, 1654, 1663, 1667, 1676, 1685, 1694, 1704, 1708, 1717, 1727, 1732, 1741, 1746, 1755, 1765, 1769,
+	1779, 1784, 1794, 1798, 1803, 1813, 1818, 1828, 1833, 1838, 1848, 1853, 1858, 1868, 1873, 1878, 1883, 1888, 1898, 1904, 1909, 1914, 1919, 1924, 1930, 1935, 1940, 1945, 1951, 1956, 1961, 1966,
+	1972, 1977, 1983, 1988, 1993, 1999, 2004, 2004, 2010, 2015, 2020, 2020, 2026, 2031, 2037, 2037, 2042, 2048, 2048, 2054, 2060, 2060, 2064, 2064, 2070, 2076, 2076, 2082, 2082, 2088, 2088, 2092,
+	2092, 2092, 2098, 2098, 2104, 2104, 2104, 2110, 2110, 2110, 2116, 2116, 2116, 2122, 2122, 2122, 2122, 2128, 2128, 2128, 2128, 2128, 2128, 2128, 2132, 2132, 2132, 2132, 2132, 2132, 2132, 2132,
+	6, 19, 32, 44, 57, 70, 83, 96, 108, 121, 134, 147, 159, 172, 185, 198, 211, 223, 236, 249, 261, 274, 287, 299, 312, 325, 338, 350, 363, 376, 388, 401,
+	413, 426, 438, 450, 463, 476, 489, 501, 513, 526, 537, 551, 563, 575, 588, 599, 612, 624, 636, 648, 660, 673, 686, 697, 708, 722, 734, 746, 756, 768, 781, 792,
+	804, 815, 829, 840, 852, 863, 875, 887, 899, 909, 921, 934, 944, 954, 967, 978, 988, 1002, 1013, 1024, 1035, 1046, 1058, 1066, 1078, 1090, 1102, 1111, 1123, 1132, 1144, 1154,
+	1166, 1176, 1185, 1198, 1208, 1218, 1228, 1238, 1248, 1258, 1268, 1279, 1289, 1300, 1310, 1321, 1328, 1339, 1350, 1357, 1368, 1379, 1387, 1398, 1406, 1417, 1425, 1436, 1444, 1452, 1464, 1472,
+	1480, 1488, 1500, 1508, 1516, 1525, 1533, 1541, 1550, 1558, 1566, 1575, 1584, 1592, 1601, 1609, 1618, 1627, 1631, 1640, 1649, 1658, 1667, 1672, 1681, 1690, 1694, 1704, 1708, 1717, 1727, 1732,
+	1741, 1746, 1755, 1760, 1765, 1774, 1779, 1789, 1794, 1798, 1808, 1813, 1818, 1828, 1833, 1838, 1843, 1848, 1858, 1863, 1868, 1873, 1878, 1883, 1888, 1893, 1898, 1904, 1909, 1914, 1919, 1924,
+	1930, 1935, 1940, 1945, 1951, 1956, 1961, 1961, 1966, 1972, 1977, 1977, 1983, 1988, 1993, 1993, 1999, 2004, 2004, 2010, 2015, 2015, 2020, 2020, 2026, 2031, 2031, 2037, 2037, 2042, 2042, 2048,
+	2048, 2048, 2054, 2054, 2060, 2060, 2060, 2064, 2064, 2064, 2070, 2070, 2070, 2076, 2076, 2076, 2076, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2088, 2088, 2088, 2088, 2088, 2088, 2088, 2088,
+	6, 18, 31, 43, 56, 68, 81, 94, 106, 119, 131, 144, 156, 169, 181, 194, 206, 218, 231, 243, 256, 268, 281, 293, 306, 318, 331, 343, 355, 368, 380, 392,
+	404, 416, 429, 441, 453, 465, 478, 490, 502, 515, 526, 539, 551, 563, 575, 586, 599, 610, 622, 634, 646, 658, 671, 682, 693, 706, 718, 730, 740, 752, 764, 775,
+	787, 798, 811, 822, 833, 845, 856, 868, 880, 889, 901, 914, 924, 934, 946, 957, 967, 980, 991, 1002, 1013, 1024, 1035, 1044, 1055, 1066, 1078, 1087, 1099, 1108, 1120, 1129,
+	1141, 1150, 1160, 1172, 1182, 1192, 1201, 1211, 1221, 1231, 1241, 1251, 1261, 1272, 1282, 1292, 1300, 1310, 1321, 1328, 1339, 1350, 1357, 1368, 1376, 1387, 1394, 1406, 1413, 1421, 1433, 1440,
+	1448, 1456, 1468, 1476, 1484, 1492, 1500, 1508, 1516, 1525, 1533, 1541, 1550, 1558, 1566, 1575, 1584, 1592, 1596, 1605, 1614, 1623, 1631, 1636, 1645, 1654, 1658, 1667, 1672, 1681, 1690, 1694,
+	1704, 1708, 1717, 1722, 1727, 1736, 1741, 1750, 1755, 1760, 1769, 1774, 1779, 1789, 1794, 1798, 1803, 1808, 1818, 1823, 1828, 1833, 1838, 1843, 1848, 1853, 1858, 1863, 1868, 1873, 1878, 1883,
+	1888, 1893, 1898, 1904, 1909, 1914, 1919, 1919, 1924, 1930, 1935, 1935, 1940, 1945, 1951, 1951, 1956, 1961, 1961, 1966, 1972, 1972, 1977, 1977, 1983, 1988, 1988, 1993, 1993, 1999, 1999, 2004,
+	2004, 2004, 2010, 2010, 2015, 2015, 2015, 2020, 2020, 2020, 2026, 2026, 2026, 2031, 2031, 2031, 2031, 2037, 2037, 2037, 2037, 2037, 2037, 2037, 2042, 2042, 2042, 2042, 2042, 2042, 2042, 2042,
+	6, 18, 30, 42, 55, 67, 79, 92, 104, 116, 128, 141, 153, 165, 177, 190, 202, 214, 226, 238, 250, 263, 275, 286, 299, 311, 324, 335, 347, 360, 372, 384,
+	396, 407, 420, 431, 443, 455, 468, 479, 491, 503, 515, 527, 539, 551, 563, 573, 586, 597, 609, 620, 632, 644, 657, 667, 678, 691, 703, 714, 724, 736, 748, 758,
+	770, 781, 794, 804, 815, 827, 838, 849, 861, 870, 882, 894, 904, 914, 926, 936, 946, 959, 970, 980, 991, 1002, 1013, 1021, 1032, 1044, 1055, 1064, 1075, 1084, 1096, 1105,
+	1117, 1126, 1135, 1147, 1157, 1166, 1176, 1185, 1195, 1205, 1214, 1224, 1234, 1244, 1255, 1265, 1272, 1282, 1292, 1300, 1310, 1321, 1328, 1339, 1346, 1357, 1364, 1376, 1383, 1391, 1402, 1409,
+	1417, 1425, 1436, 1444, 1452, 1460, 1468, 1476, 1484, 1492, 1500, 1508, 1516, 1525, 1533, 1541, 1550, 1558, 1562, 1571, 1579, 1588, 1596, 1601, 1609, 1618, 1623, 1631, 1636, 1645, 1654, 1658,
+	1667, 1672, 1681, 1685, 1690, 1699, 1704, 1713, 1717, 1722, 1732, 1736, 1741, 1750, 1755, 1760, 1765, 1769, 1779, 1784, 1789, 1794, 1798, 1803, 1808, 1813, 1818, 1823, 1828, 1833, 1838, 1843,
+	1848, 1853, 1858, 1863, 1868, 1873, 1878, 1878, 1883, 1888, 1893, 1893, 1898, 1904, 1909, 1909, 1914, 1919, 1919, 1924, 1930, 1930, 1935, 1935, 1940, 1945, 1945, 1951, 1951, 1956, 1956, 1961,
+	1961, 1961, 1966, 1966, 1972, 1972, 1972, 1977, 1977, 1977, 1983, 1983, 1983, 1988, 1988, 1988, 1988, 1993, 1993, 1993, 1993, 1993, 1993, 1993, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999,
+	6, 18, 29, 41, 53, 65, 78, 90, 101, 113, 125, 138, 149, 162, 173, 186, 198, 209, 221, 233, 245, 257, 269, 280, 293, 304, 317, 328, 340, 352, 364, 376,
+	387, 399, 411, 422, 434, 446, 458, 469, 481, 493, 503, 516, 527, 539, 551, 561, 573, 584, 596, 607, 619, 630, 643, 653, 664, 676, 688, 699, 708, 720, 732, 742,
+	754, 764, 777, 787, 798, 809, 820, 831, 842, 852, 863, 875, 884, 894, 906, 916, 926, 939, 949, 959, 970, 980, 991, 999, 1010, 1021, 1032, 1041, 1052, 1061, 1072, 1081,
+	1093, 1102, 1111, 1123, 1132, 1141, 1150, 1160, 1169, 1179, 1188, 1198, 1208, 1218, 1228, 1238, 1244, 1255, 1265, 1272, 1282, 1292, 1300, 1310, 1317, 1328, 1335, 1346, 1353, 1361, 1372, 1379,
+	1387, 1394, 1406, 1413, 1421, 1429, 1436, 1444, 1452, 1460, 1468, 1476, 1484, 1492, 1500, 1508, 1516, 1525, 1529, 1537, 1545, 1554, 1562, 1566, 1575, 1584, 1588, 1596, 1601, 1609, 1618, 1623,
+	1631, 1636, 1645, 1649, 1654, 1663, 1667, 1676, 1681, 1685, 1694, 1699, 1704, 1713, 1717, 1722, 1727, 1732, 1741, 1746, 1750, 1755, 1760, 1765, 1769, 1774, 1779, 1784, 1789, 1794, 1798, 1803,
+	1808, 1813, 1818, 1823, 1828, 1833, 1838, 1838, 1843, 1848, 1853, 1853, 1858, 1863, 1868, 1868, 1873, 1878, 1878, 1883, 1888, 1888, 1893, 1893, 1898, 1904, 1904, 1909, 1909, 1914, 1914, 1919,
+	1919, 1919, 1924, 1924, 1930, 1930, 1930, 1935, 1935, 1935, 1940, 1940, 1940, 1945, 1945, 1945, 1945, 1951, 1951, 1951, 1951, 1951, 1951, 1951, 1956, 1956, 1956, 1956, 1956, 1956, 1956, 1956,
+	5, 17, 29, 41, 52, 64, 76, 88, 99, 111, 123, 135, 146, 158, 170, 182, 193, 205, 217, 228, 239, 251, 263, 274, 286, 298, 310, 321, 333, 344, 356, 368,
+	379, 390, 402, 413, 424, 436, 448, 459, 470, 482, 493, 505, 516, 527, 539, 549, 561, 572, 583, 594, 605, 617, 629, 639, 650, 662, 673, 684, 693, 704, 716, 726,
+	738, 748, 760, 770, 781, 792, 802, 813, 824, 833, 845, 856, 866, 875, 887, 897, 906, 919, 929, 939, 949, 959, 970, 978, 988, 999, 1010, 1018, 1030, 1038, 1049, 1058,
+	1069, 1078, 1087, 1099, 1108, 1117, 1126, 1135, 1144, 1154, 1163, 1172, 1182, 1192, 1201, 1211, 1218, 1228, 1238, 1244, 1255, 1265, 1272, 1282, 1289, 1300, 1307, 1317, 1324, 1332, 1342, 1350,
+	1357, 1364, 1376, 1383, 1391, 1398, 1406, 1413, 1421, 1429, 1436, 1444, 1452, 1460, 1468, 1476, 1484, 1492, 1496, 1504, 1512, 1520, 1529, 1533, 1541, 1550, 1554, 1562, 1566, 1575, 1584, 1588,
+	1596, 1601, 1609, 1614, 1618, 1627, 1631, 1640, 1645, 1649, 1658, 1663, 1667, 1676, 1681, 1685, 1690, 1694, 1704, 1708, 1713, 1717, 1722, 1727, 1732, 1736, 1741, 1746, 1750, 1755, 1760, 1765,
+	1769, 1774, 1779, 1784, 1789, 1794, 1798, 1798, 1803, 1808, 1813, 1813, 1818, 1823, 1828, 1828, 1833, 1838, 1838, 1843, 1848, 1848, 1853, 1853, 1858, 1863, 1863, 1868, 1868, 1873, 1873, 1878,
+	1878, 1878, 1883, 1883, 1888, 1888, 1888, 1893, 1893, 1893, 1898, 1898, 1898, 1904, 1904, 1904, 1904, 1909, 1909, 1909, 1909, 1909, 1909, 1909, 1914, 1914, 1914, 1914, 1914, 1914, 1914, 1914,
+	5, 17, 28, 40, 51, 63, 74, 86, 97, 109, 120, 132, 143, 155, 166, 178, 189, 200, 212, 223, 234, 246, 258, 268, 280, 291, 303, 314, 325, 337, 348, 360,
+	371, 382, 393, 404, 415, 427, 438, 449, 460, 472, 482, 494, 505, 516, 527, 537, 549, 560, 570, 581, 592, 604, 615, 625, 636, 648, 658, 669, 678, 689, 701, 710,
+	722, 732, 744, 754, 764, 775, 785, 796, 807, 815, 827, 838, 847, 856, 868, 877, 887, 899, 909, 919, 929, 939, 949, 957, 967, 978, 988, 996, 1007, 1015, 1027, 1035,
+	1046, 1055, 1064, 1075, 1084, 1093, 1102, 1111, 1120, 1129, 1138, 1147, 1157, 1166, 1176, 1185, 1192, 1201, 1211, 1218, 1228, 1238, 1244, 1255, 1261, 1272, 1279, 1289, 1296, 1303, 1314, 1321,
+	1328, 1335, 1346, 1353, 1361, 1368, 1376, 1383, 1391, 1398, 1406, 1413, 1421, 1429, 1436, 1444, 1452, 1460, 1464, 1472, 1480, 1488, 1496, 1500, 1508, 1516, 1520, 1529, 1533, 1541, 1550, 1554,
+	1562, 1566, 1575, 1579, 1584, 1592, 1596, 1605, 1609, 1614, 1623, 1627, 1631, 1640, 1645, 1649, 1654, 1658, 1667, 1672, 1676, 1681, 1685, 1690, 1694, 1699, 1704, 1708, 1713, 1717, 1722, 1727,
+	1732, 1736, 1741, 1746, 1750, 1755, 1760, 1760, 1765, 1769, 1774, 1774, 1779, 1784, 1789, 1789, 1794, 1798, 1798, 1803, 1808, 1808, 1813, 1813, 1818, 1823, 1823, 1828, 1828, 1833, 1833, 1838,
+	1838, 1838, 1843, 1843, 1848, 1848, 1848, 1853, 1853, 1853, 1858, 1858, 1858, 1863, 1863, 1863, 1863, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1873, 1873, 1873, 1873, 1873, 1873, 1873, 1873,
+	5, 16, 28, 39, 50, 61, 73, 84, 95, 106, 118, 129, 140, 151, 162, 174, 185, 196, 207, 218, 229, 241, 252, 263, 274, 285, 297, 307, 318, 330, 341, 352,
+	363, 374, 385, 396, 406, 418, 429, 440, 450, 462, 472, 483, 494, 505, 516, 526, 537, 548, 558, 569, 580, 591, 602, 612, 622, 634, 644, 655, 664, 675, 686, 695,
+	706, 716, 728, 738, 748, 758, 768, 779, 789, 798, 809, 820, 829, 838, 849, 858, 868, 880, 889, 899, 909, 919, 929, 936, 946, 957, 967, 975, 986, 994, 1005, 1013,
+	1024, 1032, 1041, 1052, 1061, 1069, 1078, 1087, 1096, 1105, 1114, 1123, 1132, 1141, 1150, 1160, 1166, 1176, 1185, 1192, 1201, 1211, 1218, 1228, 1234, 1244, 1251, 1261, 1268, 1275, 1286, 1292,
+	1300, 1307, 1317, 1324, 1332, 1339, 1346, 1353, 1361, 1368, 1376, 1383, 1391, 1398, 1406, 1413, 1421, 1429, 1433, 1440, 1448, 1456, 1464, 1468, 1476, 1484, 1488, 1496, 1500, 1508, 1516, 1520,
+	1529, 1533, 1541, 1545, 1550, 1558, 1562, 1571, 1575, 1579, 1588, 1592, 1596, 1605, 1609, 1614, 1618, 1623, 1631, 1636, 1640, 1645, 1649, 1654, 1658, 1663, 1667, 1672, 1676, 1681, 1685, 1690,
+	1694, 1699, 1704, 1708, 1713, 1717, 1722, 1722, 1727, 1732, 1736, 1736, 1741, 1746, 1750, 1750, 1755, 1760, 1760, 1765, 1769, 1769, 1774, 1774, 1779, 1784, 1784, 1789, 1789, 1794, 1794, 1798,
+	1798, 1798, 1803, 1803, 1808, 1808, 1808, 1813, 1813, 1813, 1818, 1818, 1818, 1823, 1823, 1823, 1823, 1828, 1828, 1828, 1828, 1828, 1828, 1828, 1833, 1833, 1833, 1833, 1833, 1833, 1833, 1833,
+	5, 16, 27, 38, 49, 60, 71, 82, 93, 104, 115, 126, 137, 148, 159, 170, 181, 192, 203, 214, 224, 236, 247, 257, 268, 279, 290, 301, 312, 323, 333, 344,
+	355, 366, 377, 387, 398, 409, 420, 430, 441, 452, 462, 473, 483, 494, 505, 515, 526, 536, 546, 557, 567, 578, 589, 599, 609, 620, 630, 641, 650, 660, 671, 680,
+	691, 701, 712, 722, 732, 742, 752, 762, 772, 781, 792, 802, 811, 820, 831, 840, 849, 861, 870, 880, 889, 899, 909, 916, 926, 936, 946, 954, 965, 972, 983, 991,
+	1002, 1010, 1018, 1030, 1038, 1046, 1055, 1064, 1072, 1081, 1090, 1099, 1108, 1117, 1126, 1135, 1141, 1150, 1160, 1166, 1176, 1185, 1192, 1201, 1208, 1218, 1224, 1234, 1241, 1248, 1258, 1265,
+	1272, 1279, 1289, 1296, 1303, 1310, 1317, 1324, 1332, 1339, 1346, 1353, 1361, 1368, 1376, 1383, 1391, 1398, 1402, 1409, 1417, 1425, 1433, 1436, 1444, 1452, 1456, 1464, 1468, 1476, 1484, 1488,
+	1496, 1500, 1508, 1512, 1516, 1525, 1529, 1537, 1541, 1545, 1554, 1558, 1562, 1571, 1575, 1579, 1584, 1588, 1596, 1601, 1605, 1609, 1614, 1618, 1623, 1627, 1631, 1636, 1640, 1645, 1649, 1654,
+	1658, 1663, 1667, 1672, 1676, 1681, 1685, 1685, 1690, 1694, 1699, 1699, 1704, 1708, 1713, 1713, 1717, 1722, 1722, 1727, 1732, 1732, 1736, 1736, 1741, 1746, 1746, 1750, 1750, 1755, 1755, 1760,
+	1760, 1760, 1765, 1765, 1769, 1769, 1769, 1774, 1774, 1774, 1779, 1779, 1779, 1784, 1784, 1784, 1784, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1794, 1794, 1794, 1794, 1794, 1794, 1794, 1794,
+	5, 16, 26, 37, 48, 59, 70, 80, 91, 102, 113, 123, 134, 145, 156, 166, 177, 188, 199, 209, 220, 231, 241, 251, 263, 273, 284, 294, 305, 316, 326, 337,
+	347, 358, 369, 379, 389, 400, 411, 421, 431, 442, 452, 463, 473, 483, 494, 503, 515, 524, 534, 545, 555, 566, 577, 586, 596, 607, 617, 627, 636, 646, 657, 666,
+	676, 686, 697, 706, 716, 726, 736, 746, 756, 764, 775, 785, 794, 802, 813, 822, 831, 842, 852, 861, 870, 880, 889, 897, 906, 916, 926, 934, 944, 952, 962, 970,
+	980, 988, 996, 1007, 1015, 1024, 1032, 1041, 1049, 1058, 1066, 1075, 1084, 1093, 1102, 1111, 1117, 1126, 1135, 1141, 1150, 1160, 1166, 1176, 1182, 1192, 1198, 1208, 1214, 1221, 1231, 1238,
+	1244, 1251, 1261, 1268, 1275, 1282, 1289, 1296, 1303, 1310, 1317, 1324, 1332, 1339, 1346, 1353, 1361, 1368, 1372, 1379, 1387, 1394, 1402, 1406, 1413, 1421, 1425, 1433, 1436, 1444, 1452, 1456,
+	1464, 1468, 1476, 1480, 1484, 1492, 1496, 1504, 1508, 1512, 1520, 1525, 1529, 1537, 1541, 1545, 1550, 1554, 1562, 1566, 1571, 1575, 1579, 1584, 1588, 1592, 1596, 1601, 1605, 1609, 1614, 1618,
+	1623, 1627, 1631, 1636, 1640, 1645, 1649, 1649, 1654, 1658, 1663, 1663, 1667, 1672, 1676, 1676, 1681, 1685, 1685, 1690, 1694, 1694, 1699, 1699, 1704, 1708, 1708, 1713, 1713, 1717, 1717, 1722,
+	1722, 1722, 1727, 1727, 1732, 1732, 1732, 1736, 1736, 1736, 1741, 1741, 1741, 1746, 1746, 1746, 1746, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755,
+	5, 15, 26, 36, 47, 57, 68, 79, 89, 100, 110, 121, 131, 142, 152, 163, 173, 184, 194, 205, 215, 226, 236, 246, 257, 267, 278, 288, 298, 309, 319, 330,
+	340, 350, 361, 371, 381, 391, 402, 412, 422, 433, 442, 453, 463, 473, 483, 493, 503, 513, 523, 533, 543, 554, 564, 573, 583, 594, 604, 614, 622, 632, 643, 651,
+	662, 671, 682, 691, 701, 710, 720, 730, 740, 748, 758, 768, 777, 785, 796, 804, 813, 824, 833, 842, 852, 861, 870, 877, 887, 897, 906, 914, 924, 931, 941, 949,
+	959, 967, 975, 986, 994, 1002, 1010, 1018, 1027, 1035, 1044, 1052, 1061, 1069, 1078, 1087, 1093, 1102, 1111, 1117, 1126, 1135, 1141, 1150, 1157, 1166, 1172, 1182, 1188, 1195, 1205, 1211,
+	1218, 1224, 1234, 1241, 1248, 1255, 1261, 1268, 1275, 1282, 1289, 1296, 1303, 1310, 1317, 1324, 1332, 1339, 1342, 1350, 1357, 1364, 1372, 1376, 1383, 1391, 1394, 1402, 1406, 1413, 1421, 1425,
+	1433, 1436, 1444, 1448, 1452, 1460, 1464, 1472, 1476, 1480, 1488, 1492, 1496, 1504, 1508, 1512, 1516, 1520, 1529, 1533, 1537, 1541, 1545, 1550, 1554, 1558, 1562, 1566, 1571, 1575, 1579, 1584,
+	1588, 1592, 1596, 1601, 1605, 1609, 1614, 1614, 1618, 1623, 1627, 1627, 1631, 1636, 1640, 1640, 1645, 1649, 1649, 1654, 1658, 1658, 1663, 1663, 1667, 1672, 1672, 1676, 1676, 1681, 1681, 1685,
+	1685, 1685, 1690, 1690, 1694, 1694, 1694, 1699, 1699, 1699, 1704, 1704, 1704, 1708, 1708, 1708, 1708, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1717, 1717, 1717, 1717, 1717, 1717, 1717, 1717,
+	5, 15, 25, 36, 46, 56, 67, 77, 87, 97, 108, 118, 128, 139, 149, 159, 170, 180, 190, 200, 210, 221, 231, 241, 251, 261, 272, 282, 292, 302, 312, 323,
+	333, 343, 353, 363, 373, 383, 393, 403, 413, 423, 433, 443, 453, 463, 473, 482, 493, 502, 512, 522, 532, 542, 552, 561, 570, 581, 591, 600, 609, 619, 629, 637,
+	648, 657, 667, 676, 686, 695, 704, 714, 724, 732, 742, 752, 760, 768, 779, 787, 796, 807, 815, 824, 833, 842, 852, 858, 868, 877, 887, 894, 904, 911, 921, 929,
+	939, 946, 954, 965, 972, 980, 988, 996, 1005, 1013, 1021, 1030, 1038, 1046, 1055, 1064, 1069, 1078, 1087, 1093, 1102, 1111, 1117, 1126, 1132, 1141, 1147, 1157, 1163, 1169, 1179, 1185,
+	1192, 1198, 1208, 1214, 1221, 1228, 1234, 1241, 1248, 1255, 1261, 1268, 1275, 1282, 1289, 1296, 1303, 1310, 1314, 1321, 1328, 1335, 1342, 1346, 1353, 1361, 1364, 1372, 1376, 1383, 1391, 1394,
+	1402, 1406, 1413, 1417, 1421, 1429, 1433, 1440, 1444, 1448, 1456, 1460, 1464, 1472, 1476, 1480, 1484, 1488, 1496, 1500, 1504, 1508, 1512, 1516, 1520, 1525, 1529, 1533, 1537, 1541, 1545, 1550,
+	1554, 1558, 1562, 1566, 1571, 1575, 1579, 1579, 1584, 1588, 1592, 1592, 1596, 1601, 1605, 1605, 1609, 1614, 1614, 1618, 1623, 1623, 1627, 1627, 1631, 1636, 1636, 1640, 1640, 1645, 1645, 1649,
+	1649, 1649, 1654, 1654, 1658, 1658, 1658, 1663, 1663, 1663, 1667, 1667, 1667, 1672, 1672, 1672, 1672, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1681, 1681, 1681, 1681, 1681, 1681, 1681, 1681,
+	5, 15, 25, 35, 45, 55, 65, 75, 85, 95, 105, 116, 125, 136, 146, 156, 166, 176, 186, 196, 206, 216, 226, 236, 246, 256, 266, 276, 286, 296, 306, 316,
+	325, 335, 345, 355, 365, 375, 385, 394, 404, 414, 423, 434, 443, 453, 463, 472, 482, 491, 501, 510, 520, 530, 540, 549, 558, 569, 578, 588, 596, 605, 615, 624,
+	634, 643, 653, 662, 671, 680, 689, 699, 708, 716, 726, 736, 744, 752, 762, 770, 779, 789, 798, 807, 815, 824, 833, 840, 849, 858, 868, 875, 884, 892, 901, 909,
+	919, 926, 934, 944, 952, 959, 967, 975, 983, 991, 999, 1007, 1015, 1024, 1032, 1041, 1046, 1055, 1064, 1069, 1078, 1087, 1093, 1102, 1108, 1117, 1123, 1132, 1138, 1144, 1154, 1160,
+	1166, 1172, 1182, 1188, 1195, 1201, 1208, 1214, 1221, 1228, 1234, 1241, 1248, 1255, 1261, 1268, 1275, 1282, 1286, 1292, 1300, 1307, 1314, 1317, 1324, 1332, 1335, 1342, 1346, 1353, 1361, 1364,
+	1372, 1376, 1383, 1387, 1391, 1398, 1402, 1409, 1413, 1417, 1425, 1429, 1433, 1440, 1444, 1448, 1452, 1456, 1464, 1468, 1472, 1476, 1480, 1484, 1488, 1492, 1496, 1500, 1504, 1508, 1512, 1516,
+	1520, 1525, 1529, 1533, 1537, 1541, 1545, 1545, 1550, 1554, 1558, 1558, 1562, 1566, 1571, 1571, 1575, 1579, 1579, 1584, 1588, 1588, 1592, 1592, 1596, 1601, 1601, 1605, 1605, 1609, 1609, 1614,
+	1614, 1614, 1618, 1618, 1623, 1623, 1623, 1627, 1627, 1627, 1631, 1631, 1631, 1636, 1636, 1636, 1636, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1645, 1645, 1645, 1645, 1645, 1645, 1645, 1645,
+	4, 14, 24, 34, 44, 54, 64, 74, 83, 93, 103, 113, 123, 133, 143, 153, 162, 172, 182, 192, 201, 211, 221, 231, 241, 250, 261, 270, 280, 290, 299, 309,
+	318, 328, 338, 347, 357, 367, 377, 386, 396, 405, 414, 424, 434, 443, 453, 462, 472, 481, 490, 499, 509, 519, 529, 537, 546, 557, 566, 575, 583, 592, 602, 610,
+	620, 629, 639, 648, 657, 666, 675, 684, 693, 701, 710, 720, 728, 736, 746, 754, 762, 772, 781, 789, 798, 807, 815, 822, 831, 840, 849, 856, 866, 873, 882, 889,
+	899, 906, 914, 924, 931, 939, 946, 954, 962, 970, 978, 986, 994, 1002, 1010, 1018, 1024, 1032, 1041, 1046, 1055, 1064, 1069, 1078, 1084, 1093, 1099, 1108, 1114, 1120, 1129, 1135,
+	1141, 1147, 1157, 1163, 1169, 1176, 1182, 1188, 1195, 1201, 1208, 1214, 1221, 1228, 1234, 1241, 1248, 1255, 1258, 1265, 1272, 1279, 1286, 1289, 1296, 1303, 1307, 1314, 1317, 1324, 1332, 1335,
+	1342, 1346, 1353, 1357, 1361, 1368, 1372, 1379, 1383, 1387, 1394, 1398, 1402, 1409, 1413, 1417, 1421, 1425, 1433, 1436, 1440, 1444, 1448, 1452, 1456, 1460, 1464, 1468, 1472, 1476, 1480, 1484,
+	1488, 1492, 1496, 1500, 1504, 1508, 1512, 1512, 1516, 1520, 1525, 1525, 1529, 1533, 1537, 1537, 1541, 1545, 1545, 1550, 1554, 1554, 1558, 1558, 1562, 1566, 1566, 1571, 1571, 1575, 1575, 1579,
+	1579, 1579, 1584, 1584, 1588, 1588, 1588, 1592, 1592, 1592, 1596, 1596, 1596, 1601, 1601, 1601, 1601, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609,
+	4, 14, 24, 33, 43, 53, 62, 72, 82, 91, 101, 111, 120, 130, 140, 149, 159, 168, 178, 188, 197, 207, 217, 226, 236, 245, 255, 264, 274, 283, 293, 302,
+	312, 321, 331, 340, 349, 359, 369, 378, 387, 397, 405, 415, 424, 434, 443, 452, 462, 470, 479, 489, 498, 507, 517, 526, 534, 545, 554, 563, 570, 580, 589, 597,
+	607, 615, 625, 634, 643, 651, 660, 669, 678, 686, 695, 704, 712, 720, 730, 738, 746, 756, 764, 772, 781, 789, 798, 804, 813, 822, 831, 838, 847, 854, 863, 870,
+	880, 887, 894, 904, 911, 919, 926, 934, 941, 949, 957, 965, 972, 980, 988, 996, 1002, 1010, 1018, 1024, 1032, 1041, 1046, 1055, 1061, 1069, 1075, 1084, 1090, 1096, 1105, 1111,
+	1117, 1123, 1132, 1138, 1144, 1150, 1157, 1163, 1169, 1176, 1182, 1188, 1195, 1201, 1208, 1214, 1221, 1228, 1231, 1238, 1244, 1251, 1258, 1261, 1268, 1275, 1279, 1286, 1289, 1296, 1303, 1307,
+	1314, 1317, 1324, 1328, 1332, 1339, 1342, 1350, 1353, 1357, 1364, 1368, 1372, 1379, 1383, 1387, 1391, 1394, 1402, 1406, 1409, 1413, 1417, 1421, 1425, 1429, 1433, 1436, 1440, 1444, 1448, 1452,
+	1456, 1460, 1464, 1468, 1472, 1476, 1480, 1480, 1484, 1488, 1492, 1492, 1496, 1500, 1504, 1504, 1508, 1512, 1512, 1516, 1520, 1520, 1525, 1525, 1529, 1533, 1533, 1537, 1537, 1541, 1541, 1545,
+	1545, 1545, 1550, 1550, 1554, 1554, 1554, 1558, 1558, 1558, 1562, 1562, 1562, 1566, 1566, 1566, 1566, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575,
+	4, 14, 23, 33, 42, 51, 61, 70, 80, 89, 99, 108, 118, 127, 137, 146, 156, 165, 174, 184, 193, 202, 212, 221, 231, 239, 249, 258, 268, 277, 286, 296,
+	305, 314, 324, 333, 342, 351, 361, 370, 379, 388, 397, 406, 415, 424, 434, 442, 452, 460, 469, 478, 487, 497, 506, 515, 523, 533, 542, 551, 558, 567, 577, 584,
+	594, 602, 612, 620, 629, 637, 646, 655, 664, 671, 680, 689, 697, 704, 714, 722, 730, 740, 748, 756, 764, 772, 781, 787, 796, 804, 813, 820, 829, 836, 845, 852,
+	861, 868, 875, 884, 892, 899, 906, 914, 921, 929, 936, 944, 952, 959, 967, 975, 980, 988, 996, 1002, 1010, 1018, 1024, 1032, 1038, 1046, 1052, 1061, 1066, 1072, 1081, 1087,
+	1093, 1099, 1108, 1114, 1120, 1126, 1132, 1138, 1144, 1150, 1157, 1163, 1169, 1176, 1182, 1188, 1195, 1201, 1205, 1211, 1218, 1224, 1231, 1234, 1241, 1248, 1251, 1258, 1261, 1268, 1275, 1279,
+	1286, 1289, 1296, 1300, 1303, 1310, 1314, 1321, 1324, 1328, 1335, 1339, 1342, 1350, 1353, 1357, 1361, 1364, 1372, 1376, 1379, 1383, 1387, 1391, 1394, 1398, 1402, 1406, 1409, 1413, 1417, 1421,
+	1425, 1429, 1433, 1436, 1440, 1444, 1448, 1448, 1452, 1456, 1460, 1460, 1464, 1468, 1472, 1472, 1476, 1480, 1480, 1484, 1488, 1488, 1492, 1492, 1496, 1500, 1500, 1504, 1504, 1508, 1508, 1512,
+	1512, 1512, 1516, 1516, 1520, 1520, 1520, 1525, 1525, 1525, 1529, 1529, 1529, 1533, 1533, 1533, 1533, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541,
+	4, 13, 23, 32, 41, 50, 60, 69, 78, 87, 97, 106, 115, 124, 134, 143, 152, 161, 171, 180, 189, 198, 207, 216, 226, 234, 244, 253, 262, 271, 280, 290,
+	298, 307, 317, 325, 334, 344, 353, 362, 371, 380, 388, 398, 406, 415, 424, 433, 442, 450, 459, 468, 477, 486, 495, 503, 512, 522, 530, 539, 546, 555, 564, 572,
+	581, 589, 599, 607, 615, 624, 632, 641, 650, 657, 666, 675, 682, 689, 699, 706, 714, 724, 732, 740, 748, 756, 764, 770, 779, 787, 796, 802, 811, 818, 827, 833,
+	842, 849, 856, 866, 873, 880, 887, 894, 901, 909, 916, 924, 931, 939, 946, 954, 959, 967, 975, 980, 988, 996, 1002, 1010, 1015, 1024, 1030, 1038, 1044, 1049, 1058, 1064,
+	1069, 1075, 1084, 1090, 1096, 1102, 1108, 1114, 1120, 1126, 1132, 1138, 1144, 1150, 1157, 1163, 1169, 1176, 1179, 1185, 1192, 1198, 1205, 1208, 1214, 1221, 1224, 1231, 1234, 1241, 1248, 1251,
+	1258, 1261, 1268, 1272, 1275, 1282, 1286, 1292, 1296, 1300, 1307, 1310, 1314, 1321, 1324, 1328, 1332, 1335, 1342, 1346, 1350, 1353, 1357, 1361, 1364, 1368, 1372, 1376, 1379, 1383, 1387, 1391,
+	1394, 1398, 1402, 1406, 1409, 1413, 1417, 1417, 1421, 1425, 1429, 1429, 1433, 1436, 1440, 1440, 1444, 1448, 1448, 1452, 1456, 1456, 1460, 1460, 1464, 1468, 1468, 1472, 1472, 1476, 1476, 1480,
+	1480, 1480, 1484, 1484, 1488, 1488, 1488, 1492, 1492, 1492, 1496, 1496, 1496, 1500, 1500, 1500, 1500, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508,
+	4, 13, 22, 31, 40, 49, 58, 67, 76, 86, 95, 104, 113, 122, 131, 140, 149, 158, 167, 176, 185, 194, 203, 211, 221, 229, 239, 247, 256, 266, 274, 283,
+	292, 301, 310, 318, 327, 336, 345, 354, 363, 372, 380, 389, 398, 406, 415, 423, 433, 441, 449, 458, 467, 476, 485, 493, 501, 510, 519, 527, 534, 543, 552, 560,
+	569, 577, 586, 594, 602, 610, 619, 627, 636, 643, 651, 660, 667, 675, 684, 691, 699, 708, 716, 724, 732, 740, 748, 754, 762, 770, 779, 785, 794, 800, 809, 815,
+	824, 831, 838, 847, 854, 861, 868, 875, 882, 889, 897, 904, 911, 919, 926, 934, 939, 946, 954, 959, 967, 975, 980, 988, 994, 1002, 1007, 1015, 1021, 1027, 1035, 1041,
+	1046, 1052, 1061, 1066, 1072, 1078, 1084, 1090, 1096, 1102, 1108, 1114, 1120, 1126, 1132, 1138, 1144, 1150, 1154, 1160, 1166, 1172, 1179, 1182, 1188, 1195, 1198, 1205, 1208, 1214, 1221, 1224,
+	1231, 1234, 1241, 1244, 1248, 1255, 1258, 1265, 1268, 1272, 1279, 1282, 1286, 1292, 1296, 1300, 1303, 1307, 1314, 1317, 1321, 1324, 1328, 1332, 1335, 1339, 1342, 1346, 1350, 1353, 1357, 1361,
+	1364, 1368, 1372, 1376, 1379, 1383, 1387, 1387, 1391, 1394, 1398, 1398, 1402, 1406, 1409, 1409, 1413, 1417, 1417, 1421, 1425, 1425, 1429, 1429, 1433, 1436, 1436, 1440, 1440, 1444, 1444, 1448,
+	1448, 1448, 1452, 1452, 1456, 1456, 1456, 1460, 1460, 1460, 1464, 1464, 1464, 1468, 1468, 1468, 1468, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
+	4, 13, 22, 30, 39, 48, 57, 66, 75, 84, 93, 101, 110, 119, 128, 137, 146, 154, 163, 172, 181, 190, 199, 207, 216, 224, 234, 242, 251, 260, 268, 277,
+	286, 294, 303, 312, 320, 329, 338, 346, 355, 364, 372, 381, 389, 398, 406, 414, 423, 431, 440, 448, 457, 465, 474, 482, 490, 499, 507, 516, 523, 532, 540, 548,
+	557, 564, 573, 581, 589, 597, 605, 614, 622, 629, 637, 646, 653, 660, 669, 676, 684, 693, 701, 708, 716, 724, 732, 738, 746, 754, 762, 768, 777, 783, 792, 798,
+	807, 813, 820, 829, 836, 842, 849, 856, 863, 870, 877, 884, 892, 899, 906, 914, 919, 926, 934, 939, 946, 954, 959, 967, 972, 980, 986, 994, 999, 1005, 1013, 1018,
+	1024, 1030, 1038, 1044, 1049, 1055, 1061, 1066, 1072, 1078, 1084, 1090, 1096, 1102, 1108, 1114, 1120, 1126, 1129, 1135, 1141, 1147, 1154, 1157, 1163, 1169, 1172, 1179, 1182, 1188, 1195, 1198,
+	1205, 1208, 1214, 1218, 1221, 1228, 1231, 1238, 1241, 1244, 1251, 1255, 1258, 1265, 1268, 1272, 1275, 1279, 1286, 1289, 1292, 1296, 1300, 1303, 1307, 1310, 1314, 1317, 1321, 1324, 1328, 1332,
+	1335, 1339, 1342, 1346, 1350, 1353, 1357, 1357, 1361, 1364, 1368, 1368, 1372, 1376, 1379, 1379, 1383, 1387, 1387, 1391, 1394, 1394, 1398, 1398, 1402, 1406, 1406, 1409, 1409, 1413, 1413, 1417,
+	1417, 1417, 1421, 1421, 1425, 1425, 1425, 1429, 1429, 1429, 1433, 1433, 1433, 1436, 1436, 1436, 1436, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
+	4, 13, 21, 30, 39, 47, 56, 65, 73, 82, 91, 99, 108, 117, 125, 134, 143, 151, 160, 168, 177, 186, 194, 202, 211, 220, 229, 237, 245, 254, 263, 271,
+	280, 288, 297, 305, 313, 322, 331, 339, 347, 356, 364, 373, 381, 389, 398, 405, 414, 422, 430, 438, 447, 455, 464, 472, 479, 489, 497, 505, 512, 520, 529, 536,
+	545, 552, 561, 569, 577, 584, 592, 600, 609, 615, 624, 632, 639, 646, 655, 662, 669, 678, 686, 693, 701, 708, 716, 722, 730, 738, 746, 752, 760, 766, 775, 781,
+	789, 796, 802, 811, 818, 824, 831, 838, 845, 852, 858, 866, 873, 880, 887, 894, 899, 906, 914, 919, 926, 934, 939, 946, 952, 959, 965, 972, 978, 983, 991, 996,
+	1002, 1007, 1015, 1021, 1027, 1032, 1038, 1044, 1049, 1055, 1061, 1066, 1072, 1078, 1084, 1090, 1096, 1102, 1105, 1111, 1117, 1123, 1129, 1132, 1138, 1144, 1147, 1154, 1157, 1163, 1169, 1172,
+	1179, 1182, 1188, 1192, 1195, 1201, 1205, 1211, 1214, 1218, 1224, 1228, 1231, 1238, 1241, 1244, 1248, 1251, 1258, 1261, 1265, 1268, 1272, 1275, 1279, 1282, 1286, 1289, 1292, 1296, 1300, 1303,
+	1307, 1310, 1314, 1317, 1321, 1324, 1328, 1328, 1332, 1335, 1339, 1339, 1342, 1346, 1350, 1350, 1353, 1357, 1357, 1361, 1364, 1364, 1368, 1368, 1372, 1376, 1376, 1379, 1379, 1383, 1383, 1387,
+	1387, 1387, 1391, 1391, 1394, 1394, 1394, 1398, 1398, 1398, 1402, 1402, 1402, 1406, 1406, 1406, 1406, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,
+	4, 12, 21, 29, 38, 46, 55, 63, 72, 80, 89, 97, 105, 114, 122, 131, 140, 148, 156, 165, 173, 182, 190, 198, 207, 215, 224, 232, 240, 249, 257, 266,
+	274, 282, 290, 298, 307, 315, 324, 332, 340, 348, 356, 365, 373, 381, 389, 397, 405, 413, 421, 429, 437, 446, 454, 462, 469, 478, 486, 494, 501, 509, 517, 524,
+	533, 540, 549, 557, 564, 572, 580, 588, 596, 602, 610, 619, 625, 632, 641, 648, 655, 664, 671, 678, 686, 693, 701, 706, 714, 722, 730, 736, 744, 750, 758, 764,
+	772, 779, 785, 794, 800, 807, 813, 820, 827, 833, 840, 847, 854, 861, 868, 875, 880, 887, 894, 899, 906, 914, 919, 926, 931, 939, 944, 952, 957, 962, 970, 975,
+	980, 986, 994, 999, 1005, 1010, 1015, 1021, 1027, 1032, 1038, 1044, 1049, 1055, 1061, 1066, 1072, 1078, 1081, 1087, 1093, 1099, 1105, 1108, 1114, 1120, 1123, 1129, 1132, 1138, 1144, 1147,
+	1154, 1157, 1163, 1166, 1169, 1176, 1179, 1185, 1188, 1192, 1198, 1201, 1205, 1211, 1214, 1218, 1221, 1224, 1231, 1234, 1238, 1241, 1244, 1248, 1251, 1255, 1258, 1261, 1265, 1268, 1272, 1275,
+	1279, 1282, 1286, 1289, 1292, 1296, 1300, 1300, 1303, 1307, 1310, 1310, 1314, 1317, 1321, 1321, 1324, 1328, 1328, 1332, 1335, 1335, 1339, 1339, 1342, 1346, 1346, 1350, 1350, 1353, 1353, 1357,
+	1357, 1357, 1361, 1361, 1364, 1364, 1364, 1368, 1368, 1368, 1372, 1372, 1372, 1376, 1376, 1376, 1376, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383,
+	4, 12, 20, 29, 37, 45, 53, 62, 70, 78, 87, 95, 103, 112, 120, 128, 137, 145, 153, 161, 169, 178, 186, 194, 202, 210, 219, 227, 235, 243, 251, 260,
+	268, 276, 284, 292, 300, 308, 317, 325, 333, 341, 348, 357, 365, 373, 381, 388, 397, 404, 412, 420, 428, 436, 444, 452, 459, 468, 476, 483, 490, 498, 506, 513,
+	522, 529, 537, 545, 552, 560, 567, 575, 583, 589, 597, 605, 612, 619, 627, 634, 641, 650, 657, 664, 671, 678, 686, 691, 699, 706, 714, 720, 728, 734, 742, 748,
+	756, 762, 768, 777, 783, 789, 796, 802, 809, 815, 822, 829, 836, 842, 849, 856, 861, 868, 875, 880, 887, 894, 899, 906, 911, 919, 924, 931, 936, 941, 949, 954,
+	959, 965, 972, 978, 983, 988, 994, 999, 1005, 1010, 1015, 1021, 1027, 1032, 1038, 1044, 1049, 1055, 1058, 1064, 1069, 1075, 1081, 1084, 1090, 1096, 1099, 1105, 1108, 1114, 1120, 1123,
+	1129, 1132, 1138, 1141, 1144, 1150, 1154, 1160, 1163, 1166, 1172, 1176, 1179, 1185, 1188, 1192, 1195, 1198, 1205, 1208, 1211, 1214, 1218, 1221, 1224, 1228, 1231, 1234, 1238, 1241, 1244, 1248,
+	1251, 1255, 1258, 1261, 1265, 1268, 1272, 1272, 1275, 1279, 1282, 1282, 1286, 1289, 1292, 1292, 1296, 1300, 1300, 1303, 1307, 1307, 1310, 1310, 1314, 1317, 1317, 1321, 1321, 1324, 1324, 1328,
+	1328, 1328, 1332, 1332, 1335, 1335, 1335, 1339, 1339, 1339, 1342, 1342, 1342, 1346, 1346, 1346, 1346, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353,
+	4, 12, 20, 28, 36, 44, 52, 60, 69, 77, 85, 93, 101, 109, 117, 125, 134, 141, 150, 158, 166, 174, 182, 190, 198, 206, 214, 222, 230, 238, 246, 254,
+	262, 270, 278, 286, 294, 302, 310, 318, 325, 333, 341, 349, 357, 365, 373, 380, 388, 396, 403, 411, 419, 427, 435, 442, 449, 458, 465, 473, 479, 487, 495, 502,
+	510, 517, 526, 533, 540, 548, 555, 563, 570, 577, 584, 592, 599, 605, 614, 620, 627, 636, 643, 650, 657, 664, 671, 676, 684, 691, 699, 704, 712, 718, 726, 732,
+	740, 746, 752, 760, 766, 772, 779, 785, 792, 798, 804, 811, 818, 824, 831, 838, 842, 849, 856, 861, 868, 875, 880, 887, 892, 899, 904, 911, 916, 921, 929, 934,
+	939, 944, 952, 957, 962, 967, 972, 978, 983, 988, 994, 999, 1005, 1010, 1015, 1021, 1027, 1032, 1035, 1041, 1046, 1052, 1058, 1061, 1066, 1072, 1075, 1081, 1084, 1090, 1096, 1099,
+	1105, 1108, 1114, 1117, 1120, 1126, 1129, 1135, 1138, 1141, 1147, 1150, 1154, 1160, 1163, 1166, 1169, 1172, 1179, 1182, 1185, 1188, 1192, 1195, 1198, 1201, 1205, 1208, 1211, 1214, 1218, 1221,
+	1224, 1228, 1231, 1234, 1238, 1241, 1244, 1244, 1248, 1251, 1255, 1255, 1258, 1261, 1265, 1265, 1268, 1272, 1272, 1275, 1279, 1279, 1282, 1282, 1286, 1289, 1289, 1292, 1292, 1296, 1296, 1300,
+	1300, 1300, 1303, 1303, 1307, 1307, 1307, 1310, 1310, 1310, 1314, 1314, 1314, 1317, 1317, 1317, 1317, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324,
+	3, 11, 19, 27, 35, 43, 51, 59, 67, 75, 83, 91, 99, 107, 115, 123, 131, 138, 147, 154, 162, 170, 178, 186, 194, 201, 210, 217, 225, 233, 241, 249,
+	256, 264, 272, 280, 287, 295, 303, 311, 318, 326, 333, 342, 349, 357, 365, 372, 380, 387, 394, 402, 410, 418, 426, 433, 440, 448, 455, 463, 469, 477, 485, 491,
+	499, 506, 515, 522, 529, 536, 543, 551, 558, 564, 572, 580, 586, 592, 600, 607, 614, 622, 629, 636, 643, 650, 657, 662, 669, 676, 684, 689, 697, 703, 710, 716,
+	724, 730, 736, 744, 750, 756, 762, 768, 775, 781, 787, 794, 800, 807, 813, 820, 824, 831, 838, 842, 849, 856, 861, 868, 873, 880, 884, 892, 897, 901, 909, 914,
+	919, 924, 931, 936, 941, 946, 952, 957, 962, 967, 972, 978, 983, 988, 994, 999, 1005, 1010, 1013, 1018, 1024, 1030, 1035, 1038, 1044, 1049, 1052, 1058, 1061, 1066, 1072, 1075,
+	1081, 1084, 1090, 1093, 1096, 1102, 1105, 1111, 1114, 1117, 1123, 1126, 1129, 1135, 1138, 1141, 1144, 1147, 1154, 1157, 1160, 1163, 1166, 1169, 1172, 1176, 1179, 1182, 1185, 1188, 1192, 1195,
+	1198, 1201, 1205, 1208, 1211, 1214, 1218, 1218, 1221, 1224, 1228, 1228, 1231, 1234, 1238, 1238, 1241, 1244, 1244, 1248, 1251, 1251, 1255, 1255, 1258, 1261, 1261, 1265, 1265, 1268, 1268, 1272,
+	1272, 1272, 1275, 1275, 1279, 1279, 1279, 1282, 1282, 1282, 1286, 1286, 1286, 1289, 1289, 1289, 1289, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296,
+	3, 11, 19, 27, 35, 42, 50, 58, 66, 73, 81, 89, 97, 105, 112, 120, 128, 135, 143, 151, 159, 166, 174, 182, 190, 197, 205, 213, 220, 228, 236, 243,
+	251, 258, 266, 274, 281, 289, 297, 304, 312, 319, 326, 334, 342, 349, 357, 364, 372, 379, 386, 393, 401, 409, 416, 423, 430, 438, 446, 453, 459, 467, 474, 481,
+	489, 495, 503, 510, 517, 524, 532, 539, 546, 552, 560, 567, 573, 580, 588, 594, 600, 609, 615, 622, 629, 636, 643, 648, 655, 662, 669, 675, 682, 688, 695, 701,
+	708, 714, 720, 728, 734, 740, 746, 752, 758, 764, 770, 777, 783, 789, 796, 802, 807, 813, 820, 824, 831, 838, 842, 849, 854, 861, 866, 873, 877, 882, 889, 894,
+	899, 904, 911, 916, 921, 926, 931, 936, 941, 946, 952, 957, 962, 967, 972, 978, 983, 988, 991, 996, 1002, 1007, 1013, 1015, 1021, 1027, 1030, 1035, 1038, 1044, 1049, 1052,
+	1058, 1061, 1066, 1069, 1072, 1078, 1081, 1087, 1090, 1093, 1099, 1102, 1105, 1111, 1114, 1117, 1120, 1123, 1129, 1132, 1135, 1138, 1141, 1144, 1147, 1150, 1154, 1157, 1160, 1163, 1166, 1169,
+	1172, 1176, 1179, 1182, 1185, 1188, 1192, 1192, 1195, 1198, 1201, 1201, 1205, 1208, 1211, 1211, 1214, 1218, 1218, 1221, 1224, 1224, 1228, 1228, 1231, 1234, 1234, 1238, 1238, 1241, 1241, 1244,
+	1244, 1244, 1248, 1248, 1251, 1251, 1251, 1255, 1255, 1255, 1258, 1258, 1258, 1261, 1261, 1261, 1261, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268,
+	3, 11, 19, 26, 34, 41, 49, 57, 64, 72, 79, 87, 95, 102, 110, 118, 125, 133, 140, 148, 155, 163, 171, 178, 186, 193, 201, 208, 215, 223, 231, 238,
+	245, 253, 261, 268, 275, 283, 290, 298, 305, 312, 319, 327, 334, 342, 349, 356, 364, 371, 378, 385, 392, 400, 407, 414, 421, 429, 436, 443, 449, 457, 464, 470,
+	478, 485, 493, 499, 506, 513, 520, 527, 534, 540, 548, 555, 561, 567, 575, 581, 588, 596, 602, 609, 615, 622, 629, 634, 641, 648, 655, 660, 667, 673, 680, 686,
+	693, 699, 704, 712, 718, 724, 730, 736, 742, 748, 754, 760, 766, 772, 779, 785, 789, 796, 802, 807, 813, 820, 824, 831, 836, 842, 847, 854, 858, 863, 870, 875,
+	880, 884, 892, 897, 901, 906, 911, 916, 921, 926, 931, 936, 941, 946, 952, 957, 962, 967, 970, 975, 980, 986, 991, 994, 999, 1005, 1007, 1013, 1015, 1021, 1027, 1030,
+	1035, 1038, 1044, 1046, 1049, 1055, 1058, 1064, 1066, 1069, 1075, 1078, 1081, 1087, 1090, 1093, 1096, 1099, 1105, 1108, 1111, 1114, 1117, 1120, 1123, 1126, 1129, 1132, 1135, 1138, 1141, 1144,
+	1147, 1150, 1154, 1157, 1160, 1163, 1166, 1166, 1169, 1172, 1176, 1176, 1179, 1182, 1185, 1185, 1188, 1192, 1192, 1195, 1198, 1198, 1201, 1201, 1205, 1208, 1208, 1211, 1211, 1214, 1214, 1218,
+	1218, 1218, 1221, 1221, 1224, 1224, 1224, 1228, 1228, 1228, 1231, 1231, 1231, 1234, 1234, 1234, 1234, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	3, 11, 18, 26, 33, 40, 48, 55, 63, 70, 78, 85, 93, 100, 107, 115, 122, 130, 137, 145, 152, 159, 167, 174, 182, 189, 196, 203, 211, 218, 226, 233,
+	240, 247, 255, 262, 269, 277, 284, 291, 298, 306, 312, 320, 327, 334, 342, 348, 356, 363, 370, 377, 384, 391, 399, 405, 412, 420, 427, 434, 440, 447, 454, 460,
+	468, 474, 482, 489, 495, 502, 509, 516, 523, 529, 536, 543, 549, 555, 563, 569, 575, 583, 589, 596, 602, 609, 615, 620, 627, 634, 641, 646, 653, 658, 666, 671,
+	678, 684, 689, 697, 703, 708, 714, 720, 726, 732, 738, 744, 750, 756, 762, 768, 772, 779, 785, 789, 796, 802, 807, 813, 818, 824, 829, 836, 840, 845, 852, 856,
+	861, 866, 873, 877, 882, 887, 892, 897, 901, 906, 911, 916, 921, 926, 931, 936, 941, 946, 949, 954, 959, 965, 970, 972, 978, 983, 986, 991, 994, 999, 1005, 1007,
+	1013, 1015, 1021, 1024, 1027, 1032, 1035, 1041, 1044, 1046, 1052, 1055, 1058, 1064, 1066, 1069, 1072, 1075, 1081, 1084, 1087, 1090, 1093, 1096, 1099, 1102, 1105, 1108, 1111, 1114, 1117, 1120,
+	1123, 1126, 1129, 1132, 1135, 1138, 1141, 1141, 1144, 1147, 1150, 1150, 1154, 1157, 1160, 1160, 1163, 1166, 1166, 1169, 1172, 1172, 1176, 1176, 1179, 1182, 1182, 1185, 1185, 1188, 1188, 1192,
+	1192, 1192, 1195, 1195, 1198, 1198, 1198, 1201, 1201, 1201, 1205, 1205, 1205, 1208, 1208, 1208, 1208, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214,
+	3, 10, 18, 25, 32, 40, 47, 54, 61, 69, 76, 83, 91, 98, 105, 113, 120, 127, 134, 141, 149, 156, 163, 170, 178, 185, 192, 199, 206, 214, 221, 228,
+	235, 242, 249, 256, 263, 271, 278, 285, 292, 299, 306, 313, 320, 327, 334, 341, 348, 355, 362, 369, 376, 383, 390, 397, 403, 411, 418, 424, 430, 437, 444, 450,
+	458, 464, 472, 478, 485, 491, 498, 505, 512, 517, 524, 532, 537, 543, 551, 557, 563, 570, 577, 583, 589, 596, 602, 607, 614, 620, 627, 632, 639, 644, 651, 657,
+	664, 669, 675, 682, 688, 693, 699, 704, 710, 716, 722, 728, 734, 740, 746, 752, 756, 762, 768, 772, 779, 785, 789, 796, 800, 807, 811, 818, 822, 827, 833, 838,
+	842, 847, 854, 858, 863, 868, 873, 877, 882, 887, 892, 897, 901, 906, 911, 916, 921, 926, 929, 934, 939, 944, 949, 952, 957, 962, 965, 970, 972, 978, 983, 986,
+	991, 994, 999, 1002, 1005, 1010, 1013, 1018, 1021, 1024, 1030, 1032, 1035, 1041, 1044, 1046, 1049, 1052, 1058, 1061, 1064, 1066, 1069, 1072, 1075, 1078, 1081, 1084, 1087, 1090, 1093, 1096,
+	1099, 1102, 1105, 1108, 1111, 1114, 1117, 1117, 1120, 1123, 1126, 1126, 1129, 1132, 1135, 1135, 1138, 1141, 1141, 1144, 1147, 1147, 1150, 1150, 1154, 1157, 1157, 1160, 1160, 1163, 1163, 1166,
+	1166, 1166, 1169, 1169, 1172, 1172, 1172, 1176, 1176, 1176, 1179, 1179, 1179, 1182, 1182, 1182, 1182, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	3, 10, 17, 24, 32, 39, 46, 53, 60, 67, 74, 82, 89, 96, 103, 110, 117, 124, 131, 138, 145, 153, 160, 166, 174, 181, 188, 195, 202, 209, 216, 223,
+	230, 237, 244, 251, 258, 265, 272, 279, 286, 293, 299, 307, 313, 320, 327, 333, 341, 347, 354, 361, 368, 375, 382, 388, 394, 402, 409, 415, 421, 428, 435, 441,
+	448, 454, 462, 468, 474, 481, 487, 494, 501, 506, 513, 520, 526, 532, 539, 545, 551, 558, 564, 570, 577, 583, 589, 594, 600, 607, 614, 619, 625, 630, 637, 643,
+	650, 655, 660, 667, 673, 678, 684, 689, 695, 701, 706, 712, 718, 724, 730, 736, 740, 746, 752, 756, 762, 768, 772, 779, 783, 789, 794, 800, 804, 809, 815, 820,
+	824, 829, 836, 840, 845, 849, 854, 858, 863, 868, 873, 877, 882, 887, 892, 897, 901, 906, 909, 914, 919, 924, 929, 931, 936, 941, 944, 949, 952, 957, 962, 965,
+	970, 972, 978, 980, 983, 988, 991, 996, 999, 1002, 1007, 1010, 1013, 1018, 1021, 1024, 1027, 1030, 1035, 1038, 1041, 1044, 1046, 1049, 1052, 1055, 1058, 1061, 1064, 1066, 1069, 1072,
+	1075, 1078, 1081, 1084, 1087, 1090, 1093, 1093, 1096, 1099, 1102, 1102, 1105, 1108, 1111, 1111, 1114, 1117, 1117, 1120, 1123, 1123, 1126, 1126, 1129, 1132, 1132, 1135, 1135, 1138, 1138, 1141,
+	1141, 1141, 1144, 1144, 1147, 1147, 1147, 1150, 1150, 1150, 1154, 1154, 1154, 1157, 1157, 1157, 1157, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,
+	3, 10, 17, 24, 31, 38, 45, 52, 59, 66, 73, 80, 87, 94, 101, 108, 115, 121, 129, 135, 142, 149, 156, 163, 170, 177, 184, 191, 198, 205, 211, 218,
+	225, 232, 239, 245, 252, 259, 266, 273, 280, 286, 293, 300, 307, 313, 320, 326, 333, 340, 346, 353, 360, 367, 374, 380, 386, 393, 400, 406, 412, 419, 426, 431,
+	438, 444, 452, 458, 464, 470, 477, 483, 490, 495, 502, 509, 515, 520, 527, 533, 539, 546, 552, 558, 564, 570, 577, 581, 588, 594, 600, 605, 612, 617, 624, 629,
+	636, 641, 646, 653, 658, 664, 669, 675, 680, 686, 691, 697, 703, 708, 714, 720, 724, 730, 736, 740, 746, 752, 756, 762, 766, 772, 777, 783, 787, 792, 798, 802,
+	807, 811, 818, 822, 827, 831, 836, 840, 845, 849, 854, 858, 863, 868, 873, 877, 882, 887, 889, 894, 899, 904, 909, 911, 916, 921, 924, 929, 931, 936, 941, 944,
+	949, 952, 957, 959, 962, 967, 970, 975, 978, 980, 986, 988, 991, 996, 999, 1002, 1005, 1007, 1013, 1015, 1018, 1021, 1024, 1027, 1030, 1032, 1035, 1038, 1041, 1044, 1046, 1049,
+	1052, 1055, 1058, 1061, 1064, 1066, 1069, 1069, 1072, 1075, 1078, 1078, 1081, 1084, 1087, 1087, 1090, 1093, 1093, 1096, 1099, 1099, 1102, 1102, 1105, 1108, 1108, 1111, 1111, 1114, 1114, 1117,
+	1117, 1117, 1120, 1120, 1123, 1123, 1123, 1126, 1126, 1126, 1129, 1129, 1129, 1132, 1132, 1132, 1132, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138,
+	3, 10, 17, 23, 30, 37, 44, 51, 58, 64, 71, 78, 85, 92, 99, 105, 112, 119, 126, 133, 139, 146, 153, 159, 166, 173, 180, 187, 193, 200, 207, 214,
+	220, 227, 234, 240, 247, 253, 261, 267, 274, 280, 286, 294, 300, 307, 313, 319, 326, 333, 339, 345, 352, 359, 366, 372, 378, 385, 391, 398, 403, 410, 416, 422,
+	429, 435, 442, 448, 454, 460, 467, 473, 479, 485, 491, 498, 503, 509, 516, 522, 527, 534, 540, 546, 552, 558, 564, 569, 575, 581, 588, 592, 599, 604, 610, 615,
+	622, 627, 632, 639, 644, 650, 655, 660, 666, 671, 676, 682, 688, 693, 699, 704, 708, 714, 720, 724, 730, 736, 740, 746, 750, 756, 760, 766, 770, 775, 781, 785,
+	789, 794, 800, 804, 809, 813, 818, 822, 827, 831, 836, 840, 845, 849, 854, 858, 863, 868, 870, 875, 880, 884, 889, 892, 897, 901, 904, 909, 911, 916, 921, 924,
+	929, 931, 936, 939, 941, 946, 949, 954, 957, 959, 965, 967, 970, 975, 978, 980, 983, 986, 991, 994, 996, 999, 1002, 1005, 1007, 1010, 1013, 1015, 1018, 1021, 1024, 1027,
+	1030, 1032, 1035, 1038, 1041, 1044, 1046, 1046, 1049, 1052, 1055, 1055, 1058, 1061, 1064, 1064, 1066, 1069, 1069, 1072, 1075, 1075, 1078, 1078, 1081, 1084, 1084, 1087, 1087, 1090, 1090, 1093,
+	1093, 1093, 1096, 1096, 1099, 1099, 1099, 1102, 1102, 1102, 1105, 1105, 1105, 1108, 1108, 1108, 1108, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	3, 10, 16, 23, 30, 36, 43, 50, 56, 63, 70, 76, 83, 90, 96, 103, 110, 116, 123, 130, 136, 143, 150, 156, 163, 169, 176, 183, 189, 196, 202, 209,
+	215, 222, 229, 235, 241, 248, 255, 261, 268, 274, 280, 287, 294, 300, 307, 312, 319, 325, 332, 338, 344, 351, 358, 364, 370, 377, 383, 389, 394, 401, 407, 413,
+	420, 426, 433, 438, 444, 450, 457, 463, 469, 474, 481, 487, 493, 498, 505, 510, 516, 523, 529, 534, 540, 546, 552, 557, 563, 569, 575, 580, 586, 591, 597, 602,
+	609, 614, 619, 625, 630, 636, 641, 646, 651, 657, 662, 667, 673, 678, 684, 689, 693, 699, 704, 708, 714, 720, 724, 730, 734, 740, 744, 750, 754, 758, 764, 768,
+	772, 777, 783, 787, 792, 796, 800, 804, 809, 813, 818, 822, 827, 831, 836, 840, 845, 849, 852, 856, 861, 866, 870, 873, 877, 882, 884, 889, 892, 897, 901, 904,
+	909, 911, 916, 919, 921, 926, 929, 934, 936, 939, 944, 946, 949, 954, 957, 959, 962, 965, 970, 972, 975, 978, 980, 983, 986, 988, 991, 994, 996, 999, 1002, 1005,
+	1007, 1010, 1013, 1015, 1018, 1021, 1024, 1024, 1027, 1030, 1032, 1032, 1035, 1038, 1041, 1041, 1044, 1046, 1046, 1049, 1052, 1052, 1055, 1055, 1058, 1061, 1061, 1064, 1064, 1066, 1066, 1069,
+	1069, 1069, 1072, 1072, 1075, 1075, 1075, 1078, 1078, 1078, 1081, 1081, 1081, 1084, 1084, 1084, 1084, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090,
+	3, 9, 16, 22, 29, 35, 42, 49, 55, 62, 68, 75, 81, 88, 94, 101, 107, 114, 120, 127, 133, 140, 147, 153, 159, 166, 172, 179, 185, 192, 198, 205,
+	211, 217, 224, 230, 236, 243, 249, 256, 262, 268, 274, 281, 287, 294, 300, 306, 312, 318, 325, 331, 337, 344, 350, 356, 362, 369, 375, 381, 386, 392, 399, 404,
+	411, 416, 423, 429, 435, 441, 447, 453, 459, 464, 470, 477, 482, 487, 494, 499, 505, 512, 517, 523, 529, 534, 540, 545, 551, 557, 563, 567, 573, 578, 584, 589,
+	596, 600, 605, 612, 617, 622, 627, 632, 637, 643, 648, 653, 658, 664, 669, 675, 678, 684, 689, 693, 699, 704, 708, 714, 718, 724, 728, 734, 738, 742, 748, 752,
+	756, 760, 766, 770, 775, 779, 783, 787, 792, 796, 800, 804, 809, 813, 818, 822, 827, 831, 833, 838, 842, 847, 852, 854, 858, 863, 866, 870, 873, 877, 882, 884,
+	889, 892, 897, 899, 901, 906, 909, 914, 916, 919, 924, 926, 929, 934, 936, 939, 941, 944, 949, 952, 954, 957, 959, 962, 965, 967, 970, 972, 975, 978, 980, 983,
+	986, 988, 991, 994, 996, 999, 1002, 1002, 1005, 1007, 1010, 1010, 1013, 1015, 1018, 1018, 1021, 1024, 1024, 1027, 1030, 1030, 1032, 1032, 1035, 1038, 1038, 1041, 1041, 1044, 1044, 1046,
+	1046, 1046, 1049, 1049, 1052, 1052, 1052, 1055, 1055, 1055, 1058, 1058, 1058, 1061, 1061, 1061, 1061, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+	3, 9, 16, 22, 28, 35, 41, 48, 54, 60, 67, 73, 79, 86, 92, 99, 105, 111, 118, 124, 130, 137, 143, 149, 156, 162, 169, 175, 181, 188, 194, 200,
+	206, 213, 219, 225, 231, 238, 244, 250, 256, 263, 268, 275, 281, 287, 294, 299, 306, 312, 318, 324, 330, 336, 343, 348, 354, 361, 367, 373, 378, 384, 390, 396,
+	402, 407, 414, 420, 426, 431, 437, 443, 449, 454, 460, 467, 472, 477, 483, 489, 494, 501, 506, 512, 517, 523, 529, 533, 539, 545, 551, 555, 561, 566, 572, 577,
+	583, 588, 592, 599, 604, 609, 614, 619, 624, 629, 634, 639, 644, 650, 655, 660, 664, 669, 675, 678, 684, 689, 693, 699, 703, 708, 712, 718, 722, 726, 732, 736,
+	740, 744, 750, 754, 758, 762, 766, 770, 775, 779, 783, 787, 792, 796, 800, 804, 809, 813, 815, 820, 824, 829, 833, 836, 840, 845, 847, 852, 854, 858, 863, 866,
+	870, 873, 877, 880, 882, 887, 889, 894, 897, 899, 904, 906, 909, 914, 916, 919, 921, 924, 929, 931, 934, 936, 939, 941, 944, 946, 949, 952, 954, 957, 959, 962,
+	965, 967, 970, 972, 975, 978, 980, 980, 983, 986, 988, 988, 991, 994, 996, 996, 999, 1002, 1002, 1005, 1007, 1007, 1010, 1010, 1013, 1015, 1015, 1018, 1018, 1021, 1021, 1024,
+	1024, 1024, 1027, 1027, 1030, 1030, 1030, 1032, 1032, 1032, 1035, 1035, 1035, 1038, 1038, 1038, 1038, 1041, 1041, 1041, 1041, 1041, 1041, 1041, 1044, 1044, 1044, 1044, 1044, 1044, 1044, 1044,
+	3, 9, 15, 21, 28, 34, 40, 47, 53, 59, 65, 72, 78, 84, 90, 97, 103, 109, 115, 121, 128, 134, 140, 146, 153, 159, 165, 171, 177, 184, 190, 196,
+	202, 208, 214, 220, 226, 232, 239, 245, 251, 257, 263, 269, 275, 281, 287, 293, 299, 305, 311, 317, 323, 329, 335, 341, 346, 353, 359, 365, 370, 376, 382, 387,
+	393, 399, 405, 411, 416, 422, 428, 434, 440, 444, 450, 457, 462, 467, 473, 478, 483, 490, 495, 501, 506, 512, 517, 522, 527, 533, 539, 543, 549, 554, 560, 564,
+	570, 575, 580, 586, 591, 596, 600, 605, 610, 615, 620, 625, 630, 636, 641, 646, 650, 655, 660, 664, 669, 675, 678, 684, 688, 693, 697, 703, 706, 710, 716, 720,
+	724, 728, 734, 738, 742, 746, 750, 754, 758, 762, 766, 770, 775, 779, 783, 787, 792, 796, 798, 802, 807, 811, 815, 818, 822, 827, 829, 833, 836, 840, 845, 847,
+	852, 854, 858, 861, 863, 868, 870, 875, 877, 880, 884, 887, 889, 894, 897, 899, 901, 904, 909, 911, 914, 916, 919, 921, 924, 926, 929, 931, 934, 936, 939, 941,
+	944, 946, 949, 952, 954, 957, 959, 959, 962, 965, 967, 967, 970, 972, 975, 975, 978, 980, 980, 983, 986, 986, 988, 988, 991, 994, 994, 996, 996, 999, 999, 1002,
+	1002, 1002, 1005, 1005, 1007, 1007, 1007, 1010, 1010, 1010, 1013, 1013, 1013, 1015, 1015, 1015, 1015, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	3, 9, 15, 21, 27, 33, 39, 46, 52, 58, 64, 70, 76, 82, 88, 95, 101, 107, 113, 119, 125, 131, 137, 143, 149, 155, 162, 167, 173, 180, 186, 192,
+	198, 203, 210, 215, 221, 227, 234, 239, 245, 251, 257, 263, 269, 275, 281, 286, 293, 298, 304, 310, 316, 322, 328, 333, 339, 345, 351, 357, 362, 368, 374, 379,
+	385, 390, 397, 402, 407, 413, 419, 424, 430, 435, 441, 447, 452, 457, 463, 468, 473, 479, 485, 490, 495, 501, 506, 510, 516, 522, 527, 532, 537, 542, 548, 552,
+	558, 563, 567, 573, 578, 583, 588, 592, 597, 602, 607, 612, 617, 622, 627, 632, 636, 641, 646, 650, 655, 660, 664, 669, 673, 678, 682, 688, 691, 695, 701, 704,
+	708, 712, 718, 722, 726, 730, 734, 738, 742, 746, 750, 754, 758, 762, 766, 770, 775, 779, 781, 785, 789, 794, 798, 800, 804, 809, 811, 815, 818, 822, 827, 829,
+	833, 836, 840, 842, 845, 849, 852, 856, 858, 861, 866, 868, 870, 875, 877, 880, 882, 884, 889, 892, 894, 897, 899, 901, 904, 906, 909, 911, 914, 916, 919, 921,
+	924, 926, 929, 931, 934, 936, 939, 939, 941, 944, 946, 946, 949, 952, 954, 954, 957, 959, 959, 962, 965, 965, 967, 967, 970, 972, 972, 975, 975, 978, 978, 980,
+	980, 980, 983, 983, 986, 986, 986, 988, 988, 988, 991, 991, 991, 994, 994, 994, 994, 996, 996, 996, 996, 996, 996, 996, 999, 999, 999, 999, 999, 999, 999, 999,
+	3, 9, 14, 20, 26, 32, 39, 45, 50, 56, 62, 69, 74, 81, 86, 93, 99, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
+	193, 199, 205, 211, 217, 223, 229, 234, 240, 246, 251, 258, 263, 269, 275, 280, 286, 292, 298, 303, 309, 315, 321, 326, 332, 338, 344, 349, 354, 360, 366, 371,
+	377, 382, 388, 393, 399, 404, 410, 415, 421, 426, 431, 437, 442, 447, 453, 458, 463, 469, 474, 479, 485, 490, 495, 499, 505, 510, 516, 520, 526, 530, 536, 540,
+	546, 551, 555, 561, 566, 570, 575, 580, 584, 589, 594, 599, 604, 609, 614, 619, 622, 627, 632, 636, 641, 646, 650, 655, 658, 664, 667, 673, 676, 680, 686, 689,
+	693, 697, 703, 706, 710, 714, 718, 722, 726, 730, 734, 738, 742, 746, 750, 754, 758, 762, 764, 768, 772, 777, 781, 783, 787, 792, 794, 798, 800, 804, 809, 811,
+	815, 818, 822, 824, 827, 831, 833, 838, 840, 842, 847, 849, 852, 856, 858, 861, 863, 866, 870, 873, 875, 877, 880, 882, 884, 887, 889, 892, 894, 897, 899, 901,
+	904, 906, 909, 911, 914, 916, 919, 919, 921, 924, 926, 926, 929, 931, 934, 934, 936, 939, 939, 941, 944, 944, 946, 946, 949, 952, 952, 954, 954, 957, 957, 959,
+	959, 959, 962, 962, 965, 965, 965, 967, 967, 967, 970, 970, 970, 972, 972, 972, 972, 975, 975, 975, 975, 975, 975, 975, 978, 978, 978, 978, 978, 978, 978, 978,
+	2, 8, 14, 20, 26, 32, 38, 44, 49, 55, 61, 67, 73, 79, 85, 91, 96, 102, 108, 114, 119, 125, 131, 137, 143, 149, 155, 160, 166, 172, 178, 184,
+	189, 195, 201, 206, 212, 218, 224, 229, 235, 241, 246, 252, 258, 263, 269, 274, 280, 286, 291, 297, 302, 308, 314, 319, 325, 331, 336, 342, 346, 352, 358, 363,
+	369, 374, 380, 385, 390, 396, 401, 406, 412, 416, 422, 428, 433, 437, 443, 448, 453, 459, 464, 469, 474, 479, 485, 489, 494, 499, 505, 509, 515, 519, 524, 529,
+	534, 539, 543, 549, 554, 558, 563, 567, 572, 577, 581, 586, 591, 596, 600, 605, 609, 614, 619, 622, 627, 632, 636, 641, 644, 650, 653, 658, 662, 666, 671, 675,
+	678, 682, 688, 691, 695, 699, 703, 706, 710, 714, 718, 722, 726, 730, 734, 738, 742, 746, 748, 752, 756, 760, 764, 766, 770, 775, 777, 781, 783, 787, 792, 794,
+	798, 800, 804, 807, 809, 813, 815, 820, 822, 824, 829, 831, 833, 838, 840, 842, 845, 847, 852, 854, 856, 858, 861, 863, 866, 868, 870, 873, 875, 877, 880, 882,
+	884, 887, 889, 892, 894, 897, 899, 899, 901, 904, 906, 906, 909, 911, 914, 914, 916, 919, 919, 921, 924, 924, 926, 926, 929, 931, 931, 934, 934, 936, 936, 939,
+	939, 939, 941, 941, 944, 944, 944, 946, 946, 946, 949, 949, 949, 952, 952, 952, 952, 954, 954, 954, 954, 954, 954, 954, 957, 957, 957, 957, 957, 957, 957, 957,
+	2, 8, 14, 20, 25, 31, 37, 43, 48, 54, 60, 66, 71, 77, 83, 89, 94, 100, 106, 111, 117, 123, 129, 134, 140, 145, 151, 157, 162, 168, 174, 180,
+	185, 191, 196, 202, 207, 213, 219, 224, 230, 236, 241, 247, 252, 258, 263, 268, 274, 280, 285, 290, 296, 302, 307, 312, 318, 324, 329, 334, 339, 344, 350, 355,
+	361, 366, 372, 377, 382, 387, 392, 398, 403, 407, 413, 419, 423, 428, 434, 438, 443, 449, 454, 459, 464, 469, 474, 478, 483, 489, 494, 498, 503, 507, 513, 517,
+	523, 527, 532, 537, 542, 546, 551, 555, 560, 564, 569, 573, 578, 583, 588, 592, 596, 600, 605, 609, 614, 619, 622, 627, 630, 636, 639, 644, 648, 651, 657, 660,
+	664, 667, 673, 676, 680, 684, 688, 691, 695, 699, 703, 706, 710, 714, 718, 722, 726, 730, 732, 736, 740, 744, 748, 750, 754, 758, 760, 764, 766, 770, 775, 777,
+	781, 783, 787, 789, 792, 796, 798, 802, 804, 807, 811, 813, 815, 820, 822, 824, 827, 829, 833, 836, 838, 840, 842, 845, 847, 849, 852, 854, 856, 858, 861, 863,
+	866, 868, 870, 873, 875, 877, 880, 880, 882, 884, 887, 887, 889, 892, 894, 894, 897, 899, 899, 901, 904, 904, 906, 906, 909, 911, 911, 914, 914, 916, 916, 919,
+	919, 919, 921, 921, 924, 924, 924, 926, 926, 926, 929, 929, 929, 931, 931, 931, 931, 934, 934, 934, 934, 934, 934, 934, 936, 936, 936, 936, 936, 936, 936, 936,
+	2, 8, 14, 19, 25, 30, 36, 42, 47, 53, 59, 64, 70, 75, 81, 87, 92, 98, 103, 109, 114, 120, 126, 131, 137, 142, 148, 153, 159, 165, 170, 176,
+	181, 187, 192, 198, 203, 209, 214, 220, 225, 231, 236, 241, 247, 252, 258, 263, 268, 274, 279, 284, 290, 295, 301, 306, 311, 317, 322, 327, 332, 337, 343, 347,
+	353, 358, 364, 369, 374, 379, 384, 389, 394, 399, 404, 410, 414, 419, 424, 429, 434, 440, 444, 449, 454, 459, 464, 468, 473, 478, 483, 487, 493, 497, 502, 506,
+	512, 516, 520, 526, 530, 534, 539, 543, 548, 552, 557, 561, 566, 570, 575, 580, 583, 588, 592, 596, 600, 605, 609, 614, 617, 622, 625, 630, 634, 637, 643, 646,
+	650, 653, 658, 662, 666, 669, 673, 676, 680, 684, 688, 691, 695, 699, 703, 706, 710, 714, 716, 720, 724, 728, 732, 734, 738, 742, 744, 748, 750, 754, 758, 760,
+	764, 766, 770, 772, 775, 779, 781, 785, 787, 789, 794, 796, 798, 802, 804, 807, 809, 811, 815, 818, 820, 822, 824, 827, 829, 831, 833, 836, 838, 840, 842, 845,
+	847, 849, 852, 854, 856, 858, 861, 861, 863, 866, 868, 868, 870, 873, 875, 875, 877, 880, 880, 882, 884, 884, 887, 887, 889, 892, 892, 894, 894, 897, 897, 899,
+	899, 899, 901, 901, 904, 904, 904, 906, 906, 906, 909, 909, 909, 911, 911, 911, 911, 914, 914, 914, 914, 914, 914, 914, 916, 916, 916, 916, 916, 916, 916, 916,
+	2, 8, 13, 19, 24, 30, 35, 41, 46, 52, 57, 63, 68, 74, 79, 85, 90, 96, 101, 107, 112, 118, 123, 128, 134, 139, 145, 150, 156, 161, 166, 172,
+	177, 183, 188, 193, 199, 204, 210, 215, 220, 226, 231, 236, 241, 247, 252, 257, 263, 268, 273, 278, 283, 289, 294, 299, 304, 310, 315, 320, 325, 330, 335, 340,
+	345, 350, 356, 361, 366, 371, 376, 381, 386, 390, 396, 401, 405, 410, 415, 420, 424, 430, 435, 440, 444, 449, 454, 458, 463, 468, 473, 477, 482, 486, 491, 495,
+	501, 505, 509, 515, 519, 523, 527, 532, 536, 540, 545, 549, 554, 558, 563, 567, 570, 575, 580, 583, 588, 592, 596, 600, 604, 609, 612, 617, 620, 624, 629, 632,
+	636, 639, 644, 648, 651, 655, 658, 662, 666, 669, 673, 676, 680, 684, 688, 691, 695, 699, 701, 704, 708, 712, 716, 718, 722, 726, 728, 732, 734, 738, 742, 744,
+	748, 750, 754, 756, 758, 762, 764, 768, 770, 772, 777, 779, 781, 785, 787, 789, 792, 794, 798, 800, 802, 804, 807, 809, 811, 813, 815, 818, 820, 822, 824, 827,
+	829, 831, 833, 836, 838, 840, 842, 842, 845, 847, 849, 849, 852, 854, 856, 856, 858, 861, 861, 863, 866, 866, 868, 868, 870, 873, 873, 875, 875, 877, 877, 880,
+	880, 880, 882, 882, 884, 884, 884, 887, 887, 887, 889, 889, 889, 892, 892, 892, 892, 894, 894, 894, 894, 894, 894, 894, 897, 897, 897, 897, 897, 897, 897, 897,
+	2, 8, 13, 18, 24, 29, 35, 40, 45, 51, 56, 61, 67, 72, 78, 83, 88, 94, 99, 104, 110, 115, 120, 125, 131, 136, 142, 147, 152, 158, 163, 168,
+	173, 179, 184, 189, 194, 200, 205, 210, 215, 221, 226, 231, 236, 241, 247, 251, 257, 262, 267, 272, 277, 283, 288, 293, 298, 303, 308, 313, 318, 323, 328, 333,
+	338, 343, 348, 353, 358, 363, 368, 373, 378, 382, 387, 392, 397, 401, 406, 411, 415, 421, 426, 430, 435, 440, 444, 448, 453, 458, 463, 467, 472, 476, 481, 485,
+	490, 494, 498, 503, 507, 512, 516, 520, 524, 529, 533, 537, 542, 546, 551, 555, 558, 563, 567, 570, 575, 580, 583, 588, 591, 596, 599, 604, 607, 610, 615, 619,
+	622, 625, 630, 634, 637, 641, 644, 648, 651, 655, 658, 662, 666, 669, 673, 676, 680, 684, 686, 689, 693, 697, 701, 703, 706, 710, 712, 716, 718, 722, 726, 728,
+	732, 734, 738, 740, 742, 746, 748, 752, 754, 756, 760, 762, 764, 768, 770, 772, 775, 777, 781, 783, 785, 787, 789, 792, 794, 796, 798, 800, 802, 804, 807, 809,
+	811, 813, 815, 818, 820, 822, 824, 824, 827, 829, 831, 831, 833, 836, 838, 838, 840, 842, 842, 845, 847, 847, 849, 849, 852, 854, 854, 856, 856, 858, 858, 861,
+	861, 861, 863, 863, 866, 866, 866, 868, 868, 868, 870, 870, 870, 873, 873, 873, 873, 875, 875, 875, 875, 875, 875, 875, 877, 877, 877, 877, 877, 877, 877, 877,
+	2, 7, 13, 18, 23, 28, 34, 39, 44, 50, 55, 60, 65, 71, 76, 81, 86, 92, 97, 102, 107, 113, 118, 123, 128, 133, 139, 144, 149, 154, 159, 165,
+	170, 175, 180, 185, 190, 195, 201, 206, 211, 216, 221, 226, 231, 236, 241, 246, 251, 256, 261, 266, 271, 277, 282, 286, 291, 297, 302, 307, 311, 316, 321, 325,
+	331, 335, 341, 345, 350, 355, 360, 365, 370, 374, 379, 384, 388, 392, 398, 402, 406, 412, 416, 421, 426, 430, 435, 438, 443, 448, 453, 457, 462, 465, 470, 474,
+	479, 483, 487, 493, 497, 501, 505, 509, 513, 517, 522, 526, 530, 534, 539, 543, 546, 551, 555, 558, 563, 567, 570, 575, 578, 583, 586, 591, 594, 597, 602, 605,
+	609, 612, 617, 620, 624, 627, 630, 634, 637, 641, 644, 648, 651, 655, 658, 662, 666, 669, 671, 675, 678, 682, 686, 688, 691, 695, 697, 701, 703, 706, 710, 712,
+	716, 718, 722, 724, 726, 730, 732, 736, 738, 740, 744, 746, 748, 752, 754, 756, 758, 760, 764, 766, 768, 770, 772, 775, 777, 779, 781, 783, 785, 787, 789, 792,
+	794, 796, 798, 800, 802, 804, 807, 807, 809, 811, 813, 813, 815, 818, 820, 820, 822, 824, 824, 827, 829, 829, 831, 831, 833, 836, 836, 838, 838, 840, 840, 842,
+	842, 842, 845, 845, 847, 847, 847, 849, 849, 849, 852, 852, 852, 854, 854, 854, 854, 856, 856, 856, 856, 856, 856, 856, 858, 858, 858, 858, 858, 858, 858, 858,
+	2, 7, 12, 18, 23, 28, 33, 38, 43, 48, 54, 59, 64, 69, 74, 79, 85, 90, 95, 100, 105, 110, 115, 120, 125, 130, 136, 141, 146, 151, 156, 161,
+	166, 171, 176, 181, 186, 191, 196, 201, 206, 211, 216, 221, 226, 231, 236, 241, 246, 251, 256, 261, 266, 271, 276, 280, 285, 290, 295, 300, 304, 309, 314, 318,
+	324, 328, 333, 338, 343, 347, 352, 357, 362, 366, 371, 376, 380, 384, 389, 393, 398, 403, 407, 412, 416, 421, 426, 429, 434, 438, 443, 447, 452, 455, 460, 464,
+	469, 473, 477, 482, 486, 490, 494, 498, 502, 506, 510, 515, 519, 523, 527, 532, 534, 539, 543, 546, 551, 555, 558, 563, 566, 570, 573, 578, 581, 584, 589, 592,
+	596, 599, 604, 607, 610, 614, 617, 620, 624, 627, 630, 634, 637, 641, 644, 648, 651, 655, 657, 660, 664, 667, 671, 673, 676, 680, 682, 686, 688, 691, 695, 697,
+	701, 703, 706, 708, 710, 714, 716, 720, 722, 724, 728, 730, 732, 736, 738, 740, 742, 744, 748, 750, 752, 754, 756, 758, 760, 762, 764, 766, 768, 770, 772, 775,
+	777, 779, 781, 783, 785, 787, 789, 789, 792, 794, 796, 796, 798, 800, 802, 802, 804, 807, 807, 809, 811, 811, 813, 813, 815, 818, 818, 820, 820, 822, 822, 824,
+	824, 824, 827, 827, 829, 829, 829, 831, 831, 831, 833, 833, 833, 836, 836, 836, 836, 838, 838, 838, 838, 838, 838, 838, 840, 840, 840, 840, 840, 840, 840, 840,
+	2, 7, 12, 17, 22, 27, 32, 37, 42, 47, 52, 58, 62, 68, 73, 78, 83, 88, 93, 98, 103, 108, 113, 118, 123, 128, 133, 138, 143, 148, 153, 158,
+	162, 167, 172, 177, 182, 187, 192, 197, 202, 207, 211, 217, 221, 226, 231, 236, 241, 245, 250, 255, 260, 265, 270, 274, 279, 284, 289, 294, 298, 302, 307, 312,
+	317, 321, 326, 331, 335, 340, 344, 349, 354, 358, 363, 368, 372, 376, 381, 385, 389, 394, 399, 403, 407, 412, 416, 420, 424, 429, 434, 437, 442, 446, 450, 454,
+	459, 463, 467, 472, 476, 479, 483, 487, 491, 495, 499, 503, 507, 512, 516, 520, 523, 527, 532, 534, 539, 543, 546, 551, 554, 558, 561, 566, 569, 572, 577, 580,
+	583, 586, 591, 594, 597, 600, 604, 607, 610, 614, 617, 620, 624, 627, 630, 634, 637, 641, 643, 646, 650, 653, 657, 658, 662, 666, 667, 671, 673, 676, 680, 682,
+	686, 688, 691, 693, 695, 699, 701, 704, 706, 708, 712, 714, 716, 720, 722, 724, 726, 728, 732, 734, 736, 738, 740, 742, 744, 746, 748, 750, 752, 754, 756, 758,
+	760, 762, 764, 766, 768, 770, 772, 772, 775, 777, 779, 779, 781, 783, 785, 785, 787, 789, 789, 792, 794, 794, 796, 796, 798, 800, 800, 802, 802, 804, 804, 807,
+	807, 807, 809, 809, 811, 811, 811, 813, 813, 813, 815, 815, 815, 818, 818, 818, 818, 820, 820, 820, 820, 820, 820, 820, 822, 822, 822, 822, 822, 822, 822, 822,
+	2, 7, 12, 17, 22, 27, 32, 37, 41, 46, 51, 56, 61, 66, 71, 76, 81, 86, 91, 96, 100, 105, 110, 115, 120, 125, 130, 135, 140, 145, 149, 154,
+	159, 164, 169, 173, 178, 183, 188, 193, 198, 202, 207, 212, 217, 221, 226, 231, 236, 240, 245, 249, 254, 259, 264, 268, 273, 278, 283, 287, 291, 296, 301, 305,
+	310, 314, 319, 324, 328, 333, 337, 342, 346, 350, 355, 360, 364, 368, 373, 377, 381, 386, 390, 394, 399, 403, 407, 411, 415, 420, 424, 428, 433, 436, 441, 444,
+	449, 453, 457, 462, 465, 469, 473, 477, 481, 485, 489, 493, 497, 501, 505, 509, 512, 516, 520, 523, 527, 532, 534, 539, 542, 546, 549, 554, 557, 560, 564, 567,
+	570, 573, 578, 581, 584, 588, 591, 594, 597, 600, 604, 607, 610, 614, 617, 620, 624, 627, 629, 632, 636, 639, 643, 644, 648, 651, 653, 657, 658, 662, 666, 667,
+	671, 673, 676, 678, 680, 684, 686, 689, 691, 693, 697, 699, 701, 704, 706, 708, 710, 712, 716, 718, 720, 722, 724, 726, 728, 730, 732, 734, 736, 738, 740, 742,
+	744, 746, 748, 750, 752, 754, 756, 756, 758, 760, 762, 762, 764, 766, 768, 768, 770, 772, 772, 775, 777, 777, 779, 779, 781, 783, 783, 785, 785, 787, 787, 789,
+	789, 789, 792, 792, 794, 794, 794, 796, 796, 796, 798, 798, 798, 800, 800, 800, 800, 802, 802, 802, 802, 802, 802, 802, 804, 804, 804, 804, 804, 804, 804, 804,
+	2, 7, 12, 16, 21, 26, 31, 36, 41, 45, 50, 55, 60, 65, 70, 74, 79, 84, 89, 94, 98, 103, 108, 113, 118, 122, 127, 132, 137, 141, 146, 151,
+	156, 160, 165, 170, 174, 179, 184, 189, 193, 198, 202, 207, 212, 217, 221, 226, 231, 235, 239, 244, 249, 253, 258, 263, 267, 272, 277, 281, 285, 290, 294, 298,
+	303, 307, 312, 317, 321, 325, 330, 334, 339, 343, 347, 352, 356, 360, 365, 369, 373, 378, 382, 386, 390, 394, 399, 402, 406, 411, 415, 419, 423, 427, 431, 435,
+	440, 443, 447, 452, 455, 459, 463, 467, 470, 474, 478, 482, 486, 490, 494, 498, 501, 505, 509, 512, 516, 520, 523, 527, 530, 534, 537, 542, 545, 548, 552, 555,
+	558, 561, 566, 569, 572, 575, 578, 581, 584, 588, 591, 594, 597, 600, 604, 607, 610, 614, 615, 619, 622, 625, 629, 630, 634, 637, 639, 643, 644, 648, 651, 653,
+	657, 658, 662, 664, 666, 669, 671, 675, 676, 678, 682, 684, 686, 689, 691, 693, 695, 697, 701, 703, 704, 706, 708, 710, 712, 714, 716, 718, 720, 722, 724, 726,
+	728, 730, 732, 734, 736, 738, 740, 740, 742, 744, 746, 746, 748, 750, 752, 752, 754, 756, 756, 758, 760, 760, 762, 762, 764, 766, 766, 768, 768, 770, 770, 772,
+	772, 772, 775, 775, 777, 777, 777, 779, 779, 779, 781, 781, 781, 783, 783, 783, 783, 785, 785, 785, 785, 785, 785, 785, 787, 787, 787, 787, 787, 787, 787, 787,
+	2, 7, 11, 16, 21, 25, 30, 35, 40, 44, 49, 54, 59, 63, 68, 73, 78, 82, 87, 92, 96, 101, 106, 110, 115, 119, 124, 129, 134, 138, 143, 148,
+	152, 157, 162, 166, 171, 175, 180, 185, 189, 194, 198, 203, 207, 212, 217, 221, 226, 230, 234, 239, 243, 248, 253, 257, 261, 266, 271, 275, 279, 283, 288, 292,
+	297, 301, 306, 310, 314, 318, 323, 327, 332, 335, 340, 344, 348, 352, 357, 361, 365, 370, 374, 378, 382, 386, 390, 393, 398, 402, 406, 410, 414, 418, 422, 426,
+	430, 434, 437, 442, 446, 449, 453, 457, 460, 464, 468, 472, 476, 479, 483, 487, 490, 494, 498, 501, 505, 509, 512, 516, 519, 523, 526, 530, 533, 536, 540, 543,
+	546, 549, 554, 557, 560, 563, 566, 569, 572, 575, 578, 581, 584, 588, 591, 594, 597, 600, 602, 605, 609, 612, 615, 617, 620, 624, 625, 629, 630, 634, 637, 639,
+	643, 644, 648, 650, 651, 655, 657, 660, 662, 664, 667, 669, 671, 675, 676, 678, 680, 682, 686, 688, 689, 691, 693, 695, 697, 699, 701, 703, 704, 706, 708, 710,
+	712, 714, 716, 718, 720, 722, 724, 724, 726, 728, 730, 730, 732, 734, 736, 736, 738, 740, 740, 742, 744, 744, 746, 746, 748, 750, 750, 752, 752, 754, 754, 756,
+	756, 756, 758, 758, 760, 760, 760, 762, 762, 762, 764, 764, 764, 766, 766, 766, 766, 768, 768, 768, 768, 768, 768, 768, 770, 770, 770, 770, 770, 770, 770, 770,
+	2, 6, 11, 16, 20, 25, 30, 34, 39, 43, 48, 53, 57, 62, 67, 71, 76, 80, 85, 90, 94, 99, 103, 108, 113, 117, 122, 126, 131, 135, 140, 145,
+	149, 153, 158, 162, 167, 172, 176, 181, 185, 190, 194, 199, 203, 207, 212, 216, 221, 225, 229, 234, 238, 243, 247, 251, 256, 261, 265, 269, 273, 277, 282, 286,
+	290, 294, 299, 303, 307, 312, 316, 320, 325, 328, 333, 337, 341, 344, 349, 353, 357, 362, 366, 370, 374, 378, 382, 385, 389, 393, 398, 401, 405, 409, 413, 416,
+	421, 424, 428, 433, 436, 440, 443, 447, 450, 454, 458, 462, 465, 469, 473, 477, 479, 483, 487, 490, 494, 498, 501, 505, 507, 512, 515, 519, 522, 524, 529, 532,
+	534, 537, 542, 545, 548, 551, 554, 557, 560, 563, 566, 569, 572, 575, 578, 581, 584, 588, 589, 592, 596, 599, 602, 604, 607, 610, 612, 615, 617, 620, 624, 625,
+	629, 630, 634, 636, 637, 641, 643, 646, 648, 650, 653, 655, 657, 660, 662, 664, 666, 667, 671, 673, 675, 676, 678, 680, 682, 684, 686, 688, 689, 691, 693, 695,
+	697, 699, 701, 703, 704, 706, 708, 708, 710, 712, 714, 714, 716, 718, 720, 720, 722, 724, 724, 726, 728, 728, 730, 730, 732, 734, 734, 736, 736, 738, 738, 740,
+	740, 740, 742, 742, 744, 744, 744, 746, 746, 746, 748, 748, 748, 750, 750, 750, 750, 752, 752, 752, 752, 752, 752, 752, 754, 754, 754, 754, 754, 754, 754, 754,
+	2, 6, 11, 15, 20, 24, 29, 33, 38, 43, 47, 52, 56, 61, 65, 70, 74, 79, 83, 88, 92, 97, 101, 105, 110, 114, 119, 123, 128, 133, 137, 141,
+	146, 150, 155, 159, 163, 168, 172, 177, 181, 186, 190, 194, 199, 203, 207, 211, 216, 220, 224, 229, 233, 238, 242, 246, 250, 255, 259, 263, 267, 271, 276, 280,
+	284, 288, 293, 297, 301, 305, 309, 313, 318, 321, 325, 330, 333, 337, 342, 345, 349, 354, 358, 362, 366, 370, 374, 377, 381, 385, 389, 392, 397, 400, 404, 407,
+	412, 415, 419, 423, 427, 430, 434, 437, 441, 444, 448, 452, 455, 459, 463, 467, 469, 473, 477, 479, 483, 487, 490, 494, 497, 501, 503, 507, 510, 513, 517, 520,
+	523, 526, 530, 533, 536, 539, 542, 545, 548, 551, 554, 557, 560, 563, 566, 569, 572, 575, 577, 580, 583, 586, 589, 591, 594, 597, 599, 602, 604, 607, 610, 612,
+	615, 617, 620, 622, 624, 627, 629, 632, 634, 636, 639, 641, 643, 646, 648, 650, 651, 653, 657, 658, 660, 662, 664, 666, 667, 669, 671, 673, 675, 676, 678, 680,
+	682, 684, 686, 688, 689, 691, 693, 693, 695, 697, 699, 699, 701, 703, 704, 704, 706, 708, 708, 710, 712, 712, 714, 714, 716, 718, 718, 720, 720, 722, 722, 724,
+	724, 724, 726, 726, 728, 728, 728, 730, 730, 730, 732, 732, 732, 734, 734, 734, 734, 736, 736, 736, 736, 736, 736, 736, 738, 738, 738, 738, 738, 738, 738, 738,
+	2, 6, 11, 15, 19, 24, 28, 33, 37, 42, 46, 50, 55, 59, 64, 68, 73, 77, 81, 86, 90, 95, 99, 103, 108, 112, 117, 121, 125, 130, 134, 138,
+	143, 147, 151, 156, 160, 164, 169, 173, 177, 182, 186, 190, 194, 199, 203, 207, 211, 215, 220, 224, 228, 232, 237, 241, 245, 249, 253, 258, 261, 266, 270, 274,
+	278, 282, 286, 290, 294, 298, 302, 307, 311, 314, 318, 323, 326, 330, 334, 338, 342, 346, 350, 354, 358, 362, 366, 369, 373, 377, 381, 384, 388, 391, 396, 399,
+	403, 406, 410, 414, 418, 421, 424, 428, 431, 435, 438, 442, 446, 449, 453, 457, 459, 463, 467, 469, 473, 477, 479, 483, 486, 490, 493, 497, 499, 502, 506, 509,
+	512, 515, 519, 522, 524, 527, 530, 533, 536, 539, 542, 545, 548, 551, 554, 557, 560, 563, 564, 567, 570, 573, 577, 578, 581, 584, 586, 589, 591, 594, 597, 599,
+	602, 604, 607, 609, 610, 614, 615, 619, 620, 622, 625, 627, 629, 632, 634, 636, 637, 639, 643, 644, 646, 648, 650, 651, 653, 655, 657, 658, 660, 662, 664, 666,
+	667, 669, 671, 673, 675, 676, 678, 678, 680, 682, 684, 684, 686, 688, 689, 689, 691, 693, 693, 695, 697, 697, 699, 699, 701, 703, 703, 704, 704, 706, 706, 708,
+	708, 708, 710, 710, 712, 712, 712, 714, 714, 714, 716, 716, 716, 718, 718, 718, 718, 720, 720, 720, 720, 720, 720, 720, 722, 722, 722, 722, 722, 722, 722, 722,
+	2, 6, 10, 15, 19, 23, 28, 32, 36, 41, 45, 49, 54, 58, 62, 67, 71, 75, 80, 84, 88, 93, 97, 101, 105, 110, 114, 118, 122, 127, 131, 135,
+	140, 144, 148, 152, 156, 161, 165, 169, 173, 178, 182, 186, 190, 194, 199, 202, 207, 211, 215, 219, 223, 227, 232, 236, 239, 244, 248, 252, 256, 260, 264, 268,
+	272, 276, 280, 284, 288, 292, 296, 300, 304, 307, 312, 316, 319, 323, 327, 331, 334, 339, 343, 346, 350, 354, 358, 361, 365, 369, 373, 376, 380, 383, 387, 390,
+	394, 398, 401, 405, 409, 412, 415, 419, 422, 426, 429, 433, 436, 440, 443, 447, 449, 453, 457, 459, 463, 467, 469, 473, 476, 479, 482, 486, 489, 491, 495, 498,
+	501, 503, 507, 510, 513, 516, 519, 522, 524, 527, 530, 533, 536, 539, 542, 545, 548, 551, 552, 555, 558, 561, 564, 566, 569, 572, 573, 577, 578, 581, 584, 586,
+	589, 591, 594, 596, 597, 600, 602, 605, 607, 609, 612, 614, 615, 619, 620, 622, 624, 625, 629, 630, 632, 634, 636, 637, 639, 641, 643, 644, 646, 648, 650, 651,
+	653, 655, 657, 658, 660, 662, 664, 664, 666, 667, 669, 669, 671, 673, 675, 675, 676, 678, 678, 680, 682, 682, 684, 684, 686, 688, 688, 689, 689, 691, 691, 693,
+	693, 693, 695, 695, 697, 697, 697, 699, 699, 699, 701, 701, 701, 703, 703, 703, 703, 704, 704, 704, 704, 704, 704, 704, 706, 706, 706, 706, 706, 706, 706, 706,
+	2, 6, 10, 14, 19, 23, 27, 31, 36, 40, 44, 48, 52, 57, 61, 65, 70, 74, 78, 82, 86, 91, 95, 99, 103, 107, 112, 116, 120, 124, 128, 133,
+	137, 141, 145, 149, 153, 157, 162, 166, 170, 174, 178, 182, 186, 190, 194, 198, 202, 206, 210, 214, 218, 223, 227, 231, 234, 239, 243, 247, 250, 254, 258, 262,
+	266, 270, 274, 278, 282, 286, 290, 294, 298, 301, 305, 309, 312, 316, 320, 324, 327, 332, 335, 339, 343, 346, 350, 353, 357, 361, 365, 368, 372, 375, 379, 382,
+	386, 389, 392, 397, 400, 403, 406, 410, 413, 416, 420, 423, 427, 430, 434, 437, 440, 443, 447, 449, 453, 457, 459, 463, 465, 469, 472, 476, 478, 481, 485, 487,
+	490, 493, 497, 499, 502, 505, 507, 510, 513, 516, 519, 522, 524, 527, 530, 533, 536, 539, 540, 543, 546, 549, 552, 554, 557, 560, 561, 564, 566, 569, 572, 573,
+	577, 578, 581, 583, 584, 588, 589, 592, 594, 596, 599, 600, 602, 605, 607, 609, 610, 612, 615, 617, 619, 620, 622, 624, 625, 627, 629, 630, 632, 634, 636, 637,
+	639, 641, 643, 644, 646, 648, 650, 650, 651, 653, 655, 655, 657, 658, 660, 660, 662, 664, 664, 666, 667, 667, 669, 669, 671, 673, 673, 675, 675, 676, 676, 678,
+	678, 678, 680, 680, 682, 682, 682, 684, 684, 684, 686, 686, 686, 688, 688, 688, 688, 689, 689, 689, 689, 689, 689, 689, 691, 691, 691, 691, 691, 691, 691, 691,
+	2, 6, 10, 14, 18, 22, 26, 31, 35, 39, 43, 47, 51, 56, 60, 64, 68, 72, 76, 80, 84, 89, 93, 97, 101, 105, 109, 113, 117, 121, 125, 130,
+	134, 138, 142, 146, 150, 154, 158, 162, 166, 170, 174, 178, 182, 186, 190, 194, 198, 202, 206, 210, 214, 218, 222, 226, 229, 234, 238, 241, 245, 249, 253, 256,
+	261, 264, 268, 272, 276, 280, 283, 287, 291, 294, 298, 302, 306, 309, 313, 317, 320, 325, 328, 332, 335, 339, 343, 345, 349, 353, 357, 360, 364, 367, 371, 374,
+	378, 381, 384, 388, 391, 394, 398, 401, 404, 407, 411, 414, 418, 421, 424, 428, 430, 434, 437, 440, 443, 447, 449, 453, 455, 459, 462, 465, 468, 470, 474, 477,
+	479, 482, 486, 489, 491, 494, 497, 499, 502, 505, 507, 510, 513, 516, 519, 522, 524, 527, 529, 532, 534, 537, 540, 542, 545, 548, 549, 552, 554, 557, 560, 561,
+	564, 566, 569, 570, 572, 575, 577, 580, 581, 583, 586, 588, 589, 592, 594, 596, 597, 599, 602, 604, 605, 607, 609, 610, 612, 614, 615, 617, 619, 620, 622, 624,
+	625, 627, 629, 630, 632, 634, 636, 636, 637, 639, 641, 641, 643, 644, 646, 646, 648, 650, 650, 651, 653, 653, 655, 655, 657, 658, 658, 660, 660, 662, 662, 664,
+	664, 664, 666, 666, 667, 667, 667, 669, 669, 669, 671, 671, 671, 673, 673, 673, 673, 675, 675, 675, 675, 675, 675, 675, 676, 676, 676, 676, 676, 676, 676, 676,
+	2, 6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 62, 67, 70, 75, 79, 83, 87, 91, 95, 99, 103, 107, 111, 115, 119, 123, 127,
+	131, 135, 139, 143, 147, 151, 155, 159, 162, 166, 170, 174, 178, 182, 186, 190, 194, 198, 201, 205, 209, 213, 217, 221, 224, 229, 232, 236, 239, 243, 247, 251,
+	255, 258, 263, 266, 270, 274, 277, 281, 285, 288, 292, 296, 299, 302, 307, 310, 313, 318, 321, 325, 328, 332, 335, 338, 342, 345, 349, 352, 356, 359, 363, 366,
+	370, 373, 376, 380, 383, 386, 389, 392, 396, 399, 402, 405, 409, 412, 415, 419, 421, 424, 428, 430, 434, 437, 440, 443, 446, 449, 452, 455, 458, 460, 464, 467,
+	469, 472, 476, 478, 481, 483, 486, 489, 491, 494, 497, 499, 502, 505, 507, 510, 513, 516, 517, 520, 523, 526, 529, 530, 533, 536, 537, 540, 542, 545, 548, 549,
+	552, 554, 557, 558, 560, 563, 564, 567, 569, 570, 573, 575, 577, 580, 581, 583, 584, 586, 589, 591, 592, 594, 596, 597, 599, 600, 602, 604, 605, 607, 609, 610,
+	612, 614, 615, 617, 619, 620, 622, 622, 624, 625, 627, 627, 629, 630, 632, 632, 634, 636, 636, 637, 639, 639, 641, 641, 643, 644, 644, 646, 646, 648, 648, 650,
+	650, 650, 651, 651, 653, 653, 653, 655, 655, 655, 657, 657, 657, 658, 658, 658, 658, 660, 660, 660, 660, 660, 660, 660, 662, 662, 662, 662, 662, 662, 662, 662,
+	1, 5, 9, 13, 17, 21, 25, 29, 33, 37, 41, 45, 49, 53, 57, 61, 65, 69, 73, 77, 81, 85, 89, 93, 97, 100, 105, 108, 112, 116, 120, 124,
+	128, 132, 136, 140, 143, 147, 151, 155, 159, 163, 166, 171, 174, 178, 182, 186, 190, 193, 197, 201, 205, 209, 213, 216, 220, 224, 227, 231, 234, 238, 242, 245,
+	249, 253, 257, 261, 264, 268, 271, 275, 279, 282, 286, 290, 293, 296, 300, 303, 307, 311, 314, 318, 321, 325, 328, 331, 334, 338, 342, 344, 348, 351, 355, 358,
+	362, 365, 368, 372, 375, 378, 381, 384, 387, 390, 393, 397, 400, 403, 406, 410, 412, 415, 419, 421, 424, 428, 430, 434, 436, 440, 442, 446, 448, 450, 454, 457,
+	459, 462, 465, 468, 470, 473, 476, 478, 481, 483, 486, 489, 491, 494, 497, 499, 502, 505, 506, 509, 512, 515, 517, 519, 522, 524, 526, 529, 530, 533, 536, 537,
+	540, 542, 545, 546, 548, 551, 552, 555, 557, 558, 561, 563, 564, 567, 569, 570, 572, 573, 577, 578, 580, 581, 583, 584, 586, 588, 589, 591, 592, 594, 596, 597,
+	599, 600, 602, 604, 605, 607, 609, 609, 610, 612, 614, 614, 615, 617, 619, 619, 620, 622, 622, 624, 625, 625, 627, 627, 629, 630, 630, 632, 632, 634, 634, 636,
+	636, 636, 637, 637, 639, 639, 639, 641, 641, 641, 643, 643, 643, 644, 644, 644, 644, 646, 646, 646, 646, 646, 646, 646, 648, 648, 648, 648, 648, 648, 648, 648,
+	1, 5, 9, 13, 17, 21, 25, 29, 33, 36, 40, 44, 48, 52, 56, 60, 64, 67, 71, 75, 79, 83, 87, 91, 95, 98, 102, 106, 110, 114, 118, 121,
+	125, 129, 133, 137, 140, 144, 148, 152, 156, 159, 163, 167, 171, 174, 178, 182, 186, 189, 193, 196, 200, 204, 208, 211, 215, 219, 223, 226, 229, 233, 237, 240,
+	244, 247, 251, 255, 258, 262, 266, 269, 273, 276, 280, 283, 286, 290, 294, 297, 300, 304, 307, 311, 314, 318, 321, 324, 327, 331, 334, 337, 341, 344, 347, 350,
+	354, 357, 360, 364, 367, 370, 373, 376, 379, 382, 385, 388, 391, 394, 398, 401, 403, 406, 410, 412, 415, 419, 421, 424, 427, 430, 433, 436, 438, 441, 444, 447,
+	449, 452, 455, 458, 460, 463, 465, 468, 470, 473, 476, 478, 481, 483, 486, 489, 491, 494, 495, 498, 501, 503, 506, 507, 510, 513, 515, 517, 519, 522, 524, 526,
+	529, 530, 533, 534, 536, 539, 540, 543, 545, 546, 549, 551, 552, 555, 557, 558, 560, 561, 564, 566, 567, 569, 570, 572, 573, 575, 577, 578, 580, 581, 583, 584,
+	586, 588, 589, 591, 592, 594, 596, 596, 597, 599, 600, 600, 602, 604, 605, 605, 607, 609, 609, 610, 612, 612, 614, 614, 615, 617, 617, 619, 619, 620, 620, 622,
+	622, 622, 624, 624, 625, 625, 625, 627, 627, 627, 629, 629, 629, 630, 630, 630, 630, 632, 632, 632, 632, 632, 632, 632, 634, 634, 634, 634, 634, 634, 634, 634,
+	1, 5, 9, 13, 17, 20, 24, 28, 32, 36, 39, 43, 47, 51, 55, 59, 62, 66, 70, 74, 77, 81, 85, 89, 93, 96, 100, 104, 107, 111, 115, 119,
+	122, 126, 130, 134, 137, 141, 145, 149, 152, 156, 159, 163, 167, 171, 174, 178, 182, 185, 189, 192, 196, 200, 203, 207, 210, 214, 218, 221, 224, 228, 232, 235,
+	239, 242, 246, 249, 253, 256, 260, 263, 267, 270, 274, 277, 280, 283, 287, 290, 294, 298, 301, 304, 307, 311, 314, 317, 320, 324, 327, 330, 333, 336, 340, 343,
+	346, 349, 352, 356, 359, 362, 365, 368, 371, 374, 377, 380, 383, 386, 389, 392, 394, 398, 401, 403, 406, 410, 412, 415, 418, 421, 423, 427, 429, 431, 435, 437,
+	440, 442, 446, 448, 450, 453, 455, 458, 460, 463, 465, 468, 470, 473, 476, 478, 481, 483, 485, 487, 490, 493, 495, 497, 499, 502, 503, 506, 507, 510, 513, 515,
+	517, 519, 522, 523, 524, 527, 529, 532, 533, 534, 537, 539, 540, 543, 545, 546, 548, 549, 552, 554, 555, 557, 558, 560, 561, 563, 564, 566, 567, 569, 570, 572,
+	573, 575, 577, 578, 580, 581, 583, 583, 584, 586, 588, 588, 589, 591, 592, 592, 594, 596, 596, 597, 599, 599, 600, 600, 602, 604, 604, 605, 605, 607, 607, 609,
+	609, 609, 610, 610, 612, 612, 612, 614, 614, 614, 615, 615, 615, 617, 617, 617, 617, 619, 619, 619, 619, 619, 619, 619, 620, 620, 620, 620, 620, 620, 620, 620,
+	1, 5, 9, 13, 16, 20, 24, 27, 31, 35, 39, 42, 46, 50, 53, 57, 61, 65, 68, 72, 76, 79, 83, 87, 91, 94, 98, 101, 105, 109, 113, 116,
+	120, 123, 127, 131, 134, 138, 142, 145, 149, 153, 156, 160, 163, 167, 171, 174, 178, 181, 185, 188, 192, 195, 199, 202, 206, 210, 213, 217, 220, 223, 227, 230,
+	234, 237, 241, 244, 247, 251, 254, 258, 261, 264, 268, 271, 274, 277, 281, 284, 287, 291, 294, 298, 301, 304, 307, 310, 313, 317, 320, 323, 326, 329, 333, 335,
+	339, 342, 344, 348, 351, 354, 357, 360, 363, 366, 369, 372, 375, 378, 381, 384, 386, 389, 392, 394, 398, 401, 403, 406, 409, 412, 414, 418, 420, 422, 426, 428,
+	430, 433, 436, 438, 441, 443, 446, 448, 450, 453, 455, 458, 460, 463, 465, 468, 470, 473, 474, 477, 479, 482, 485, 486, 489, 491, 493, 495, 497, 499, 502, 503,
+	506, 507, 510, 512, 513, 516, 517, 520, 522, 523, 526, 527, 529, 532, 533, 534, 536, 537, 540, 542, 543, 545, 546, 548, 549, 551, 552, 554, 555, 557, 558, 560,
+	561, 563, 564, 566, 567, 569, 570, 570, 572, 573, 575, 575, 577, 578, 580, 580, 581, 583, 583, 584, 586, 586, 588, 588, 589, 591, 591, 592, 592, 594, 594, 596,
+	596, 596, 597, 597, 599, 599, 599, 600, 600, 600, 602, 602, 602, 604, 604, 604, 604, 605, 605, 605, 605, 605, 605, 605, 607, 607, 607, 607, 607, 607, 607, 607,
+	1, 5, 9, 12, 16, 20, 23, 27, 30, 34, 38, 41, 45, 49, 52, 56, 60, 63, 67, 70, 74, 78, 81, 85, 89, 92, 96, 99, 103, 107, 110, 114,
+	117, 121, 124, 128, 131, 135, 139, 142, 146, 149, 153, 156, 160, 163, 167, 170, 174, 177, 181, 184, 188, 191, 195, 198, 201, 205, 209, 212, 215, 218, 222, 225,
+	229, 232, 236, 239, 242, 245, 249, 252, 256, 258, 262, 266, 268, 271, 275, 278, 281, 285, 288, 291, 294, 298, 301, 303, 307, 310, 313, 316, 319, 322, 325, 328,
+	332, 334, 337, 341, 344, 346, 349, 352, 355, 358, 361, 364, 367, 370, 373, 376, 378, 381, 384, 386, 389, 392, 394, 398, 400, 403, 405, 409, 411, 413, 416, 419,
+	421, 423, 427, 429, 431, 434, 436, 438, 441, 443, 446, 448, 450, 453, 455, 458, 460, 463, 464, 467, 469, 472, 474, 476, 478, 481, 482, 485, 486, 489, 491, 493,
+	495, 497, 499, 501, 502, 505, 506, 509, 510, 512, 515, 516, 517, 520, 522, 523, 524, 526, 529, 530, 532, 533, 534, 536, 537, 539, 540, 542, 543, 545, 546, 548,
+	549, 551, 552, 554, 555, 557, 558, 558, 560, 561, 563, 563, 564, 566, 567, 567, 569, 570, 570, 572, 573, 573, 575, 575, 577, 578, 578, 580, 580, 581, 581, 583,
+	583, 583, 584, 584, 586, 586, 586, 588, 588, 588, 589, 589, 589, 591, 591, 591, 591, 592, 592, 592, 592, 592, 592, 592, 594, 594, 594, 594, 594, 594, 594, 594,
+	1, 5, 8, 12, 16, 19, 23, 26, 30, 33, 37, 41, 44, 48, 51, 55, 58, 62, 65, 69, 72, 76, 80, 83, 87, 90, 94, 97, 101, 104, 108, 111,
+	115, 118, 122, 125, 129, 132, 136, 139, 143, 146, 149, 153, 156, 160, 163, 166, 170, 173, 177, 180, 184, 187, 191, 194, 197, 201, 204, 207, 210, 214, 217, 220,
+	224, 227, 231, 234, 237, 240, 243, 247, 250, 253, 256, 260, 263, 266, 269, 272, 275, 279, 282, 285, 288, 291, 294, 297, 300, 303, 307, 309, 312, 315, 318, 321,
+	325, 327, 330, 333, 336, 339, 342, 344, 347, 350, 353, 356, 359, 362, 365, 368, 370, 373, 376, 378, 381, 384, 386, 389, 391, 394, 397, 400, 402, 404, 407, 410,
+	412, 414, 418, 420, 422, 424, 427, 429, 431, 434, 436, 438, 441, 443, 446, 448, 450, 453, 454, 457, 459, 462, 464, 465, 468, 470, 472, 474, 476, 478, 481, 482,
+	485, 486, 489, 490, 491, 494, 495, 498, 499, 501, 503, 505, 506, 509, 510, 512, 513, 515, 517, 519, 520, 522, 523, 524, 526, 527, 529, 530, 532, 533, 534, 536,
+	537, 539, 540, 542, 543, 545, 546, 546, 548, 549, 551, 551, 552, 554, 555, 555, 557, 558, 558, 560, 561, 561, 563, 563, 564, 566, 566, 567, 567, 569, 569, 570,
+	570, 570, 572, 572, 573, 573, 573, 575, 575, 575, 577, 577, 577, 578, 578, 578, 578, 580, 580, 580, 580, 580, 580, 580, 581, 581, 581, 581, 581, 581, 581, 581,
+	1, 5, 8, 12, 15, 19, 22, 26, 29, 33, 36, 40, 43, 47, 50, 54, 57, 60, 64, 67, 71, 74, 78, 81, 85, 88, 92, 95, 99, 102, 105, 109,
+	112, 116, 119, 122, 126, 129, 133, 136, 140, 143, 146, 150, 153, 156, 160, 163, 166, 170, 173, 176, 180, 183, 187, 190, 193, 196, 200, 203, 206, 209, 213, 215,
+	219, 222, 226, 229, 232, 235, 238, 241, 245, 247, 251, 254, 257, 260, 263, 266, 269, 273, 276, 279, 282, 285, 288, 290, 294, 297, 300, 302, 306, 308, 312, 314,
+	318, 320, 323, 326, 329, 332, 334, 337, 340, 343, 345, 348, 351, 354, 357, 360, 362, 365, 368, 370, 373, 376, 378, 381, 383, 386, 388, 391, 393, 396, 399, 401,
+	403, 405, 409, 411, 413, 415, 418, 420, 422, 424, 427, 429, 431, 434, 436, 438, 441, 443, 444, 447, 449, 452, 454, 455, 458, 460, 462, 464, 465, 468, 470, 472,
+	474, 476, 478, 479, 481, 483, 485, 487, 489, 490, 493, 494, 495, 498, 499, 501, 502, 503, 506, 507, 509, 510, 512, 513, 515, 516, 517, 519, 520, 522, 523, 524,
+	526, 527, 529, 530, 532, 533, 534, 534, 536, 537, 539, 539, 540, 542, 543, 543, 545, 546, 546, 548, 549, 549, 551, 551, 552, 554, 554, 555, 555, 557, 557, 558,
+	558, 558, 560, 560, 561, 561, 561, 563, 563, 563, 564, 564, 564, 566, 566, 566, 566, 567, 567, 567, 567, 567, 567, 567, 569, 569, 569, 569, 569, 569, 569, 569,
+	1, 5, 8, 11, 15, 18, 22, 25, 29, 32, 35, 39, 42, 46, 49, 52, 56, 59, 63, 66, 69, 73, 76, 79, 83, 86, 90, 93, 96, 100, 103, 107,
+	110, 113, 117, 120, 123, 126, 130, 133, 137, 140, 143, 147, 150, 153, 156, 159, 163, 166, 169, 172, 176, 179, 183, 186, 189, 192, 195, 199, 201, 205, 208, 211,
+	214, 217, 221, 224, 227, 230, 233, 236, 239, 242, 245, 249, 251, 254, 258, 261, 263, 267, 270, 273, 276, 279, 282, 284, 287, 290, 294, 296, 299, 302, 305, 307,
+	311, 313, 316, 319, 322, 325, 327, 330, 333, 335, 338, 341, 344, 346, 349, 352, 354, 357, 360, 362, 365, 368, 370, 373, 375, 378, 380, 383, 385, 387, 390, 392,
+	394, 397, 400, 402, 404, 406, 409, 411, 413, 415, 418, 420, 422, 424, 427, 429, 431, 434, 435, 437, 440, 442, 444, 446, 448, 450, 452, 454, 455, 458, 460, 462,
+	464, 465, 468, 469, 470, 473, 474, 477, 478, 479, 482, 483, 485, 487, 489, 490, 491, 493, 495, 497, 498, 499, 501, 502, 503, 505, 506, 507, 509, 510, 512, 513,
+	515, 516, 517, 519, 520, 522, 523, 523, 524, 526, 527, 527, 529, 530, 532, 532, 533, 534, 534, 536, 537, 537, 539, 539, 540, 542, 542, 543, 543, 545, 545, 546,
+	546, 546, 548, 548, 549, 549, 549, 551, 551, 551, 552, 552, 552, 554, 554, 554, 554, 555, 555, 555, 555, 555, 555, 555, 557, 557, 557, 557, 557, 557, 557, 557,
+	1, 5, 8, 11, 15, 18, 21, 25, 28, 31, 35, 38, 41, 45, 48, 51, 55, 58, 61, 65, 68, 71, 75, 78, 81, 84, 88, 91, 94, 98, 101, 104,
+	107, 111, 114, 117, 120, 124, 127, 130, 134, 137, 140, 143, 147, 150, 153, 156, 159, 162, 166, 169, 172, 175, 179, 182, 185, 188, 191, 194, 197, 200, 203, 206,
+	210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249, 252, 255, 258, 261, 264, 267, 270, 273, 276, 278, 281, 284, 287, 290, 293, 295, 298, 301,
+	304, 307, 309, 312, 315, 318, 320, 323, 325, 328, 331, 333, 336, 339, 342, 344, 346, 349, 352, 354, 357, 360, 362, 365, 367, 370, 372, 375, 377, 379, 382, 384,
+	386, 388, 391, 393, 396, 398, 400, 402, 404, 406, 409, 411, 413, 415, 418, 420, 422, 424, 426, 428, 430, 433, 435, 436, 438, 441, 442, 444, 446, 448, 450, 452,
+	454, 455, 458, 459, 460, 463, 464, 467, 468, 469, 472, 473, 474, 477, 478, 479, 481, 482, 485, 486, 487, 489, 490, 491, 493, 494, 495, 497, 498, 499, 501, 502,
+	503, 505, 506, 507, 509, 510, 512, 512, 513, 515, 516, 516, 517, 519, 520, 520, 522, 523, 523, 524, 526, 526, 527, 527, 529, 530, 530, 532, 532, 533, 533, 534,
+	534, 534, 536, 536, 537, 537, 537, 539, 539, 539, 540, 540, 540, 542, 542, 542, 542, 543, 543, 543, 543, 543, 543, 543, 545, 545, 545, 545, 545, 545, 545, 545,
+	1, 4, 8, 11, 14, 17, 21, 24, 27, 31, 34, 37, 40, 44, 47, 50, 53, 57, 60, 63, 66, 70, 73, 76, 79, 83, 86, 89, 92, 96, 99, 102,
+	105, 108, 112, 115, 118, 121, 124, 128, 131, 134, 137, 140, 143, 147, 150, 153, 156, 159, 162, 165, 168, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202,
+	205, 208, 211, 214, 217, 220, 223, 226, 229, 232, 235, 238, 241, 243, 247, 249, 252, 256, 258, 261, 264, 267, 270, 272, 275, 278, 281, 283, 286, 289, 292, 294,
+	298, 300, 302, 306, 308, 311, 313, 316, 318, 321, 324, 326, 329, 332, 334, 337, 339, 342, 344, 346, 349, 352, 354, 357, 359, 362, 364, 367, 369, 371, 374, 376,
+	378, 380, 383, 385, 387, 389, 391, 393, 396, 398, 400, 402, 404, 406, 409, 411, 413, 415, 416, 419, 421, 423, 426, 427, 429, 431, 433, 435, 436, 438, 441, 442,
+	444, 446, 448, 449, 450, 453, 454, 457, 458, 459, 462, 463, 464, 467, 468, 469, 470, 472, 474, 476, 477, 478, 479, 481, 482, 483, 485, 486, 487, 489, 490, 491,
+	493, 494, 495, 497, 498, 499, 501, 501, 502, 503, 505, 505, 506, 507, 509, 509, 510, 512, 512, 513, 515, 515, 516, 516, 517, 519, 519, 520, 520, 522, 522, 523,
+	523, 523, 524, 524, 526, 526, 526, 527, 527, 527, 529, 529, 529, 530, 530, 530, 530, 532, 532, 532, 532, 532, 532, 532, 533, 533, 533, 533, 533, 533, 533, 533,
+	1, 4, 8, 11, 14, 17, 20, 24, 27, 30, 33, 36, 39, 43, 46, 49, 52, 55, 59, 62, 65, 68, 71, 74, 78, 81, 84, 87, 90, 94, 97, 100,
+	103, 106, 109, 112, 115, 119, 122, 125, 128, 131, 134, 137, 140, 143, 147, 149, 153, 156, 159, 162, 165, 168, 171, 174, 177, 180, 183, 186, 189, 192, 195, 198,
+	201, 203, 207, 210, 213, 215, 218, 221, 224, 227, 230, 233, 236, 238, 241, 244, 247, 250, 253, 256, 258, 261, 264, 266, 269, 272, 275, 277, 280, 283, 286, 288,
+	291, 294, 296, 299, 302, 304, 307, 309, 312, 314, 317, 319, 322, 325, 327, 330, 332, 334, 337, 339, 342, 344, 346, 349, 351, 354, 356, 359, 361, 363, 366, 368,
+	370, 372, 375, 377, 379, 381, 383, 385, 387, 389, 391, 393, 396, 398, 400, 402, 404, 406, 407, 410, 412, 414, 416, 418, 420, 422, 423, 426, 427, 429, 431, 433,
+	435, 436, 438, 440, 441, 443, 444, 447, 448, 449, 452, 453, 454, 457, 458, 459, 460, 462, 464, 465, 467, 468, 469, 470, 472, 473, 474, 476, 477, 478, 479, 481,
+	482, 483, 485, 486, 487, 489, 490, 490, 491, 493, 494, 494, 495, 497, 498, 498, 499, 501, 501, 502, 503, 503, 505, 505, 506, 507, 507, 509, 509, 510, 510, 512,
+	512, 512, 513, 513, 515, 515, 515, 516, 516, 516, 517, 517, 517, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 522, 522, 522, 522, 522, 522, 522, 522,
+	1, 4, 7, 10, 14, 17, 20, 23, 26, 29, 32, 36, 39, 42, 45, 48, 51, 54, 57, 60, 64, 67, 70, 73, 76, 79, 82, 85, 88, 92, 95, 98,
+	101, 104, 107, 110, 113, 116, 119, 122, 125, 128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 161, 164, 167, 170, 173, 176, 179, 182, 185, 188, 191, 193,
+	196, 199, 202, 205, 208, 211, 214, 217, 220, 222, 225, 228, 231, 233, 236, 239, 241, 245, 247, 250, 253, 256, 258, 261, 263, 266, 269, 271, 274, 277, 280, 282,
+	285, 287, 290, 293, 295, 298, 300, 302, 305, 307, 310, 312, 315, 318, 320, 323, 325, 327, 330, 332, 334, 337, 339, 342, 344, 346, 348, 351, 353, 355, 358, 360,
+	362, 364, 367, 369, 371, 373, 375, 377, 379, 381, 383, 385, 387, 389, 391, 393, 396, 398, 399, 401, 403, 405, 407, 409, 411, 413, 414, 416, 418, 420, 422, 423,
+	426, 427, 429, 430, 431, 434, 435, 437, 438, 440, 442, 443, 444, 447, 448, 449, 450, 452, 454, 455, 457, 458, 459, 460, 462, 463, 464, 465, 467, 468, 469, 470,
+	472, 473, 474, 476, 477, 478, 479, 479, 481, 482, 483, 483, 485, 486, 487, 487, 489, 490, 490, 491, 493, 493, 494, 494, 495, 497, 497, 498, 498, 499, 499, 501,
+	501, 501, 502, 502, 503, 503, 503, 505, 505, 505, 506, 506, 506, 507, 507, 507, 507, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	1, 4, 7, 10, 13, 16, 19, 23, 26, 29, 32, 35, 38, 41, 44, 47, 50, 53, 56, 59, 62, 65, 68, 71, 74, 77, 81, 83, 86, 90, 93, 96,
+	99, 101, 105, 107, 110, 113, 117, 119, 122, 125, 128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 161, 164, 166, 169, 172, 175, 178, 181, 184, 187, 189,
+	192, 195, 198, 201, 203, 206, 209, 212, 215, 217, 220, 223, 226, 228, 231, 234, 236, 239, 242, 245, 247, 250, 253, 255, 258, 261, 263, 266, 268, 271, 274, 276,
+	279, 281, 283, 286, 289, 291, 294, 296, 298, 301, 303, 306, 308, 311, 313, 316, 318, 320, 323, 325, 327, 330, 332, 334, 336, 339, 341, 344, 345, 347, 350, 352,
+	354, 356, 359, 361, 363, 365, 367, 369, 371, 373, 375, 377, 379, 381, 383, 385, 387, 389, 390, 392, 394, 397, 399, 400, 402, 404, 405, 407, 409, 411, 413, 414,
+	416, 418, 420, 421, 422, 424, 426, 428, 429, 430, 433, 434, 435, 437, 438, 440, 441, 442, 444, 446, 447, 448, 449, 450, 452, 453, 454, 455, 457, 458, 459, 460,
+	462, 463, 464, 465, 467, 468, 469, 469, 470, 472, 473, 473, 474, 476, 477, 477, 478, 479, 479, 481, 482, 482, 483, 483, 485, 486, 486, 487, 487, 489, 489, 490,
+	490, 490, 491, 491, 493, 493, 493, 494, 494, 494, 495, 495, 495, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 499, 499, 499, 499, 499, 499, 499, 499,
+	1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46, 49, 52, 55, 58, 61, 64, 67, 70, 73, 76, 79, 82, 85, 88, 91, 94,
+	96, 99, 102, 105, 108, 111, 114, 117, 120, 123, 125, 129, 131, 134, 137, 140, 143, 146, 149, 151, 154, 157, 160, 163, 166, 169, 172, 174, 177, 180, 183, 185,
+	188, 191, 194, 196, 199, 202, 205, 207, 210, 213, 215, 218, 221, 223, 226, 229, 231, 234, 237, 239, 242, 245, 247, 249, 252, 255, 258, 260, 263, 265, 268, 270,
+	273, 275, 277, 280, 283, 285, 287, 290, 292, 294, 297, 299, 302, 304, 307, 309, 311, 313, 316, 318, 320, 323, 325, 327, 329, 332, 333, 336, 338, 340, 343, 344,
+	346, 348, 351, 353, 355, 357, 359, 361, 363, 365, 367, 369, 371, 373, 375, 377, 379, 381, 382, 384, 386, 388, 390, 391, 393, 396, 397, 399, 400, 402, 404, 405,
+	407, 409, 411, 412, 413, 415, 416, 419, 420, 421, 423, 424, 426, 428, 429, 430, 431, 433, 435, 436, 437, 438, 440, 441, 442, 443, 444, 446, 447, 448, 449, 450,
+	452, 453, 454, 455, 457, 458, 459, 459, 460, 462, 463, 463, 464, 465, 467, 467, 468, 469, 469, 470, 472, 472, 473, 473, 474, 476, 476, 477, 477, 478, 478, 479,
+	479, 479, 481, 481, 482, 482, 482, 483, 483, 483, 485, 485, 485, 486, 486, 486, 486, 487, 487, 487, 487, 487, 487, 487, 489, 489, 489, 489, 489, 489, 489, 489,
+	1, 4, 7, 10, 13, 16, 19, 22, 24, 27, 30, 33, 36, 39, 42, 45, 48, 51, 54, 57, 59, 62, 65, 68, 71, 74, 77, 80, 83, 86, 89, 92,
+	94, 97, 100, 103, 106, 109, 112, 114, 117, 120, 123, 126, 129, 131, 134, 137, 140, 143, 145, 148, 151, 154, 157, 159, 162, 165, 168, 171, 173, 176, 179, 181,
+	184, 187, 190, 192, 195, 198, 200, 203, 206, 208, 211, 214, 216, 218, 221, 224, 226, 229, 232, 234, 237, 239, 242, 244, 247, 249, 252, 254, 257, 259, 262, 264,
+	267, 269, 271, 274, 277, 279, 281, 283, 286, 288, 290, 293, 295, 298, 300, 302, 304, 307, 309, 311, 313, 316, 318, 320, 322, 325, 326, 329, 331, 333, 335, 337,
+	339, 341, 344, 345, 347, 349, 351, 353, 355, 357, 359, 361, 363, 365, 367, 369, 371, 373, 374, 376, 378, 380, 382, 383, 385, 387, 388, 390, 391, 393, 396, 397,
+	399, 400, 402, 403, 404, 406, 407, 410, 411, 412, 414, 415, 416, 419, 420, 421, 422, 423, 426, 427, 428, 429, 430, 431, 433, 434, 435, 436, 437, 438, 440, 441,
+	442, 443, 444, 446, 447, 448, 449, 449, 450, 452, 453, 453, 454, 455, 457, 457, 458, 459, 459, 460, 462, 462, 463, 463, 464, 465, 465, 467, 467, 468, 468, 469,
+	469, 469, 470, 470, 472, 472, 472, 473, 473, 473, 474, 474, 474, 476, 476, 476, 476, 477, 477, 477, 477, 477, 477, 477, 478, 478, 478, 478, 478, 478, 478, 478,
+	1, 4, 7, 10, 12, 15, 18, 21, 24, 27, 30, 33, 35, 38, 41, 44, 47, 50, 53, 55, 58, 61, 64, 67, 70, 72, 75, 78, 81, 84, 87, 90,
+	92, 95, 98, 101, 103, 106, 109, 112, 115, 118, 120, 123, 126, 129, 131, 134, 137, 140, 142, 145, 148, 151, 153, 156, 159, 162, 164, 167, 169, 172, 175, 177,
+	180, 183, 186, 188, 191, 193, 196, 199, 201, 203, 206, 209, 211, 214, 217, 219, 221, 224, 227, 229, 232, 234, 237, 239, 241, 244, 247, 249, 251, 253, 256, 258,
+	261, 263, 266, 268, 271, 273, 275, 277, 280, 282, 284, 286, 289, 291, 294, 296, 298, 300, 302, 304, 307, 309, 311, 313, 315, 318, 319, 322, 324, 325, 328, 330,
+	332, 333, 336, 338, 340, 342, 344, 345, 347, 349, 351, 353, 355, 357, 359, 361, 363, 365, 366, 368, 370, 372, 374, 375, 377, 379, 380, 382, 383, 385, 387, 388,
+	390, 391, 393, 394, 396, 398, 399, 401, 402, 403, 405, 406, 407, 410, 411, 412, 413, 414, 416, 418, 419, 420, 421, 422, 423, 424, 426, 427, 428, 429, 430, 431,
+	433, 434, 435, 436, 437, 438, 440, 440, 441, 442, 443, 443, 444, 446, 447, 447, 448, 449, 449, 450, 452, 452, 453, 453, 454, 455, 455, 457, 457, 458, 458, 459,
+	459, 459, 460, 460, 462, 462, 462, 463, 463, 463, 464, 464, 464, 465, 465, 465, 465, 467, 467, 467, 467, 467, 467, 467, 468, 468, 468, 468, 468, 468, 468, 468,
+	1, 4, 7, 9, 12, 15, 18, 21, 23, 26, 29, 32, 35, 37, 40, 43, 46, 49, 51, 54, 57, 60, 63, 65, 68, 71, 74, 76, 79, 82, 85, 88,
+	90, 93, 96, 99, 101, 104, 107, 110, 112, 115, 118, 120, 123, 126, 129, 131, 134, 137, 139, 142, 145, 147, 150, 153, 155, 158, 161, 163, 166, 168, 171, 173,
+	176, 179, 182, 184, 187, 189, 192, 194, 197, 199, 202, 205, 207, 209, 212, 214, 217, 220, 222, 224, 227, 229, 232, 234, 236, 239, 241, 243, 246, 248, 251, 253,
+	256, 258, 260, 263, 265, 267, 269, 271, 274, 276, 278, 280, 283, 285, 287, 290, 291, 294, 296, 298, 300, 302, 304, 307, 308, 311, 312, 315, 317, 318, 321, 323,
+	325, 326, 329, 331, 333, 334, 336, 338, 340, 342, 344, 345, 347, 349, 351, 353, 355, 357, 358, 360, 362, 364, 366, 367, 369, 371, 372, 374, 375, 377, 379, 380,
+	382, 383, 385, 386, 387, 389, 390, 392, 393, 394, 397, 398, 399, 401, 402, 403, 404, 405, 407, 409, 410, 411, 412, 413, 414, 415, 416, 418, 419, 420, 421, 422,
+	423, 424, 426, 427, 428, 429, 430, 430, 431, 433, 434, 434, 435, 436, 437, 437, 438, 440, 440, 441, 442, 442, 443, 443, 444, 446, 446, 447, 447, 448, 448, 449,
+	449, 449, 450, 450, 452, 452, 452, 453, 453, 453, 454, 454, 454, 455, 455, 455, 455, 457, 457, 457, 457, 457, 457, 457, 458, 458, 458, 458, 458, 458, 458, 458,
+	1, 4, 6, 9, 12, 15, 17, 20, 23, 26, 28, 31, 34, 37, 39, 42, 45, 48, 50, 53, 56, 59, 61, 64, 67, 69, 72, 75, 78, 80, 83, 86,
+	88, 91, 94, 96, 99, 102, 105, 107, 110, 113, 115, 118, 120, 123, 126, 128, 131, 134, 136, 139, 141, 144, 147, 149, 152, 155, 157, 160, 162, 165, 167, 170,
+	172, 175, 178, 180, 183, 185, 188, 190, 193, 195, 198, 200, 202, 205, 207, 210, 212, 215, 217, 220, 222, 224, 227, 229, 231, 234, 236, 238, 241, 243, 245, 247,
+	250, 252, 254, 257, 259, 261, 263, 266, 268, 270, 272, 274, 277, 279, 281, 283, 285, 287, 290, 291, 294, 296, 298, 300, 302, 304, 306, 308, 310, 312, 314, 316,
+	318, 319, 322, 324, 325, 327, 329, 331, 333, 334, 336, 338, 340, 342, 344, 345, 347, 349, 350, 352, 354, 356, 358, 359, 361, 363, 364, 366, 367, 369, 371, 372,
+	374, 375, 377, 378, 379, 381, 382, 384, 385, 386, 388, 389, 390, 392, 393, 394, 396, 397, 399, 400, 401, 402, 403, 404, 405, 406, 407, 409, 410, 411, 412, 413,
+	414, 415, 416, 418, 419, 420, 421, 421, 422, 423, 424, 424, 426, 427, 428, 428, 429, 430, 430, 431, 433, 433, 434, 434, 435, 436, 436, 437, 437, 438, 438, 440,
+	440, 440, 441, 441, 442, 442, 442, 443, 443, 443, 444, 444, 444, 446, 446, 446, 446, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	1, 4, 6, 9, 12, 14, 17, 20, 22, 25, 28, 30, 33, 36, 39, 41, 44, 47, 49, 52, 55, 57, 60, 62, 65, 68, 71, 73, 76, 79, 81, 84,
+	86, 89, 92, 94, 97, 100, 102, 105, 107, 110, 113, 115, 118, 120, 123, 125, 128, 131, 133, 136, 138, 141, 144, 146, 149, 151, 154, 156, 159, 161, 164, 166,
+	169, 171, 174, 176, 179, 181, 184, 186, 189, 191, 193, 196, 198, 200, 203, 205, 207, 210, 213, 215, 217, 220, 222, 224, 226, 229, 231, 233, 236, 238, 240, 242,
+	245, 247, 249, 251, 253, 256, 258, 260, 262, 264, 266, 268, 271, 273, 275, 277, 279, 281, 283, 285, 287, 290, 291, 294, 295, 298, 299, 302, 303, 305, 307, 309,
+	311, 312, 315, 317, 318, 320, 322, 324, 325, 327, 329, 331, 333, 334, 336, 338, 340, 342, 343, 344, 346, 348, 350, 351, 353, 355, 356, 358, 359, 361, 363, 364,
+	366, 367, 369, 370, 371, 373, 374, 376, 377, 378, 380, 381, 382, 384, 385, 386, 387, 388, 390, 391, 392, 393, 394, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+	405, 406, 407, 409, 410, 411, 412, 412, 413, 414, 415, 415, 416, 418, 419, 419, 420, 421, 421, 422, 423, 423, 424, 424, 426, 427, 427, 428, 428, 429, 429, 430,
+	430, 430, 431, 431, 433, 433, 433, 434, 434, 434, 435, 435, 435, 436, 436, 436, 436, 437, 437, 437, 437, 437, 437, 437, 438, 438, 438, 438, 438, 438, 438, 438,
+	1, 3, 6, 9, 11, 14, 17, 19, 22, 25, 27, 30, 32, 35, 38, 40, 43, 46, 48, 51, 53, 56, 59, 61, 64, 66, 69, 72, 74, 77, 79, 82,
+	85, 87, 90, 92, 95, 97, 100, 103, 105, 108, 110, 113, 115, 118, 120, 123, 125, 128, 130, 133, 135, 138, 141, 143, 145, 148, 151, 153, 155, 158, 160, 162,
+	165, 167, 170, 172, 175, 177, 180, 182, 185, 187, 189, 192, 194, 196, 199, 201, 203, 206, 208, 210, 213, 215, 217, 219, 221, 224, 226, 228, 231, 232, 235, 237,
+	239, 241, 243, 246, 248, 250, 252, 254, 256, 258, 261, 263, 265, 267, 269, 271, 273, 275, 277, 279, 281, 283, 285, 287, 289, 291, 293, 295, 297, 298, 301, 302,
+	304, 306, 308, 310, 312, 313, 315, 317, 318, 320, 322, 324, 325, 327, 329, 331, 333, 334, 335, 337, 339, 341, 343, 344, 345, 347, 348, 350, 351, 353, 355, 356,
+	358, 359, 361, 362, 363, 365, 366, 368, 369, 370, 372, 373, 374, 376, 377, 378, 379, 380, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 396,
+	397, 398, 399, 400, 401, 402, 403, 403, 404, 405, 406, 406, 407, 409, 410, 410, 411, 412, 412, 413, 414, 414, 415, 415, 416, 418, 418, 419, 419, 420, 420, 421,
+	421, 421, 422, 422, 423, 423, 423, 424, 424, 424, 426, 426, 426, 427, 427, 427, 427, 428, 428, 428, 428, 428, 428, 428, 429, 429, 429, 429, 429, 429, 429, 429,
+	1, 3, 6, 9, 11, 14, 16, 19, 21, 24, 27, 29, 32, 34, 37, 39, 42, 45, 47, 50, 52, 55, 57, 60, 62, 65, 68, 70, 73, 75, 78, 80,
+	83, 85, 88, 90, 93, 95, 98, 100, 103, 105, 108, 110, 113, 115, 118, 120, 123, 125, 128, 130, 133, 135, 138, 140, 142, 145, 147, 150, 152, 154, 157, 159,
+	162, 164, 166, 169, 171, 173, 176, 178, 181, 183, 185, 188, 190, 192, 194, 196, 199, 201, 203, 206, 208, 210, 213, 214, 217, 219, 221, 223, 226, 227, 230, 232,
+	234, 236, 238, 241, 243, 245, 247, 249, 251, 253, 255, 257, 259, 261, 263, 266, 267, 269, 271, 273, 275, 277, 279, 281, 283, 285, 286, 289, 290, 292, 294, 296,
+	298, 299, 302, 303, 305, 307, 308, 310, 312, 313, 315, 317, 318, 320, 322, 324, 325, 327, 328, 330, 332, 333, 335, 336, 338, 340, 341, 343, 344, 345, 347, 348,
+	350, 351, 353, 354, 355, 357, 358, 360, 361, 362, 364, 365, 366, 368, 369, 370, 371, 372, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387,
+	388, 389, 390, 391, 392, 393, 394, 394, 396, 397, 398, 398, 399, 400, 401, 401, 402, 403, 403, 404, 405, 405, 406, 406, 407, 409, 409, 410, 410, 411, 411, 412,
+	412, 412, 413, 413, 414, 414, 414, 415, 415, 415, 416, 416, 416, 418, 418, 418, 418, 419, 419, 419, 419, 419, 419, 419, 420, 420, 420, 420, 420, 420, 420, 420,
+	1, 3, 6, 8, 11, 13, 16, 18, 21, 23, 26, 29, 31, 34, 36, 39, 41, 44, 46, 49, 51, 54, 56, 59, 61, 64, 66, 69, 71, 74, 76, 79,
+	81, 83, 86, 88, 91, 93, 96, 98, 101, 103, 105, 108, 110, 113, 115, 118, 120, 122, 125, 127, 130, 132, 135, 137, 139, 142, 144, 147, 149, 151, 153, 156,
+	158, 160, 163, 165, 167, 170, 172, 174, 177, 179, 181, 184, 186, 188, 190, 192, 194, 197, 199, 201, 203, 206, 208, 210, 212, 214, 217, 218, 221, 223, 225, 227,
+	229, 231, 233, 236, 238, 239, 241, 243, 245, 247, 249, 251, 253, 256, 258, 260, 261, 263, 266, 267, 269, 271, 273, 275, 277, 279, 280, 283, 284, 286, 288, 290,
+	291, 293, 295, 297, 298, 300, 302, 303, 305, 307, 308, 310, 312, 313, 315, 317, 318, 320, 321, 323, 325, 326, 328, 329, 331, 333, 333, 335, 336, 338, 340, 341,
+	343, 344, 345, 346, 347, 349, 350, 352, 353, 354, 356, 357, 358, 360, 361, 362, 363, 364, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+	380, 381, 382, 383, 384, 385, 386, 386, 387, 388, 389, 389, 390, 391, 392, 392, 393, 394, 394, 396, 397, 397, 398, 398, 399, 400, 400, 401, 401, 402, 402, 403,
+	403, 403, 404, 404, 405, 405, 405, 406, 406, 406, 407, 407, 407, 409, 409, 409, 409, 410, 410, 410, 410, 410, 410, 410, 411, 411, 411, 411, 411, 411, 411, 411,
+	1, 3, 6, 8, 11, 13, 16, 18, 20, 23, 25, 28, 30, 33, 35, 38, 40, 43, 45, 48, 50, 52, 55, 57, 60, 62, 65, 67, 70, 72, 74, 77,
+	79, 82, 84, 86, 89, 91, 94, 96, 99, 101, 103, 106, 108, 110, 113, 115, 118, 120, 122, 124, 127, 129, 132, 134, 136, 139, 141, 143, 145, 148, 150, 152,
+	155, 157, 159, 162, 164, 166, 168, 171, 173, 175, 177, 180, 182, 184, 186, 188, 190, 193, 195, 197, 199, 201, 203, 205, 207, 210, 212, 214, 216, 218, 220, 222,
+	224, 226, 228, 231, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254, 256, 258, 260, 261, 263, 266, 267, 269, 271, 273, 274, 277, 278, 280, 282, 283,
+	285, 286, 289, 290, 292, 294, 295, 297, 298, 300, 302, 303, 305, 307, 308, 310, 312, 313, 314, 316, 318, 319, 321, 322, 324, 325, 326, 328, 329, 331, 333, 333,
+	335, 336, 338, 339, 340, 342, 343, 344, 345, 346, 348, 349, 350, 352, 353, 354, 355, 356, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+	372, 373, 374, 375, 376, 377, 378, 378, 379, 380, 381, 381, 382, 383, 384, 384, 385, 386, 386, 387, 388, 388, 389, 389, 390, 391, 391, 392, 392, 393, 393, 394,
+	394, 394, 396, 396, 397, 397, 397, 398, 398, 398, 399, 399, 399, 400, 400, 400, 400, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	1, 3, 6, 8, 10, 13, 15, 18, 20, 22, 25, 27, 30, 32, 35, 37, 39, 42, 44, 47, 49, 51, 54, 56, 59, 61, 63, 66, 68, 70, 73, 75,
+	78, 80, 82, 85, 87, 89, 92, 94, 96, 99, 101, 103, 106, 108, 110, 113, 115, 117, 119, 122, 124, 126, 129, 131, 133, 136, 138, 140, 142, 145, 147, 149,
+	151, 153, 156, 158, 160, 162, 165, 167, 169, 171, 173, 176, 178, 180, 182, 184, 186, 189, 191, 193, 195, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217,
+	220, 221, 223, 226, 227, 229, 231, 233, 235, 237, 239, 241, 243, 245, 247, 249, 250, 252, 254, 256, 258, 260, 261, 263, 265, 267, 268, 271, 272, 274, 276, 277,
+	279, 280, 283, 284, 286, 287, 289, 290, 292, 294, 295, 297, 298, 300, 302, 303, 305, 307, 307, 309, 311, 312, 314, 315, 317, 318, 319, 321, 322, 324, 325, 326,
+	328, 329, 331, 332, 333, 334, 335, 337, 338, 339, 341, 342, 343, 344, 345, 346, 347, 348, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+	364, 365, 366, 367, 368, 369, 370, 370, 371, 372, 373, 373, 374, 375, 376, 376, 377, 378, 378, 379, 380, 380, 381, 381, 382, 383, 383, 384, 384, 385, 385, 386,
+	386, 386, 387, 387, 388, 388, 388, 389, 389, 389, 390, 390, 390, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 393, 393, 393, 393, 393, 393, 393, 393,
+	1, 3, 5, 8, 10, 12, 15, 17, 20, 22, 24, 27, 29, 31, 34, 36, 39, 41, 43, 46, 48, 50, 53, 55, 57, 59, 62, 64, 67, 69, 71, 74,
+	76, 78, 81, 83, 85, 87, 90, 92, 94, 97, 99, 101, 103, 106, 108, 110, 113, 115, 117, 119, 121, 124, 126, 128, 130, 133, 135, 137, 139, 141, 144, 146,
+	148, 150, 153, 155, 157, 159, 161, 163, 166, 167, 170, 172, 174, 176, 178, 180, 182, 185, 187, 189, 191, 193, 195, 196, 199, 201, 203, 205, 207, 209, 211, 213,
+	215, 217, 218, 221, 223, 224, 226, 228, 230, 232, 234, 236, 238, 239, 241, 243, 245, 247, 249, 250, 252, 254, 256, 258, 259, 261, 263, 265, 266, 268, 270, 271,
+	273, 274, 277, 278, 280, 281, 283, 284, 286, 287, 289, 290, 292, 294, 295, 297, 298, 300, 301, 302, 304, 306, 307, 308, 310, 312, 312, 314, 315, 317, 318, 319,
+	321, 322, 324, 325, 325, 327, 328, 330, 331, 332, 333, 334, 335, 337, 338, 339, 340, 341, 343, 344, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+	356, 357, 358, 359, 360, 361, 362, 362, 363, 364, 365, 365, 366, 367, 368, 368, 369, 370, 370, 371, 372, 372, 373, 373, 374, 375, 375, 376, 376, 377, 377, 378,
+	378, 378, 379, 379, 380, 380, 380, 381, 381, 381, 382, 382, 382, 383, 383, 383, 383, 384, 384, 384, 384, 384, 384, 384, 385, 385, 385, 385, 385, 385, 385, 385,
+	1, 3, 5, 8, 10, 12, 15, 17, 19, 21, 24, 26, 28, 31, 33, 35, 38, 40, 42, 45, 47, 49, 51, 54, 56, 58, 61, 63, 65, 67, 70, 72,
+	74, 76, 79, 81, 83, 86, 88, 90, 92, 95, 97, 99, 101, 103, 106, 108, 110, 112, 114, 117, 119, 121, 123, 125, 128, 130, 132, 134, 136, 138, 141, 143,
+	145, 147, 149, 151, 153, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 181, 183, 185, 187, 189, 191, 192, 194, 196, 199, 200, 202, 204, 206, 208,
+	210, 212, 214, 216, 218, 220, 221, 223, 225, 227, 229, 231, 232, 234, 236, 238, 239, 241, 243, 245, 247, 249, 250, 252, 253, 256, 257, 259, 261, 262, 264, 266,
+	267, 268, 271, 272, 274, 275, 277, 278, 280, 281, 283, 284, 286, 287, 289, 290, 292, 294, 294, 296, 298, 299, 301, 302, 303, 305, 306, 307, 308, 310, 312, 312,
+	314, 315, 317, 318, 318, 320, 321, 323, 324, 325, 326, 327, 328, 330, 331, 332, 333, 333, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 344, 345, 346, 347,
+	348, 349, 350, 351, 352, 353, 354, 354, 355, 356, 357, 357, 358, 359, 360, 360, 361, 362, 362, 363, 364, 364, 365, 365, 366, 367, 367, 368, 368, 369, 369, 370,
+	370, 370, 371, 371, 372, 372, 372, 373, 373, 373, 374, 374, 374, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 377, 377, 377, 377, 377, 377, 377, 377,
+	1, 3, 5, 7, 10, 12, 14, 16, 19, 21, 23, 26, 28, 30, 32, 35, 37, 39, 41, 44, 46, 48, 50, 52, 55, 57, 59, 61, 64, 66, 68, 70,
+	73, 75, 77, 79, 81, 84, 86, 88, 90, 93, 95, 97, 99, 101, 103, 105, 108, 110, 112, 114, 116, 119, 121, 123, 125, 127, 129, 131, 133, 135, 138, 140,
+	142, 144, 146, 148, 150, 152, 154, 156, 159, 160, 162, 165, 166, 168, 171, 172, 174, 177, 179, 181, 183, 185, 187, 188, 190, 192, 194, 196, 198, 200, 202, 203,
+	206, 207, 209, 211, 213, 215, 217, 218, 220, 222, 224, 226, 227, 229, 231, 233, 234, 236, 238, 239, 241, 243, 245, 247, 248, 250, 251, 253, 255, 256, 258, 260,
+	261, 263, 265, 266, 268, 269, 271, 272, 274, 275, 277, 278, 280, 281, 283, 284, 286, 287, 288, 290, 291, 293, 294, 295, 297, 298, 299, 301, 302, 303, 305, 306,
+	307, 308, 310, 311, 312, 313, 314, 316, 317, 318, 319, 320, 321, 323, 324, 325, 325, 326, 328, 329, 330, 331, 332, 333, 333, 334, 335, 336, 337, 338, 339, 340,
+	341, 342, 343, 344, 344, 345, 346, 346, 347, 348, 349, 349, 350, 351, 352, 352, 353, 354, 354, 355, 356, 356, 357, 357, 358, 359, 359, 360, 360, 361, 361, 362,
+	362, 362, 363, 363, 364, 364, 364, 365, 365, 365, 366, 366, 366, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 369, 369, 369, 369, 369, 369, 369, 369,
+	1, 3, 5, 7, 9, 12, 14, 16, 18, 21, 23, 25, 27, 29, 32, 34, 36, 38, 40, 43, 45, 47, 49, 51, 54, 56, 58, 60, 62, 65, 67, 69,
+	71, 73, 75, 78, 80, 82, 84, 86, 88, 91, 93, 95, 97, 99, 101, 103, 105, 107, 110, 112, 114, 116, 118, 120, 122, 124, 126, 129, 130, 133, 135, 137,
+	139, 141, 143, 145, 147, 149, 151, 153, 155, 157, 159, 161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 184, 186, 188, 190, 192, 194, 195, 198, 199,
+	201, 203, 205, 207, 209, 210, 212, 214, 215, 217, 219, 221, 223, 224, 226, 228, 229, 231, 233, 234, 236, 238, 239, 241, 243, 245, 246, 248, 249, 251, 253, 254,
+	256, 257, 259, 261, 262, 263, 265, 266, 268, 269, 271, 272, 274, 275, 277, 278, 280, 281, 282, 283, 285, 286, 288, 289, 290, 292, 293, 294, 295, 297, 298, 299,
+	301, 302, 303, 304, 305, 307, 307, 309, 310, 311, 312, 313, 314, 316, 317, 318, 318, 319, 321, 322, 323, 324, 325, 325, 326, 327, 328, 329, 330, 331, 332, 333,
+	333, 334, 335, 336, 337, 338, 339, 339, 340, 341, 342, 342, 343, 344, 344, 344, 345, 346, 346, 347, 348, 348, 349, 349, 350, 351, 351, 352, 352, 353, 353, 354,
+	354, 354, 355, 355, 356, 356, 356, 357, 357, 357, 358, 358, 358, 359, 359, 359, 359, 360, 360, 360, 360, 360, 360, 360, 361, 361, 361, 361, 361, 361, 361, 361,
+	1, 3, 5, 7, 9, 11, 14, 16, 18, 20, 22, 24, 27, 29, 31, 33, 35, 37, 40, 42, 44, 46, 48, 50, 52, 55, 57, 59, 61, 63, 65, 67,
+	70, 72, 74, 76, 78, 80, 82, 84, 86, 89, 91, 93, 95, 97, 99, 101, 103, 105, 107, 109, 111, 113, 116, 118, 119, 122, 124, 126, 128, 130, 132, 134,
+	136, 138, 140, 142, 144, 146, 148, 150, 152, 153, 156, 158, 159, 161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 180, 182, 184, 186, 188, 190, 191, 193, 195,
+	197, 199, 200, 202, 204, 206, 207, 209, 211, 213, 214, 216, 218, 220, 221, 223, 224, 226, 228, 229, 231, 233, 234, 236, 238, 239, 241, 243, 244, 245, 247, 249,
+	250, 251, 253, 255, 256, 258, 259, 261, 262, 263, 265, 266, 268, 269, 271, 272, 274, 275, 276, 277, 279, 280, 282, 283, 284, 286, 286, 288, 289, 290, 292, 293,
+	294, 295, 297, 298, 298, 300, 301, 302, 303, 304, 306, 307, 307, 309, 310, 311, 312, 312, 314, 315, 316, 317, 318, 318, 319, 320, 321, 322, 323, 324, 325, 325,
+	326, 327, 328, 329, 330, 331, 332, 332, 333, 333, 334, 334, 335, 336, 337, 337, 338, 339, 339, 340, 341, 341, 342, 342, 343, 344, 344, 344, 344, 345, 345, 346,
+	346, 346, 347, 347, 348, 348, 348, 349, 349, 349, 350, 350, 350, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 353, 353, 353, 353, 353, 353, 353, 353,
+	1, 3, 5, 7, 9, 11, 13, 15, 18, 20, 22, 24, 26, 28, 30, 32, 35, 37, 39, 41, 43, 45, 47, 49, 51, 53, 56, 58, 60, 62, 64, 66,
+	68, 70, 72, 74, 76, 78, 81, 83, 85, 87, 89, 91, 93, 95, 97, 99, 101, 103, 105, 107, 109, 111, 113, 115, 117, 119, 121, 123, 125, 127, 129, 131,
+	133, 135, 137, 139, 141, 143, 145, 147, 149, 150, 152, 154, 156, 158, 160, 162, 163, 166, 167, 169, 171, 173, 175, 176, 178, 180, 182, 184, 186, 187, 189, 191,
+	193, 194, 196, 198, 200, 201, 203, 205, 206, 208, 210, 211, 213, 215, 217, 218, 220, 221, 223, 224, 226, 228, 229, 231, 232, 234, 236, 238, 239, 240, 242, 243,
+	245, 246, 248, 249, 251, 252, 253, 255, 256, 258, 259, 261, 262, 263, 265, 266, 268, 269, 270, 271, 273, 274, 276, 277, 278, 280, 280, 282, 283, 284, 286, 286,
+	288, 289, 290, 291, 292, 294, 294, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 312, 313, 314, 315, 316, 317, 318, 318,
+	319, 320, 321, 322, 323, 324, 325, 325, 325, 326, 327, 327, 328, 329, 330, 330, 331, 332, 332, 333, 333, 333, 334, 334, 335, 336, 336, 337, 337, 338, 338, 339,
+	339, 339, 340, 340, 341, 341, 341, 342, 342, 342, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 345, 345, 345, 345, 345, 345, 345, 345,
+	1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 65,
+	67, 69, 71, 73, 75, 77, 79, 81, 83, 85, 87, 89, 91, 93, 95, 97, 99, 101, 103, 105, 107, 109, 111, 113, 114, 117, 119, 120, 122, 124, 126, 128,
+	130, 132, 134, 136, 138, 140, 141, 143, 145, 147, 149, 151, 153, 154, 156, 158, 160, 162, 164, 166, 167, 169, 171, 172, 174, 176, 178, 180, 182, 183, 185, 187,
+	189, 190, 192, 194, 195, 197, 199, 200, 202, 203, 205, 207, 209, 210, 212, 214, 215, 217, 218, 220, 221, 223, 224, 226, 227, 229, 231, 232, 234, 235, 237, 238,
+	239, 241, 243, 244, 245, 247, 248, 249, 251, 252, 253, 255, 256, 258, 259, 261, 262, 263, 264, 266, 267, 268, 270, 271, 272, 274, 274, 276, 277, 278, 280, 280,
+	282, 283, 284, 285, 286, 287, 288, 290, 290, 291, 293, 294, 294, 296, 297, 298, 298, 299, 301, 302, 302, 303, 304, 305, 306, 307, 307, 308, 309, 310, 311, 312,
+	312, 313, 314, 315, 316, 317, 318, 318, 318, 319, 320, 320, 321, 322, 323, 323, 324, 325, 325, 325, 326, 326, 327, 327, 328, 329, 329, 330, 330, 331, 331, 332,
+	332, 332, 333, 333, 333, 333, 333, 334, 334, 334, 335, 335, 335, 336, 336, 336, 336, 337, 337, 337, 337, 337, 337, 337, 338, 338, 338, 338, 338, 338, 338, 338,
+	1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 53, 55, 57, 59, 61, 63,
+	65, 67, 69, 71, 73, 75, 77, 79, 81, 83, 85, 87, 89, 91, 93, 95, 97, 99, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 119, 121, 123, 125,
+	127, 129, 131, 133, 135, 137, 138, 140, 142, 144, 146, 148, 149, 151, 153, 155, 156, 159, 160, 162, 164, 166, 167, 169, 171, 172, 174, 176, 178, 179, 181, 183,
+	185, 186, 188, 190, 191, 193, 194, 196, 198, 199, 201, 202, 204, 206, 207, 209, 210, 212, 214, 215, 217, 218, 220, 221, 223, 224, 226, 227, 229, 230, 232, 233,
+	234, 236, 238, 239, 240, 241, 243, 244, 245, 247, 248, 249, 251, 252, 253, 255, 256, 258, 258, 260, 261, 263, 264, 265, 266, 268, 268, 270, 271, 272, 274, 274,
+	276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 290, 290, 291, 292, 293, 294, 295, 296, 297, 298, 298, 299, 300, 301, 302, 302, 303, 304, 305,
+	306, 307, 307, 308, 309, 310, 311, 311, 312, 312, 313, 313, 314, 315, 316, 316, 317, 318, 318, 318, 319, 319, 320, 320, 321, 322, 322, 323, 323, 324, 324, 325,
+	325, 325, 325, 325, 326, 326, 326, 327, 327, 327, 328, 328, 328, 329, 329, 329, 329, 330, 330, 330, 330, 330, 330, 330, 331, 331, 331, 331, 331, 331, 331, 331,
+	0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62,
+	64, 66, 68, 70, 71, 73, 75, 77, 79, 81, 83, 85, 87, 89, 91, 93, 95, 96, 98, 100, 102, 104, 106, 108, 110, 112, 113, 115, 117, 119, 121, 122,
+	124, 126, 128, 130, 132, 134, 135, 137, 139, 141, 143, 145, 146, 148, 150, 151, 153, 155, 157, 159, 160, 162, 164, 165, 167, 169, 171, 172, 174, 175, 177, 179,
+	181, 182, 184, 186, 187, 189, 190, 192, 193, 195, 196, 198, 200, 201, 203, 205, 206, 207, 209, 210, 212, 214, 215, 217, 218, 220, 221, 223, 224, 225, 227, 228,
+	229, 231, 232, 234, 235, 236, 238, 239, 240, 241, 243, 244, 245, 247, 248, 249, 251, 252, 253, 254, 256, 257, 258, 259, 261, 262, 263, 264, 265, 266, 268, 268,
+	270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 286, 288, 289, 290, 290, 291, 292, 293, 294, 294, 295, 296, 297, 298, 298,
+	299, 300, 301, 302, 302, 303, 304, 304, 305, 306, 307, 307, 307, 308, 309, 309, 310, 311, 311, 312, 312, 312, 313, 313, 314, 315, 315, 316, 316, 317, 317, 318,
+	318, 318, 318, 318, 319, 319, 319, 320, 320, 320, 321, 321, 321, 322, 322, 322, 322, 323, 323, 323, 323, 323, 323, 323, 324, 324, 324, 324, 324, 324, 324, 324,
+	0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 53, 55, 57, 59, 60,
+	62, 64, 66, 68, 70, 72, 74, 76, 78, 79, 81, 83, 85, 87, 89, 91, 93, 94, 96, 98, 100, 102, 104, 105, 107, 109, 111, 113, 114, 116, 118, 120,
+	122, 123, 125, 127, 129, 131, 133, 134, 136, 138, 140, 141, 143, 145, 147, 148, 150, 152, 153, 155, 157, 159, 160, 162, 163, 165, 167, 168, 170, 172, 173, 175,
+	177, 178, 180, 182, 183, 185, 186, 188, 189, 191, 192, 194, 195, 197, 199, 200, 201, 203, 205, 206, 207, 209, 210, 212, 213, 215, 216, 218, 219, 220, 222, 223,
+	224, 226, 227, 229, 230, 231, 232, 234, 235, 236, 238, 239, 240, 241, 243, 244, 245, 247, 247, 249, 250, 251, 253, 253, 255, 256, 257, 258, 259, 261, 262, 263,
+	264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 280, 282, 283, 283, 284, 285, 286, 286, 287, 288, 289, 290, 290, 291, 292,
+	293, 294, 294, 295, 296, 297, 298, 298, 298, 299, 300, 300, 301, 302, 302, 302, 303, 304, 304, 305, 306, 306, 307, 307, 307, 308, 308, 309, 309, 310, 310, 311,
+	311, 311, 312, 312, 312, 312, 312, 313, 313, 313, 314, 314, 314, 315, 315, 315, 315, 316, 316, 316, 316, 316, 316, 316, 317, 317, 317, 317, 317, 317, 317, 317,
+	0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 19, 21, 23, 25, 27, 29, 31, 33, 35, 37, 38, 40, 42, 44, 46, 48, 50, 52, 53, 55, 57, 59,
+	61, 63, 65, 67, 68, 70, 72, 74, 76, 78, 79, 81, 83, 85, 87, 89, 91, 92, 94, 96, 98, 100, 101, 103, 105, 107, 109, 110, 112, 114, 116, 117,
+	119, 121, 123, 124, 126, 128, 130, 131, 133, 135, 137, 138, 140, 141, 143, 145, 147, 149, 150, 152, 153, 155, 157, 158, 160, 162, 163, 165, 166, 168, 170, 171,
+	173, 174, 176, 178, 179, 181, 182, 184, 185, 187, 188, 190, 191, 193, 194, 196, 197, 199, 200, 201, 203, 205, 206, 207, 209, 210, 211, 213, 214, 215, 217, 218,
+	220, 221, 223, 224, 225, 226, 227, 229, 230, 231, 232, 234, 235, 236, 238, 239, 240, 241, 242, 243, 245, 246, 247, 248, 249, 251, 251, 253, 253, 255, 256, 257,
+	258, 259, 261, 261, 262, 263, 264, 266, 266, 267, 268, 269, 270, 271, 272, 273, 274, 274, 276, 277, 277, 278, 279, 280, 280, 281, 282, 283, 283, 284, 285, 286,
+	286, 287, 288, 289, 290, 290, 291, 291, 292, 293, 294, 294, 294, 295, 296, 296, 297, 298, 298, 298, 299, 299, 300, 300, 301, 302, 302, 302, 302, 303, 303, 304,
+	304, 304, 305, 305, 306, 306, 306, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 309, 309, 309, 309, 309, 309, 309, 310, 310, 310, 310, 310, 310, 310, 310,
+	0, 2, 4, 6, 8, 10, 12, 13, 15, 17, 19, 21, 23, 25, 26, 28, 30, 32, 34, 36, 38, 39, 41, 43, 45, 47, 49, 50, 52, 54, 56, 58,
+	60, 61, 63, 65, 67, 69, 71, 72, 74, 76, 78, 80, 81, 83, 85, 87, 89, 90, 92, 94, 96, 97, 99, 101, 103, 105, 106, 108, 110, 111, 113, 115,
+	117, 118, 120, 122, 123, 125, 127, 129, 130, 132, 134, 135, 137, 138, 140, 142, 143, 145, 147, 149, 150, 152, 153, 155, 156, 158, 160, 161, 163, 164, 166, 167,
+	169, 171, 172, 174, 175, 177, 178, 180, 181, 183, 184, 186, 187, 189, 190, 192, 193, 194, 196, 197, 199, 200, 201, 203, 204, 206, 207, 209, 210, 211, 213, 214,
+	215, 216, 218, 219, 220, 221, 223, 224, 225, 226, 227, 229, 230, 231, 232, 234, 235, 236, 237, 238, 239, 241, 242, 243, 244, 245, 246, 247, 248, 249, 251, 251,
+	253, 253, 255, 256, 256, 258, 258, 260, 261, 261, 263, 263, 264, 266, 266, 267, 268, 268, 270, 271, 271, 272, 273, 274, 274, 275, 276, 277, 277, 278, 279, 280,
+	280, 281, 282, 283, 283, 284, 285, 285, 286, 286, 287, 287, 288, 289, 290, 290, 290, 291, 291, 292, 293, 293, 294, 294, 294, 295, 295, 296, 296, 297, 297, 298,
+	298, 298, 298, 298, 299, 299, 299, 300, 300, 300, 301, 301, 301, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 303, 303, 303, 303, 303, 303, 303, 303,
+	0, 2, 4, 6, 8, 10, 11, 13, 15, 17, 19, 20, 22, 24, 26, 28, 30, 31, 33, 35, 37, 39, 40, 42, 44, 46, 48, 49, 51, 53, 55, 57,
+	58, 60, 62, 64, 65, 67, 69, 71, 73, 74, 76, 78, 80, 81, 83, 85, 87, 88, 90, 92, 94, 95, 97, 99, 100, 102, 104, 106, 107, 109, 111, 112,
+	114, 116, 118, 119, 121, 122, 124, 126, 128, 129, 131, 133, 134, 135, 137, 139, 140, 142, 144, 145, 147, 149, 150, 151, 153, 155, 156, 158, 159, 161, 162, 164,
+	166, 167, 168, 170, 172, 173, 174, 176, 177, 179, 180, 182, 183, 185, 186, 188, 189, 190, 192, 193, 194, 196, 197, 199, 200, 201, 202, 204, 205, 206, 208, 209,
+	210, 211, 213, 214, 215, 217, 218, 219, 220, 221, 223, 224, 225, 226, 227, 229, 230, 231, 232, 233, 234, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246,
+	247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 258, 260, 261, 261, 262, 263, 264, 265, 266, 266, 267, 268, 268, 269, 270, 271, 271, 272, 273, 274,
+	274, 275, 276, 277, 277, 278, 279, 279, 280, 280, 281, 281, 282, 283, 283, 283, 284, 285, 285, 286, 286, 286, 287, 287, 288, 289, 289, 290, 290, 290, 290, 291,
+	291, 291, 292, 292, 293, 293, 293, 294, 294, 294, 294, 294, 294, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 297, 297, 297, 297, 297, 297, 297, 297,
+	0, 2, 4, 6, 8, 9, 11, 13, 15, 16, 18, 20, 22, 24, 25, 27, 29, 31, 32, 34, 36, 38, 40, 41, 43, 45, 47, 48, 50, 52, 54, 55,
+	57, 59, 61, 62, 64, 66, 68, 69, 71, 73, 74, 76, 78, 80, 81, 83, 85, 86, 88, 90, 92, 93, 95, 97, 98, 100, 102, 103, 105, 107, 108, 110,
+	112, 113, 115, 117, 118, 120, 121, 123, 125, 126, 128, 130, 131, 133, 134, 136, 137, 139, 141, 142, 144, 145, 147, 148, 150, 151, 153, 154, 156, 157, 159, 160,
+	162, 163, 165, 166, 168, 169, 171, 172, 173, 175, 176, 178, 179, 181, 182, 184, 185, 186, 188, 189, 190, 192, 193, 194, 195, 197, 198, 200, 201, 202, 203, 205,
+	206, 207, 209, 210, 211, 212, 213, 214, 215, 217, 218, 219, 220, 221, 223, 224, 225, 226, 227, 228, 229, 231, 232, 232, 234, 235, 236, 237, 238, 239, 240, 241,
+	242, 243, 244, 245, 245, 247, 247, 249, 249, 250, 251, 252, 253, 254, 255, 256, 256, 257, 258, 259, 260, 261, 261, 262, 263, 263, 264, 265, 266, 266, 267, 268,
+	268, 269, 270, 271, 271, 272, 273, 273, 274, 274, 275, 275, 276, 277, 277, 277, 278, 279, 279, 280, 280, 280, 281, 281, 282, 283, 283, 283, 283, 284, 284, 285,
+	285, 285, 286, 286, 286, 286, 286, 287, 287, 287, 288, 288, 288, 289, 289, 289, 289, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+	0, 2, 4, 6, 7, 9, 11, 13, 14, 16, 18, 20, 21, 23, 25, 27, 28, 30, 32, 33, 35, 37, 39, 40, 42, 44, 46, 47, 49, 51, 52, 54,
+	56, 58, 59, 61, 63, 64, 66, 68, 70, 71, 73, 75, 76, 78, 80, 81, 83, 85, 86, 88, 90, 91, 93, 95, 96, 98, 100, 101, 103, 104, 106, 107,
+	109, 111, 113, 114, 116, 117, 119, 120, 122, 123, 125, 127, 128, 130, 131, 133, 134, 136, 138, 139, 141, 142, 144, 145, 147, 148, 150, 151, 153, 154, 156, 157,
+	159, 160, 161, 163, 164, 166, 167, 168, 170, 171, 172, 174, 175, 177, 178, 180, 181, 182, 184, 185, 186, 188, 189, 190, 191, 193, 194, 195, 196, 198, 199, 200,
+	201, 202, 204, 205, 206, 207, 209, 210, 211, 212, 213, 214, 215, 217, 218, 219, 220, 221, 222, 223, 224, 226, 227, 227, 229, 230, 231, 232, 232, 234, 235, 236,
+	237, 238, 239, 239, 240, 241, 242, 243, 244, 245, 246, 247, 247, 249, 249, 250, 251, 251, 253, 253, 254, 255, 256, 256, 257, 258, 258, 259, 260, 261, 261, 262,
+	263, 263, 264, 265, 266, 266, 267, 267, 268, 268, 269, 269, 270, 271, 271, 271, 272, 273, 273, 274, 274, 274, 275, 275, 276, 277, 277, 277, 277, 278, 278, 279,
+	279, 279, 280, 280, 280, 280, 280, 281, 281, 281, 282, 282, 282, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	0, 2, 4, 5, 7, 9, 11, 12, 14, 16, 17, 19, 21, 23, 24, 26, 28, 29, 31, 33, 34, 36, 38, 39, 41, 43, 45, 46, 48, 50, 51, 53,
+	55, 56, 58, 60, 61, 63, 65, 66, 68, 70, 71, 73, 75, 76, 78, 79, 81, 83, 84, 86, 88, 89, 91, 93, 94, 96, 97, 99, 100, 102, 104, 105,
+	107, 108, 110, 112, 113, 115, 116, 118, 119, 121, 122, 124, 125, 127, 129, 130, 131, 133, 135, 136, 138, 139, 141, 142, 143, 145, 147, 148, 149, 151, 152, 153,
+	155, 156, 158, 159, 161, 162, 163, 165, 166, 167, 169, 170, 172, 173, 174, 176, 177, 178, 180, 181, 182, 184, 185, 186, 187, 189, 190, 191, 192, 193, 195, 196,
+	197, 198, 200, 201, 202, 203, 204, 205, 206, 207, 209, 210, 211, 212, 213, 214, 215, 217, 217, 218, 220, 221, 222, 223, 224, 225, 226, 227, 227, 229, 230, 231,
+	232, 232, 234, 234, 235, 236, 237, 238, 239, 239, 241, 241, 242, 243, 244, 245, 245, 246, 247, 248, 249, 249, 250, 251, 251, 252, 253, 253, 254, 255, 256, 256,
+	257, 258, 258, 259, 260, 261, 261, 261, 262, 263, 263, 263, 264, 265, 266, 266, 266, 267, 267, 268, 268, 268, 269, 269, 270, 271, 271, 271, 271, 272, 272, 273,
+	273, 273, 274, 274, 274, 274, 274, 275, 275, 275, 276, 276, 276, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 278, 278, 278, 278, 278, 278, 278, 278,
+	0, 2, 4, 5, 7, 9, 10, 12, 14, 15, 17, 19, 20, 22, 24, 25, 27, 29, 30, 32, 34, 35, 37, 39, 40, 42, 44, 45, 47, 49, 50, 52,
+	53, 55, 57, 58, 60, 62, 63, 65, 67, 68, 70, 71, 73, 75, 76, 78, 79, 81, 83, 84, 86, 87, 89, 91, 92, 94, 95, 97, 98, 100, 101, 103,
+	105, 106, 108, 109, 111, 112, 114, 115, 117, 118, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135, 136, 138, 139, 140, 142, 143, 145, 146, 147, 149, 150,
+	152, 153, 154, 156, 157, 159, 160, 161, 162, 164, 165, 166, 168, 169, 171, 172, 173, 174, 176, 177, 178, 180, 181, 182, 183, 185, 186, 187, 188, 189, 191, 192,
+	193, 194, 195, 196, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226,
+	227, 227, 229, 229, 230, 231, 232, 233, 234, 234, 236, 236, 237, 238, 239, 239, 240, 241, 242, 243, 243, 244, 245, 245, 246, 247, 247, 248, 249, 249, 250, 251,
+	251, 252, 253, 253, 254, 255, 256, 256, 256, 257, 258, 258, 258, 259, 260, 260, 261, 261, 261, 262, 263, 263, 263, 263, 264, 265, 265, 266, 266, 266, 266, 267,
+	267, 267, 268, 268, 268, 268, 268, 269, 269, 269, 270, 270, 270, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	0, 2, 4, 5, 7, 8, 10, 12, 13, 15, 17, 18, 20, 22, 23, 25, 26, 28, 30, 31, 33, 35, 36, 38, 39, 41, 43, 44, 46, 48, 49, 51,
+	52, 54, 56, 57, 59, 60, 62, 64, 65, 67, 68, 70, 71, 73, 75, 76, 78, 79, 81, 82, 84, 86, 87, 89, 90, 92, 93, 95, 96, 98, 99, 101,
+	102, 104, 105, 107, 108, 110, 111, 113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 128, 129, 130, 132, 133, 135, 136, 137, 139, 140, 141, 143, 144, 146, 147,
+	149, 150, 151, 153, 154, 155, 156, 158, 159, 160, 162, 163, 164, 166, 167, 168, 169, 171, 172, 173, 174, 176, 177, 178, 179, 181, 182, 183, 184, 185, 187, 188,
+	189, 190, 191, 192, 193, 194, 195, 196, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 213, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+	222, 223, 224, 224, 225, 226, 227, 228, 229, 229, 231, 231, 232, 233, 234, 234, 235, 236, 237, 238, 238, 239, 239, 240, 241, 241, 242, 243, 243, 244, 245, 245,
+	246, 247, 247, 248, 249, 249, 250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255, 256, 256, 256, 257, 257, 258, 258, 258, 259, 259, 260, 260, 261, 261, 261,
+	261, 261, 262, 262, 263, 263, 263, 263, 263, 263, 264, 264, 264, 265, 265, 265, 265, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+	0, 2, 4, 5, 7, 8, 10, 12, 13, 15, 16, 18, 19, 21, 23, 24, 26, 27, 29, 31, 32, 34, 35, 37, 39, 40, 42, 43, 45, 47, 48, 50,
+	51, 53, 54, 56, 57, 59, 61, 62, 64, 65, 67, 68, 70, 71, 73, 74, 76, 78, 79, 81, 82, 84, 85, 87, 88, 90, 91, 93, 94, 96, 97, 99,
+	100, 101, 103, 105, 106, 107, 109, 110, 112, 113, 115, 116, 118, 119, 120, 122, 123, 125, 126, 128, 129, 130, 132, 133, 134, 136, 137, 138, 140, 141, 143, 144,
+	145, 147, 148, 149, 151, 152, 153, 154, 156, 157, 158, 159, 161, 162, 163, 165, 166, 167, 168, 169, 171, 172, 173, 174, 175, 177, 178, 179, 180, 181, 183, 184,
+	185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 198, 199, 200, 201, 202, 203, 203, 205, 206, 207, 208, 209, 210, 211, 211, 213, 213, 214, 215, 216,
+	217, 218, 219, 220, 220, 221, 222, 223, 224, 224, 226, 226, 227, 228, 229, 229, 230, 231, 232, 232, 233, 234, 234, 235, 236, 236, 237, 238, 238, 239, 239, 240,
+	241, 241, 242, 243, 243, 244, 245, 245, 245, 246, 247, 247, 247, 248, 249, 249, 249, 250, 250, 251, 251, 251, 252, 252, 253, 253, 253, 254, 254, 255, 255, 256,
+	256, 256, 256, 256, 257, 257, 257, 258, 258, 258, 258, 258, 258, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 261, 261, 261, 261, 261, 261, 261, 261,
+	0, 2, 3, 5, 7, 8, 10, 11, 13, 14, 16, 18, 19, 21, 22, 24, 25, 27, 28, 30, 32, 33, 35, 36, 38, 39, 41, 42, 44, 46, 47, 49,
+	50, 52, 53, 55, 56, 58, 59, 61, 62, 64, 65, 67, 68, 70, 71, 73, 74, 76, 77, 79, 80, 82, 83, 85, 86, 88, 89, 91, 92, 94, 95, 96,
+	98, 99, 101, 102, 104, 105, 107, 108, 110, 111, 112, 114, 115, 116, 118, 119, 120, 122, 123, 125, 126, 128, 129, 130, 131, 133, 134, 135, 137, 138, 140, 141,
+	142, 143, 145, 146, 147, 149, 150, 151, 152, 153, 155, 156, 157, 159, 160, 161, 162, 163, 165, 166, 167, 168, 169, 171, 172, 173, 174, 175, 176, 177, 179, 180,
+	181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 198, 199, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 211,
+	213, 213, 214, 215, 215, 217, 217, 218, 219, 220, 221, 221, 222, 223, 224, 224, 225, 226, 227, 227, 228, 229, 229, 230, 231, 231, 232, 232, 233, 234, 234, 235,
+	236, 236, 237, 238, 238, 239, 239, 239, 240, 241, 241, 241, 242, 243, 243, 243, 244, 245, 245, 245, 246, 246, 247, 247, 247, 248, 248, 249, 249, 249, 249, 250,
+	250, 250, 251, 251, 251, 251, 251, 252, 252, 252, 253, 253, 253, 253, 253, 253, 253, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
+	0, 2, 3, 5, 6, 8, 9, 11, 13, 14, 16, 17, 19, 20, 22, 23, 25, 26, 28, 29, 31, 32, 34, 35, 37, 38, 40, 41, 43, 45, 46, 48,
+	49, 50, 52, 53, 55, 56, 58, 59, 61, 62, 64, 65, 67, 68, 70, 71, 73, 74, 76, 77, 79, 80, 82, 83, 84, 86, 87, 89, 90, 92, 93, 94,
+	96, 97, 99, 100, 101, 103, 104, 106, 107, 108, 110, 111, 113, 114, 115, 117, 118, 119, 121, 122, 123, 125, 126, 127, 129, 130, 131, 133, 134, 135, 137, 138,
+	139, 140, 141, 143, 144, 145, 147, 148, 149, 150, 151, 153, 154, 155, 156, 158, 159, 160, 161, 162, 163, 165, 166, 167, 168, 169, 170, 172, 172, 173, 175, 176,
+	177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 202, 203, 204, 205, 206, 207,
+	208, 209, 210, 210, 211, 212, 213, 214, 214, 215, 216, 217, 217, 218, 219, 220, 220, 221, 222, 223, 223, 224, 224, 225, 226, 226, 227, 227, 228, 229, 229, 230,
+	231, 231, 232, 232, 233, 234, 234, 234, 235, 236, 236, 236, 237, 238, 238, 238, 239, 239, 239, 240, 241, 241, 241, 241, 242, 243, 243, 243, 243, 244, 244, 245,
+	245, 245, 245, 245, 246, 246, 246, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+	0, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18, 20, 21, 23, 24, 26, 27, 29, 30, 32, 33, 35, 36, 38, 39, 41, 42, 44, 45, 47,
+	48, 49, 51, 52, 54, 55, 57, 58, 60, 61, 62, 64, 65, 67, 68, 70, 71, 73, 74, 75, 77, 78, 80, 81, 83, 84, 86, 87, 88, 90, 91, 92,
+	94, 95, 97, 98, 99, 101, 102, 103, 105, 106, 107, 109, 110, 111, 113, 114, 115, 117, 118, 119, 121, 122, 123, 124, 126, 127, 129, 130, 131, 132, 134, 135,
+	136, 137, 138, 140, 141, 142, 143, 145, 146, 147, 148, 149, 151, 152, 153, 154, 155, 156, 158, 159, 160, 161, 162, 163, 164, 166, 166, 168, 169, 170, 171, 172,
+	173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 195, 196, 198, 198, 199, 200, 201, 202, 202,
+	203, 204, 205, 206, 206, 207, 208, 209, 210, 210, 211, 212, 213, 214, 214, 215, 215, 216, 217, 218, 218, 219, 220, 220, 221, 221, 222, 223, 223, 224, 224, 225,
+	226, 226, 227, 227, 228, 229, 229, 229, 230, 231, 231, 231, 232, 232, 233, 233, 234, 234, 234, 235, 236, 236, 236, 236, 237, 238, 238, 238, 238, 239, 239, 239,
+	239, 239, 240, 240, 241, 241, 241, 241, 241, 241, 242, 242, 242, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	0, 2, 3, 5, 6, 8, 9, 11, 12, 13, 15, 16, 18, 19, 21, 22, 24, 25, 27, 28, 29, 31, 32, 34, 35, 37, 38, 40, 41, 43, 44, 46,
+	47, 48, 50, 51, 53, 54, 56, 57, 58, 60, 61, 63, 64, 65, 67, 68, 70, 71, 72, 74, 75, 77, 78, 79, 81, 82, 84, 85, 86, 88, 89, 90,
+	92, 93, 95, 96, 97, 99, 100, 101, 103, 104, 105, 107, 108, 109, 110, 112, 113, 114, 116, 117, 118, 119, 121, 122, 123, 124, 126, 127, 128, 129, 131, 132,
+	133, 134, 135, 137, 138, 139, 140, 141, 143, 144, 145, 146, 147, 149, 150, 151, 152, 153, 154, 155, 156, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168,
+	169, 170, 172, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 191, 192, 193, 194, 195, 195, 196, 198, 198,
+	199, 200, 201, 201, 202, 203, 203, 205, 205, 206, 207, 207, 208, 209, 210, 210, 211, 211, 213, 213, 214, 214, 215, 215, 216, 217, 217, 218, 218, 219, 220, 220,
+	221, 221, 222, 223, 223, 224, 224, 224, 225, 226, 226, 226, 227, 227, 228, 228, 229, 229, 229, 230, 231, 231, 231, 231, 232, 232, 232, 233, 233, 234, 234, 234,
+	234, 234, 235, 235, 236, 236, 236, 236, 236, 236, 237, 237, 237, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 239, 239, 239, 239, 239, 239, 239, 239,
+	0, 2, 3, 5, 6, 7, 9, 10, 12, 13, 15, 16, 17, 19, 20, 22, 23, 25, 26, 27, 29, 30, 32, 33, 35, 36, 37, 39, 40, 42, 43, 45,
+	46, 47, 49, 50, 51, 53, 54, 56, 57, 59, 60, 61, 63, 64, 65, 67, 68, 70, 71, 72, 74, 75, 76, 78, 79, 81, 82, 83, 84, 86, 87, 88,
+	90, 91, 93, 94, 95, 96, 98, 99, 100, 101, 103, 104, 105, 107, 108, 109, 110, 112, 113, 114, 116, 117, 118, 119, 120, 122, 123, 124, 125, 126, 128, 129,
+	130, 131, 133, 134, 135, 136, 137, 138, 140, 141, 142, 143, 144, 145, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 159, 159, 161, 162, 162, 164, 165,
+	166, 166, 168, 169, 170, 171, 172, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 187, 188, 189, 190, 191, 191, 192, 193, 194,
+	195, 195, 196, 197, 198, 199, 199, 200, 201, 201, 202, 203, 203, 205, 205, 206, 206, 207, 208, 209, 209, 210, 210, 211, 211, 212, 213, 213, 214, 214, 215, 215,
+	216, 217, 217, 218, 218, 219, 220, 220, 220, 221, 221, 221, 222, 223, 223, 223, 224, 224, 224, 225, 226, 226, 226, 226, 227, 227, 227, 228, 228, 229, 229, 229,
+	229, 229, 230, 230, 231, 231, 231, 231, 231, 231, 232, 232, 232, 232, 232, 232, 232, 233, 233, 233, 233, 233, 233, 233, 234, 234, 234, 234, 234, 234, 234, 234,
+	0, 2, 3, 4, 6, 7, 9, 10, 11, 13, 14, 16, 17, 18, 20, 21, 23, 24, 25, 27, 28, 30, 31, 32, 34, 35, 37, 38, 39, 41, 42, 44,
+	45, 46, 48, 49, 50, 52, 53, 55, 56, 57, 59, 60, 61, 63, 64, 65, 67, 68, 69, 71, 72, 73, 75, 76, 77, 79, 80, 81, 83, 84, 85, 86,
+	88, 89, 91, 92, 93, 94, 96, 97, 98, 99, 101, 102, 103, 104, 106, 107, 108, 110, 111, 112, 113, 114, 116, 117, 118, 119, 120, 121, 123, 124, 125, 126,
+	128, 129, 130, 131, 132, 133, 134, 135, 137, 138, 139, 140, 141, 142, 143, 145, 145, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+	162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 183, 184, 185, 186, 187, 187, 188, 189, 190,
+	191, 191, 192, 193, 193, 194, 195, 196, 196, 197, 198, 199, 199, 200, 201, 201, 202, 202, 203, 204, 205, 205, 206, 206, 207, 207, 208, 209, 209, 210, 210, 211,
+	211, 212, 213, 213, 214, 214, 215, 215, 215, 216, 217, 217, 217, 218, 218, 218, 219, 220, 220, 220, 221, 221, 221, 221, 222, 223, 223, 223, 223, 224, 224, 224,
+	224, 224, 225, 225, 226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 228, 228, 228, 228, 228, 228, 228, 229, 229, 229, 229, 229, 229, 229, 229,
+	0, 2, 3, 4, 6, 7, 8, 10, 11, 13, 14, 15, 17, 18, 19, 21, 22, 24, 25, 26, 28, 29, 30, 32, 33, 34, 36, 37, 39, 40, 41, 43,
+	44, 45, 47, 48, 49, 51, 52, 53, 55, 56, 57, 59, 60, 61, 63, 64, 65, 67, 68, 69, 70, 72, 73, 74, 76, 77, 78, 80, 81, 82, 83, 85,
+	86, 87, 89, 90, 91, 92, 94, 95, 96, 97, 99, 100, 101, 102, 103, 105, 106, 107, 108, 110, 111, 112, 113, 114, 115, 117, 118, 119, 120, 121, 122, 123,
+	125, 126, 127, 128, 129, 130, 131, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 145, 145, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+	159, 159, 161, 162, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 172, 173, 174, 175, 176, 177, 178, 179, 179, 180, 181, 182, 183, 183, 184, 185, 186,
+	187, 187, 188, 189, 189, 190, 191, 192, 192, 193, 194, 194, 195, 196, 196, 197, 198, 198, 199, 200, 200, 201, 201, 202, 202, 203, 203, 204, 205, 205, 206, 206,
+	207, 207, 208, 209, 209, 210, 210, 210, 211, 211, 212, 212, 213, 213, 214, 214, 214, 215, 215, 215, 216, 216, 217, 217, 217, 218, 218, 218, 218, 219, 219, 220,
+	220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 222, 222, 222, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 224, 224, 224,
+	0, 2, 3, 4, 6, 7, 8, 10, 11, 12, 14, 15, 16, 18, 19, 20, 22, 23, 24, 26, 27, 28, 30, 31, 32, 34, 35, 36, 38, 39, 40, 42,
+	43, 44, 46, 47, 48, 50, 51, 52, 53, 55, 56, 57, 59, 60, 61, 62, 64, 65, 66, 68, 69, 70, 72, 73, 74, 75, 77, 78, 79, 80, 82, 83,
+	84, 85, 87, 88, 89, 90, 92, 93, 94, 95, 96, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 110, 111, 112, 113, 114, 115, 116, 118, 119, 120, 121,
+	122, 123, 124, 125, 126, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 145, 145, 147, 147, 149, 149, 151, 151, 152, 153, 154,
+	155, 156, 157, 158, 159, 160, 161, 162, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 171, 172, 173, 174, 175, 175, 176, 177, 178, 179, 179, 180, 181, 182,
+	183, 183, 184, 185, 185, 186, 187, 188, 188, 189, 190, 190, 191, 192, 192, 193, 193, 194, 195, 195, 196, 196, 197, 198, 198, 199, 199, 200, 200, 201, 201, 202,
+	202, 203, 203, 204, 205, 205, 206, 206, 206, 207, 207, 207, 208, 209, 209, 209, 210, 210, 210, 211, 211, 211, 212, 212, 213, 213, 213, 214, 214, 214, 214, 215,
+	215, 215, 215, 215, 216, 216, 216, 217, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 219, 219, 219, 219, 219, 219, 219, 219,
+	0, 1, 3, 4, 5, 7, 8, 9, 11, 12, 13, 15, 16, 17, 19, 20, 21, 23, 24, 25, 26, 28, 29, 30, 32, 33, 34, 36, 37, 38, 39, 41,
+	42, 43, 45, 46, 47, 48, 50, 51, 52, 54, 55, 56, 57, 59, 60, 61, 62, 64, 65, 66, 67, 69, 70, 71, 72, 74, 75, 76, 77, 79, 80, 81,
+	82, 83, 85, 86, 87, 88, 90, 91, 92, 93, 94, 96, 97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 112, 113, 114, 115, 116, 117, 118,
+	119, 120, 121, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+	152, 153, 154, 155, 156, 156, 157, 158, 159, 160, 161, 162, 162, 163, 164, 165, 166, 167, 167, 168, 169, 170, 171, 172, 172, 173, 174, 175, 175, 176, 177, 178,
+	179, 179, 180, 181, 181, 182, 183, 184, 184, 185, 186, 186, 187, 188, 188, 189, 189, 190, 191, 191, 192, 192, 193, 193, 194, 194, 195, 195, 196, 196, 197, 198,
+	198, 199, 199, 200, 200, 201, 201, 201, 202, 202, 203, 203, 203, 204, 205, 205, 205, 206, 206, 206, 207, 207, 207, 207, 208, 209, 209, 209, 209, 210, 210, 210,
+	210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 213, 213, 213, 213, 213, 213, 213, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+	0, 1, 3, 4, 5, 7, 8, 9, 10, 12, 13, 14, 16, 17, 18, 19, 21, 22, 23, 25, 26, 27, 28, 30, 31, 32, 34, 35, 36, 37, 39, 40,
+	41, 42, 44, 45, 46, 47, 49, 50, 51, 52, 54, 55, 56, 57, 59, 60, 61, 62, 64, 65, 66, 67, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79,
+	81, 82, 83, 84, 85, 86, 88, 89, 90, 91, 92, 94, 95, 96, 97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 113, 113, 115, 116,
+	117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 133, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+	149, 149, 151, 151, 152, 153, 154, 155, 156, 156, 157, 158, 159, 160, 161, 162, 162, 163, 164, 165, 166, 166, 167, 168, 169, 170, 170, 171, 172, 172, 173, 174,
+	175, 175, 176, 177, 177, 178, 179, 180, 180, 181, 182, 182, 183, 184, 184, 185, 185, 186, 187, 187, 188, 188, 189, 189, 190, 190, 191, 191, 192, 192, 193, 193,
+	194, 194, 195, 195, 196, 196, 197, 197, 198, 198, 199, 199, 199, 200, 200, 200, 201, 201, 201, 202, 202, 202, 203, 203, 203, 204, 204, 205, 205, 205, 205, 206,
+	206, 206, 206, 206, 207, 207, 207, 207, 207, 207, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210, 210, 210, 210, 210, 210, 210,
+	0, 1, 3, 4, 5, 6, 8, 9, 10, 11, 13, 14, 15, 17, 18, 19, 20, 22, 23, 24, 25, 27, 28, 29, 30, 32, 33, 34, 35, 37, 38, 39,
+	40, 41, 43, 44, 45, 46, 48, 49, 50, 51, 52, 54, 55, 56, 57, 59, 60, 61, 62, 63, 65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 78,
+	79, 80, 81, 82, 83, 85, 86, 87, 88, 89, 90, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+	114, 115, 116, 118, 119, 119, 120, 121, 122, 123, 124, 125, 126, 128, 129, 130, 130, 131, 133, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+	145, 146, 147, 148, 149, 150, 151, 151, 152, 153, 154, 155, 156, 156, 157, 158, 159, 160, 160, 161, 162, 163, 164, 164, 165, 166, 166, 167, 168, 169, 170, 170,
+	171, 172, 172, 173, 173, 174, 175, 176, 176, 177, 178, 178, 179, 180, 180, 181, 181, 182, 183, 183, 184, 184, 185, 185, 186, 186, 187, 187, 188, 188, 189, 189,
+	190, 190, 191, 191, 192, 192, 193, 193, 193, 194, 194, 194, 195, 195, 196, 196, 196, 197, 197, 198, 198, 198, 199, 199, 199, 200, 200, 200, 200, 201, 201, 201,
+	201, 201, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 204, 204, 204, 204, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205, 205,
+	0, 1, 3, 4, 5, 6, 8, 9, 10, 11, 12, 14, 15, 16, 17, 19, 20, 21, 22, 24, 25, 26, 27, 28, 30, 31, 32, 33, 35, 36, 37, 38,
+	39, 41, 42, 43, 44, 45, 47, 48, 49, 50, 51, 53, 54, 55, 56, 57, 59, 60, 61, 62, 63, 64, 66, 67, 68, 69, 70, 71, 72, 74, 75, 76,
+	77, 78, 79, 81, 82, 83, 84, 85, 86, 87, 88, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111,
+	112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 130, 131, 133, 133, 134, 135, 136, 137, 138, 139, 140, 141, 141,
+	142, 143, 144, 145, 146, 147, 147, 148, 149, 150, 151, 151, 152, 153, 154, 155, 156, 156, 157, 158, 159, 159, 160, 161, 162, 162, 163, 164, 164, 165, 166, 166,
+	167, 168, 169, 169, 170, 171, 171, 172, 172, 173, 174, 174, 175, 176, 176, 177, 177, 178, 179, 179, 180, 180, 181, 181, 182, 182, 183, 183, 184, 184, 185, 185,
+	186, 186, 187, 187, 188, 188, 189, 189, 189, 190, 190, 190, 191, 191, 192, 192, 192, 193, 193, 193, 194, 194, 194, 194, 195, 195, 195, 196, 196, 196, 196, 197,
+	197, 197, 198, 198, 198, 198, 198, 199, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 201, 201, 201, 201, 201, 201, 201, 201,
+	0, 1, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 15, 16, 17, 18, 19, 21, 22, 23, 24, 25, 27, 28, 29, 30, 31, 33, 34, 35, 36, 37,
+	39, 40, 41, 42, 43, 44, 46, 47, 48, 49, 50, 51, 53, 54, 55, 56, 57, 58, 59, 61, 62, 63, 64, 65, 66, 68, 69, 70, 71, 72, 73, 74,
+	75, 76, 78, 79, 80, 81, 82, 83, 84, 85, 86, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+	110, 110, 111, 113, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 130, 131, 132, 133, 134, 135, 136, 137, 138, 138,
+	139, 140, 141, 142, 143, 143, 144, 145, 146, 147, 147, 148, 149, 150, 151, 151, 152, 153, 153, 154, 155, 156, 157, 157, 158, 159, 159, 160, 161, 162, 162, 163,
+	164, 164, 165, 166, 166, 167, 167, 168, 169, 169, 170, 171, 171, 172, 172, 173, 173, 174, 175, 175, 176, 176, 177, 177, 178, 178, 179, 179, 180, 180, 181, 181,
+	182, 182, 183, 183, 184, 184, 185, 185, 185, 186, 186, 186, 187, 187, 188, 188, 188, 189, 189, 189, 190, 190, 190, 190, 191, 191, 191, 192, 192, 192, 192, 193,
+	193, 193, 193, 193, 194, 194, 194, 194, 194, 194, 195, 195, 195, 195, 195, 195, 195, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+	0, 1, 2, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 28, 29, 31, 32, 33, 34, 35, 37,
+	38, 39, 40, 41, 42, 43, 45, 46, 47, 48, 49, 50, 51, 53, 54, 55, 56, 57, 58, 59, 60, 62, 63, 64, 65, 66, 67, 68, 69, 70, 72, 73,
+	74, 75, 76, 77, 78, 79, 80, 81, 83, 83, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+	107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 129, 130, 131, 132, 133, 134, 135, 135,
+	136, 137, 138, 139, 140, 140, 141, 142, 143, 143, 144, 145, 146, 147, 147, 148, 149, 150, 150, 151, 152, 153, 153, 154, 155, 156, 156, 157, 157, 158, 159, 159,
+	160, 161, 162, 162, 162, 163, 164, 165, 165, 166, 166, 167, 167, 168, 169, 169, 170, 170, 171, 172, 172, 172, 173, 173, 174, 174, 175, 175, 176, 176, 177, 177,
+	178, 178, 179, 179, 180, 180, 181, 181, 181, 182, 182, 182, 183, 183, 184, 184, 184, 185, 185, 185, 186, 186, 186, 186, 187, 187, 187, 188, 188, 188, 188, 189,
+	189, 189, 189, 189, 190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+	0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22, 23, 24, 25, 27, 28, 29, 30, 31, 32, 33, 35, 36,
+	37, 38, 39, 40, 41, 43, 44, 45, 46, 47, 48, 49, 50, 51, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 64, 65, 66, 67, 68, 69, 70, 71,
+	72, 73, 74, 75, 76, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 119, 120, 121, 122, 123, 124, 125, 126, 126, 128, 128, 129, 130, 131, 132, 133,
+	133, 134, 135, 136, 137, 137, 138, 139, 140, 140, 141, 142, 143, 143, 144, 145, 146, 147, 147, 148, 149, 149, 150, 151, 151, 152, 153, 153, 154, 155, 156, 156,
+	157, 157, 158, 159, 159, 160, 160, 161, 162, 162, 163, 163, 164, 165, 165, 166, 166, 166, 167, 168, 168, 169, 169, 170, 170, 171, 171, 172, 172, 172, 173, 173,
+	174, 174, 175, 175, 176, 176, 177, 177, 177, 178, 178, 178, 179, 179, 180, 180, 180, 181, 181, 181, 182, 182, 182, 182, 183, 183, 183, 184, 184, 184, 184, 185,
+	185, 185, 185, 185, 186, 186, 186, 186, 186, 186, 187, 187, 187, 187, 187, 187, 187, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+	0, 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 13, 14, 15, 16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 27, 28, 29, 30, 32, 33, 34, 35,
+	36, 37, 38, 39, 40, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 69, 70,
+	71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 101,
+	103, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 113, 114, 115, 116, 117, 118, 119, 119, 120, 121, 122, 123, 124, 125, 125, 126, 127, 128, 129, 130,
+	130, 131, 132, 133, 134, 134, 135, 136, 137, 137, 138, 139, 140, 140, 141, 142, 143, 143, 144, 145, 145, 146, 147, 147, 148, 149, 149, 150, 151, 151, 152, 153,
+	153, 154, 155, 155, 156, 156, 157, 158, 158, 159, 159, 160, 160, 161, 162, 162, 162, 163, 164, 164, 165, 165, 166, 166, 166, 167, 167, 168, 168, 169, 169, 170,
+	170, 171, 171, 172, 172, 172, 173, 173, 173, 174, 174, 174, 175, 175, 176, 176, 176, 177, 177, 177, 178, 178, 178, 178, 179, 179, 179, 180, 180, 180, 180, 181,
+	181, 181, 181, 181, 182, 182, 182, 182, 182, 182, 183, 183, 183, 183, 183, 183, 183, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+	0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 27, 28, 29, 30, 31, 32, 33, 34,
+	35, 36, 37, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68,
+	69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 97, 99, 99,
+	100, 101, 102, 103, 104, 105, 106, 107, 107, 108, 109, 110, 111, 112, 113, 114, 114, 115, 116, 117, 118, 119, 119, 120, 121, 122, 123, 124, 124, 125, 126, 127,
+	128, 128, 129, 130, 131, 131, 132, 133, 134, 134, 135, 136, 137, 137, 138, 139, 140, 140, 141, 141, 142, 143, 144, 144, 145, 146, 146, 147, 147, 148, 149, 149,
+	150, 151, 151, 152, 152, 153, 153, 154, 155, 155, 156, 156, 157, 158, 158, 159, 159, 159, 160, 161, 161, 162, 162, 162, 163, 163, 164, 164, 165, 165, 166, 166,
+	166, 167, 167, 168, 168, 169, 169, 169, 170, 170, 171, 171, 171, 172, 172, 172, 172, 173, 173, 173, 174, 174, 174, 174, 175, 175, 175, 176, 176, 176, 176, 177,
+	177, 177, 177, 177, 178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+	0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+	35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 58, 59, 59, 61, 62, 63, 64, 65, 66, 67,
+	68, 69, 70, 71, 72, 73, 74, 75, 76, 76, 78, 79, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 95, 96, 97,
+	98, 99, 100, 101, 102, 103, 103, 104, 105, 106, 107, 108, 109, 110, 110, 111, 112, 113, 114, 114, 115, 116, 117, 118, 119, 119, 120, 121, 122, 122, 123, 124,
+	125, 125, 126, 127, 128, 129, 129, 130, 131, 131, 132, 133, 134, 134, 135, 136, 137, 137, 138, 138, 139, 140, 141, 141, 142, 143, 143, 144, 144, 145, 146, 146,
+	147, 147, 148, 149, 149, 150, 150, 151, 151, 152, 153, 153, 153, 154, 155, 155, 156, 156, 157, 157, 158, 158, 159, 159, 159, 160, 160, 161, 161, 162, 162, 162,
+	163, 163, 164, 164, 165, 165, 166, 166, 166, 166, 167, 167, 167, 168, 168, 168, 169, 169, 169, 170, 170, 170, 171, 171, 171, 172, 172, 172, 172, 172, 172, 173,
+	173, 173, 173, 173, 174, 174, 174, 174, 174, 174, 175, 175, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+	0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 32, 33,
+	34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+	66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 81, 83, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 93, 94, 95,
+	96, 97, 98, 99, 100, 100, 101, 102, 103, 104, 105, 105, 106, 107, 108, 109, 110, 110, 111, 112, 113, 114, 114, 115, 116, 117, 118, 119, 119, 120, 121, 121,
+	122, 123, 124, 124, 125, 126, 126, 127, 128, 129, 129, 130, 131, 131, 132, 133, 134, 134, 135, 135, 136, 137, 138, 138, 139, 140, 140, 141, 141, 142, 143, 143,
+	144, 144, 145, 145, 146, 147, 147, 148, 148, 149, 149, 150, 150, 151, 151, 152, 152, 153, 153, 154, 154, 155, 155, 156, 156, 156, 157, 157, 158, 158, 159, 159,
+	159, 160, 160, 161, 161, 162, 162, 162, 162, 163, 163, 163, 164, 164, 165, 165, 165, 166, 166, 166, 166, 166, 167, 167, 167, 168, 168, 168, 168, 169, 169, 169,
+	169, 169, 170, 170, 170, 170, 170, 171, 171, 171, 171, 171, 171, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+	33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 69, 70, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 83, 84, 85, 86, 87, 88, 89, 90, 91, 91, 92, 93,
+	94, 95, 96, 97, 97, 98, 99, 100, 101, 101, 102, 103, 104, 105, 106, 107, 107, 108, 109, 110, 110, 111, 112, 113, 113, 114, 115, 116, 117, 117, 118, 119,
+	119, 120, 121, 122, 122, 123, 124, 124, 125, 126, 126, 127, 128, 129, 129, 130, 131, 131, 132, 133, 133, 134, 135, 135, 136, 137, 137, 138, 138, 139, 140, 140,
+	141, 141, 142, 142, 143, 143, 144, 145, 145, 145, 146, 147, 147, 148, 148, 149, 149, 149, 150, 151, 151, 151, 152, 152, 153, 153, 153, 154, 154, 155, 155, 156,
+	156, 156, 157, 157, 158, 158, 159, 159, 159, 159, 160, 160, 160, 161, 161, 161, 162, 162, 162, 162, 163, 163, 163, 163, 164, 164, 164, 165, 165, 165, 165, 166,
+	166, 166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 169, 169, 169, 169, 169, 169, 169, 169,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 59, 60, 61, 62,
+	63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 83, 84, 85, 86, 87, 88, 89, 89, 90, 91,
+	92, 93, 94, 95, 95, 96, 97, 98, 99, 99, 100, 101, 102, 103, 103, 104, 105, 106, 107, 107, 108, 109, 110, 110, 111, 112, 113, 113, 114, 115, 116, 116,
+	117, 118, 119, 119, 120, 120, 121, 122, 122, 123, 124, 124, 125, 126, 126, 127, 128, 129, 129, 130, 130, 131, 132, 132, 133, 134, 134, 135, 135, 136, 137, 137,
+	138, 138, 139, 139, 140, 140, 141, 141, 142, 142, 143, 143, 144, 145, 145, 145, 146, 146, 147, 147, 148, 148, 149, 149, 149, 150, 150, 151, 151, 151, 152, 152,
+	153, 153, 153, 154, 154, 155, 155, 155, 156, 156, 156, 156, 157, 157, 158, 158, 158, 159, 159, 159, 159, 159, 160, 160, 160, 161, 161, 161, 161, 162, 162, 162,
+	162, 162, 162, 162, 163, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 164, 164, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 56, 57, 58, 59, 60, 61,
+	62, 63, 64, 65, 66, 67, 67, 68, 69, 70, 71, 72, 73, 74, 75, 75, 76, 77, 78, 79, 80, 81, 82, 82, 83, 84, 85, 86, 87, 87, 88, 89,
+	90, 91, 92, 93, 93, 94, 95, 96, 96, 97, 98, 99, 100, 100, 101, 102, 103, 103, 104, 105, 106, 107, 107, 108, 109, 110, 110, 111, 112, 112, 113, 114,
+	114, 115, 116, 117, 117, 118, 119, 119, 120, 120, 121, 122, 122, 123, 124, 124, 125, 126, 126, 127, 128, 128, 129, 129, 130, 131, 131, 132, 132, 133, 134, 134,
+	135, 135, 136, 136, 137, 137, 138, 138, 139, 139, 140, 140, 141, 141, 142, 142, 143, 143, 144, 144, 145, 145, 145, 146, 146, 147, 147, 147, 148, 148, 149, 149,
+	149, 150, 150, 151, 151, 151, 152, 152, 152, 153, 153, 153, 153, 154, 154, 154, 155, 155, 155, 156, 156, 156, 156, 156, 157, 157, 157, 158, 158, 158, 158, 159,
+	159, 159, 159, 159, 159, 159, 159, 160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162, 162, 162, 162, 162, 162, 162,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+	31, 32, 33, 34, 35, 36, 37, 38, 39, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 52, 53, 54, 55, 56, 57, 58, 59, 60,
+	61, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 70, 71, 72, 73, 74, 75, 76, 76, 77, 78, 79, 80, 81, 81, 82, 83, 84, 85, 86, 86, 87,
+	88, 89, 90, 91, 91, 92, 93, 94, 94, 95, 96, 97, 97, 98, 99, 100, 100, 101, 102, 103, 103, 104, 105, 106, 106, 107, 108, 109, 109, 110, 111, 111,
+	112, 113, 113, 114, 115, 115, 116, 117, 117, 118, 119, 119, 120, 120, 121, 122, 122, 123, 123, 124, 125, 125, 126, 126, 127, 128, 128, 129, 129, 130, 131, 131,
+	132, 132, 133, 133, 134, 134, 135, 135, 136, 136, 137, 137, 138, 138, 139, 139, 140, 140, 141, 141, 141, 142, 142, 143, 143, 143, 144, 144, 145, 145, 145, 146,
+	146, 147, 147, 147, 148, 148, 149, 149, 149, 149, 150, 150, 150, 151, 151, 151, 151, 152, 152, 152, 153, 153, 153, 153, 153, 154, 154, 154, 154, 155, 155, 155,
+	155, 155, 156, 156, 156, 156, 156, 156, 156, 156, 157, 157, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 27, 28, 29,
+	30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 50, 51, 52, 53, 54, 55, 56, 57, 58, 58,
+	59, 60, 61, 62, 63, 64, 65, 65, 66, 67, 68, 69, 70, 70, 71, 72, 73, 74, 75, 76, 76, 77, 78, 79, 80, 81, 81, 82, 83, 84, 85, 85,
+	86, 87, 88, 89, 89, 90, 91, 92, 92, 93, 94, 95, 95, 96, 97, 98, 98, 99, 100, 100, 101, 102, 103, 103, 104, 105, 105, 106, 107, 107, 108, 109,
+	110, 110, 111, 112, 112, 113, 113, 114, 115, 115, 116, 117, 117, 118, 119, 119, 120, 120, 121, 121, 122, 123, 123, 124, 124, 125, 125, 126, 126, 127, 128, 128,
+	129, 129, 130, 130, 131, 131, 132, 133, 133, 133, 134, 134, 135, 135, 136, 136, 137, 137, 138, 138, 138, 139, 139, 140, 140, 140, 141, 141, 141, 142, 142, 143,
+	143, 143, 144, 144, 145, 145, 145, 145, 146, 146, 147, 147, 147, 147, 148, 148, 148, 149, 149, 149, 149, 149, 150, 150, 150, 151, 151, 151, 151, 151, 151, 152,
+	152, 152, 152, 152, 153, 153, 153, 153, 153, 153, 153, 153, 153, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155,
+	0, 1, 2, 3, 4, 5, 6, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+	30, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 40, 41, 42, 43, 44, 45, 46, 47, 48, 48, 49, 50, 51, 52, 53, 54, 55, 55, 56, 57,
+	58, 59, 60, 61, 61, 62, 63, 64, 65, 66, 67, 67, 68, 69, 70, 71, 71, 72, 73, 74, 75, 76, 76, 77, 78, 79, 80, 80, 81, 82, 83, 83,
+	84, 85, 86, 87, 87, 88, 89, 90, 90, 91, 92, 93, 93, 94, 95, 96, 96, 97, 98, 98, 99, 100, 100, 101, 102, 103, 103, 104, 105, 105, 106, 107,
+	107, 108, 109, 109, 110, 110, 111, 112, 112, 113, 113, 114, 115, 115, 116, 117, 117, 118, 118, 119, 119, 120, 121, 121, 122, 122, 123, 123, 124, 124, 125, 125,
+	126, 126, 127, 128, 128, 129, 129, 130, 130, 130, 131, 131, 132, 133, 133, 133, 134, 134, 135, 135, 135, 136, 136, 137, 137, 137, 138, 138, 138, 139, 139, 140,
+	140, 140, 141, 141, 141, 142, 142, 142, 143, 143, 143, 143, 144, 144, 145, 145, 145, 145, 145, 146, 146, 146, 147, 147, 147, 147, 147, 148, 148, 148, 148, 149,
+	149, 149, 149, 149, 149, 149, 149, 150, 150, 150, 150, 150, 150, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+	0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 24, 25, 26, 27, 28,
+	29, 30, 31, 32, 32, 33, 34, 35, 36, 37, 38, 39, 40, 40, 41, 42, 43, 44, 45, 46, 47, 47, 48, 49, 50, 51, 52, 53, 53, 54, 55, 56,
+	57, 58, 59, 59, 60, 61, 62, 63, 64, 64, 65, 66, 67, 67, 68, 69, 70, 71, 72, 72, 73, 74, 75, 75, 76, 77, 78, 79, 79, 80, 81, 82,
+	83, 83, 84, 85, 86, 86, 87, 88, 88, 89, 90, 91, 91, 92, 93, 94, 94, 95, 96, 96, 97, 98, 98, 99, 100, 100, 101, 102, 102, 103, 104, 104,
+	105, 105, 106, 107, 107, 108, 109, 109, 110, 110, 111, 112, 112, 113, 113, 114, 115, 115, 116, 116, 117, 118, 118, 119, 119, 120, 120, 121, 121, 122, 122, 123,
+	123, 124, 124, 125, 125, 126, 126, 127, 127, 128, 128, 129, 129, 130, 130, 130, 131, 131, 132, 132, 133, 133, 133, 134, 134, 134, 135, 135, 135, 136, 136, 137,
+	137, 137, 138, 138, 138, 139, 139, 139, 140, 140, 140, 140, 141, 141, 141, 141, 142, 142, 142, 143, 143, 143, 143, 143, 144, 144, 144, 145, 145, 145, 145, 145,
+	145, 145, 146, 146, 146, 146, 146, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+	0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9, 10, 11, 12, 12, 13, 14, 15, 16, 17, 18, 19, 20, 20, 21, 22, 23, 24, 25, 26, 27, 27,
+	28, 29, 30, 31, 32, 33, 34, 34, 35, 36, 37, 38, 39, 40, 40, 41, 42, 43, 44, 45, 46, 46, 47, 48, 49, 50, 51, 51, 52, 53, 54, 55,
+	56, 56, 57, 58, 59, 60, 60, 61, 62, 63, 64, 65, 65, 66, 67, 68, 68, 69, 70, 71, 72, 72, 73, 74, 75, 75, 76, 77, 78, 78, 79, 80,
+	81, 81, 82, 83, 84, 84, 85, 86, 86, 87, 88, 89, 89, 90, 91, 92, 92, 93, 94, 94, 95, 96, 96, 97, 97, 98, 99, 100, 100, 101, 101, 102,
+	103, 103, 104, 105, 105, 106, 106, 107, 107, 108, 109, 109, 110, 110, 111, 112, 112, 113, 113, 114, 114, 115, 116, 116, 117, 117, 118, 118, 119, 119, 120, 120,
+	121, 121, 122, 122, 122, 123, 123, 124, 124, 125, 125, 126, 126, 127, 127, 128, 128, 128, 129, 129, 130, 130, 130, 131, 131, 131, 132, 132, 133, 133, 133, 134,
+	134, 134, 135, 135, 135, 136, 136, 136, 137, 137, 137, 137, 138, 138, 138, 138, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141, 141, 141, 142, 142, 142,
+	142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144, 144, 144, 144, 144, 144, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+	0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9, 10, 10, 11, 12, 13, 14, 15, 16, 16, 17, 18, 19, 20, 21, 22, 23, 23, 24, 25, 26, 27,
+	28, 29, 29, 30, 31, 32, 33, 34, 35, 35, 36, 37, 38, 39, 40, 40, 41, 42, 43, 44, 45, 45, 46, 47, 48, 49, 50, 50, 51, 52, 53, 53,
+	54, 55, 56, 57, 58, 58, 59, 60, 61, 61, 62, 63, 64, 65, 65, 66, 67, 68, 69, 69, 70, 71, 72, 72, 73, 74, 75, 75, 76, 77, 78, 78,
+	79, 80, 80, 81, 82, 83, 83, 84, 85, 85, 86, 87, 87, 88, 89, 90, 90, 91, 92, 92, 93, 94, 94, 95, 95, 96, 97, 97, 98, 99, 99, 100,
+	100, 101, 102, 102, 103, 103, 104, 105, 105, 106, 106, 107, 107, 108, 109, 109, 110, 110, 111, 111, 112, 113, 113, 113, 114, 115, 115, 116, 116, 117, 117, 118,
+	118, 119, 119, 119, 120, 120, 121, 121, 122, 122, 123, 123, 123, 124, 124, 125, 125, 125, 126, 126, 127, 127, 128, 128, 128, 129, 129, 129, 130, 130, 130, 131,
+	131, 131, 132, 132, 133, 133, 133, 133, 134, 134, 134, 134, 135, 135, 135, 135, 136, 136, 136, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 139, 139, 139,
+	139, 139, 140, 140, 140, 140, 140, 140, 140, 140, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 142, 142, 142, 142, 142, 142, 142, 142,
+	0, 1, 2, 2, 3, 4, 5, 6, 7, 8, 8, 9, 10, 11, 12, 13, 14, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 25, 26,
+	27, 28, 29, 30, 30, 31, 32, 33, 34, 35, 35, 36, 37, 38, 39, 39, 40, 41, 42, 43, 44, 44, 45, 46, 47, 48, 48, 49, 50, 51, 52, 52,
+	53, 54, 55, 56, 56, 57, 58, 59, 59, 60, 61, 62, 62, 63, 64, 65, 65, 66, 67, 68, 69, 69, 70, 71, 71, 72, 73, 74, 74, 75, 76, 76,
+	77, 78, 79, 79, 80, 81, 81, 82, 83, 83, 84, 85, 86, 86, 87, 88, 88, 89, 90, 90, 91, 92, 92, 93, 93, 94, 95, 95, 96, 96, 97, 98,
+	98, 99, 100, 100, 101, 101, 102, 102, 103, 103, 104, 105, 105, 106, 106, 107, 107, 108, 108, 109, 110, 110, 111, 111, 112, 112, 113, 113, 113, 114, 115, 115,
+	116, 116, 117, 117, 117, 118, 118, 119, 119, 119, 120, 120, 121, 121, 122, 122, 122, 123, 123, 124, 124, 124, 125, 125, 125, 126, 126, 126, 127, 127, 128, 128,
+	128, 129, 129, 129, 130, 130, 130, 130, 131, 131, 131, 131, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 136, 136, 136,
+	136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 139, 139, 139, 139, 139, 139, 139, 139,
+	0, 1, 2, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 11, 12, 12, 13, 14, 15, 16, 17, 17, 18, 19, 20, 21, 22, 22, 23, 24, 25, 26,
+	26, 27, 28, 29, 30, 31, 31, 32, 33, 34, 35, 35, 36, 37, 38, 39, 39, 40, 41, 42, 43, 43, 44, 45, 46, 47, 47, 48, 49, 50, 50, 51,
+	52, 53, 54, 54, 55, 56, 57, 57, 58, 59, 60, 60, 61, 62, 63, 63, 64, 65, 66, 66, 67, 68, 69, 69, 70, 71, 71, 72, 73, 73, 74, 75,
+	76, 76, 77, 78, 78, 79, 80, 80, 81, 82, 82, 83, 84, 84, 85, 86, 86, 87, 88, 88, 89, 90, 90, 91, 91, 92, 93, 93, 94, 94, 95, 96,
+	96, 97, 97, 98, 99, 99, 100, 100, 101, 101, 102, 102, 103, 103, 104, 105, 105, 106, 106, 107, 107, 108, 108, 109, 109, 110, 110, 111, 111, 112, 112, 113,
+	113, 113, 114, 114, 115, 115, 116, 116, 117, 117, 118, 118, 118, 119, 119, 119, 120, 120, 121, 121, 121, 122, 122, 122, 123, 123, 123, 124, 124, 124, 125, 125,
+	125, 126, 126, 126, 127, 127, 128, 128, 128, 128, 129, 129, 129, 129, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 132, 132, 132, 133, 133, 133, 133, 133,
+	133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136,
+	0, 1, 2, 2, 3, 4, 5, 6, 6, 7, 8, 9, 10, 11, 11, 12, 13, 14, 15, 15, 16, 17, 18, 19, 19, 20, 21, 22, 23, 24, 24, 25,
+	26, 27, 28, 28, 29, 30, 31, 32, 32, 33, 34, 35, 35, 36, 37, 38, 39, 39, 40, 41, 42, 43, 43, 44, 45, 46, 46, 47, 48, 49, 49, 50,
+	51, 52, 52, 53, 54, 55, 55, 56, 57, 58, 58, 59, 60, 60, 61, 62, 63, 64, 64, 65, 66, 66, 67, 68, 68, 69, 70, 70, 71, 72, 73, 73,
+	74, 75, 75, 76, 77, 77, 78, 79, 79, 80, 81, 81, 82, 83, 83, 84, 84, 85, 86, 86, 87, 88, 88, 89, 89, 90, 91, 91, 92, 92, 93, 94,
+	94, 95, 95, 96, 96, 97, 97, 98, 99, 99, 100, 100, 101, 101, 102, 102, 103, 103, 104, 104, 105, 105, 106, 106, 107, 107, 108, 108, 109, 109, 110, 110,
+	111, 111, 112, 112, 112, 113, 113, 114, 114, 114, 115, 115, 116, 116, 117, 117, 117, 118, 118, 119, 119, 119, 119, 120, 120, 120, 121, 121, 121, 122, 122, 122,
+	123, 123, 123, 124, 124, 124, 125, 125, 125, 125, 126, 126, 126, 126, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130,
+	130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+	0, 1, 2, 2, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10, 11, 12, 13, 13, 14, 15, 16, 17, 17, 18, 19, 20, 21, 21, 22, 23, 24, 25,
+	25, 26, 27, 28, 28, 29, 30, 31, 32, 32, 33, 34, 35, 35, 36, 37, 38, 39, 39, 40, 41, 42, 42, 43, 44, 45, 45, 46, 47, 48, 48, 49,
+	50, 50, 51, 52, 53, 53, 54, 55, 56, 56, 57, 58, 59, 59, 60, 61, 61, 62, 63, 64, 64, 65, 66, 66, 67, 68, 68, 69, 70, 70, 71, 72,
+	72, 73, 74, 74, 75, 76, 76, 77, 78, 78, 79, 79, 80, 81, 81, 82, 83, 83, 84, 84, 85, 86, 86, 87, 87, 88, 89, 89, 90, 90, 91, 92,
+	92, 93, 93, 94, 94, 95, 95, 96, 96, 97, 97, 98, 99, 99, 100, 100, 101, 101, 101, 102, 103, 103, 104, 104, 105, 105, 105, 106, 106, 107, 107, 108,
+	108, 109, 109, 110, 110, 110, 111, 111, 112, 112, 113, 113, 113, 114, 114, 114, 115, 115, 116, 116, 116, 117, 117, 117, 118, 118, 118, 119, 119, 119, 119, 120,
+	120, 120, 121, 121, 121, 122, 122, 122, 122, 123, 123, 123, 123, 124, 124, 124, 124, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 127, 127, 127, 127, 128,
+	128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+	0, 1, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 9, 10, 11, 12, 12, 13, 14, 15, 16, 16, 17, 18, 19, 19, 20, 21, 22, 23, 23, 24,
+	25, 26, 26, 27, 28, 29, 29, 30, 31, 32, 32, 33, 34, 35, 35, 36, 37, 38, 38, 39, 40, 41, 41, 42, 43, 44, 44, 45, 46, 47, 47, 48,
+	49, 49, 50, 51, 52, 52, 53, 54, 55, 55, 56, 57, 57, 58, 59, 59, 60, 61, 61, 62, 63, 64, 64, 65, 65, 66, 67, 67, 68, 69, 70, 70,
+	71, 71, 72, 73, 73, 74, 75, 75, 76, 76, 77, 78, 78, 79, 80, 80, 81, 81, 82, 83, 83, 84, 84, 85, 86, 86, 87, 87, 88, 88, 89, 90,
+	90, 91, 91, 92, 92, 93, 93, 94, 94, 95, 95, 96, 96, 97, 97, 98, 99, 99, 99, 100, 100, 101, 101, 102, 102, 103, 103, 104, 104, 105, 105, 105,
+	106, 106, 107, 107, 107, 108, 108, 109, 109, 110, 110, 110, 111, 111, 112, 112, 112, 113, 113, 113, 114, 114, 114, 115, 115, 115, 116, 116, 116, 117, 117, 117,
+	118, 118, 118, 119, 119, 119, 119, 119, 120, 120, 120, 120, 121, 121, 121, 121, 122, 122, 122, 122, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 125,
+	125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+	0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 14, 14, 15, 16, 17, 17, 18, 19, 20, 20, 21, 22, 23, 24,
+	24, 25, 26, 26, 27, 28, 29, 29, 30, 31, 32, 32, 33, 34, 35, 35, 36, 37, 38, 38, 39, 40, 41, 41, 42, 43, 43, 44, 45, 46, 46, 47,
+	48, 48, 49, 50, 50, 51, 52, 53, 53, 54, 55, 55, 56, 57, 57, 58, 59, 59, 60, 61, 61, 62, 63, 63, 64, 65, 65, 66, 67, 67, 68, 69,
+	69, 70, 70, 71, 72, 72, 73, 74, 74, 75, 75, 76, 77, 77, 78, 79, 79, 80, 80, 81, 81, 82, 83, 83, 84, 84, 85, 86, 86, 86, 87, 88,
+	88, 89, 89, 90, 90, 91, 91, 92, 92, 93, 93, 94, 94, 95, 95, 96, 96, 97, 97, 98, 98, 99, 99, 100, 100, 101, 101, 101, 102, 102, 103, 103,
+	104, 104, 105, 105, 105, 106, 106, 107, 107, 107, 108, 108, 108, 109, 109, 110, 110, 110, 111, 111, 111, 112, 112, 112, 113, 113, 113, 113, 114, 114, 114, 115,
+	115, 115, 116, 116, 116, 117, 117, 117, 117, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 120, 120, 120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122,
+	122, 122, 122, 122, 123, 123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+	0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11, 12, 13, 13, 14, 15, 16, 16, 17, 18, 19, 19, 20, 21, 22, 22, 23,
+	24, 24, 25, 26, 27, 27, 28, 29, 30, 30, 31, 32, 32, 33, 34, 35, 35, 36, 37, 37, 38, 39, 40, 40, 41, 42, 43, 43, 44, 45, 45, 46,
+	47, 47, 48, 49, 49, 50, 51, 51, 52, 53, 53, 54, 55, 55, 56, 57, 57, 58, 59, 59, 60, 61, 61, 62, 63, 63, 64, 65, 65, 66, 67, 67,
+	68, 68, 69, 70, 70, 71, 71, 72, 73, 73, 74, 74, 75, 76, 76, 77, 77, 78, 79, 79, 80, 80, 81, 81, 82, 83, 83, 84, 84, 85, 85, 86,
+	86, 87, 87, 88, 88, 89, 89, 90, 90, 91, 91, 92, 92, 93, 93, 94, 94, 95, 95, 96, 96, 97, 97, 97, 98, 99, 99, 99, 100, 100, 101, 101,
+	101, 102, 102, 103, 103, 103, 104, 104, 105, 105, 105, 106, 106, 107, 107, 107, 107, 108, 108, 109, 109, 109, 110, 110, 110, 110, 111, 111, 111, 112, 112, 112,
+	113, 113, 113, 113, 114, 114, 114, 114, 115, 115, 115, 115, 116, 116, 116, 116, 117, 117, 117, 117, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119,
+	119, 119, 120, 120, 120, 120, 120, 120, 120, 120, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 122, 122, 122,
+	0, 1, 1, 2, 3, 4, 4, 5, 6, 6, 7, 8, 9, 9, 10, 11, 12, 12, 13, 14, 14, 15, 16, 17, 17, 18, 19, 20, 20, 21, 22, 23,
+	23, 24, 25, 25, 26, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 34, 35, 35, 36, 37, 37, 38, 39, 39, 40, 41, 42, 42, 43, 44, 44, 45,
+	46, 46, 47, 48, 48, 49, 50, 50, 51, 52, 52, 53, 54, 54, 55, 56, 56, 57, 58, 58, 59, 59, 60, 61, 61, 62, 63, 63, 64, 64, 65, 66,
+	66, 67, 67, 68, 69, 69, 70, 70, 71, 72, 72, 73, 73, 74, 75, 75, 76, 76, 77, 77, 78, 79, 79, 80, 80, 81, 81, 82, 82, 83, 83, 84,
+	84, 85, 86, 86, 86, 87, 87, 88, 88, 89, 89, 90, 90, 91, 91, 92, 92, 93, 93, 94, 94, 95, 95, 95, 96, 96, 97, 97, 97, 98, 99, 99,
+	99, 100, 100, 100, 101, 101, 101, 102, 102, 103, 103, 103, 104, 104, 105, 105, 105, 105, 106, 106, 107, 107, 107, 107, 108, 108, 108, 109, 109, 109, 110, 110,
+	110, 110, 111, 111, 111, 112, 112, 112, 112, 113, 113, 113, 113, 113, 114, 114, 114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+	117, 117, 117, 117, 118, 118, 118, 118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+	0, 1, 1, 2, 3, 3, 4, 5, 6, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 13, 14, 15, 16, 16, 17, 18, 18, 19, 20, 21, 21, 22,
+	23, 23, 24, 25, 25, 26, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 34, 35, 35, 36, 37, 37, 38, 39, 39, 40, 41, 41, 42, 43, 43, 44,
+	45, 45, 46, 47, 47, 48, 49, 49, 50, 50, 51, 52, 52, 53, 54, 54, 55, 56, 56, 57, 58, 58, 59, 59, 60, 61, 61, 62, 62, 63, 64, 64,
+	65, 65, 66, 67, 67, 68, 68, 69, 70, 70, 71, 71, 72, 72, 73, 74, 74, 75, 75, 76, 76, 77, 77, 78, 78, 79, 79, 80, 81, 81, 82, 82,
+	83, 83, 84, 84, 85, 85, 86, 86, 86, 87, 87, 88, 88, 89, 89, 90, 90, 91, 91, 92, 92, 93, 93, 93, 94, 94, 95, 95, 95, 96, 96, 97,
+	97, 97, 98, 98, 99, 99, 99, 100, 100, 100, 101, 101, 101, 102, 102, 103, 103, 103, 104, 104, 104, 105, 105, 105, 105, 106, 106, 106, 107, 107, 107, 107,
+	108, 108, 108, 109, 109, 109, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 114, 114, 114, 114, 114,
+	114, 114, 115, 115, 115, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 117, 117, 117, 117, 117, 117, 117,
+	0, 1, 1, 2, 3, 3, 4, 5, 5, 6, 7, 8, 8, 9, 10, 10, 11, 12, 12, 13, 14, 15, 15, 16, 17, 17, 18, 19, 19, 20, 21, 22,
+	22, 23, 24, 24, 25, 26, 26, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 34, 34, 35, 36, 36, 37, 38, 38, 39, 40, 40, 41, 42, 42, 43,
+	44, 44, 45, 46, 46, 47, 48, 48, 49, 49, 50, 51, 51, 52, 53, 53, 54, 55, 55, 56, 56, 57, 58, 58, 59, 59, 60, 60, 61, 62, 62, 63,
+	64, 64, 65, 65, 66, 66, 67, 67, 68, 69, 69, 70, 70, 71, 71, 72, 72, 73, 74, 74, 75, 75, 76, 76, 77, 77, 78, 78, 79, 79, 80, 80,
+	81, 81, 82, 82, 83, 83, 84, 84, 85, 85, 86, 86, 86, 87, 87, 88, 88, 89, 89, 90, 90, 91, 91, 91, 92, 92, 93, 93, 93, 94, 94, 95,
+	95, 95, 96, 96, 96, 97, 97, 98, 98, 98, 99, 99, 99, 100, 100, 100, 101, 101, 101, 102, 102, 102, 103, 103, 103, 103, 104, 104, 104, 105, 105, 105,
+	105, 106, 106, 106, 107, 107, 107, 107, 107, 108, 108, 108, 108, 109, 109, 109, 109, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 111, 112, 112, 112,
+	112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+	0, 1, 1, 2, 3, 3, 4, 5, 5, 6, 7, 7, 8, 9, 9, 10, 11, 12, 12, 13, 14, 14, 15, 16, 16, 17, 18, 18, 19, 20, 20, 21,
+	22, 22, 23, 24, 24, 25, 26, 26, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 34, 34, 35, 36, 36, 37, 38, 38, 39, 40, 40, 41, 41, 42,
+	43, 43, 44, 45, 45, 46, 47, 47, 48, 48, 49, 50, 50, 51, 51, 52, 53, 53, 54, 55, 55, 56, 56, 57, 57, 58, 59, 59, 60, 60, 61, 61,
+	62, 63, 63, 64, 64, 65, 65, 66, 67, 67, 68, 68, 69, 69, 70, 70, 71, 71, 72, 72, 73, 74, 74, 75, 75, 76, 76, 77, 77, 78, 78, 79,
+	79, 79, 80, 81, 81, 81, 82, 82, 83, 83, 84, 84, 85, 85, 86, 86, 86, 87, 87, 88, 88, 89, 89, 89, 90, 90, 91, 91, 91, 92, 92, 93,
+	93, 93, 94, 94, 94, 95, 95, 96, 96, 96, 97, 97, 97, 98, 98, 98, 99, 99, 99, 100, 100, 100, 100, 101, 101, 101, 101, 102, 102, 102, 103, 103,
+	103, 103, 104, 104, 104, 105, 105, 105, 105, 105, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 108, 108, 108, 108, 108, 109, 109, 109, 109, 109, 109, 110,
+	110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 112, 112, 112, 112, 112, 112, 112, 112,
+	0, 1, 1, 2, 3, 3, 4, 5, 5, 6, 7, 7, 8, 9, 9, 10, 11, 11, 12, 13, 13, 14, 15, 15, 16, 17, 17, 18, 19, 19, 20, 21,
+	21, 22, 23, 23, 24, 25, 25, 26, 26, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 34, 34, 35, 36, 36, 37, 37, 38, 39, 39, 40, 41, 41,
+	42, 42, 43, 44, 44, 45, 46, 46, 47, 47, 48, 49, 49, 50, 50, 51, 51, 52, 53, 53, 54, 55, 55, 56, 56, 57, 57, 58, 59, 59, 60, 60,
+	61, 61, 62, 62, 63, 64, 64, 65, 65, 66, 66, 67, 67, 68, 68, 69, 69, 70, 70, 71, 71, 72, 72, 73, 73, 74, 74, 75, 75, 76, 76, 77,
+	77, 78, 78, 79, 79, 80, 80, 81, 81, 81, 82, 82, 83, 83, 84, 84, 85, 85, 85, 86, 86, 87, 87, 87, 88, 88, 89, 89, 89, 90, 90, 91,
+	91, 91, 92, 92, 92, 93, 93, 94, 94, 94, 95, 95, 95, 96, 96, 96, 96, 97, 97, 97, 98, 98, 98, 99, 99, 99, 99, 100, 100, 100, 100, 101,
+	101, 101, 101, 102, 102, 102, 103, 103, 103, 103, 103, 103, 104, 104, 104, 104, 105, 105, 105, 105, 105, 105, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 108, 108, 108, 108, 108, 108, 108, 108, 108, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	0, 0, 1, 2, 2, 3, 4, 4, 5, 6, 6, 7, 8, 8, 9, 10, 10, 11, 12, 12, 13, 14, 14, 15, 16, 16, 17, 18, 18, 19, 19, 20,
+	21, 21, 22, 23, 23, 24, 25, 25, 26, 27, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 33, 34, 35, 35, 36, 37, 37, 38, 38, 39, 40, 40,
+	41, 41, 42, 43, 43, 44, 45, 45, 46, 46, 47, 48, 48, 49, 49, 50, 50, 51, 52, 52, 53, 53, 54, 54, 55, 56, 56, 57, 57, 58, 58, 59,
+	59, 60, 60, 61, 62, 62, 63, 63, 64, 64, 65, 65, 66, 66, 67, 67, 68, 68, 69, 69, 70, 70, 71, 71, 72, 72, 73, 73, 74, 74, 75, 75,
+	76, 76, 77, 77, 78, 78, 78, 79, 79, 80, 80, 81, 81, 81, 82, 82, 83, 83, 83, 84, 84, 85, 85, 86, 86, 86, 87, 87, 87, 88, 88, 89,
+	89, 89, 90, 90, 90, 91, 91, 92, 92, 92, 93, 93, 93, 94, 94, 94, 94, 95, 95, 95, 96, 96, 96, 96, 97, 97, 97, 97, 98, 98, 98, 99,
+	99, 99, 99, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 102, 102, 102, 102, 103, 103, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+	105, 105, 105, 105, 105, 105, 105, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	0, 0, 1, 2, 2, 3, 4, 4, 5, 6, 6, 7, 8, 8, 9, 9, 10, 11, 11, 12, 13, 13, 14, 15, 15, 16, 17, 17, 18, 18, 19, 20,
+	20, 21, 22, 22, 23, 23, 24, 25, 25, 26, 27, 27, 28, 28, 29, 30, 30, 31, 32, 32, 33, 33, 34, 35, 35, 36, 36, 37, 38, 38, 39, 39,
+	40, 41, 41, 42, 42, 43, 44, 44, 45, 45, 46, 47, 47, 48, 48, 49, 49, 50, 50, 51, 52, 52, 53, 53, 54, 54, 55, 55, 56, 56, 57, 58,
+	58, 59, 59, 60, 60, 61, 61, 62, 62, 63, 63, 64, 64, 65, 65, 66, 66, 67, 67, 68, 68, 69, 69, 70, 70, 71, 71, 72, 72, 73, 73, 74,
+	74, 74, 75, 75, 76, 76, 77, 77, 78, 78, 78, 79, 79, 80, 80, 81, 81, 81, 82, 82, 83, 83, 83, 84, 84, 85, 85, 85, 86, 86, 86, 87,
+	87, 87, 88, 88, 88, 89, 89, 90, 90, 90, 91, 91, 91, 92, 92, 92, 92, 93, 93, 93, 94, 94, 94, 94, 95, 95, 95, 95, 96, 96, 96, 96,
+	97, 97, 97, 97, 98, 98, 98, 98, 99, 99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 102, 102, 102, 102, 102, 102, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 105, 105, 105, 105, 105, 105, 105, 105,
+	0, 0, 1, 2, 2, 3, 4, 4, 5, 5, 6, 7, 7, 8, 9, 9, 10, 11, 11, 12, 12, 13, 14, 14, 15, 16, 16, 17, 17, 18, 19, 19,
+	20, 20, 21, 22, 22, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 30, 30, 31, 31, 32, 33, 33, 34, 34, 35, 36, 36, 37, 37, 38, 39,
+	39, 40, 40, 41, 41, 42, 43, 43, 44, 44, 45, 46, 46, 47, 47, 48, 48, 49, 49, 50, 50, 51, 52, 52, 53, 53, 54, 54, 55, 55, 56, 56,
+	57, 57, 58, 59, 59, 59, 60, 60, 61, 61, 62, 62, 63, 64, 64, 65, 65, 65, 66, 66, 67, 67, 68, 68, 69, 69, 70, 70, 71, 71, 72, 72,
+	72, 73, 73, 74, 74, 75, 75, 75, 76, 76, 77, 77, 78, 78, 78, 79, 79, 80, 80, 80, 81, 81, 82, 82, 82, 83, 83, 83, 84, 84, 85, 85,
+	85, 86, 86, 86, 86, 87, 87, 88, 88, 88, 89, 89, 89, 90, 90, 90, 90, 91, 91, 91, 92, 92, 92, 92, 93, 93, 93, 93, 94, 94, 94, 94,
+	95, 95, 95, 95, 96, 96, 96, 96, 96, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 99, 99, 99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 100,
+	100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+	0, 0, 1, 2, 2, 3, 4, 4, 5, 5, 6, 7, 7, 8, 8, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 15, 16, 16, 17, 18, 18, 19,
+	19, 20, 21, 21, 22, 22, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 30, 30, 31, 31, 32, 33, 33, 34, 34, 35, 35, 36, 37, 37, 38,
+	38, 39, 39, 40, 41, 41, 42, 42, 43, 43, 44, 45, 45, 46, 46, 47, 47, 48, 48, 49, 49, 50, 50, 51, 51, 52, 53, 53, 54, 54, 55, 55,
+	56, 56, 57, 57, 58, 58, 59, 59, 60, 60, 61, 61, 62, 62, 63, 63, 64, 64, 65, 65, 65, 66, 66, 67, 67, 68, 68, 69, 69, 70, 70, 70,
+	71, 71, 72, 72, 73, 73, 73, 74, 74, 75, 75, 75, 76, 76, 77, 77, 78, 78, 78, 79, 79, 79, 80, 80, 81, 81, 81, 82, 82, 82, 83, 83,
+	83, 84, 84, 84, 85, 85, 85, 86, 86, 86, 87, 87, 87, 88, 88, 88, 88, 89, 89, 89, 90, 90, 90, 90, 91, 91, 91, 91, 92, 92, 92, 92,
+	93, 93, 93, 93, 94, 94, 94, 94, 94, 95, 95, 95, 95, 95, 96, 96, 96, 96, 96, 96, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98,
+	98, 98, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+	0, 0, 1, 2, 2, 3, 3, 4, 5, 5, 6, 6, 7, 8, 8, 9, 9, 10, 11, 11, 12, 12, 13, 14, 14, 15, 15, 16, 17, 17, 18, 18,
+	19, 20, 20, 21, 21, 22, 23, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 29, 30, 31, 31, 32, 32, 33, 34, 34, 35, 35, 36, 36, 37,
+	37, 38, 39, 39, 40, 40, 41, 41, 42, 42, 43, 44, 44, 45, 45, 46, 46, 47, 47, 48, 48, 49, 49, 50, 50, 51, 51, 52, 52, 53, 53, 54,
+	55, 55, 55, 56, 56, 57, 57, 58, 58, 59, 59, 60, 60, 61, 61, 62, 62, 63, 63, 64, 64, 65, 65, 65, 66, 66, 67, 67, 68, 68, 69, 69,
+	69, 70, 70, 71, 71, 71, 72, 72, 73, 73, 73, 74, 74, 75, 75, 75, 76, 76, 76, 77, 77, 78, 78, 78, 79, 79, 79, 80, 80, 81, 81, 81,
+	82, 82, 82, 83, 83, 83, 83, 84, 84, 84, 85, 85, 85, 86, 86, 86, 86, 87, 87, 87, 88, 88, 88, 88, 89, 89, 89, 89, 90, 90, 90, 90,
+	91, 91, 91, 91, 92, 92, 92, 92, 92, 93, 93, 93, 93, 93, 94, 94, 94, 94, 94, 94, 95, 95, 95, 95, 95, 95, 95, 96, 96, 96, 96, 96,
+	96, 96, 96, 96, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+	0, 0, 1, 2, 2, 3, 3, 4, 5, 5, 6, 6, 7, 7, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 14, 15, 16, 16, 17, 17, 18,
+	19, 19, 20, 20, 21, 21, 22, 23, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 29, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35, 36, 36,
+	37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 42, 43, 43, 44, 44, 45, 45, 46, 46, 47, 47, 48, 48, 49, 49, 50, 50, 51, 51, 52, 52, 53,
+	53, 54, 54, 55, 55, 56, 56, 57, 57, 58, 58, 59, 59, 59, 60, 60, 61, 61, 62, 62, 63, 63, 64, 64, 64, 65, 65, 66, 66, 67, 67, 67,
+	68, 68, 69, 69, 70, 70, 70, 71, 71, 71, 72, 72, 73, 73, 73, 74, 74, 75, 75, 75, 76, 76, 76, 77, 77, 78, 78, 78, 78, 79, 79, 79,
+	80, 80, 81, 81, 81, 81, 82, 82, 82, 83, 83, 83, 83, 84, 84, 84, 85, 85, 85, 86, 86, 86, 86, 86, 87, 87, 87, 87, 88, 88, 88, 88,
+	89, 89, 89, 89, 90, 90, 90, 90, 90, 91, 91, 91, 91, 91, 92, 92, 92, 92, 92, 92, 93, 93, 93, 93, 93, 93, 93, 94, 94, 94, 94, 94,
+	94, 94, 94, 94, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+	0, 0, 1, 2, 2, 3, 3, 4, 4, 5, 6, 6, 7, 7, 8, 8, 9, 10, 10, 11, 11, 12, 12, 13, 14, 14, 15, 15, 16, 16, 17, 18,
+	18, 19, 19, 20, 20, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 32, 32, 33, 33, 34, 34, 35, 35,
+	36, 36, 37, 37, 38, 39, 39, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 46, 47, 47, 48, 48, 49, 49, 50, 50, 51, 51, 52,
+	52, 53, 53, 54, 54, 55, 55, 55, 56, 56, 57, 57, 58, 58, 59, 59, 59, 60, 60, 61, 61, 62, 62, 63, 63, 64, 64, 64, 65, 65, 66, 66,
+	66, 67, 67, 68, 68, 68, 69, 69, 70, 70, 70, 71, 71, 71, 72, 72, 73, 73, 73, 74, 74, 74, 75, 75, 75, 76, 76, 76, 77, 77, 78, 78,
+	78, 78, 79, 79, 79, 80, 80, 80, 81, 81, 81, 81, 82, 82, 82, 83, 83, 83, 83, 84, 84, 84, 84, 85, 85, 85, 85, 86, 86, 86, 86, 86,
+	87, 87, 87, 87, 88, 88, 88, 88, 88, 89, 89, 89, 89, 89, 90, 90, 90, 90, 90, 90, 91, 91, 91, 91, 91, 91, 91, 92, 92, 92, 92, 92,
+	92, 92, 92, 92, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+	0, 0, 1, 1, 2, 3, 3, 4, 4, 5, 5, 6, 7, 7, 8, 8, 9, 9, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 16, 16, 17, 17,
+	18, 18, 19, 19, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 35,
+	35, 36, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 46, 47, 47, 48, 48, 49, 49, 50, 50, 50,
+	51, 51, 52, 52, 53, 53, 54, 54, 55, 55, 56, 56, 56, 57, 57, 58, 58, 59, 59, 59, 60, 60, 61, 61, 62, 62, 62, 63, 63, 64, 64, 65,
+	65, 65, 66, 66, 67, 67, 67, 68, 68, 68, 69, 69, 70, 70, 70, 71, 71, 71, 72, 72, 72, 73, 73, 73, 74, 74, 74, 75, 75, 75, 76, 76,
+	76, 77, 77, 77, 78, 78, 78, 79, 79, 79, 79, 80, 80, 80, 81, 81, 81, 81, 82, 82, 82, 82, 83, 83, 83, 83, 83, 84, 84, 84, 84, 85,
+	85, 85, 85, 86, 86, 86, 86, 86, 86, 87, 87, 87, 87, 87, 88, 88, 88, 88, 88, 88, 89, 89, 89, 89, 89, 89, 89, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+	0, 0, 1, 1, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 14, 14, 15, 15, 16, 16, 17,
+	17, 18, 18, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32, 32, 33, 33, 34,
+	34, 35, 35, 36, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 46, 47, 47, 48, 48, 48, 49, 49,
+	50, 50, 51, 51, 52, 52, 53, 53, 53, 54, 54, 55, 55, 56, 56, 57, 57, 57, 58, 58, 59, 59, 59, 60, 60, 61, 61, 62, 62, 62, 63, 63,
+	64, 64, 64, 65, 65, 65, 66, 66, 67, 67, 67, 68, 68, 68, 69, 69, 70, 70, 70, 70, 71, 71, 72, 72, 72, 73, 73, 73, 73, 74, 74, 74,
+	75, 75, 75, 76, 76, 76, 76, 77, 77, 77, 78, 78, 78, 79, 79, 79, 79, 79, 80, 80, 80, 81, 81, 81, 81, 81, 82, 82, 82, 82, 83, 83,
+	83, 83, 83, 84, 84, 84, 84, 84, 85, 85, 85, 85, 85, 86, 86, 86, 86, 86, 86, 86, 87, 87, 87, 87, 87, 87, 87, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+	0, 0, 1, 1, 2, 2, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16,
+	17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 29, 29, 29, 30, 31, 31, 32, 32, 33, 33,
+	34, 34, 35, 35, 36, 36, 37, 37, 38, 38, 39, 39, 39, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 46, 47, 47, 47, 48, 48,
+	49, 49, 50, 50, 51, 51, 51, 52, 52, 53, 53, 54, 54, 55, 55, 55, 56, 56, 57, 57, 57, 58, 58, 59, 59, 59, 60, 60, 61, 61, 61, 62,
+	62, 62, 63, 63, 64, 64, 64, 65, 65, 65, 66, 66, 67, 67, 67, 68, 68, 68, 69, 69, 69, 70, 70, 70, 71, 71, 71, 72, 72, 72, 73, 73,
+	73, 73, 74, 74, 74, 75, 75, 75, 75, 76, 76, 76, 76, 77, 77, 77, 78, 78, 78, 78, 79, 79, 79, 79, 79, 80, 80, 80, 80, 81, 81, 81,
+	81, 81, 82, 82, 82, 82, 83, 83, 83, 83, 83, 83, 83, 84, 84, 84, 84, 84, 84, 85, 85, 85, 85, 85, 85, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	0, 0, 1, 1, 2, 2, 3, 3, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 14, 14, 15, 15, 16, 16,
+	17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32, 32,
+	33, 33, 34, 34, 35, 35, 36, 36, 37, 37, 38, 38, 39, 39, 40, 40, 40, 41, 41, 42, 42, 43, 43, 44, 44, 45, 45, 46, 46, 46, 47, 47,
+	48, 48, 49, 49, 50, 50, 50, 51, 51, 52, 52, 52, 53, 53, 54, 54, 55, 55, 55, 56, 56, 57, 57, 57, 58, 58, 59, 59, 59, 60, 60, 60,
+	61, 61, 62, 62, 62, 63, 63, 63, 64, 64, 64, 65, 65, 65, 66, 66, 67, 67, 67, 67, 68, 68, 69, 69, 69, 70, 70, 70, 70, 71, 71, 71,
+	72, 72, 72, 72, 73, 73, 73, 74, 74, 74, 74, 75, 75, 75, 75, 76, 76, 76, 76, 77, 77, 77, 77, 78, 78, 78, 78, 78, 79, 79, 79, 79,
+	79, 80, 80, 80, 80, 81, 81, 81, 81, 81, 81, 81, 82, 82, 82, 82, 82, 83, 83, 83, 83, 83, 83, 83, 83, 84, 84, 84, 84, 84, 84, 84,
+	84, 84, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+	0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16,
+	16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32,
+	32, 33, 33, 34, 34, 35, 35, 35, 36, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 41, 42, 42, 43, 43, 44, 44, 45, 45, 45, 46, 46,
+	47, 47, 48, 48, 48, 49, 49, 50, 50, 50, 51, 51, 52, 52, 53, 53, 53, 54, 54, 55, 55, 55, 56, 56, 56, 57, 57, 58, 58, 58, 59, 59,
+	59, 60, 60, 61, 61, 61, 62, 62, 62, 63, 63, 63, 64, 64, 64, 65, 65, 65, 66, 66, 66, 67, 67, 67, 68, 68, 68, 69, 69, 69, 70, 70,
+	70, 70, 71, 71, 71, 71, 72, 72, 72, 72, 73, 73, 73, 74, 74, 74, 74, 74, 75, 75, 75, 75, 76, 76, 76, 76, 76, 77, 77, 77, 77, 78,
+	78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 80, 80, 80, 80, 80, 80, 81, 81, 81, 81, 81, 81, 81, 81, 82, 82, 82, 82, 82, 82, 82, 83,
+	83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+	0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15,
+	16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 29, 29, 29, 30, 30, 31,
+	31, 32, 32, 33, 33, 34, 34, 35, 35, 36, 36, 37, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 41, 42, 42, 43, 43, 44, 44, 44, 45, 45,
+	46, 46, 47, 47, 47, 48, 48, 49, 49, 49, 50, 50, 51, 51, 51, 52, 52, 53, 53, 53, 54, 54, 55, 55, 55, 56, 56, 56, 57, 57, 58, 58,
+	58, 59, 59, 59, 60, 60, 60, 61, 61, 61, 62, 62, 62, 63, 63, 63, 64, 64, 64, 65, 65, 65, 66, 66, 66, 67, 67, 67, 67, 68, 68, 68,
+	69, 69, 69, 69, 70, 70, 70, 70, 71, 71, 71, 71, 72, 72, 72, 72, 73, 73, 73, 73, 74, 74, 74, 74, 74, 75, 75, 75, 75, 75, 76, 76,
+	76, 76, 76, 77, 77, 77, 77, 77, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 80, 80, 80, 80, 80, 80, 80, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+	0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15,
+	16, 16, 17, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 28, 29, 29, 30, 30,
+	31, 31, 32, 32, 33, 33, 33, 34, 34, 35, 35, 36, 36, 37, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 41, 42, 42, 43, 43, 43, 44, 44,
+	45, 45, 46, 46, 46, 47, 47, 48, 48, 48, 49, 49, 50, 50, 50, 51, 51, 51, 52, 52, 53, 53, 53, 54, 54, 55, 55, 55, 56, 56, 56, 57,
+	57, 57, 58, 58, 58, 59, 59, 59, 60, 60, 60, 61, 61, 61, 62, 62, 62, 63, 63, 63, 64, 64, 64, 64, 65, 65, 65, 66, 66, 66, 67, 67,
+	67, 67, 68, 68, 68, 68, 69, 69, 69, 69, 70, 70, 70, 70, 71, 71, 71, 71, 72, 72, 72, 72, 72, 73, 73, 73, 73, 73, 74, 74, 74, 74,
+	74, 75, 75, 75, 75, 75, 76, 76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 77, 77, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79,
+	79, 79, 79, 79, 79, 79, 79, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 81, 81, 81, 81, 81, 81, 81, 81,
+	0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15,
+	15, 16, 16, 17, 17, 18, 18, 19, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 26, 27, 27, 28, 28, 29, 29, 30,
+	30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35, 35, 35, 36, 36, 37, 37, 38, 38, 38, 39, 39, 40, 40, 40, 41, 41, 42, 42, 43, 43, 43,
+	44, 44, 45, 45, 45, 46, 46, 47, 47, 47, 48, 48, 48, 49, 49, 50, 50, 50, 51, 51, 51, 52, 52, 53, 53, 53, 54, 54, 54, 55, 55, 55,
+	56, 56, 56, 57, 57, 57, 58, 58, 58, 59, 59, 59, 60, 60, 60, 61, 61, 61, 61, 62, 62, 62, 63, 63, 63, 64, 64, 64, 64, 65, 65, 65,
+	66, 66, 66, 66, 67, 67, 67, 67, 68, 68, 68, 68, 69, 69, 69, 69, 70, 70, 70, 70, 70, 71, 71, 71, 71, 71, 72, 72, 72, 72, 72, 73,
+	73, 73, 73, 73, 74, 74, 74, 74, 74, 74, 75, 75, 75, 75, 75, 75, 75, 76, 76, 76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 77, 77, 77,
+	77, 77, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+	0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 13, 14, 14,
+	15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 25, 26, 26, 27, 27, 28, 28, 29, 29,
+	29, 30, 30, 31, 31, 32, 32, 32, 33, 33, 34, 34, 35, 35, 35, 36, 36, 37, 37, 38, 38, 38, 39, 39, 40, 40, 40, 41, 41, 42, 42, 42,
+	43, 43, 44, 44, 44, 45, 45, 46, 46, 46, 47, 47, 47, 48, 48, 49, 49, 49, 50, 50, 50, 51, 51, 51, 52, 52, 52, 53, 53, 53, 54, 54,
+	55, 55, 55, 56, 56, 56, 56, 57, 57, 57, 58, 58, 58, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61, 62, 62, 62, 62, 63, 63, 63, 64, 64,
+	64, 64, 65, 65, 65, 65, 66, 66, 66, 66, 67, 67, 67, 67, 68, 68, 68, 68, 69, 69, 69, 69, 69, 70, 70, 70, 70, 70, 70, 71, 71, 71,
+	71, 71, 72, 72, 72, 72, 72, 72, 73, 73, 73, 73, 73, 73, 74, 74, 74, 74, 74, 74, 74, 74, 75, 75, 75, 75, 75, 75, 75, 75, 75, 76,
+	76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14,
+	15, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28,
+	29, 29, 30, 30, 30, 31, 31, 32, 32, 33, 33, 33, 34, 34, 35, 35, 35, 36, 36, 37, 37, 38, 38, 38, 39, 39, 40, 40, 40, 41, 41, 41,
+	42, 42, 43, 43, 43, 44, 44, 45, 45, 45, 46, 46, 46, 47, 47, 48, 48, 48, 49, 49, 49, 50, 50, 50, 51, 51, 51, 52, 52, 52, 53, 53,
+	53, 54, 54, 54, 55, 55, 55, 56, 56, 56, 56, 57, 57, 57, 58, 58, 58, 59, 59, 59, 59, 60, 60, 60, 61, 61, 61, 61, 62, 62, 62, 62,
+	63, 63, 63, 64, 64, 64, 64, 65, 65, 65, 65, 65, 66, 66, 66, 66, 67, 67, 67, 67, 67, 68, 68, 68, 68, 68, 69, 69, 69, 69, 69, 70,
+	70, 70, 70, 70, 70, 71, 71, 71, 71, 71, 71, 71, 72, 72, 72, 72, 72, 72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 74, 74, 74, 74, 74,
+	74, 74, 74, 74, 74, 74, 74, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 12, 13, 13, 14,
+	14, 15, 15, 16, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 20, 21, 21, 22, 22, 23, 23, 23, 24, 24, 25, 25, 26, 26, 26, 27, 27, 28,
+	28, 29, 29, 29, 30, 30, 31, 31, 32, 32, 32, 33, 33, 33, 34, 34, 35, 35, 36, 36, 36, 37, 37, 37, 38, 38, 39, 39, 39, 40, 40, 41,
+	41, 41, 42, 42, 43, 43, 43, 44, 44, 44, 45, 45, 45, 46, 46, 47, 47, 47, 48, 48, 48, 49, 49, 49, 50, 50, 50, 51, 51, 51, 52, 52,
+	52, 52, 53, 53, 53, 54, 54, 54, 55, 55, 55, 56, 56, 56, 56, 57, 57, 57, 58, 58, 58, 59, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61,
+	61, 62, 62, 62, 62, 63, 63, 63, 63, 64, 64, 64, 64, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 67, 67, 67, 67, 67, 67, 68, 68, 68,
+	68, 68, 69, 69, 69, 69, 69, 69, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 71, 71, 71, 71, 71, 71, 72, 72, 72, 72, 72, 72, 72, 72,
+	72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 11, 11, 12, 12, 13, 13, 13,
+	14, 14, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19, 19, 20, 20, 20, 21, 21, 22, 22, 23, 23, 23, 24, 24, 25, 25, 25, 26, 26, 27, 27,
+	28, 28, 28, 29, 29, 30, 30, 30, 31, 31, 32, 32, 32, 33, 33, 34, 34, 34, 35, 35, 36, 36, 36, 37, 37, 37, 38, 38, 39, 39, 39, 40,
+	40, 40, 41, 41, 42, 42, 42, 43, 43, 43, 44, 44, 44, 45, 45, 46, 46, 46, 47, 47, 47, 48, 48, 48, 48, 49, 49, 50, 50, 50, 50, 51,
+	51, 51, 52, 52, 52, 53, 53, 53, 53, 54, 54, 54, 55, 55, 55, 56, 56, 56, 56, 57, 57, 57, 58, 58, 58, 58, 59, 59, 59, 59, 60, 60,
+	60, 60, 61, 61, 61, 61, 61, 62, 62, 62, 62, 63, 63, 63, 63, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 67,
+	67, 67, 67, 67, 67, 68, 68, 68, 68, 68, 68, 68, 69, 69, 69, 69, 69, 69, 69, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 71,
+	71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+	0, 0, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6, 7, 7, 8, 8, 8, 9, 9, 10, 10, 11, 11, 11, 12, 12, 13, 13,
+	14, 14, 14, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19, 19, 20, 20, 20, 21, 21, 22, 22, 22, 23, 23, 24, 24, 25, 25, 25, 26, 26, 26,
+	27, 27, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 32, 32, 32, 33, 33, 34, 34, 34, 35, 35, 36, 36, 36, 37, 37, 37, 38, 38, 39, 39,
+	39, 40, 40, 40, 41, 41, 41, 42, 42, 42, 43, 43, 43, 44, 44, 45, 45, 45, 46, 46, 46, 47, 47, 47, 47, 48, 48, 48, 49, 49, 49, 50,
+	50, 50, 51, 51, 51, 51, 52, 52, 52, 53, 53, 53, 53, 54, 54, 54, 55, 55, 55, 55, 56, 56, 56, 56, 57, 57, 57, 58, 58, 58, 58, 59,
+	59, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65,
+	65, 65, 66, 66, 66, 66, 66, 66, 67, 67, 67, 67, 67, 67, 67, 67, 68, 68, 68, 68, 68, 68, 68, 68, 69, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 71, 71, 71, 71, 71, 71,
+	0, 0, 1, 1, 1, 2, 2, 3, 3, 4, 4, 4, 5, 5, 6, 6, 7, 7, 7, 8, 8, 9, 9, 9, 10, 10, 11, 11, 12, 12, 12, 13,
+	13, 14, 14, 15, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19, 19, 19, 20, 20, 21, 21, 22, 22, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26,
+	26, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 31, 31, 31, 32, 32, 32, 33, 33, 34, 34, 34, 35, 35, 35, 36, 36, 37, 37, 37, 38, 38,
+	38, 39, 39, 39, 40, 40, 40, 41, 41, 41, 42, 42, 43, 43, 43, 44, 44, 44, 45, 45, 45, 46, 46, 46, 46, 47, 47, 47, 48, 48, 48, 49,
+	49, 49, 50, 50, 50, 50, 51, 51, 51, 51, 52, 52, 52, 53, 53, 53, 53, 54, 54, 54, 55, 55, 55, 55, 56, 56, 56, 56, 56, 57, 57, 57,
+	58, 58, 58, 58, 58, 59, 59, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 64, 64,
+	64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+	0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 4, 4, 5, 5, 6, 6, 6, 7, 7, 8, 8, 8, 9, 9, 10, 10, 11, 11, 11, 12, 12, 13,
+	13, 13, 14, 14, 15, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21, 22, 22, 23, 23, 23, 24, 24, 25, 25, 25,
+	26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32, 33, 33, 33, 34, 34, 34, 35, 35, 35, 36, 36, 36, 37, 37,
+	38, 38, 38, 39, 39, 39, 40, 40, 40, 41, 41, 41, 42, 42, 42, 43, 43, 43, 44, 44, 44, 45, 45, 45, 45, 46, 46, 46, 47, 47, 47, 48,
+	48, 48, 48, 49, 49, 49, 50, 50, 50, 50, 51, 51, 51, 51, 52, 52, 52, 53, 53, 53, 53, 54, 54, 54, 54, 55, 55, 55, 55, 56, 56, 56,
+	56, 56, 57, 57, 57, 57, 58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62,
+	62, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	66, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 68, 68, 68, 68, 68, 68, 68, 68,
+	0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 4, 4, 5, 5, 5, 6, 6, 7, 7, 7, 8, 8, 9, 9, 9, 10, 10, 11, 11, 12, 12, 12,
+	13, 13, 14, 14, 14, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21, 22, 22, 23, 23, 23, 24, 24, 24, 25,
+	25, 26, 26, 26, 27, 27, 27, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 32, 32, 32, 33, 33, 33, 34, 34, 34, 35, 35, 35, 36, 36, 36,
+	37, 37, 37, 38, 38, 38, 39, 39, 39, 40, 40, 40, 41, 41, 41, 42, 42, 42, 43, 43, 43, 44, 44, 44, 44, 45, 45, 45, 46, 46, 46, 47,
+	47, 47, 47, 48, 48, 48, 48, 49, 49, 49, 50, 50, 50, 50, 51, 51, 51, 51, 52, 52, 52, 52, 53, 53, 53, 53, 54, 54, 54, 54, 55, 55,
+	55, 55, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60, 60, 61, 61, 61,
+	61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65,
+	65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+	0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 6, 6, 6, 7, 7, 8, 8, 8, 9, 9, 10, 10, 10, 11, 11, 12, 12,
+	12, 13, 13, 14, 14, 14, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 24, 24, 24,
+	25, 25, 25, 26, 26, 26, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 32, 32, 32, 33, 33, 33, 34, 34, 34, 35, 35, 35, 36,
+	36, 36, 37, 37, 37, 38, 38, 38, 39, 39, 39, 39, 40, 40, 40, 41, 41, 41, 42, 42, 42, 43, 43, 43, 43, 44, 44, 44, 45, 45, 45, 46,
+	46, 46, 46, 47, 47, 47, 47, 48, 48, 48, 48, 49, 49, 49, 50, 50, 50, 50, 50, 51, 51, 51, 52, 52, 52, 52, 52, 53, 53, 53, 53, 54,
+	54, 54, 54, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 59, 60,
+	60, 60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 63, 63, 63, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+	0, 0, 0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 6, 6, 6, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 11, 11, 11, 12,
+	12, 13, 13, 13, 14, 14, 14, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 19, 19, 19, 20, 20, 20, 21, 21, 22, 22, 22, 23, 23, 23, 24,
+	24, 24, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 32, 32, 32, 32, 33, 33, 33, 34, 34, 35, 35,
+	35, 35, 36, 36, 36, 37, 37, 37, 38, 38, 38, 39, 39, 39, 40, 40, 40, 40, 41, 41, 41, 42, 42, 42, 43, 43, 43, 43, 44, 44, 44, 45,
+	45, 45, 45, 46, 46, 46, 46, 47, 47, 47, 47, 48, 48, 48, 48, 49, 49, 49, 49, 50, 50, 50, 50, 51, 51, 51, 51, 52, 52, 52, 52, 52,
+	53, 53, 53, 53, 53, 54, 54, 54, 54, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58,
+	59, 59, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62,
+	62, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+	0, 0, 0, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 10, 10, 10, 11, 11, 12,
+	12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 19, 19, 19, 20, 20, 20, 21, 21, 21, 22, 22, 23, 23, 23,
+	24, 24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32, 32, 33, 33, 33, 34, 34,
+	34, 35, 35, 35, 36, 36, 36, 37, 37, 37, 37, 38, 38, 38, 39, 39, 39, 40, 40, 40, 40, 41, 41, 41, 42, 42, 42, 43, 43, 43, 43, 44,
+	44, 44, 44, 45, 45, 45, 45, 46, 46, 46, 46, 47, 47, 47, 47, 48, 48, 48, 48, 49, 49, 49, 49, 50, 50, 50, 50, 50, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 57, 57, 57, 57,
+	57, 57, 58, 58, 58, 58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+	0, 0, 0, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 11, 11, 11,
+	12, 12, 12, 13, 13, 13, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 20, 20, 20, 21, 21, 21, 22, 22, 22, 23,
+	23, 23, 24, 24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32, 32, 33, 33, 33,
+	34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 40, 40, 40, 40, 41, 41, 41, 42, 42, 42, 42, 43,
+	43, 43, 43, 44, 44, 44, 44, 45, 45, 45, 45, 46, 46, 46, 46, 47, 47, 47, 47, 48, 48, 48, 48, 48, 49, 49, 49, 49, 50, 50, 50, 50,
+	50, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 56, 56, 56,
+	56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+	59, 59, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61,
+	0, 0, 0, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 10, 10, 10, 11, 11,
+	11, 12, 12, 12, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21, 22, 22, 22,
+	23, 23, 23, 24, 24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32, 32, 33,
+	33, 33, 33, 34, 34, 34, 35, 35, 35, 36, 36, 36, 36, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 40, 40, 40, 40, 41, 41, 41, 41, 42,
+	42, 42, 43, 43, 43, 43, 43, 44, 44, 44, 44, 45, 45, 45, 45, 46, 46, 46, 46, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 49, 49, 49,
+	49, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 54, 55, 55,
+	55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+	0, 0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 10, 11,
+	11, 11, 12, 12, 12, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 20, 21, 21, 21, 22,
+	22, 22, 23, 23, 23, 24, 24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32,
+	32, 32, 33, 33, 33, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39, 40, 40, 40, 41, 41,
+	41, 41, 42, 42, 42, 42, 43, 43, 43, 43, 43, 44, 44, 44, 44, 45, 45, 45, 45, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 48, 48, 48,
+	48, 48, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 11,
+	11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 20, 21, 21, 21,
+	22, 22, 22, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 31, 31, 31,
+	32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39, 40, 40,
+	40, 40, 41, 41, 41, 41, 42, 42, 42, 42, 43, 43, 43, 43, 43, 44, 44, 44, 44, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46, 47, 47, 47,
+	47, 47, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 52,
+	52, 53, 53, 53, 53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 10,
+	11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 20, 20, 21,
+	21, 21, 22, 22, 22, 23, 23, 23, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 30, 30, 30, 30,
+	31, 31, 31, 32, 32, 32, 32, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39,
+	39, 39, 40, 40, 40, 40, 41, 41, 41, 41, 42, 42, 42, 42, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 46, 46, 46,
+	46, 46, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51,
+	51, 51, 52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 55,
+	55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10,
+	10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 20, 20, 20,
+	21, 21, 21, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 30, 30,
+	30, 30, 31, 31, 31, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 37, 37, 37, 37, 38, 38, 38,
+	38, 39, 39, 39, 39, 40, 40, 40, 40, 40, 41, 41, 41, 41, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 45, 45, 45,
+	45, 45, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50,
+	50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 9, 10,
+	10, 10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20,
+	20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 28, 28, 28, 28, 29, 29, 29,
+	29, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 37, 37, 37, 37,
+	38, 38, 38, 38, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 44, 44, 44,
+	44, 44, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49,
+	49, 49, 49, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10,
+	10, 10, 11, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 19,
+	20, 20, 20, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 29,
+	29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 37,
+	37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 43, 43, 43, 43,
+	43, 43, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48,
+	48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51,
+	51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9,
+	10, 10, 10, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 18, 19, 19,
+	19, 20, 20, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28,
+	28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 32, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36,
+	36, 36, 36, 37, 37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42,
+	42, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47,
+	47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9,
+	9, 10, 10, 10, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 19,
+	19, 19, 19, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 27, 27, 27, 27,
+	28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35,
+	35, 35, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41,
+	41, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 45, 45, 46, 46, 46, 46,
+	46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 9, 9,
+	9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18,
+	18, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27,
+	27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34,
+	34, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45,
+	45, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 8, 8, 8, 8, 9,
+	9, 9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 18, 18,
+	18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26,
+	26, 27, 27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33,
+	34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39,
+	40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44,
+	44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 9,
+	9, 9, 9, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17,
+	18, 18, 18, 18, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 25, 26,
+	26, 26, 26, 27, 27, 27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 32, 33, 33,
+	33, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 39, 39,
+	39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46,
+	46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 8, 8, 8, 8,
+	9, 9, 9, 9, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17,
+	17, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25,
+	25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 31, 32, 32, 32,
+	32, 32, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 38, 38,
+	38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42,
+	42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+	0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8,
+	8, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16, 17,
+	17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 24,
+	25, 25, 25, 25, 26, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 31,
+	32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37,
+	37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41,
+	41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 8, 8,
+	8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 16, 16, 16, 16,
+	17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 23, 24, 24,
+	24, 24, 25, 25, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 31,
+	31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36,
+	36, 36, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40,
+	40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8,
+	8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16,
+	16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 23,
+	24, 24, 24, 24, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 30, 30, 30,
+	30, 30, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35,
+	36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+	39, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 8,
+	8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16,
+	16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 22, 23, 23,
+	23, 23, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29,
+	29, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 35, 35,
+	35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39,
+	39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41,
+	41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+	8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 14, 15, 15, 15,
+	15, 16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 22,
+	23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 29, 29,
+	29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34,
+	34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38,
+	38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+	40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 14, 15, 15,
+	15, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 22, 22,
+	22, 22, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 28, 28, 28, 28,
+	28, 28, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33,
+	33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+	39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7,
+	7, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 13, 14, 14, 14, 14, 15,
+	15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21,
+	22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27,
+	28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+	38, 38, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 7,
+	7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14,
+	14, 15, 15, 15, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21, 21,
+	21, 21, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 27, 27,
+	27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 32, 32,
+	32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38,
+	38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7,
+	7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 14, 14,
+	14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20,
+	21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26,
+	26, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31,
+	31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7,
+	7, 7, 7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 13, 14,
+	14, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 20, 20, 20,
+	20, 20, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 26, 26,
+	26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30,
+	30, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 36,
+	36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 13, 13, 13, 13,
+	14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 20,
+	20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25,
+	25, 25, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30,
+	30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 13, 13, 13,
+	13, 13, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19,
+	19, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 25,
+	25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6,
+	6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 13, 13,
+	13, 13, 13, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 19, 19,
+	19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24,
+	24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6,
+	6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12,
+	13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18,
+	19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 24,
+	24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31,
+	31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6,
+	6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12,
+	12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 18, 18, 18,
+	18, 18, 18, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23,
+	23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27,
+	27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+	30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6,
+	6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12,
+	12, 12, 12, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 18,
+	18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 23,
+	23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30,
+	30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6,
+	6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 12,
+	12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17,
+	17, 17, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22,
+	22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31,
+	31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6,
+	6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+	12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 17, 17,
+	17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 22,
+	22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+	30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11,
+	11, 11, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16,
+	17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21,
+	21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+	5, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11,
+	11, 11, 11, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16,
+	16, 16, 16, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 21,
+	21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24,
+	24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5,
+	5, 5, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 11,
+	11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 16, 16,
+	16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20,
+	20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+	5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10,
+	11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15,
+	16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20,
+	20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+	5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10,
+	10, 10, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15,
+	15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5,
+	5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10,
+	10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 15, 15,
+	15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19,
+	19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 5,
+	5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10,
+	10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14,
+	14, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5,
+	5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9,
+	10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14,
+	14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+	9, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14,
+	14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21,
+	21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+	4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9,
+	9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13,
+	14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+	4, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9,
+	9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13,
+	13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+	4, 4, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 9, 9,
+	9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13,
+	13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+	4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+	9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+	4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8,
+	8, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21,
+	21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4,
+	4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8,
+	8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22,
+	22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+	4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+	4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8,
+	8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21,
+	21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+	4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+	3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+/* all 128 LFO PM waveforms: 128 combinations of 7 bits meaningful (of F-NUMBER), 8 LFO depths, 32 LFO output levels per one depth */
+static const INT32 lfo_pm_table[128*8*32] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+	0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+	0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+	0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+	0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+	0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+	0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+	0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+	0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+	0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+	0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+	0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+	0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+	0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+	0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+	0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+	0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+	0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+	0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+	0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+	0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+	0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+	0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+	0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+	0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+	0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+	0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+	0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+	0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+	0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+	0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+	0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+	0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+	0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+	0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+	0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+	0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+	0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+	0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+	0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+	0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+	0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+	0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+	0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+	0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+	0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+	0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+	0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+	0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+	0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+	0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+	0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+	0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+	0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+	0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+	0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+	0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+	0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+	0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+	0, 0, 16, 24, 32, 32, 40, 48, 48, 40, 32, 32, 24, 16, 0, 0, 0, 0, -16, -24, -32, -32, -40, -48, -48, -40, -32, -32, -24, -16, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+	0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+	0, 0, 16, 24, 33, 33, 41, 49, 49, 41, 33, 33, 24, 16, 0, 0, 0, 0, -16, -24, -33, -33, -41, -49, -49, -41, -33, -33, -24, -16, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+	0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+	0, 0, 17, 25, 34, 34, 42, 51, 51, 42, 34, 34, 25, 17, 0, 0, 0, 0, -17, -25, -34, -34, -42, -51, -51, -42, -34, -34, -25, -17, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+	0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+	0, 0, 17, 25, 35, 35, 43, 52, 52, 43, 35, 35, 25, 17, 0, 0, 0, 0, -17, -25, -35, -35, -43, -52, -52, -43, -35, -35, -25, -17, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+	0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+	0, 0, 18, 27, 36, 36, 45, 54, 54, 45, 36, 36, 27, 18, 0, 0, 0, 0, -18, -27, -36, -36, -45, -54, -54, -45, -36, -36, -27, -18, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+	0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+	0, 0, 18, 27, 37, 37, 46, 55, 55, 46, 37, 37, 27, 18, 0, 0, 0, 0, -18, -27, -37, -37, -46, -55, -55, -46, -37, -37, -27, -18, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+	0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+	0, 0, 19, 28, 38, 38, 47, 57, 57, 47, 38, 38, 28, 19, 0, 0, 0, 0, -19, -28, -38, -38, -47, -57, -57, -47, -38, -38, -28, -19, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+	0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+	0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+	0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+	0, 0, 19, 28, 39, 39, 48, 58, 58, 48, 39, 39, 28, 19, 0, 0, 0, 0, -19, -28, -39, -39, -48, -58, -58, -48, -39, -39, -28, -19, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+	0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+	0, 0, 20, 30, 40, 40, 50, 60, 60, 50, 40, 40, 30, 20, 0, 0, 0, 0, -20, -30, -40, -40, -50, -60, -60, -50, -40, -40, -30, -20, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+	0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+	0, 0, 20, 30, 41, 41, 51, 61, 61, 51, 41, 41, 30, 20, 0, 0, 0, 0, -20, -30, -41, -41, -51, -61, -61, -51, -41, -41, -30, -20, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+	0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+	0, 0, 21, 31, 42, 42, 52, 63, 63, 52, 42, 42, 31, 21, 0, 0, 0, 0, -21, -31, -42, -42, -52, -63, -63, -52, -42, -42, -31, -21, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+	0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+	0, 0, 21, 31, 43, 43, 53, 64, 64, 53, 43, 43, 31, 21, 0, 0, 0, 0, -21, -31, -43, -43, -53, -64, -64, -53, -43, -43, -31, -21, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+	0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+	0, 0, 22, 33, 44, 44, 55, 66, 66, 55, 44, 44, 33, 22, 0, 0, 0, 0, -22, -33, -44, -44, -55, -66, -66, -55, -44, -44, -33, -22, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+	0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+	0, 0, 22, 33, 45, 45, 56, 67, 67, 56, 45, 45, 33, 22, 0, 0, 0, 0, -22, -33, -45, -45, -56, -67, -67, -56, -45, -45, -33, -22, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+	0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+	0, 0, 23, 34, 46, 46, 57, 69, 69, 57, 46, 46, 34, 23, 0, 0, 0, 0, -23, -34, -46, -46, -57, -69, -69, -57, -46, -46, -34, -23, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+	0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+	0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+	0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+	0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+	0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+	0, 0, 23, 34, 47, 47, 58, 70, 70, 58, 47, 47, 34, 23, 0, 0, 0, 0, -23, -34, -47, -47, -58, -70, -70, -58, -47, -47, -34, -23, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+	0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+	0, 0, 24, 36, 48, 48, 60, 72, 72, 60, 48, 48, 36, 24, 0, 0, 0, 0, -24, -36, -48, -48, -60, -72, -72, -60, -48, -48, -36, -24, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+	0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+	0, 0, 24, 36, 49, 49, 61, 73, 73, 61, 49, 49, 36, 24, 0, 0, 0, 0, -24, -36, -49, -49, -61, -73, -73, -61, -49, -49, -36, -24, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+	0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+	0, 0, 25, 37, 50, 50, 62, 75, 75, 62, 50, 50, 37, 25, 0, 0, 0, 0, -25, -37, -50, -50, -62, -75, -75, -62, -50, -50, -37, -25, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+	0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+	0, 0, 25, 37, 51, 51, 63, 76, 76, 63, 51, 51, 37, 25, 0, 0, 0, 0, -25, -37, -51, -51, -63, -76, -76, -63, -51, -51, -37, -25, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+	0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+	0, 0, 26, 39, 52, 52, 65, 78, 78, 65, 52, 52, 39, 26, 0, 0, 0, 0, -26, -39, -52, -52, -65, -78, -78, -65, -52, -52, -39, -26, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+	0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+	0, 0, 26, 39, 53, 53, 66, 79, 79, 66, 53, 53, 39, 26, 0, 0, 0, 0, -26, -39, -53, -53, -66, -79, -79, -66, -53, -53, -39, -26, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+	0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+	0, 0, 27, 40, 54, 54, 67, 81, 81, 67, 54, 54, 40, 27, 0, 0, 0, 0, -27, -40, -54, -54, -67, -81, -81, -67, -54, -54, -40, -27, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+	0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+	0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+	0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+	0, 0, 27, 40, 55, 55, 68, 82, 82, 68, 55, 55, 40, 27, 0, 0, 0, 0, -27, -40, -55, -55, -68, -82, -82, -68, -55, -55, -40, -27, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+	0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+	0, 0, 28, 42, 56, 56, 70, 84, 84, 70, 56, 56, 42, 28, 0, 0, 0, 0, -28, -42, -56, -56, -70, -84, -84, -70, -56, -56, -42, -28, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+	0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+	0, 0, 28, 42, 57, 57, 71, 85, 85, 71, 57, 57, 42, 28, 0, 0, 0, 0, -28, -42, -57, -57, -71, -85, -85, -71, -57, -57, -42, -28, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+	0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+	0, 0, 29, 43, 58, 58, 72, 87, 87, 72, 58, 58, 43, 29, 0, 0, 0, 0, -29, -43, -58, -58, -72, -87, -87, -72, -58, -58, -43, -29, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+	0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+	0, 0, 29, 43, 59, 59, 73, 88, 88, 73, 59, 59, 43, 29, 0, 0, 0, 0, -29, -43, -59, -59, -73, -88, -88, -73, -59, -59, -43, -29, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+	0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+	0, 0, 30, 45, 60, 60, 75, 90, 90, 75, 60, 60, 45, 30, 0, 0, 0, 0, -30, -45, -60, -60, -75, -90, -90, -75, -60, -60, -45, -30, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+	0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+	0, 0, 30, 45, 61, 61, 76, 91, 91, 76, 61, 61, 45, 30, 0, 0, 0, 0, -30, -45, -61, -61, -76, -91, -91, -76, -61, -61, -45, -30, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+	0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+	0, 0, 31, 46, 62, 62, 77, 93, 93, 77, 62, 62, 46, 31, 0, 0, 0, 0, -31, -46, -62, -62, -77, -93, -93, -77, -62, -62, -46, -31, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+	0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+	0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+	0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+	0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+	0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+	0, 0, 31, 46, 63, 63, 78, 94, 94, 78, 63, 63, 46, 31, 0, 0, 0, 0, -31, -46, -63, -63, -78, -94, -94, -78, -63, -63, -46, -31, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+	0, 0, 16, 24, 32, 32, 40, 48, 48, 40, 32, 32, 24, 16, 0, 0, 0, 0, -16, -24, -32, -32, -40, -48, -48, -40, -32, -32, -24, -16, 0, 0,
+	0, 0, 32, 48, 64, 64, 80, 96, 96, 80, 64, 64, 48, 32, 0, 0, 0, 0, -32, -48, -64, -64, -80, -96, -96, -80, -64, -64, -48, -32, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+	0, 0, 16, 24, 32, 32, 40, 48, 48, 40, 32, 32, 24, 16, 0, 0, 0, 0, -16, -24, -32, -32, -40, -48, -48, -40, -32, -32, -24, -16, 0, 0,
+	0, 0, 32, 48, 65, 65, 81, 97, 97, 81, 65, 65, 48, 32, 0, 0, 0, 0, -32, -48, -65, -65, -81, -97, -97, -81, -65, -65, -48, -32, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+	0, 0, 16, 24, 33, 33, 41, 49, 49, 41, 33, 33, 24, 16, 0, 0, 0, 0, -16, -24, -33, -33, -41, -49, -49, -41, -33, -33, -24, -16, 0, 0,
+	0, 0, 33, 49, 66, 66, 82, 99, 99, 82, 66, 66, 49, 33, 0, 0, 0, 0, -33, -49, -66, -66, -82, -99, -99, -82, -66, -66, -49, -33, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+	0, 0, 16, 24, 33, 33, 41, 49, 49, 41, 33, 33, 24, 16, 0, 0, 0, 0, -16, -24, -33, -33, -41, -49, -49, -41, -33, -33, -24, -16, 0, 0,
+	0, 0, 33, 49, 67, 67, 83, 100, 100, 83, 67, 67, 49, 33, 0, 0, 0, 0, -33, -49, -67, -67, -83, -100, -100, -83, -67, -67, -49, -33, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+	0, 0, 17, 25, 34, 34, 42, 51, 51, 42, 34, 34, 25, 17, 0, 0, 0, 0, -17, -25, -34, -34, -42, -51, -51, -42, -34, -34, -25, -17, 0, 0,
+	0, 0, 34, 51, 68, 68, 85, 102, 102, 85, 68, 68, 51, 34, 0, 0, 0, 0, -34, -51, -68, -68, -85, -102, -102, -85, -68, -68, -51, -34, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+	0, 0, 17, 25, 34, 34, 42, 51, 51, 42, 34, 34, 25, 17, 0, 0, 0, 0, -17, -25, -34, -34, -42, -51, -51, -42, -34, -34, -25, -17, 0, 0,
+	0, 0, 34, 51, 69, 69, 86, 103, 103, 86, 69, 69, 51, 34, 0, 0, 0, 0, -34, -51, -69, -69, -86, -103, -103, -86, -69, -69, -51, -34, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+	0, 0, 17, 25, 35, 35, 43, 52, 52, 43, 35, 35, 25, 17, 0, 0, 0, 0, -17, -25, -35, -35, -43, -52, -52, -43, -35, -35, -25, -17, 0, 0,
+	0, 0, 35, 52, 70, 70, 87, 105, 105, 87, 70, 70, 52, 35, 0, 0, 0, 0, -35, -52, -70, -70, -87, -105, -105, -87, -70, -70, -52, -35, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+	0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+	0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+	0, 0, 17, 25, 35, 35, 43, 52, 52, 43, 35, 35, 25, 17, 0, 0, 0, 0, -17, -25, -35, -35, -43, -52, -52, -43, -35, -35, -25, -17, 0, 0,
+	0, 0, 35, 52, 71, 71, 88, 106, 106, 88, 71, 71, 52, 35, 0, 0, 0, 0, -35, -52, -71, -71, -88, -106, -106, -88, -71, -71, -52, -35, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+	0, 0, 18, 27, 36, 36, 45, 54, 54, 45, 36, 36, 27, 18, 0, 0, 0, 0, -18, -27, -36, -36, -45, -54, -54, -45, -36, -36, -27, -18, 0, 0,
+	0, 0, 36, 54, 72, 72, 90, 108, 108, 90, 72, 72, 54, 36, 0, 0, 0, 0, -36, -54, -72, -72, -90, -108, -108, -90, -72, -72, -54, -36, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+	0, 0, 18, 27, 36, 36, 45, 54, 54, 45, 36, 36, 27, 18, 0, 0, 0, 0, -18, -27, -36, -36, -45, -54, -54, -45, -36, -36, -27, -18, 0, 0,
+	0, 0, 36, 54, 73, 73, 91, 109, 109, 91, 73, 73, 54, 36, 0, 0, 0, 0, -36, -54, -73, -73, -91, -109, -109, -91, -73, -73, -54, -36, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+	0, 0, 18, 27, 37, 37, 46, 55, 55, 46, 37, 37, 27, 18, 0, 0, 0, 0, -18, -27, -37, -37, -46, -55, -55, -46, -37, -37, -27, -18, 0, 0,
+	0, 0, 37, 55, 74, 74, 92, 111, 111, 92, 74, 74, 55, 37, 0, 0, 0, 0, -37, -55, -74, -74, -92, -111, -111, -92, -74, -74, -55, -37, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+	0, 0, 18, 27, 37, 37, 46, 55, 55, 46, 37, 37, 27, 18, 0, 0, 0, 0, -18, -27, -37, -37, -46, -55, -55, -46, -37, -37, -27, -18, 0, 0,
+	0, 0, 37, 55, 75, 75, 93, 112, 112, 93, 75, 75, 55, 37, 0, 0, 0, 0, -37, -55, -75, -75, -93, -112, -112, -93, -75, -75, -55, -37, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+	0, 0, 19, 28, 38, 38, 47, 57, 57, 47, 38, 38, 28, 19, 0, 0, 0, 0, -19, -28, -38, -38, -47, -57, -57, -47, -38, -38, -28, -19, 0, 0,
+	0, 0, 38, 57, 76, 76, 95, 114, 114, 95, 76, 76, 57, 38, 0, 0, 0, 0, -38, -57, -76, -76, -95, -114, -114, -95, -76, -76, -57, -38, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+	0, 0, 19, 28, 38, 38, 47, 57, 57, 47, 38, 38, 28, 19, 0, 0, 0, 0, -19, -28, -38, -38, -47, -57, -57, -47, -38, -38, -28, -19, 0, 0,
+	0, 0, 38, 57, 77, 77, 96, 115, 115, 96, 77, 77, 57, 38, 0, 0, 0, 0, -38, -57, -77, -77, -96, -115, -115, -96, -77, -77, -57, -38, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+	0, 0, 19, 28, 39, 39, 48, 58, 58, 48, 39, 39, 28, 19, 0, 0, 0, 0, -19, -28, -39, -39, -48, -58, -58, -48, -39, -39, -28, -19, 0, 0,
+	0, 0, 39, 58, 78, 78, 97, 117, 117, 97, 78, 78, 58, 39, 0, 0, 0, 0, -39, -58, -78, -78, -97, -117, -117, -97, -78, -78, -58, -39, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+	0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+	0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+	0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+	0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+	0, 0, 19, 28, 39, 39, 48, 58, 58, 48, 39, 39, 28, 19, 0, 0, 0, 0, -19, -28, -39, -39, -48, -58, -58, -48, -39, -39, -28, -19, 0, 0,
+	0, 0, 39, 58, 79, 79, 98, 118, 118, 98, 79, 79, 58, 39, 0, 0, 0, 0, -39, -58, -79, -79, -98, -118, -118, -98, -79, -79, -58, -39, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+	0, 0, 20, 30, 40, 40, 50, 60, 60, 50, 40, 40, 30, 20, 0, 0, 0, 0, -20, -30, -40, -40, -50, -60, -60, -50, -40, -40, -30, -20, 0, 0,
+	0, 0, 40, 60, 80, 80, 100, 120, 120, 100, 80, 80, 60, 40, 0, 0, 0, 0, -40, -60, -80, -80, -100, -120, -120, -100, -80, -80, -60, -40, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+	0, 0, 20, 30, 40, 40, 50, 60, 60, 50, 40, 40, 30, 20, 0, 0, 0, 0, -20, -30, -40, -40, -50, -60, -60, -50, -40, -40, -30, -20, 0, 0,
+	0, 0, 40, 60, 81, 81, 101, 121, 121, 101, 81, 81, 60, 40, 0, 0, 0, 0, -40, -60, -81, -81, -101, -121, -121, -101, -81, -81, -60, -40, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+	0, 0, 20, 30, 41, 41, 51, 61, 61, 51, 41, 41, 30, 20, 0, 0, 0, 0, -20, -30, -41, -41, -51, -61, -61, -51, -41, -41, -30, -20, 0, 0,
+	0, 0, 41, 61, 82, 82, 102, 123, 123, 102, 82, 82, 61, 41, 0, 0, 0, 0, -41, -61, -82, -82, -102, -123, -123, -102, -82, -82, -61, -41, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+	0, 0, 20, 30, 41, 41, 51, 61, 61, 51, 41, 41, 30, 20, 0, 0, 0, 0, -20, -30, -41, -41, -51, -61, -61, -51, -41, -41, -30, -20, 0, 0,
+	0, 0, 41, 61, 83, 83, 103, 124, 124, 103, 83, 83, 61, 41, 0, 0, 0, 0, -41, -61, -83, -83, -103, -124, -124, -103, -83, -83, -61, -41, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+	0, 0, 21, 31, 42, 42, 52, 63, 63, 52, 42, 42, 31, 21, 0, 0, 0, 0, -21, -31, -42, -42, -52, -63, -63, -52, -42, -42, -31, -21, 0, 0,
+	0, 0, 42, 63, 84, 84, 105, 126, 126, 105, 84, 84, 63, 42, 0, 0, 0, 0, -42, -63, -84, -84, -105, -126, -126, -105, -84, -84, -63, -42, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+	0, 0, 21, 31, 42, 42, 52, 63, 63, 52, 42, 42, 31, 21, 0, 0, 0, 0, -21, -31, -42, -42, -52, -63, -63, -52, -42, -42, -31, -21, 0, 0,
+	0, 0, 42, 63, 85, 85, 106, 127, 127, 106, 85, 85, 63, 42, 0, 0, 0, 0, -42, -63, -85, -85, -106, -127, -127, -106, -85, -85, -63, -42, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+	0, 0, 21, 31, 43, 43, 53, 64, 64, 53, 43, 43, 31, 21, 0, 0, 0, 0, -21, -31, -43, -43, -53, -64, -64, -53, -43, -43, -31, -21, 0, 0,
+	0, 0, 43, 64, 86, 86, 107, 129, 129, 107, 86, 86, 64, 43, 0, 0, 0, 0, -43, -64, -86, -86, -107, -129, -129, -107, -86, -86, -64, -43, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+	0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+	0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+	0, 0, 21, 31, 43, 43, 53, 64, 64, 53, 43, 43, 31, 21, 0, 0, 0, 0, -21, -31, -43, -43, -53, -64, -64, -53, -43, -43, -31, -21, 0, 0,
+	0, 0, 43, 64, 87, 87, 108, 130, 130, 108, 87, 87, 64, 43, 0, 0, 0, 0, -43, -64, -87, -87, -108, -130, -130, -108, -87, -87, -64, -43, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+	0, 0, 22, 33, 44, 44, 55, 66, 66, 55, 44, 44, 33, 22, 0, 0, 0, 0, -22, -33, -44, -44, -55, -66, -66, -55, -44, -44, -33, -22, 0, 0,
+	0, 0, 44, 66, 88, 88, 110, 132, 132, 110, 88, 88, 66, 44, 0, 0, 0, 0, -44, -66, -88, -88, -110, -132, -132, -110, -88, -88, -66, -44, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+	0, 0, 22, 33, 44, 44, 55, 66, 66, 55, 44, 44, 33, 22, 0, 0, 0, 0, -22, -33, -44, -44, -55, -66, -66, -55, -44, -44, -33, -22, 0, 0,
+	0, 0, 44, 66, 89, 89, 111, 133, 133, 111, 89, 89, 66, 44, 0, 0, 0, 0, -44, -66, -89, -89, -111, -133, -133, -111, -89, -89, -66, -44, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+	0, 0, 22, 33, 45, 45, 56, 67, 67, 56, 45, 45, 33, 22, 0, 0, 0, 0, -22, -33, -45, -45, -56, -67, -67, -56, -45, -45, -33, -22, 0, 0,
+	0, 0, 45, 67, 90, 90, 112, 135, 135, 112, 90, 90, 67, 45, 0, 0, 0, 0, -45, -67, -90, -90, -112, -135, -135, -112, -90, -90, -67, -45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+	0, 0, 22, 33, 45, 45, 56, 67, 67, 56, 45, 45, 33, 22, 0, 0, 0, 0, -22, -33, -45, -45, -56, -67, -67, -56, -45, -45, -33, -22, 0, 0,
+	0, 0, 45, 67, 91, 91, 113, 136, 136, 113, 91, 91, 67, 45, 0, 0, 0, 0, -45, -67, -91, -91, -113, -136, -136, -113, -91, -91, -67, -45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+	0, 0, 23, 34, 46, 46, 57, 69, 69, 57, 46, 46, 34, 23, 0, 0, 0, 0, -23, -34, -46, -46, -57, -69, -69, -57, -46, -46, -34, -23, 0, 0,
+	0, 0, 46, 69, 92, 92, 115, 138, 138, 115, 92, 92, 69, 46, 0, 0, 0, 0, -46, -69, -92, -92, -115, -138, -138, -115, -92, -92, -69, -46, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+	0, 0, 23, 34, 46, 46, 57, 69, 69, 57, 46, 46, 34, 23, 0, 0, 0, 0, -23, -34, -46, -46, -57, -69, -69, -57, -46, -46, -34, -23, 0, 0,
+	0, 0, 46, 69, 93, 93, 116, 139, 139, 116, 93, 93, 69, 46, 0, 0, 0, 0, -46, -69, -93, -93, -116, -139, -139, -116, -93, -93, -69, -46, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+	0, 0, 23, 34, 47, 47, 58, 70, 70, 58, 47, 47, 34, 23, 0, 0, 0, 0, -23, -34, -47, -47, -58, -70, -70, -58, -47, -47, -34, -23, 0, 0,
+	0, 0, 47, 70, 94, 94, 117, 141, 141, 117, 94, 94, 70, 47, 0, 0, 0, 0, -47, -70, -94, -94, -117, -141, -141, -117, -94, -94, -70, -47, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+	0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+	0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+	0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+	0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+	0, 0, 23, 34, 47, 47, 58, 70, 70, 58, 47, 47, 34, 23, 0, 0, 0, 0, -23, -34, -47, -47, -58, -70, -70, -58, -47, -47, -34, -23, 0, 0,
+	0, 0, 47, 70, 95, 95, 118, 142, 142, 118, 95, 95, 70, 47, 0, 0, 0, 0, -47, -70, -95, -95, -118, -142, -142, -118, -95, -95, -70, -47, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+	0, 0, 24, 36, 48, 48, 60, 72, 72, 60, 48, 48, 36, 24, 0, 0, 0, 0, -24, -36, -48, -48, -60, -72, -72, -60, -48, -48, -36, -24, 0, 0,
+	0, 0, 48, 72, 96, 96, 120, 144, 144, 120, 96, 96, 72, 48, 0, 0, 0, 0, -48, -72, -96, -96, -120, -144, -144, -120, -96, -96, -72, -48, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+	0, 0, 24, 36, 48, 48, 60, 72, 72, 60, 48, 48, 36, 24, 0, 0, 0, 0, -24, -36, -48, -48, -60, -72, -72, -60, -48, -48, -36, -24, 0, 0,
+	0, 0, 48, 72, 97, 97, 121, 145, 145, 121, 97, 97, 72, 48, 0, 0, 0, 0, -48, -72, -97, -97, -121, -145, -145, -121, -97, -97, -72, -48, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+	0, 0, 24, 36, 49, 49, 61, 73, 73, 61, 49, 49, 36, 24, 0, 0, 0, 0, -24, -36, -49, -49, -61, -73, -73, -61, -49, -49, -36, -24, 0, 0,
+	0, 0, 49, 73, 98, 98, 122, 147, 147, 122, 98, 98, 73, 49, 0, 0, 0, 0, -49, -73, -98, -98, -122, -147, -147, -122, -98, -98, -73, -49, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+	0, 0, 24, 36, 49, 49, 61, 73, 73, 61, 49, 49, 36, 24, 0, 0, 0, 0, -24, -36, -49, -49, -61, -73, -73, -61, -49, -49, -36, -24, 0, 0,
+	0, 0, 49, 73, 99, 99, 123, 148, 148, 123, 99, 99, 73, 49, 0, 0, 0, 0, -49, -73, -99, -99, -123, -148, -148, -123, -99, -99, -73, -49, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+	0, 0, 25, 37, 50, 50, 62, 75, 75, 62, 50, 50, 37, 25, 0, 0, 0, 0, -25, -37, -50, -50, -62, -75, -75, -62, -50, -50, -37, -25, 0, 0,
+	0, 0, 50, 75, 100, 100, 125, 150, 150, 125, 100, 100, 75, 50, 0, 0, 0, 0, -50, -75, -100, -100, -125, -150, -150, -125, -100, -100, -75, -50, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+	0, 0, 25, 37, 50, 50, 62, 75, 75, 62, 50, 50, 37, 25, 0, 0, 0, 0, -25, -37, -50, -50, -62, -75, -75, -62, -50, -50, -37, -25, 0, 0,
+	0, 0, 50, 75, 101, 101, 126, 151, 151, 126, 101, 101, 75, 50, 0, 0, 0, 0, -50, -75, -101, -101, -126, -151, -151, -126, -101, -101, -75, -50, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+	0, 0, 25, 37, 51, 51, 63, 76, 76, 63, 51, 51, 37, 25, 0, 0, 0, 0, -25, -37, -51, -51, -63, -76, -76, -63, -51, -51, -37, -25, 0, 0,
+	0, 0, 51, 76, 102, 102, 127, 153, 153, 127, 102, 102, 76, 51, 0, 0, 0, 0, -51, -76, -102, -102, -127, -153, -153, -127, -102, -102, -76, -51, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+	0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+	0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+	0, 0, 25, 37, 51, 51, 63, 76, 76, 63, 51, 51, 37, 25, 0, 0, 0, 0, -25, -37, -51, -51, -63, -76, -76, -63, -51, -51, -37, -25, 0, 0,
+	0, 0, 51, 76, 103, 103, 128, 154, 154, 128, 103, 103, 76, 51, 0, 0, 0, 0, -51, -76, -103, -103, -128, -154, -154, -128, -103, -103, -76, -51, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+	0, 0, 26, 39, 52, 52, 65, 78, 78, 65, 52, 52, 39, 26, 0, 0, 0, 0, -26, -39, -52, -52, -65, -78, -78, -65, -52, -52, -39, -26, 0, 0,
+	0, 0, 52, 78, 104, 104, 130, 156, 156, 130, 104, 104, 78, 52, 0, 0, 0, 0, -52, -78, -104, -104, -130, -156, -156, -130, -104, -104, -78, -52, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+	0, 0, 26, 39, 52, 52, 65, 78, 78, 65, 52, 52, 39, 26, 0, 0, 0, 0, -26, -39, -52, -52, -65, -78, -78, -65, -52, -52, -39, -26, 0, 0,
+	0, 0, 52, 78, 105, 105, 131, 157, 157, 131, 105, 105, 78, 52, 0, 0, 0, 0, -52, -78, -105, -105, -131, -157, -157, -131, -105, -105, -78, -52, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+	0, 0, 26, 39, 53, 53, 66, 79, 79, 66, 53, 53, 39, 26, 0, 0, 0, 0, -26, -39, -53, -53, -66, -79, -79, -66, -53, -53, -39, -26, 0, 0,
+	0, 0, 53, 79, 106, 106, 132, 159, 159, 132, 106, 106, 79, 53, 0, 0, 0, 0, -53, -79, -106, -106, -132, -159, -159, -132, -106, -106, -79, -53, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+	0, 0, 26, 39, 53, 53, 66, 79, 79, 66, 53, 53, 39, 26, 0, 0, 0, 0, -26, -39, -53, -53, -66, -79, -79, -66, -53, -53, -39, -26, 0, 0,
+	0, 0, 53, 79, 107, 107, 133, 160, 160, 133, 107, 107, 79, 53, 0, 0, 0, 0, -53, -79, -107, -107, -133, -160, -160, -133, -107, -107, -79, -53, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+	0, 0, 27, 40, 54, 54, 67, 81, 81, 67, 54, 54, 40, 27, 0, 0, 0, 0, -27, -40, -54, -54, -67, -81, -81, -67, -54, -54, -40, -27, 0, 0,
+	0, 0, 54, 81, 108, 108, 135, 162, 162, 135, 108, 108, 81, 54, 0, 0, 0, 0, -54, -81, -108, -108, -135, -162, -162, -135, -108, -108, -81, -54, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+	0, 0, 27, 40, 54, 54, 67, 81, 81, 67, 54, 54, 40, 27, 0, 0, 0, 0, -27, -40, -54, -54, -67, -81, -81, -67, -54, -54, -40, -27, 0, 0,
+	0, 0, 54, 81, 109, 109, 136, 163, 163, 136, 109, 109, 81, 54, 0, 0, 0, 0, -54, -81, -109, -109, -136, -163, -163, -136, -109, -109, -81, -54, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+	0, 0, 27, 40, 55, 55, 68, 82, 82, 68, 55, 55, 40, 27, 0, 0, 0, 0, -27, -40, -55, -55, -68, -82, -82, -68, -55, -55, -40, -27, 0, 0,
+	0, 0, 55, 82, 110, 110, 137, 165, 165, 137, 110, 110, 82, 55, 0, 0, 0, 0, -55, -82, -110, -110, -137, -165, -165, -137, -110, -110, -82, -55, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+	0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+	0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+	0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+	0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+	0, 0, 27, 40, 55, 55, 68, 82, 82, 68, 55, 55, 40, 27, 0, 0, 0, 0, -27, -40, -55, -55, -68, -82, -82, -68, -55, -55, -40, -27, 0, 0,
+	0, 0, 55, 82, 111, 111, 138, 166, 166, 138, 111, 111, 82, 55, 0, 0, 0, 0, -55, -82, -111, -111, -138, -166, -166, -138, -111, -111, -82, -55, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+	0, 0, 28, 42, 56, 56, 70, 84, 84, 70, 56, 56, 42, 28, 0, 0, 0, 0, -28, -42, -56, -56, -70, -84, -84, -70, -56, -56, -42, -28, 0, 0,
+	0, 0, 56, 84, 112, 112, 140, 168, 168, 140, 112, 112, 84, 56, 0, 0, 0, 0, -56, -84, -112, -112, -140, -168, -168, -140, -112, -112, -84, -56, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+	0, 0, 28, 42, 56, 56, 70, 84, 84, 70, 56, 56, 42, 28, 0, 0, 0, 0, -28, -42, -56, -56, -70, -84, -84, -70, -56, -56, -42, -28, 0, 0,
+	0, 0, 56, 84, 113, 113, 141, 169, 169, 141, 113, 113, 84, 56, 0, 0, 0, 0, -56, -84, -113, -113, -141, -169, -169, -141, -113, -113, -84, -56, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+	0, 0, 28, 42, 57, 57, 71, 85, 85, 71, 57, 57, 42, 28, 0, 0, 0, 0, -28, -42, -57, -57, -71, -85, -85, -71, -57, -57, -42, -28, 0, 0,
+	0, 0, 57, 85, 114, 114, 142, 171, 171, 142, 114, 114, 85, 57, 0, 0, 0, 0, -57, -85, -114, -114, -142, -171, -171, -142, -114, -114, -85, -57, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+	0, 0, 28, 42, 57, 57, 71, 85, 85, 71, 57, 57, 42, 28, 0, 0, 0, 0, -28, -42, -57, -57, -71, -85, -85, -71, -57, -57, -42, -28, 0, 0,
+	0, 0, 57, 85, 115, 115, 143, 172, 172, 143, 115, 115, 85, 57, 0, 0, 0, 0, -57, -85, -115, -115, -143, -172, -172, -143, -115, -115, -85, -57, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+	0, 0, 29, 43, 58, 58, 72, 87, 87, 72, 58, 58, 43, 29, 0, 0, 0, 0, -29, -43, -58, -58, -72, -87, -87, -72, -58, -58, -43, -29, 0, 0,
+	0, 0, 58, 87, 116, 116, 145, 174, 174, 145, 116, 116, 87, 58, 0, 0, 0, 0, -58, -87, -116, -116, -145, -174, -174, -145, -116, -116, -87, -58, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+	0, 0, 29, 43, 58, 58, 72, 87, 87, 72, 58, 58, 43, 29, 0, 0, 0, 0, -29, -43, -58, -58, -72, -87, -87, -72, -58, -58, -43, -29, 0, 0,
+	0, 0, 58, 87, 117, 117, 146, 175, 175, 146, 117, 117, 87, 58, 0, 0, 0, 0, -58, -87, -117, -117, -146, -175, -175, -146, -117, -117, -87, -58, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+	0, 0, 29, 43, 59, 59, 73, 88, 88, 73, 59, 59, 43, 29, 0, 0, 0, 0, -29, -43, -59, -59, -73, -88, -88, -73, -59, -59, -43, -29, 0, 0,
+	0, 0, 59, 88, 118, 118, 147, 177, 177, 147, 118, 118, 88, 59, 0, 0, 0, 0, -59, -88, -118, -118, -147, -177, -177, -147, -118, -118, -88, -59, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+	0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+	0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+	0, 0, 29, 43, 59, 59, 73, 88, 88, 73, 59, 59, 43, 29, 0, 0, 0, 0, -29, -43, -59, -59, -73, -88, -88, -73, -59, -59, -43, -29, 0, 0,
+	0, 0, 59, 88, 119, 119, 148, 178, 178, 148, 119, 119, 88, 59, 0, 0, 0, 0, -59, -88, -119, -119, -148, -178, -178, -148, -119, -119, -88, -59, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+	0, 0, 30, 45, 60, 60, 75, 90, 90, 75, 60, 60, 45, 30, 0, 0, 0, 0, -30, -45, -60, -60, -75, -90, -90, -75, -60, -60, -45, -30, 0, 0,
+	0, 0, 60, 90, 120, 120, 150, 180, 180, 150, 120, 120, 90, 60, 0, 0, 0, 0, -60, -90, -120, -120, -150, -180, -180, -150, -120, -120, -90, -60, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+	0, 0, 30, 45, 60, 60, 75, 90, 90, 75, 60, 60, 45, 30, 0, 0, 0, 0, -30, -45, -60, -60, -75, -90, -90, -75, -60, -60, -45, -30, 0, 0,
+	0, 0, 60, 90, 121, 121, 151, 181, 181, 151, 121, 121, 90, 60, 0, 0, 0, 0, -60, -90, -121, -121, -151, -181, -181, -151, -121, -121, -90, -60, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+	0, 0, 30, 45, 61, 61, 76, 91, 91, 76, 61, 61, 45, 30, 0, 0, 0, 0, -30, -45, -61, -61, -76, -91, -91, -76, -61, -61, -45, -30, 0, 0,
+	0, 0, 61, 91, 122, 122, 152, 183, 183, 152, 122, 122, 91, 61, 0, 0, 0, 0, -61, -91, -122, -122, -152, -183, -183, -152, -122, -122, -91, -61, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+	0, 0, 30, 45, 61, 61, 76, 91, 91, 76, 61, 61, 45, 30, 0, 0, 0, 0, -30, -45, -61, -61, -76, -91, -91, -76, -61, -61, -45, -30, 0, 0,
+	0, 0, 61, 91, 123, 123, 153, 184, 184, 153, 123, 123, 91, 61, 0, 0, 0, 0, -61, -91, -123, -123, -153, -184, -184, -153, -123, -123, -91, -61, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+	0, 0, 31, 46, 62, 62, 77, 93, 93, 77, 62, 62, 46, 31, 0, 0, 0, 0, -31, -46, -62, -62, -77, -93, -93, -77, -62, -62, -46, -31, 0, 0,
+	0, 0, 62, 93, 124, 124, 155, 186, 186, 155, 124, 124, 93, 62, 0, 0, 0, 0, -62, -93, -124, -124, -155, -186, -186, -155, -124, -124, -93, -62, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+	0, 0, 31, 46, 62, 62, 77, 93, 93, 77, 62, 62, 46, 31, 0, 0, 0, 0, -31, -46, -62, -62, -77, -93, -93, -77, -62, -62, -46, -31, 0, 0,
+	0, 0, 62, 93, 125, 125, 156, 187, 187, 156, 125, 125, 93, 62, 0, 0, 0, 0, -62, -93, -125, -125, -156, -187, -187, -156, -125, -125, -93, -62, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+	0, 0, 31, 46, 63, 63, 78, 94, 94, 78, 63, 63, 46, 31, 0, 0, 0, 0, -31, -46, -63, -63, -78, -94, -94, -78, -63, -63, -46, -31, 0, 0,
+	0, 0, 63, 94, 126, 126, 157, 189, 189, 157, 126, 126, 94, 63, 0, 0, 0, 0, -63, -94, -126, -126, -157, -189, -189, -157, -126, -126, -94, -63, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+	0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+	0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+	0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+	0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+	0, 0, 31, 46, 63, 63, 78, 94, 94, 78, 63, 63, 46, 31, 0, 0, 0, 0, -31, -46, -63, -63, -78, -94, -94, -78, -63, -63, -46, -31, 0, 0,
+	0, 0, 63, 94, 127, 127, 158, 190, 190, 158, 127, 127, 94, 63, 0, 0, 0, 0, -63, -94, -127, -127, -158, -190, -190, -158, -127, -127, -94, -63, 0, 0,
+};
+
@@ -15,6 +15,7 @@
 #include "sound/sn76496.h"
 #include "cd/megasd.h"
 #include "state.h"
+#include "patch.h"
 
 static arearw    *areaRead;
 static arearw    *areaWrite;
@@ -191,14 +192,119 @@ static const char * const chunk_names[CHUNK_DEFAULT_COUNT] = {
   "32X events",
 };
 
-static int write_chunk(unsigned char name, int len, void *data, void *file)
+// chunk index, appended to state files after the terminating chunk.
+// The sequential loader stops before it, but it allows seeking directly
+// to single chunks (e.g. for gfx only loading).
+#define STATE_INDEX_MAGIC "PicoSIDX"
+#define STATE_INDEX_MAX   128
+#define STATE_INDEX_TRAIL 16 // u32 count, u32 offset, magic
+
+static struct state_index {
+  u8 chunk;
+  u32 offs, len;
+} state_index[STATE_INDEX_MAX];
+static int state_index_cnt;
+static int g_write_index;
+static int g_write_offs;
+
+static int write_chunk_hdr(unsigned char name, int len, void *file)
 {
   size_t bwritten = 0;
   bwritten += areaWrite(&name, 1, 1, file);
   bwritten += areaWrite(&len, 1, 4, file);
-  bwritten += areaWrite(data, 1, len, file);
 
-  return (bwritten == len + 4 + 1);
+  if (name && state_index_cnt < STATE_INDEX_MAX) {
+    struct state_index *si = &state_index[state_index_cnt++];
+    si->chunk = name, si->offs = g_write_offs + 5, si->len = len;
+  }
+  g_write_offs += bwritten;
+
+  return (bwritten == 4 + 1);
+}
+
+static int write_chunk(unsigned char name, int len, void *data, void *file)
+{
+  size_t bwritten;
+
+  if (!write_chunk_hdr(name, len, file))
+    return 0;
+  bwritten = areaWrite(data, 1, len, file);
+  g_write_offs += bwritten;
+
+  return (bwritten == len);
+}
+
+// save 1M mode word RAM in 2M format without converting it in place
+static int write_chunk_wram_1M(unsigned char name, u8 *buf, void *file)
+{
+  int offs, len = sizeof(Pico_mcd->word_ram2M);
+  size_t bwritten;
+
+  if (!write_chunk_hdr(name, len, file))
+    return 0;
+  for (offs = 0; offs < len; offs += 0x4000) {
+    wram_1M_to_2M_copy(buf, Pico_mcd->word_ram2M, offs, 0x4000);
+    bwritten = areaWrite(buf, 1, 0x4000, file);
+    g_write_offs += bwritten;
+    if (bwritten != 0x4000)
+      return 0;
+  }
+
+  return 1;
+}
+
+static int write_index(void *file, u8 *buf, size_t size)
+{
+  size_t b = 0;
+  int i;
+
+  if (state_index_cnt*9 + STATE_INDEX_TRAIL > size)
+    return 0;
+
+  for (i = 0; i < state_index_cnt; i++) {
+    save_u8_(buf, &b, state_index[i].chunk);
+    save_u32(buf, &b, state_index[i].offs);
+    save_u32(buf, &b, state_index[i].len);
+  }
+  save_u32(buf, &b, state_index_cnt);
+  save_u32(buf, &b, g_write_offs);
+  memcpy(buf + b, STATE_INDEX_MAGIC, 8);
+  b += 8;
+
+  return areaWrite(buf, 1, b, file) == b;
+}
+
+// returns number of index entries, 0 if the file has no index
+static int read_index(void *file)
+{
+  u8 buf[STATE_INDEX_MAX*9];
+  size_t b = 0;
+  int i, cnt, offs;
+
+  state_index_cnt = 0;
+  // not possible for compressed files, gzseek can't seek from the end
+  if (areaSeek(file, -STATE_INDEX_TRAIL, SEEK_END) != 0)
+    return 0;
+  if (areaRead(buf, 1, STATE_INDEX_TRAIL, file) != STATE_INDEX_TRAIL)
+    return 0;
+  if (memcmp(buf + 8, STATE_INDEX_MAGIC, 8))
+    return 0;
+
+  cnt = load_u32(buf, &b);
+  offs = load_u32(buf, &b);
+  if (cnt <= 0 || cnt > STATE_INDEX_MAX)
+    return 0;
+  if (areaSeek(file, offs, SEEK_SET) != 0)
+    return 0;
+  if (areaRead(buf, 1, cnt*9, file) != cnt*9)
+    return 0;
+
+  for (b = i = 0; i < cnt; i++) {
+    state_index[i].chunk = load_u8_(buf, &b);
+    state_index[i].offs = load_u32(buf, &b);
+    state_index[i].len = load_u32(buf, &b);
+  }
+  return state_index_cnt = cnt;
 }
 
 #define CHUNK_LIMIT_W 18772 // sizeof(cdc)
@@ -240,6 +346,8 @@ static int state_save(void *file)
 
   areaWrite("PicoSEXT", 1, 8, file);
   areaWrite(&ver, 1, 4, file);
+  g_write_offs = 12;
+  state_index_cnt = 0;
 
   if (!(PicoIn.AHW & PAHW_SMS)) {
     // the patches can cause incompatible saves with no-idle
@@ -302,14 +410,16 @@ static int state_save(void *file)
   {
     memset(buff, 0, sizeof(buff));
     SekPackCpu(buff, 1);
-    if (Pico_mcd->s68k_regs[3] & 4) // 1M mode?
-      wram_1M_to_2M(Pico_mcd->word_ram2M);
     memcpy(&Pico_mcd->m.hint_vector, Pico_mcd->bios + 0x72,
       sizeof(Pico_mcd->m.hint_vector));
 
     CHECKED_WRITE_BUFF(CHUNK_S68K,     buff);
     CHECKED_WRITE_BUFF(CHUNK_PRG_RAM,  Pico_mcd->prg_ram);
-    CHECKED_WRITE_BUFF(CHUNK_WORD_RAM, Pico_mcd->word_ram2M); // in 2M format
+    if (Pico_mcd->s68k_regs[3] & 4) { // 1M mode?
+      if (!write_chunk_wram_1M(CHUNK_WORD_RAM, buf2, file))
+        goto out;
+    } else
+      CHECKED_WRITE_BUFF(CHUNK_WORD_RAM, Pico_mcd->word_ram2M); // in 2M format
     CHECKED_WRITE_BUFF(CHUNK_PCM_RAM,  Pico_mcd->pcm_ram);
     CHECKED_WRITE_BUFF(CHUNK_BRAM,     Pico_mcd->bram);
     CHECKED_WRITE_BUFF(CHUNK_GA_REGS,  Pico_mcd->s68k_regs); // GA regs, not CPU regs
@@ -327,9 +437,6 @@ static int state_save(void *file)
     CHECKED_WRITE(CHUNK_CD_CDD, len, buf2);
 
     CHECKED_WRITE_BUFF(CHUNK_CD_MSD, Pico_msd);
-
-    if (Pico_mcd->s68k_regs[3] & 4) // convert back
-      wram_2M_to_1M(Pico_mcd->word_ram2M);
   }
 
 #ifndef NO_32X
@@ -373,6 +480,8 @@ static int state_save(void *file)
   }
 
   CHECKED_WRITE(0, 0, NULL);
+  if (g_write_index && !write_index(file, buf2, CHUNK_LIMIT_W))
+    goto out;
   retval = 0;
 
 out:
@@ -651,6 +760,7 @@ readend:
   if (!has_iov2)
     io_ports_reset();
 
+  PicoPatchRefresh();
   Pico.m.dirtyPal = 1;
   retval = 0;
 
@@ -659,9 +769,46 @@ out:
   return retval;
 }
 
+// returns 1 if a needed chunk was found, 0 if not, -1 on error
+static int state_load_gfx_chunk(void *file, int chunk, int len, u8 *buff_vdp, int *len_vdp)
+{
+  switch (chunk)
+  {
+    case CHUNK_VRAM:  CHECKED_READ_BUFF(PicoMem.vram);  return 1;
+    case CHUNK_CRAM:  CHECKED_READ_BUFF(PicoMem.cram);  return 1;
+    case CHUNK_VSRAM: CHECKED_READ_BUFF(PicoMem.vsram); return 1;
+    case CHUNK_VIDEO: CHECKED_READ_BUFF(Pico.video); return 1;
+    case CHUNK_VDP:   CHECKED_READ2((*len_vdp = len), buff_vdp); return 0;
+
+#ifndef NO_32X
+    case CHUNK_DRAM:
+      if (Pico32xMem != NULL)
+        CHECKED_READ_BUFF(Pico32xMem->dram);
+      return 1;
+
+    case CHUNK_32XPAL:
+      if (Pico32xMem != NULL)
+        CHECKED_READ_BUFF(Pico32xMem->pal);
+      Pico32x.dirty_pal = 1;
+      return 1;
+
+    case CHUNK_32XSYS:
+      CHECKED_READ_BUFF(Pico32x);
+      return 1;
+#endif
+    default:
+      areaSeek(file, len, SEEK_CUR);
+      return 0;
+  }
+
+out:
+readend:
+  return -1;
+}
+
 static int state_load_gfx(void *file)
 {
-  int ver, len, found = 0, to_find = 4;
+  int ver, len, i, ret, found = 0, to_find = 4;
   u8 buff_vdp[0x200];
   int len_vdp = 0;
   char buff[8];
@@ -675,6 +822,29 @@ static int state_load_gfx(void *file)
     R_ERROR_RETURN("bad header");
   CHECKED_READ(4, &ver);
 
+  if (read_index(file) > 0) {
+    // seek directly to the needed chunks
+    for (i = 0; i < state_index_cnt && found < to_find; i++) {
+      switch (state_index[i].chunk) {
+        case CHUNK_VRAM: case CHUNK_CRAM: case CHUNK_VSRAM: case CHUNK_VIDEO:
+        case CHUNK_VDP: case CHUNK_DRAM: case CHUNK_32XPAL: case CHUNK_32XSYS:
+          break;
+        default:
+          continue;
+      }
+      if (areaSeek(file, state_index[i].offs, SEEK_SET) != 0)
+        R_ERROR_RETURN("bad index");
+      g_read_offs = state_index[i].offs;
+      len = state_index[i].len;
+      ret = state_load_gfx_chunk(file, state_index[i].chunk, len, buff_vdp, &len_vdp);
+      if (ret < 0)
+        goto out;
+      found += ret;
+    }
+    goto done;
+  }
+  areaSeek(file, 12, SEEK_SET);
+
   while (!areaEof(file) && found < to_find)
   {
     CHECKED_READ(1, buff);
@@ -682,39 +852,16 @@ static int state_load_gfx(void *file)
     if (len < 0 || len > 1024*512) R_ERROR_RETURN("bad length");
     if (buff[0] > CHUNK_FM && buff[0] <= CHUNK_MISC_CD && !(PicoIn.AHW & PAHW_MCD))
       R_ERROR_RETURN("cd chunk in non CD state?");
+    if (!len && !buff[0])
+      break;
 
-    switch (buff[0])
-    {
-      case CHUNK_VRAM:  CHECKED_READ_BUFF(PicoMem.vram);  found++; break;
-      case CHUNK_CRAM:  CHECKED_READ_BUFF(PicoMem.cram);  found++; break;
-      case CHUNK_VSRAM: CHECKED_READ_BUFF(PicoMem.vsram); found++; break;
-      case CHUNK_VIDEO: CHECKED_READ_BUFF(Pico.video); found++; break;
-      case CHUNK_VDP:   CHECKED_READ2((len_vdp = len), buff_vdp); break;
-
-#ifndef NO_32X
-      case CHUNK_DRAM:
-        if (Pico32xMem != NULL)
-          CHECKED_READ_BUFF(Pico32xMem->dram);
-        found++;
-        break;
-
-      case CHUNK_32XPAL:
-        if (Pico32xMem != NULL)
-          CHECKED_READ_BUFF(Pico32xMem->pal);
-        found++;
-        Pico32x.dirty_pal = 1;
-        break;
-
-      case CHUNK_32XSYS:
-        CHECKED_READ_BUFF(Pico32x);
-        found++;
-        break;
-#endif
-      default:
-        areaSeek(file, len, SEEK_CUR);
-        break;
-    }
+    ret = state_load_gfx_chunk(file, buff[0], len, buff_vdp, &len_vdp);
+    if (ret < 0)
+      goto out;
+    found += ret;
   }
+
+done:
   PicoVideoLoad(buff_vdp, len_vdp);
 
 out:
@@ -726,10 +873,14 @@ static int pico_state_internal(void *afile, int is_save)
 {
   int ret;
 
+  // sound chips must be up to date before their state is accessed, and any
+  // writes logged while loading must be applied
+  PsndSync();
   if (is_save)
     ret = state_save(afile);
   else
     ret = state_load(afile);
+  PsndSync();
 
   return ret;
 }
@@ -743,7 +894,9 @@ int PicoState(const char *fname, int is_save)
   if (afile == NULL)
     return -1;
 
+  g_write_index = 1;
   ret = pico_state_internal(afile, is_save);
+  g_write_index = 0;
   areaClose(afile);
   return ret;
 }
@@ -415,6 +415,13 @@ int PicoVideoFIFOHint(void)
   return burn;
 }
 
+// check if there's no FIFO or DMA activity needing per-line processing
+int PicoVideoFIFOIdle(void)
+{
+  return !VdpFIFO.fifo_ql && !(Pico.video.status &
+            (PVS_CPUWR|PVS_CPURD|PVS_DMAFILL|PVS_DMABG|SR_DMA));
+}
+
 // switch FIFO mode between active/inactive display
 void PicoVideoFIFOMode(int active, int h40)
 {
@@ -458,6 +465,7 @@ static NOINLINE void VideoWriteVRAM128(u32 a, u16 d)
   u32 b = ((a & 2) >> 1) | ((a & 0x400) >> 9) | (a & 0x3FC) | ((a & 0x1F800) >> 1);
 
   ((u8 *)PicoMem.vram)[b] = d;
+  VideoDirtyVRAM(b);
   if (!(u16)((b^SATaddr) & SATmask))
     Pico.est.rendstatus |= PDRAW_DIRTY_SPRITES;
 
@@ -465,6 +473,15 @@ static NOINLINE void VideoWriteVRAM128(u32 a, u16 d)
     UpdateSAT(a, d);
 }
 
+static void VideoDirtyVRAMRange(u32 a, int len)
+{
+  u32 e = (a + len-1) & ~0x3ff;
+
+  for (a &= ~0x3ff; a != e; a += 0x400)
+    VideoDirtyVRAM(a);
+  VideoDirtyVRAM(e);
+}
+
 static void VideoWrite(u16 d)
 {
   struct PicoVideo *pvid = &Pico.video;
@@ -604,6 +621,7 @@ static void DmaSlow(int len, u32 source)
       {
         // most used DMA mode
         memcpy((char *)r + (u16)a, base + (source & mask), len * 2);
+        VideoDirtyVRAMRange((u16)a, len * 2);
         a += len * 2;
         break;
       }
@@ -691,6 +709,7 @@ static void DmaCopy(int len)
   for (; len; len--)
   {
     vr[(u16)a] = vr[(u16)(source++)];
+    VideoDirtyVRAM(a);
     if (((a^SATaddr) & SATmask) == 0)
       UpdateSAT(a, ((u16 *)vr)[(u16)a >> 1]);
     // AutoIncrement
@@ -726,6 +745,7 @@ static NOINLINE void DmaFill(int data)
       {
         // most used DMA mode
         memset(vr + (u16)a, high, len);
+        VideoDirtyVRAMRange((u16)a, len);
         a += len;
         break;
       }
@@ -733,6 +753,7 @@ static NOINLINE void DmaFill(int data)
         // Write upper byte to adjacent address
         // (here we are byteswapped, so address is already 'adjacent')
         vr[(u16)a] = high;
+        VideoDirtyVRAM(a);
         if (((a^SATaddr) & SATmask) == 0)
           UpdateSAT(a, ((u16 *)vr)[(u16)a >> 1]);
 
@@ -1224,6 +1245,7 @@ void PicoVideoReset(void)
 
   memset(&VdpFIFO, 0, sizeof(VdpFIFO));
   Pico.m.dirtyPal = 1;
+  VideoDirtyVRAMRange(0, 0x10000);
 
   PicoDrawBgcDMA(NULL, 0, 0, 0, 0);
   PicoVideoFIFOMode(pv->reg[1]&0x40, pv->reg[12]&1);
@@ -1272,6 +1294,9 @@ void PicoVideoCacheSAT(int load)
     ((u16 *)VdpSATCache)[l*2    ] = PicoMem.vram[(addr>>1)    ];
     ((u16 *)VdpSATCache)[l*2 + 1] = PicoMem.vram[(addr>>1) + 1];
   }
+  // VRAM has been reloaded
+  if (load)
+    VideoDirtyVRAMRange(0, 0x10000);
 
   Pico.est.rendstatus |= PDRAW_DIRTY_SPRITES;
 }
@@ -0,0 +1,296 @@
+/*
+ * PicoDrive
+ *
+ * A/V capture to a raw Y4M video and a WAV audio stream. Conversion and
+ * writing is done in a background thread, with double buffered frame data.
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <pthread.h>
+
+#include <pico/pico_int.h>
+#include "capture.h"
+
+#define CAP_W	320
+#define CAP_H	240
+#define CAP_SND	(4*4096)	// max audio bytes per frame
+
+// the emulation thread fills one slot while the writer handles the other
+struct cap_slot {
+	unsigned short pix[CAP_W*CAP_H];
+	unsigned char snd[CAP_SND];
+	int w, h;		// 0: no image, repeat the last one
+	int snd_len;
+	int full;		// handed over to the writer
+};
+
+static struct cap_slot *slots;
+static int cur, have_image;
+
+static FILE *vfile, *afile;
+static int vw, vh, fps;		// stream parameters, set by the 1st frame
+static int rate, chans;
+static unsigned int adata;	// audio bytes written
+static unsigned char *yuv;
+
+static pthread_t thr;
+static pthread_mutex_t mtx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cnd = PTHREAD_COND_INITIALIZER;
+static int thr_run, thr_exit;
+
+// writer thread
+
+static void put_le(unsigned char *p, unsigned int v, int bytes)
+{
+	for (; bytes > 0; bytes--, v >>= 8)
+		*p++ = v;
+}
+
+static void wav_header(unsigned int len)
+{
+	unsigned char h[44];
+
+	memcpy(h, "RIFF\0\0\0\0WAVEfmt \20\0\0\0\1\0", 22); // PCM
+	put_le(h +  4, len + 36, 4);
+	put_le(h + 22, chans, 2);
+	put_le(h + 24, rate, 4);
+	put_le(h + 28, rate * chans * 2, 4);
+	put_le(h + 32, chans * 2, 2);
+	put_le(h + 34, 16, 2);
+	memcpy(h + 36, "data", 4);
+	put_le(h + 40, len, 4);
+	fwrite(h, 1, sizeof(h), afile);
+}
+
+static void convert_yuv(struct cap_slot *s)
+{
+	unsigned char *py = yuv, *pu = yuv + vw*vh, *pv = pu + vw*vh;
+	int ox = (vw - s->w) / 2, oy = (vh - s->h) / 2;
+	int x, y, w = s->w, h = s->h;
+
+	if (w != vw || h != vh) {
+		// different size than the stream, center and crop
+		memset(py, 16, vw*vh);
+		memset(pu, 128, 2*vw*vh);
+	}
+	for (y = 0; y < h; y++) {
+		unsigned short *ps = s->pix + y*w;
+		int d = (y + oy) * vw + ox;
+
+		if (y + oy < 0 || y + oy >= vh)
+			continue;
+		for (x = 0; x < w; x++, ps++) {
+			unsigned int p = *ps;
+			int r, g, b;
+
+			if (x + ox < 0 || x + ox >= vw)
+				continue;
+#if defined(USE_BGR555)
+			r = (p << 3) & 0xf8, g = (p >> 2) & 0xf8, b = (p >> 7) & 0xf8;
+#elif defined(USE_BGR565)
+			r = (p << 3) & 0xf8, g = (p >> 3) & 0xfc, b = (p >> 8) & 0xf8;
+#else
+			r = (p >> 8) & 0xf8, g = (p >> 3) & 0xfc, b = (p << 3) & 0xf8;
+#endif
+			// BT.601, limited range
+			py[d+x] = 16 + ((66*r + 129*g + 25*b + 128) >> 8);
+			pu[d+x] = 128 + ((-38*r - 74*g + 112*b + 128) >> 8);
+			pv[d+x] = 128 + ((112*r - 94*g - 18*b + 128) >> 8);
+		}
+	}
+}
+
+static void capture_write(struct cap_slot *s)
+{
+	if (vfile) {
+		if (yuv == NULL) {
+			// 1st frame, image starts black
+			yuv = malloc(3*vw*vh);
+			if (yuv == NULL)
+				return;
+			memset(yuv, 16, vw*vh);
+			memset(yuv + vw*vh, 128, 2*vw*vh);
+			fprintf(vfile, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n",
+				vw, vh, fps);
+		}
+		if (s->w)
+			convert_yuv(s);
+		fputs("FRAME\n", vfile);
+		fwrite(yuv, 1, 3*vw*vh, vfile);
+	}
+	if (afile && s->snd_len) {
+		if (!CPU_IS_LE) {
+			unsigned char *p = s->snd, t;
+			int i;
+			for (i = 0; i < s->snd_len; i += 2)
+				t = p[i], p[i] = p[i+1], p[i+1] = t;
+		}
+		fwrite(s->snd, 1, s->snd_len, afile);
+		adata += s->snd_len;
+	}
+}
+
+static void *capture_thread(void *arg)
+{
+	int n = 0;
+
+	pthread_mutex_lock(&mtx);
+	for (;;) {
+		struct cap_slot *s = &slots[n];
+
+		while (!s->full && !thr_exit)
+			pthread_cond_wait(&cnd, &mtx);
+		if (!s->full)
+			break;
+		pthread_mutex_unlock(&mtx);
+
+		capture_write(s);
+
+		pthread_mutex_lock(&mtx);
+		s->full = 0;
+		pthread_cond_broadcast(&cnd);
+		n ^= 1;
+	}
+	pthread_mutex_unlock(&mtx);
+	return NULL;
+}
+
+// emulation thread
+
+int capture_start(const char *fname)
+{
+	int l = strlen(fname);
+	int audio = l > 4 && !strcasecmp(fname + l - 4, ".wav");
+	FILE *f;
+
+	if (thr_run || (audio ? afile : vfile) != NULL)
+		return -1;
+	if (slots == NULL && (slots = calloc(2, sizeof(*slots))) == NULL)
+		return -1;
+	f = fopen(fname, "wb");
+	if (f == NULL) {
+		lprintf("capture: can't open %s\n", fname);
+		return -1;
+	}
+	if (audio)
+		afile = f;
+	else
+		vfile = f;
+	return 0;
+}
+
+int capture_active(void)
+{
+	return vfile != NULL || afile != NULL;
+}
+
+int capture_audio_active(void)
+{
+	return afile != NULL;
+}
+
+void capture_video(const unsigned short *pix, int w, int h, int pitch)
+{
+	struct cap_slot *s;
+	int y;
+
+	if (!vfile || !slots)
+		return;
+	s = &slots[cur];
+	if (w > CAP_W) w = CAP_W;
+	if (h > CAP_H) h = CAP_H;
+	for (y = 0; y < h; y++, pix += pitch)
+		memcpy(s->pix + y*w, pix, w*2);
+	s->w = w, s->h = h;
+	have_image = 1;
+}
+
+void capture_audio(const void *samples, int bytes)
+{
+	struct cap_slot *s;
+
+	if (!afile || !slots)
+		return;
+	s = &slots[cur];
+	if (bytes > CAP_SND - s->snd_len)
+		bytes = CAP_SND - s->snd_len;
+	memcpy(s->snd + s->snd_len, samples, bytes);
+	s->snd_len += bytes;
+}
+
+void capture_frame_end(void)
+{
+	struct cap_slot *s;
+
+	if (!capture_active())
+		return;
+
+	if (!thr_run) {
+		// 1st frame, set up the streams and start the writer
+		s = &slots[cur];
+		vw = s->w ? s->w : CAP_W;
+		vh = s->h ? s->h : (Pico.m.pal ? 240 : 224);
+		fps = Pico.m.pal ? 50 : 60;
+		rate = PicoIn.sndRate;
+		chans = PicoIn.opt & POPT_EN_STEREO ? 2 : 1;
+		if (afile)
+			wav_header(~0U - 36); // length unknown, fixed on stop
+		thr_exit = 0;
+		if (pthread_create(&thr, NULL, capture_thread, NULL)) {
+			lprintf("capture: can't create thread\n");
+			capture_stop();
+			return;
+		}
+		thr_run = 1;
+	}
+
+	s = &slots[cur];
+	if (!have_image)
+		s->w = 0;
+	have_image = 0;
+
+	pthread_mutex_lock(&mtx);
+	s->full = 1;
+	pthread_cond_broadcast(&cnd);
+	cur ^= 1;
+	// wait if the writer is a whole frame behind, dropping would break sync
+	while (slots[cur].full)
+		pthread_cond_wait(&cnd, &mtx);
+	pthread_mutex_unlock(&mtx);
+	slots[cur].snd_len = 0;
+}
+
+void capture_stop(void)
+{
+	if (thr_run) {
+		pthread_mutex_lock(&mtx);
+		thr_exit = 1;
+		pthread_cond_broadcast(&cnd);
+		pthread_mutex_unlock(&mtx);
+		pthread_join(thr, NULL);
+		thr_run = 0;
+	}
+
+	if (afile) {
+		// fix the length in the header if the output is seekable
+		if (adata && fseek(afile, 0, SEEK_SET) == 0)
+			wav_header(adata);
+		fclose(afile);
+		afile = NULL;
+	}
+	if (vfile) {
+		fclose(vfile);
+		vfile = NULL;
+	}
+	free(slots);
+	free(yuv);
+	slots = NULL;
+	yuv = NULL;
+	cur = have_image = adata = 0;
+}
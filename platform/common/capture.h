@@ -0,0 +1,16 @@
+#ifndef __COMMON_CAPTURE_H__
+#define __COMMON_CAPTURE_H__
+
+// A/V capture to a Y4M video and/or a WAV audio stream (file or fifo)
+int  capture_start(const char *fname);	// .wav: audio, else video
+void capture_stop(void);
+int  capture_active(void);
+int  capture_audio_active(void);
+
+// collect the output of the current frame
+void capture_video(const unsigned short *pix, int w, int h, int pitch);
+void capture_audio(const void *samples, int bytes);
+// hand it over to the writer. Repeats the last image if there was none
+void capture_frame_end(void);
+
+#endif
@@ -89,7 +89,8 @@ SRCS_COMMON += $(R)pico/pico.c $(R)pico/cart.c $(R)pico/memory.c \
 	$(R)pico/state.c $(R)pico/sek.c $(R)pico/z80if.c \
 	$(R)pico/videoport.c $(R)pico/draw2.c $(R)pico/draw.c \
 	$(R)pico/mode4.c $(R)pico/misc.c $(R)pico/eeprom.c \
-	$(R)pico/patch.c $(R)pico/debug.c $(R)pico/media.c
+	$(R)pico/patch.c $(R)pico/debug.c $(R)pico/media.c \
+	$(R)pico/movie.c
 # SMS
 ifneq "$(no_sms)" "1"
 SRCS_COMMON += $(R)pico/sms.c
@@ -101,6 +102,10 @@ SRCS_COMMON += $(R)pico/cd/mcd.c $(R)pico/cd/memory.c $(R)pico/cd/sek.c \
 	$(R)pico/cd/cdc.c $(R)pico/cd/cdd.c $(R)pico/cd/cd_image.c \
 	$(R)pico/cd/cd_parse.c $(R)pico/cd/gfx.c $(R)pico/cd/gfx_dma.c \
 	$(R)pico/cd/misc.c $(R)pico/cd/pcm.c $(R)pico/cd/megasd.c
+ifeq "$(use_cdcache)" "1"
+DEFINES += USE_CD_CACHE
+LDFLAGS += -lpthread
+endif
 # 32X
 ifneq "$(no_32x)" "1"
 SRCS_COMMON += $(R)pico/32x/32x.c $(R)pico/32x/memory.c $(R)pico/32x/draw.c \
@@ -126,6 +131,10 @@ SRCS_COMMON += $(R)pico/sound/sound.c $(R)pico/sound/resampler.c
 SRCS_COMMON += $(R)pico/sound/sn76496.c $(R)pico/sound/ym2612.c
 SRCS_COMMON += $(R)pico/sound/ym2413.c
 SRCS_COMMON += $(R)pico/sound/vgm.c
+ifeq "$(use_sndthread)" "1"
+DEFINES += USE_SND_THREAD
+LDFLAGS += -lpthread
+endif
 ifneq "$(ARCH)$(asm_mix)" "arm1"
 SRCS_COMMON += $(R)pico/sound/mix.c
 endif
@@ -145,6 +154,9 @@ endif
 ifeq "$(use_fame)" "1"
 DEFINES += EMU_F68K
 SRCS_COMMON += $(R)cpu/fame/famec.c
+ifeq "$(fame_gotos)" "1"
+$(R)cpu/fame/famec.o: CFLAGS += -DFAMEC_USE_GOTOS
+endif
 endif
 
 # --- Z80 ---
@@ -27,6 +27,10 @@
 #include "input_pico.h"
 #include "menu_pico.h"
 #include "config_file.h"
+#include "sndring.h"
+#ifdef HAVE_CAPTURE
+#include "capture.h"
+#endif
 
 #include <pico/pico_int.h>
 #include <pico/patch.h>
@@ -78,10 +82,6 @@ int reset_timing = 0;
 static unsigned int notice_msg_time;	/* when started showing */
 static char noticeMsg[40];
 
-unsigned char *movie_data = NULL;
-static int movie_size = 0;
-
-
 /* don't use tolower() for easy old glibc binary compatibility */
 static void strlwr_(char *string)
 {
@@ -413,6 +413,7 @@ int emu_reload_rom(const char *rom_fname_in)
 	char ext[5];
 	enum media_type_e media_type;
 	int menu_romload_started = 0;
+	int is_movie = 0;
 	char carthw_path[512];
 	int retval = 0;
 
@@ -426,47 +427,24 @@ int emu_reload_rom(const char *rom_fname_in)
 
 	// early cleanup
 	PicoPatchUnload();
-	if (movie_data) {
-		free(movie_data);
-		movie_data = 0;
-	}
 
-	if (!strcasecmp(ext, ".gmv"))
+	if (!strcasecmp(ext, ".gmv") || !strcasecmp(ext, ".pmv"))
 	{
-		// check for both gmv and rom
+		// check for both movie and rom
 		int dummy;
-		FILE *movie_file = fopen(rom_fname, "rb");
-		if (!movie_file) {
-			menu_update_msg("Failed to open movie.");
-			goto out;
-		}
-		fseek(movie_file, 0, SEEK_END);
-		movie_size = ftell(movie_file);
-		fseek(movie_file, 0, SEEK_SET);
-		if (movie_size < 64+3) {
-			menu_update_msg("Invalid GMV file.");
-			fclose(movie_file);
-			goto out;
-		}
-		movie_data = malloc(movie_size);
-		if (movie_data == NULL) {
-			menu_update_msg("low memory.");
-			fclose(movie_file);
-			goto out;
-		}
-		dummy = fread(movie_data, 1, movie_size, movie_file);
-		fclose(movie_file);
-		if (strncmp((char *)movie_data, "Gens Movie TEST", 15) != 0) {
-			menu_update_msg("Invalid GMV file.");
+		if (PicoMoviePlay(rom_fname) != 0) {
+			menu_update_msg("Invalid movie file.");
 			goto out;
 		}
 		dummy = try_rfn_cut(rom_fname) || try_rfn_cut(rom_fname);
 		if (!dummy) {
+			PicoMovieStop();
 			menu_update_msg("Could't find a ROM for movie.");
 			goto out;
 		}
 		get_ext(rom_fname, ext);
-		lprintf("gmv loaded for %s\n", rom_fname);
+		lprintf("movie loaded for %s\n", rom_fname);
+		is_movie = 1;
 	}
 	else if (!strcasecmp(ext, ".pat"))
 	{
@@ -517,26 +495,12 @@ int emu_reload_rom(const char *rom_fname_in)
 		PicoPatchApply();
 	}
 
-	// additional movie stuff
-	if (movie_data)
+	// input devices and options are set by the movie on its 1st frame
+	if (is_movie)
 	{
-		enum input_device indev = (movie_data[0x14] == '6') ?
-			PICO_INPUT_PAD_6BTN : PICO_INPUT_PAD_3BTN;
-		PicoSetInputDevice(0, indev);
-		PicoSetInputDevice(1, indev);
-
-		PicoIn.opt |= POPT_DIS_VDP_FIFO; // no VDP fifo timing
-		if (movie_data[0xF] >= 'A') {
-			if (movie_data[0x16] & 0x80) {
-				PicoIn.regionOverride = 8;
-			} else {
-				PicoIn.regionOverride = 4;
-			}
-			PicoReset();
-			// TODO: bits 6 & 5
-		}
-		movie_data[0x18+30] = 0;
-		emu_status_msg("MOVIE: %s", (char *) &movie_data[0x18]);
+		unsigned int frames;
+		PicoMovieStatus(NULL, &frames);
+		emu_status_msg("MOVIE: %u frames", frames);
 	}
 	else
 	{
@@ -683,6 +647,8 @@ void emu_prep_defconfig(void)
 	defaultConfig.msh2_khz = PICO_MSH2_HZ / 1000;
 	defaultConfig.ssh2_khz = PICO_SSH2_HZ / 1000;
 	defaultConfig.max_skip = 4;
+	defaultConfig.ff_skip = 8;
+	defaultConfig.ff_opts = FFOPT_NO_SOUND | FFOPT_NO_FIFO | FFOPT_FAST_IDLE;
 	defaultConfig.h32_layer = 0;
 
 	// platform specific overrides
@@ -845,33 +811,6 @@ void emu_osd_text16(int x, int y, const char *text)
 	emu_text_out16(x, y, text);
 }
 
-static void update_movie(void)
-{
-	int offs = Pico.m.frame_count*3 + 0x40;
-	if (offs+3 > movie_size) {
-		free(movie_data);
-		movie_data = 0;
-		emu_status_msg("END OF MOVIE.");
-		lprintf("END OF MOVIE.\n");
-	} else {
-		// MXYZ SACB RLDU
-		PicoIn.pad[0] = ~movie_data[offs]   & 0x8f; // ! SCBA RLDU
-		if(!(movie_data[offs]   & 0x10)) PicoIn.pad[0] |= 0x40; // C
-		if(!(movie_data[offs]   & 0x20)) PicoIn.pad[0] |= 0x10; // A
-		if(!(movie_data[offs]   & 0x40)) PicoIn.pad[0] |= 0x20; // B
-		PicoIn.pad[1] = ~movie_data[offs+1] & 0x8f; // ! SCBA RLDU
-		if(!(movie_data[offs+1] & 0x10)) PicoIn.pad[1] |= 0x40; // C
-		if(!(movie_data[offs+1] & 0x20)) PicoIn.pad[1] |= 0x10; // A
-		if(!(movie_data[offs+1] & 0x40)) PicoIn.pad[1] |= 0x20; // B
-		PicoIn.pad[0] |= (~movie_data[offs+2] & 0x0A) << 8; // ! MZYX
-		if(!(movie_data[offs+2] & 0x01)) PicoIn.pad[0] |= 0x0400; // X
-		if(!(movie_data[offs+2] & 0x04)) PicoIn.pad[0] |= 0x0100; // Z
-		PicoIn.pad[1] |= (~movie_data[offs+2] & 0xA0) << 4; // ! MZYX
-		if(!(movie_data[offs+2] & 0x10)) PicoIn.pad[1] |= 0x0400; // X
-		if(!(movie_data[offs+2] & 0x40)) PicoIn.pad[1] |= 0x0100; // Z
-	}
-}
-
 static int try_ropen_file(const char *fname, int *time)
 {
 	struct stat st;
@@ -1039,26 +978,47 @@ int emu_save_load_game(int load, int sram)
 	}
 }
 
+// switch to/from the fast forward profile. Called between frames, so the
+// emulation is run with one set of options for each whole frame.
 void emu_set_fastforward(int set_on)
 {
 	static void *set_PsndOut = NULL;
-	static int set_Frameskip, set_EmuOpt, is_on = 0;
+	static void (*set_writeSound)(int len) = NULL;
+	static int set_Frameskip, set_EmuOpt, set_PicoOpt, is_on = 0;
+	static int opt_mask;
 
 	if (set_on && !is_on) {
 		set_PsndOut = PicoIn.sndOut;
+		set_writeSound = PicoIn.writeSound;
 		set_Frameskip = currentConfig.Frameskip;
 		set_EmuOpt = currentConfig.EmuOpt;
-		PicoIn.sndOut = NULL;
-		currentConfig.Frameskip = 8;
+		set_PicoOpt = PicoIn.opt;
+		if (currentConfig.ff_opts & FFOPT_NO_SOUND)
+			PicoIn.sndOut = NULL;
+		else	// keep the sound chips running, but don't output
+			PicoIn.writeSound = NULL;
+		currentConfig.Frameskip = currentConfig.ff_skip;
 		currentConfig.EmuOpt &= ~EOPT_EN_SOUND;
 		currentConfig.EmuOpt |= EOPT_NO_FRMLIMIT;
+		opt_mask = 0;
+		// these change emulation timing, a movie would desync
+		if (!PicoMovieStatus(NULL, NULL)) {
+			if (currentConfig.ff_opts & FFOPT_NO_FIFO)
+				opt_mask |= POPT_DIS_VDP_FIFO;
+			if (currentConfig.ff_opts & FFOPT_FAST_IDLE)
+				opt_mask |= POPT_FAST_IDLE;
+		}
+		PicoIn.opt |= opt_mask;
 		is_on = 1;
 		emu_status_msg("FAST FORWARD");
 	}
 	else if (!set_on && is_on) {
 		PicoIn.sndOut = set_PsndOut;
+		PicoIn.writeSound = set_writeSound;
 		currentConfig.Frameskip = set_Frameskip;
 		currentConfig.EmuOpt = set_EmuOpt;
+		// only restore what was changed, the rest may have been toggled
+		PicoIn.opt = (PicoIn.opt & ~opt_mask) | (set_PicoOpt & opt_mask);
 		PsndRerate(1);
 		is_on = 0;
 	}
@@ -1482,8 +1442,10 @@ void emu_update_input(void)
 		run_events_pico(events);
 	if (events)
 		run_events_ui(events);
-	if (movie_data)
-		update_movie();
+	if (PicoMovieFrame() < 0) {
+		emu_status_msg("END OF MOVIE.");
+		lprintf("END OF MOVIE.\n");
+	}
 
 	prev_events = actions[IN_BINDTYPE_EMU] & PEV_MASK;
 }
@@ -1580,13 +1542,35 @@ void emu_finish(void)
 
 	pprof_finish();
 
+#ifdef HAVE_CAPTURE
+	capture_stop();
+#endif
 	PicoExit();
 	sndout_exit();
 }
 
+// samples written to sndout, for the output rate control (see below)
+static int snd_written;
+
 static void snd_write_nonblocking(int len)
 {
+#ifdef HAVE_CAPTURE
+	capture_audio(PicoIn.sndOut, len);
+	if (!(currentConfig.EmuOpt & EOPT_EN_SOUND))
+		return;
+#endif
 	sndout_write_nb(PicoIn.sndOut, len);
+	snd_written += len / (PicoIn.opt & POPT_EN_STEREO ? 4 : 2);
+}
+
+static int emu_sound_needed(void)
+{
+#ifdef HAVE_CAPTURE
+	// audio capture needs sound output even if sound is disabled
+	if (capture_audio_active())
+		return 1;
+#endif
+	return currentConfig.EmuOpt & EOPT_EN_SOUND;
 }
 
 void emu_sound_start(void)
@@ -1596,7 +1580,7 @@ void emu_sound_start(void)
 	// auto-select rate?
 	if (PicoIn.sndRate > 52000 && PicoIn.sndRate < 54000)
 		PicoIn.sndRate = YM2612_NATIVE_RATE();
-	if (currentConfig.EmuOpt & EOPT_EN_SOUND)
+	if (emu_sound_needed())
 	{
 		int is_stereo = (PicoIn.opt & POPT_EN_STEREO) ? 1 : 0;
 
@@ -1607,9 +1591,11 @@ void emu_sound_start(void)
 		printf("starting audio: %i len: %i stereo: %i, pal: %i\n",
 			PicoIn.sndRate, Pico.snd.len, is_stereo, Pico.m.pal);
 
-		sndout_start(PicoIn.sndRate, is_stereo);
 		PicoIn.writeSound = snd_write_nonblocking;
-		plat_update_volume(0, 0);
+		if (currentConfig.EmuOpt & EOPT_EN_SOUND) {
+			sndout_start(PicoIn.sndRate, is_stereo);
+			plat_update_volume(0, 0);
+		}
 	}
 }
 
@@ -1666,11 +1652,120 @@ static void emu_loop_prep(void)
 	pemu_loop_prep();
 }
 
+/* check if presenting the last emulated frame can be left out since it
+ * didn't change. Only for SDL, other platforms may need to flip anyway */
+static int emu_frame_is_dupe(const char *notice, int osd_changed)
+{
+#ifdef USE_SDL
+	if (PicoIn.frameChanged || notice != NULL || osd_changed)
+		return 0;
+	// things pemu_finalize_frame draws on top of the emulated image
+	if ((currentConfig.ghosting && (PicoIn.AHW & PAHW_GG)) ||
+	    (PicoIn.AHW & PAHW_PICO) || kbd_mode ||
+	    (currentConfig.EmuOpt & EOPT_GUN_CURSOR) ||
+	    ((PicoIn.AHW & PAHW_MCD) && (currentConfig.EmuOpt & EOPT_EN_CD_LEDS)))
+		return 0;
+	return 1;
+#else
+	return 0;
+#endif
+}
+
 /* our tick here is 1 us right now */
 #define ms_to_ticks(x)	(int)(x * 1000)
 #define get_ticks()	plat_get_ticks_us()
 #define vsync_delay	ms_to_ticks(1)
 
+/*
+ * adaptive frame delay: wait part of the frame time before reading input
+ * and emulating, so that input is sampled as late as possible. The time
+ * left for emulation is the 99th percentile of the recent frame times
+ * (2nd slowest of 128) with some margin, it's raised at once on a miss.
+ */
+#define fdelay_window	128
+#define fdelay_margin	ms_to_ticks(2)
+
+static int fdelay_budget, fdelay_cnt;
+static int fdelay_max1, fdelay_max2;
+
+static void frame_delay_reset(int target_frametime)
+{
+	fdelay_budget = target_frametime;
+	fdelay_cnt = fdelay_max1 = fdelay_max2 = 0;
+}
+
+static void frame_delay_update(int cost, int target_frametime)
+{
+	if (cost > fdelay_max1)
+		fdelay_max2 = fdelay_max1, fdelay_max1 = cost;
+	else if (cost > fdelay_max2)
+		fdelay_max2 = cost;
+
+	if (cost > fdelay_budget) {
+		// too late, start over with what would have been enough
+		fdelay_budget = cost + fdelay_margin;
+		fdelay_cnt = fdelay_max1 = fdelay_max2 = 0;
+	}
+	else if (++fdelay_cnt == fdelay_window) {
+		fdelay_budget = fdelay_max2 + fdelay_margin;
+		fdelay_cnt = fdelay_max1 = fdelay_max2 = 0;
+	}
+	if (fdelay_budget > target_frametime)
+		fdelay_budget = target_frametime;
+}
+
+/*
+ * sound output rate control. sndout can't tell its fill level, so it's
+ * estimated from the samples written and the time passed, at which rate the
+ * driver consumes them. Slightly more or fewer samples are produced per frame
+ * to keep it steady, e.g. if the display paces the frames at a rate somewhat
+ * off the emulated one, instead of dropping samples or running dry.
+ */
+#define snd_rate_frames	2 // estimated fill level to aim for, in frames
+
+static long long snd_fill;	// in samples * ticks per second
+static unsigned int snd_fill_ticks;
+
+static void snd_rate_reset(unsigned int ticks)
+{
+	snd_fill = (long long)Pico.snd.len * snd_rate_frames * ms_to_ticks(1000);
+	snd_fill_ticks = ticks;
+	snd_written = 0;
+	PsndSetRateAdjust(0);
+}
+
+static void snd_rate_update(unsigned int ticks)
+{
+	int target = Pico.snd.len * snd_rate_frames;
+
+	snd_fill += (long long)snd_written * ms_to_ticks(1000);
+	snd_fill -= (long long)(ticks - snd_fill_ticks) * PicoIn.sndRate;
+	snd_fill_ticks = ticks;
+	snd_written = 0;
+	// the driver plays silence if empty and drops samples if full
+	if (snd_fill < 0)
+		snd_fill = 0;
+	if (snd_fill > 2LL * target * ms_to_ticks(1000))
+		snd_fill = 2LL * target * ms_to_ticks(1000);
+
+	PsndSetRateAdjust(sndring_fill_adjust(snd_fill / ms_to_ticks(1000), target));
+}
+
+static void snd_rate_frame(unsigned int ticks, int reset)
+{
+	// other writers (e.g. PSP) have their own control
+	if (PicoIn.writeSound != snd_write_nonblocking || PicoIn.sndOut == NULL)
+		return;
+#ifdef HAVE_CAPTURE
+	// the captured audio must stay in step with the captured frames
+	reset |= capture_active();
+#endif
+	if (reset || (currentConfig.EmuOpt & EOPT_NO_FRMLIMIT))
+		snd_rate_reset(ticks);
+	else
+		snd_rate_update(ticks);
+}
+
 void emu_loop(void)
 {
 	int frames_done, frames_shown;	/* actual frames for fps counter */
@@ -1681,6 +1776,7 @@ void emu_loop(void)
 	char *notice_msg = NULL;
 	char fpsbuff[24];
 	int fskip_cnt = 0;
+	int osd_changed = 1;
 
 	fpsbuff[0] = 0;
 
@@ -1698,11 +1794,13 @@ void emu_loop(void)
 
 	reset_timing = 1;
 	frames_done = frames_shown = 0;
+	frame_delay_reset(target_frametime);
 
 	/* loop with resync every 1 sec. */
 	while (engineState == PGS_Running)
 	{
-		int skip = 0;
+		int skip = 0, dupe = 0, fdelay, was_reset = reset_timing;
+		unsigned int timestamp_emu = 0;
 		int diff;
 
 		pprof_start(main);
@@ -1719,6 +1817,7 @@ void emu_loop(void)
 		}
 
 		timestamp = get_ticks();
+		snd_rate_frame(timestamp, was_reset);
 
 		// show notice_msg message?
 		if (notice_msg_time != 0)
@@ -1730,6 +1829,7 @@ void emu_loop(void)
 				notice_msg_time = 0;
 				notice_msg = NULL;
 				plat_status_msg_clear();
+				osd_changed = 1;
 			}
 			else {
 				int sum = noticeMsg[0] + noticeMsg[1] + noticeMsg[2];
@@ -1761,6 +1861,7 @@ void emu_loop(void)
 #endif
 			frames_shown = frames_done = 0;
 			timestamp_fps += ms_to_ticks(1000);
+			osd_changed = 1;
 		}
 #ifdef PFRAMES
 		sprintf(fpsbuff, "%i", Pico.m.frame_count);
@@ -1798,13 +1899,30 @@ void emu_loop(void)
 			diff = timestamp_aim - timestamp;
 		}
 
-		emu_update_input();
-
+#ifdef HAVE_CAPTURE
+		// the captured streams need every frame
+		if (capture_active())
+			skip = fskip_cnt = 0;
+#endif
 		// 3D glasses
 		skip |= (PicoIn.AHW & PAHW_SMS) &&
 			(Pico.m.hardware & PMS_HW_3D) &&
 			(PicoMem.zram[0x1ffb] & 1);
 
+		// the frame should be done when the frame limiter would end waiting
+		fdelay = (currentConfig.EmuOpt & EOPT_FRAME_DELAY) && !skip
+		    && !(currentConfig.EmuOpt & (EOPT_NO_FRMLIMIT|EOPT_EXT_FRMLIMIT));
+		if (fdelay) {
+			int wait = diff - vsync_delay - fdelay_budget;
+			if (wait > target_frametime)
+				wait = target_frametime;
+			if (wait > 0)
+				plat_wait_till_us(timestamp + wait);
+			timestamp_emu = get_ticks();
+		}
+
+		emu_update_input();
+
 		if (skip) {
 			int do_audio = diff > -target_frametime * 2;
 			PicoIn.skipFrame = do_audio ? 1 : 2;
@@ -1813,13 +1931,23 @@ void emu_loop(void)
 		}
 		else {
 			PicoFrame();
-			pemu_finalize_frame(fpsbuff, notice_msg);
+			// image unchanged, no need to convert and flip it again
+			dupe = emu_frame_is_dupe(notice_msg, osd_changed);
+			if (!dupe) {
+				pemu_finalize_frame(fpsbuff, notice_msg);
+				osd_changed = 0;
+			}
 			frames_shown++;
 		}
+		if (fdelay)
+			frame_delay_update(get_ticks() - timestamp_emu, target_frametime);
+#ifdef HAVE_CAPTURE
+		capture_frame_end();
+#endif
 		frames_done++;
 		timestamp_aim += target_frametime;
 
-		if (!skip && !flip_after_sync)
+		if (!skip && !dupe && !flip_after_sync)
 			plat_video_flip();
 
 		/* frame limiter */
@@ -1842,7 +1970,7 @@ void emu_loop(void)
 			}
 		}
 
-		if (!skip && flip_after_sync)
+		if (!skip && !dupe && flip_after_sync)
 			plat_video_flip();
 
 		pprof_end(main);
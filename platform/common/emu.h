@@ -37,6 +37,12 @@ extern int g_screen_ppitch; // pitch in pixels
 #define EOPT_PICO_PEN     (1<<21)
 #define EOPT_MOUSE        (1<<22)
 #define EOPT_GUN_CURSOR   (1<<23)
+#define EOPT_FRAME_DELAY  (1<<24) // adaptive delay before input and emulation
+
+// cheaper emulation while fast forwarding (currentConfig.ff_opts)
+#define FFOPT_NO_SOUND    (1<<0)  // don't render sound at all, else only muted
+#define FFOPT_NO_FIFO     (1<<1)  // no VDP FIFO timing
+#define FFOPT_FAST_IDLE   (1<<2)  // detect idle/polling CPUs sooner
 
 enum {
 	EOPT_SCALE_NONE = 0,
@@ -102,13 +108,14 @@ typedef struct _currentConfig_t {
 	int overclock_68k;
 	int max_skip;
 	int h32_layer;
+	int ff_skip;  // frames skipped after each shown one while fast forwarding
+	int ff_opts;  // FFOPT_*
 } currentConfig_t;
 
 extern currentConfig_t currentConfig, defaultConfig;
 extern const char *PicoConfigFile;
 extern int state_slot;
 extern int config_slot, config_slot_current;
-extern unsigned char *movie_data;
 extern int reset_timing;
 extern int flip_after_sync;
 extern int kbd_mode;
@@ -19,6 +19,10 @@
 #include "menu_pico.h"
 #include "emu.h"
 #include "version.h"
+#ifdef HAVE_CAPTURE
+#include "capture.h"
+#endif
+#include <pico/pico.h>
 #include <cpu/debug.h>
 
 static int load_state_slot = -1;
@@ -40,6 +44,14 @@ void parse_cmd_line(int argc, char *argv[])
 			{
 				if (x+1 < argc) { ++x; load_state_slot = atoi(argv[x]); }
 			}
+			else if (strcasecmp(argv[x], "-record") == 0) {
+				if (x+1 < argc) { ++x; PicoMovieRecord(argv[x]); }
+			}
+#ifdef HAVE_CAPTURE
+			else if (strcasecmp(argv[x], "-capture") == 0) {
+				if (x+1 < argc) { ++x; capture_start(argv[x]); }
+			}
+#endif
 			else if (strcasecmp(argv[x], "-pdb") == 0) {
 				if (x+1 < argc) { ++x; pdb_command(argv[x]); }
 			}
@@ -66,7 +78,12 @@ void parse_cmd_line(int argc, char *argv[])
 		printf("usage: %s [options] [romfile]\n", argv[0]);
 		printf("options:\n"
 			" -config <file>    use specified config file instead of default 'config.cfg'\n"
-			" -loadstate <num>  if ROM is specified, try loading savestate slot <num>\n");
+			" -loadstate <num>  if ROM is specified, try loading savestate slot <num>\n"
+			" -record <file>    record input to a .pmv movie, replay with picoreplay\n"
+#ifdef HAVE_CAPTURE
+			" -capture <file>   write video (.y4m) or audio (.wav) to <file> or fifo\n"
+#endif
+			);
 		exit(1);
 	}
 }
@@ -917,10 +917,14 @@ static const char h_sh2cycles[]  = "Cycles/millisecond (similar to DOSBox)\n"
 				   "lower values speed up emulation but break games\n"
 				   "at least 11000 recommended for compatibility";
 static const char h_h32layer[]   = "In 32X H32 mode, ON centers on 32X instead of MD";
+static const char h_ffopts[]     = "Only while fast forwarding. Faster, but less exact";
+static const char h_fdelay[]     = "Read input as late as possible before the frame\n"
+				   "is emulated, for lower input lag";
 
 static menu_entry e_menu_adv_options[] =
 {
 	mee_onoff     ("Disable frame limiter",    MA_OPT2_NO_FRAME_LIMIT,currentConfig.EmuOpt, EOPT_NO_FRMLIMIT),
+	mee_onoff_h   ("Adaptive frame delay",     MA_OPT2_FRAME_DELAY,   currentConfig.EmuOpt, EOPT_FRAME_DELAY, h_fdelay),
 	mee_onoff     ("Disable sprite limit",     MA_OPT2_NO_SPRITE_LIM, PicoIn.opt, POPT_DIS_SPRITE_LIM),
 	mee_onoff     ("Disable idle loop patching",MA_OPT2_NO_IDLE_LOOPS,PicoIn.opt, POPT_DIS_IDLE_DET),
 	mee_onoff_h   ("Emulate Game Gear LCD",    MA_OPT2_ENABLE_GGLCD  ,PicoIn.opt, POPT_EN_GG_LCD, h_gglcd),
@@ -929,6 +933,10 @@ static menu_entry e_menu_adv_options[] =
 	mee_onoff_h   ("Enable dynarecs",          MA_OPT2_DYNARECS,      PicoIn.opt, POPT_EN_DRC, h_dynarec),
 	mee_cust_h    ("Master SH2 cycles",        MA_32XOPT_MSH2_CYCLES, mh_opt_sh2cycles, mgn_opt_sh2cycles, h_sh2cycles),
 	mee_cust_h    ("Slave SH2 cycles",         MA_32XOPT_SSH2_CYCLES, mh_opt_sh2cycles, mgn_opt_sh2cycles, h_sh2cycles),
+	mee_range     ("Fast forward frameskip",   MA_OPT2_FF_SKIP,       currentConfig.ff_skip, 0, 16),
+	mee_onoff_h   ("Fast forward w/o sound",   MA_OPT2_FF_NO_SOUND,   currentConfig.ff_opts, FFOPT_NO_SOUND, h_ffopts),
+	mee_onoff_h   ("Fast forward w/o VDP FIFO",MA_OPT2_FF_NO_FIFO,    currentConfig.ff_opts, FFOPT_NO_FIFO, h_ffopts),
+	mee_onoff_h   ("Fast forward idle skip",   MA_OPT2_FF_FAST_IDLE,  currentConfig.ff_opts, FFOPT_FAST_IDLE, h_ffopts),
 	MENU_OPTIONS_ADV
 	mee_end,
 };
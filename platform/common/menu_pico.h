@@ -76,6 +76,11 @@ typedef enum
 	MA_OPT2_OVERCLOCK_M68K,
 	MA_OPT2_MAX_FRAMESKIP,
 	MA_OPT2_PWM_IRQ_OPT,
+	MA_OPT2_FF_SKIP,
+	MA_OPT2_FF_NO_SOUND,
+	MA_OPT2_FF_NO_FIFO,
+	MA_OPT2_FF_FAST_IDLE,
+	MA_OPT2_FRAME_DELAY,
 	MA_OPT2_DONE,
 	MA_OPT3_GAMMAA,		/* psp (all OPT3) */
 	MA_OPT3_FILTERING,
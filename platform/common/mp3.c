@@ -14,6 +14,7 @@
 
 static FILE *mp3_current_file;
 static int mp3_file_len, mp3_file_pos;
+static short *cdda_out;
 static int cdda_out_pos;
 static int decoder_active;
 
@@ -77,20 +78,14 @@ out:
 	return retval;
 }
 
-void mp3_start_play(void *f_, int pos1024)
+// run by cdda decode-ahead, possibly in a worker thread
+static int mp3_open(void *f_, int pos1024)
 {
 	unsigned char buf[2048];
 	FILE *f = f_;
-	int ret;
-
-	mp3_file_len = mp3_file_pos = 0;
-	mp3_current_file = NULL;
-	cdda_out_pos = 0;
-	decoder_active = 0;
-
-	if (!(PicoIn.opt & POPT_EN_MCD_CDDA) || f == NULL) // cdda disabled or no file?
-		return;
 
+	mp3_current_file = f;
+	mp3_file_pos = 0;
 	fseek(f, 0, SEEK_END);
 	mp3_file_len = ftell(f);
 
@@ -117,15 +112,30 @@ void mp3_start_play(void *f_, int pos1024)
 		mp3_file_pos += pos64 >> 10;
 	}
 
-	ret = mp3dec_start(f, mp3_file_pos);
-	if (ret != 0) {
+	return mp3dec_start(f, mp3_file_pos);
+}
+
+static int mp3_decode(void)
+{
+	return mp3dec_decode(mp3_current_file, &mp3_file_pos, mp3_file_len);
+}
+
+void mp3_start_play(void *f_, int pos1024)
+{
+	FILE *f = f_;
+
+	cdda_ahead_stop();
+
+	cdda_out = NULL;
+	cdda_out_pos = 1152; // fetch 1st block on 1st update
+	decoder_active = 0;
+
+	if (!(PicoIn.opt & POPT_EN_MCD_CDDA) || f == NULL) // cdda disabled or no file?
 		return;
-	}
 
-	mp3_current_file = f;
 	decoder_active = 1;
 
-	mp3dec_decode(mp3_current_file, &mp3_file_pos, mp3_file_len);
+	cdda_ahead_start(mp3_open, mp3_decode, f, pos1024);
 }
 
 void mp3_update(s32 *buffer, int length, int stereo)
@@ -133,37 +143,35 @@ void mp3_update(s32 *buffer, int length, int stereo)
 	int length_mp3;
 	void (*mix_samples)(s32 *dest_buf, short *mp3_buf, int count, int fac16) = mix_16h_to_32_resample_stereo;
 
-	if (mp3_current_file == NULL || mp3_file_pos >= mp3_file_len)
-		return; /* no file / EOF */
-
 	if (!decoder_active)
-		return;
+		return; /* no file / EOF */
 
 	length_mp3 = length * Pico.snd.cdda_mult >> 16;
 	if (!stereo)
 		mix_samples = mix_16h_to_32_resample_mono;
 
-	if (1152 - cdda_out_pos >= length_mp3) {
-		mix_samples(buffer, cdda_out_buffer + cdda_out_pos * 2,
+	if (cdda_out != NULL && 1152 - cdda_out_pos >= length_mp3) {
+		mix_samples(buffer, cdda_out + cdda_out_pos * 2,
 			length, Pico.snd.cdda_mult);
 
 		cdda_out_pos += length_mp3;
 	} else {
 		int left = (1152 - cdda_out_pos) * Pico.snd.cdda_div >> 16;
-		int ret, sm = stereo ? 2 : 1;
+		int sm = stereo ? 2 : 1;
 
 		if (left > 0)
-			mix_samples(buffer, cdda_out_buffer + cdda_out_pos * 2,
+			mix_samples(buffer, cdda_out + cdda_out_pos * 2,
 				left, Pico.snd.cdda_mult);
 
-		ret = mp3dec_decode(mp3_current_file, &mp3_file_pos,
-			mp3_file_len);
-		if (ret == 0) {
-			mix_samples(buffer + left * sm, cdda_out_buffer,
+		cdda_out = cdda_ahead_next();
+		if (cdda_out != NULL) {
+			mix_samples(buffer + left * sm, cdda_out,
 				length-left, Pico.snd.cdda_mult);
 			cdda_out_pos = (length-left) * Pico.snd.cdda_mult >> 16;
-		} else
-			cdda_out_pos = 0;
+		} else if (cdda_ahead_eof())
+			decoder_active = 0;
+		else	// not decoded yet, silence until it is
+			cdda_out_pos = 1152;
 	}
 }
 
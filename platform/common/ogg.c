@@ -21,6 +21,8 @@
 
 static OggVorbis_File ogg_current_file;
 static int ogg_current_index;
+static int ogg_file_open;
+static short *cdda_out;
 static int cdda_out_pos;
 static int decoder_active;
 
@@ -47,33 +49,70 @@ int ogg_get_length(void *f_)
 	return fs;
 }
 
-void ogg_start_play(void *f_, int sample_offset)
+// run by cdda decode-ahead, possibly in a worker thread
+static int ogg_open(void *f_, int sample_offset)
 {
 	FILE *f = f_;
 	int ret;
 
-	cdda_out_pos = 0;
-	decoder_active = 0;
-
-	if (!(PicoIn.opt & POPT_EN_MCD_CDDA) || f == NULL) // cdda disabled or no file?
-		return;
+	if (ogg_file_open)
+		ov_clear(&ogg_current_file);
+	ogg_file_open = 0;
 
 	fseek(f, 0, SEEK_SET);
 	ret = ov_open_callbacks(f, &ogg_current_file, NULL, 0, ogg_cb);
 	if (ret)
-		return;
+		return ret;
 	ogg_current_index = 0;
+	ogg_file_open = 1;
 
 	// seek..
 	ov_pcm_seek(&ogg_current_file, sample_offset);
+	return 0;
+}
+
+static int ogg_decode(void)
+{
+	int length_ogg, ret = 0;
+
+	for (length_ogg = 4*1152; length_ogg > 0; ) {
+		ret = ov_read(&ogg_current_file,
+			(char *)cdda_out_buffer + (4*1152 - length_ogg),
+			length_ogg, !CPU_IS_LE,2,1, &ogg_current_index);
+		if (ret > 0)
+			length_ogg -= ret;
+		else
+			break;
+	}
+	return ret <= 0;
+}
+
+void ogg_start_play(void *f_, int sample_offset)
+{
+	FILE *f = f_;
+
+	// the previous track is closed by ogg_open, possibly in the worker
+	cdda_ahead_stop();
+
+	cdda_out = NULL;
+	cdda_out_pos = 1152; // fetch 1st block on 1st update
+	decoder_active = 0;
+
+	if (!(PicoIn.opt & POPT_EN_MCD_CDDA) || f == NULL) // cdda disabled or no file?
+		return;
 
 	decoder_active = 1;
+
+	cdda_ahead_start(ogg_open, ogg_decode, f, sample_offset);
 }
 
 void ogg_stop_play(void)
 {
-	if (decoder_active)
+	cdda_ahead_stop();
+	cdda_ahead_wait();
+	if (ogg_file_open)
 		ov_clear(&ogg_current_file);
+	ogg_file_open = 0;
 	decoder_active = 0;
 }
 
@@ -91,34 +130,28 @@ void ogg_update(s32 *buffer, int length, int stereo)
 	if (!stereo)
 		mix_samples = mix_16h_to_32_resample_mono;
 
-	if (1152 - cdda_out_pos >= length_ogg) {
-		mix_samples(buffer, cdda_out_buffer + cdda_out_pos * 2,
+	if (cdda_out != NULL && 1152 - cdda_out_pos >= length_ogg) {
+		mix_samples(buffer, cdda_out + cdda_out_pos * 2,
 			length, Pico.snd.cdda_mult);
 
 		cdda_out_pos += length_ogg;
 	} else {
 		int left = (1152 - cdda_out_pos) * Pico.snd.cdda_div >> 16;
-		int ret, sm = stereo ? 2 : 1;
+		int sm = stereo ? 2 : 1;
 
 		if (left > 0)
-			mix_samples(buffer, cdda_out_buffer + cdda_out_pos * 2,
+			mix_samples(buffer, cdda_out + cdda_out_pos * 2,
 				left, Pico.snd.cdda_mult);
 
-		for (length_ogg = 4*1152; length_ogg > 0; ) {
-			ret = ov_read(&ogg_current_file,
-				(char *)cdda_out_buffer + (4*1152 - length_ogg),
-				length_ogg, !CPU_IS_LE,2,1, &ogg_current_index);
-			if (ret > 0)
-				length_ogg -= ret;
-			else
-				break;
-		}
-		if (ret > 0) {
-			mix_samples(buffer + left * sm, cdda_out_buffer,
+		cdda_out = cdda_ahead_next();
+		if (cdda_out != NULL) {
+			mix_samples(buffer + left * sm, cdda_out,
 				length-left, Pico.snd.cdda_mult);
 			cdda_out_pos = (length-left) * Pico.snd.cdda_mult >> 16;
-		} else
-			cdda_out_pos = 0;
+		} else if (cdda_ahead_eof())
+			decoder_active = 0;
+		else	// not decoded yet, silence until it is
+			cdda_out_pos = 1152;
 	}
 }
 
@@ -0,0 +1,92 @@
+/*
+ * PicoDrive
+ *
+ * Lock-free audio ring buffer with dynamic rate control. The writer nudges
+ * the core output rate by a fraction of a percent depending on the buffer
+ * fill level, so that the emulation speed and the audio clock can't drift
+ * apart, and the buffer can be kept small without under- or overruns.
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ */
+
+#include <string.h>
+
+#include "sndring.h"
+
+// maximum rate deviation in ppm, about the limit for an unnoticed pitch change
+#define ADJ_MAX		5000
+
+// positions are only written by their owner, the other side reads them with
+// acquire semantics to see the sample data written before the update
+#define LOAD(p)		__atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define STORE(p, v)	__atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+void sndring_init(struct sndring *r, short *buf, unsigned int size)
+{
+	r->buf = buf;
+	r->size = size;
+	r->rd = r->wr = 0;
+}
+
+void sndring_reset(struct sndring *r)
+{
+	STORE(&r->rd, LOAD(&r->wr));
+}
+
+unsigned int sndring_fill(struct sndring *r)
+{
+	return LOAD(&r->wr) - LOAD(&r->rd);
+}
+
+int sndring_write(struct sndring *r, const short *data, int count)
+{
+	unsigned int wr = r->wr, mask = r->size - 1;
+	unsigned int space = r->size - (wr - LOAD(&r->rd));
+	int n;
+
+	if (count > (int)space)
+		count = space;
+	n = r->size - (wr & mask);
+	if (n > count)
+		n = count;
+	memcpy(r->buf + (wr & mask), data, n * 2);
+	memcpy(r->buf, data + n, (count - n) * 2);
+	STORE(&r->wr, wr + count);
+	return count;
+}
+
+int sndring_read(struct sndring *r, short *data, int count)
+{
+	unsigned int rd = r->rd, mask = r->size - 1;
+	unsigned int fill = LOAD(&r->wr) - rd;
+	int n;
+
+	if (count > (int)fill)
+		count = fill;
+	n = r->size - (rd & mask);
+	if (n > count)
+		n = count;
+	memcpy(data, r->buf + (rd & mask), n * 2);
+	memcpy(data + n, r->buf, (count - n) * 2);
+	STORE(&r->rd, rd + count);
+	return count;
+}
+
+int sndring_fill_adjust(int fill, unsigned int target)
+{
+	// proportional control, full deviation at an empty or twice full buffer.
+	// Below target more samples per frame are produced, and vice versa
+	if (target == 0)
+		return 0;
+	if (fill < 0)
+		fill = 0;
+	if (fill > 2 * (int)target)
+		fill = 2 * target;
+	return (long long)ADJ_MAX * ((int)target - fill) / (int)target;
+}
+
+int sndring_rate_adjust(struct sndring *r, unsigned int target)
+{
+	return sndring_fill_adjust(sndring_fill(r), target);
+}
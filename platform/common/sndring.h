@@ -0,0 +1,26 @@
+#ifndef __COMMON_SNDRING_H__
+#define __COMMON_SNDRING_H__
+
+// lock-free single producer/single consumer ring of 16 bit samples, between
+// the emulation thread (writer) and an audio output thread or callback
+struct sndring {
+	short *buf;
+	unsigned int size;	// in samples, power of 2
+	unsigned int rd, wr;	// free running positions
+};
+
+void sndring_init(struct sndring *r, short *buf, unsigned int size);
+void sndring_reset(struct sndring *r);	// drop all data, consumer side only
+unsigned int sndring_fill(struct sndring *r);
+
+// return the amount of samples actually transferred
+int  sndring_write(struct sndring *r, const short *data, int count);
+int  sndring_read(struct sndring *r, short *data, int count);
+
+// output rate adjustment in ppm for PsndSetRateAdjust, driving the fill
+// level towards target. Call once per frame, after writing the frame
+int  sndring_rate_adjust(struct sndring *r, unsigned int target);
+// the same for a fill level known otherwise, e.g. of an output driver
+int  sndring_fill_adjust(int fill, unsigned int target);
+
+#endif
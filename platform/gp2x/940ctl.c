@@ -391,8 +391,9 @@ int YM2612UpdateOne_940(int *buffer, int length, int stereo, int is_buf_empty)
 	ym_active_chs = shared_ctl->ym_active_chs;
 
 	// mix in ym buffer. is_buf_empty means nobody mixed there anything yet and it may contain trash
-	if (is_buf_empty && ym_active_chs) memcpy(buffer, ym_buf, length << (stereo + 2));
-	else memset32(buffer, 0, length<<stereo);
+	// no buffer if the frame is skipped without sound
+	if (is_buf_empty && ym_active_chs && buffer) memcpy(buffer, ym_buf, length << (stereo + 2));
+	else if (buffer) memset32(buffer, 0, length<<stereo);
 
 	if (shared_ctl->writebuffsel == 1) {
 		shared_ctl->writebuff0[writebuff_ptr & 0xffff] = 0xffff;
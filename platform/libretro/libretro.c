@@ -123,6 +123,8 @@ static int vout_ghosting = 0;
 
 static bool libretro_update_av_info = false;
 static bool libretro_update_geometry = false;
+static bool libretro_can_dupe = false;
+static bool libretro_frame_shown = false; /* last rendered frame was presented */
 
 static unsigned short libretro_mem_AHW = 0;
 
@@ -853,7 +855,8 @@ typedef struct patch
 
 extern void decode(char *buff, patch *dest);
 extern uint32_t m68k_read16(uint32_t a);
-extern void m68k_write16(uint32_t a, uint16_t d);
+
+static bool patches_changed;
 
 void retro_cheat_reset(void)
 {
@@ -866,13 +869,12 @@ void retro_cheat_reset(void)
 		if (addr < Pico.romsize) {
 			if (PicoPatches[i].active)
 				*(unsigned short *)(Pico.rom + addr) = PicoPatches[i].data_old;
-		} else if (!(PicoIn.AHW & PAHW_SMS)) {
-			if (PicoPatches[i].active)
-				m68k_write16(PicoPatches[i].addr,PicoPatches[i].data_old);
 		}
 	}
 
+	// also unfreezes RAM patches
 	PicoPatchUnload();
+	patches_changed = false;
 }
 
 void retro_cheat_set(unsigned index, bool enabled, const char *code)
@@ -923,6 +925,8 @@ void retro_cheat_set(unsigned index, bool enabled, const char *code)
 
 		buff = strtok(NULL,"+");
 	}
+	// applied once on the next frame, RAM patches stay frozen
+	patches_changed = true;
 }
 
 /* multidisk support */
@@ -1804,6 +1808,8 @@ static const unsigned short retro_pico_map[] = {
 #define RETRO_PICO_MAP_LEN (sizeof(retro_pico_map) / sizeof(retro_pico_map[0]))
 
 static int has_4_pads;
+static int ff_profile, ff_active;
+static unsigned int ff_opts; // PicoIn.opt bits set for fast forward
 
 static void snd_write(int len)
 {
@@ -1861,6 +1867,15 @@ static void update_variables(bool first_run)
          PicoIn.opt &= ~POPT_EN_MCD_RAMCART;
    }
 
+   var.value = NULL;
+   var.key = "picodrive_cd_preload";
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value) {
+      if (strcmp(var.value, "enabled") == 0)
+         PicoIn.opt |= POPT_EN_MCD_PRELOAD;
+      else
+         PicoIn.opt &= ~POPT_EN_MCD_PRELOAD;
+   }
+
    var.value = NULL;
    var.key = "picodrive_smstype";
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value) {
@@ -2004,6 +2019,23 @@ static void update_variables(bool first_run)
       PicoIn.opt &= ~POPT_EN_DRC;
 #endif
 
+#ifdef USE_SND_THREAD
+   var.value = NULL;
+   var.key = "picodrive_sound_thread";
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value) {
+      if (strcmp(var.value, "enabled") == 0)
+         PicoIn.opt |= POPT_EN_SND_THREAD;
+      else
+         PicoIn.opt &= ~POPT_EN_SND_THREAD;
+   }
+#endif
+
+   var.value = NULL;
+   var.key = "picodrive_ff_profile";
+   ff_profile = 0;
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      ff_profile = strcmp(var.value, "enabled") == 0;
+
    var.value = NULL;
    var.key = "picodrive_fmchip";
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value) {
@@ -2358,6 +2390,8 @@ void retro_run(void)
 {
    bool updated = false;
    int pad, i, padcount;
+   int av_enable = 3;
+   bool last_shown;
    static void *buff;
 
    if (PicoIn.AHW != libretro_mem_AHW)
@@ -2365,8 +2399,26 @@ void retro_run(void)
 
    PicoIn.skipFrame = 0;
 
-   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated) {
+      // sound options must not change while the sound thread is running
+      PsndSync();
       update_variables(false);
+   }
+
+   // cheaper emulation while the frontend is fast forwarding
+   {
+      bool ff = false;
+      if (ff_profile)
+         environ_cb(RETRO_ENVIRONMENT_GET_FASTFORWARDING, &ff);
+      if (ff && !ff_active) {
+         ff_opts = ~PicoIn.opt & (POPT_DIS_VDP_FIFO|POPT_FAST_IDLE);
+         PicoIn.opt |= ff_opts;
+         ff_active = 1;
+      } else if (!ff && ff_active) {
+         PicoIn.opt &= ~ff_opts;
+         ff_active = 0;
+      }
+   }
 
    input_poll_cb();
 
@@ -2413,8 +2465,10 @@ void retro_run(void)
        run_events_pico(new_ev);
    }
 
-   if (PicoPatches)
+   if (patches_changed) {
       PicoPatchApply();
+      patches_changed = false;
+   }
 
    /* Check whether current frame should
     * be skipped */
@@ -2439,6 +2493,12 @@ void retro_run(void)
          frameskip_counter++;
    }
 
+   /* If the frontend discards both audio and video
+    * (e.g. run-ahead), only advance the sound chips */
+   if (environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &av_enable) &&
+         !(av_enable & 3))
+      PicoIn.skipFrame = 2;
+
    /* If frameskip settings have changed, update
     * frontend audio latency */
    if (update_audio_latency) {
@@ -2469,6 +2529,19 @@ void retro_run(void)
       return;
    }
 
+   /* If nothing on screen has changed, let the frontend
+    * show the last frame again (no conversion needed).
+    * Not for ghosting and the Pico overlay, which modify
+    * the output buffer, or if the last frame was hidden */
+   last_shown = libretro_frame_shown;
+   libretro_frame_shown = (av_enable & 1);
+   if (libretro_can_dupe && last_shown && !PicoIn.frameChanged &&
+       !(vout_ghosting && vout_height == 144) &&
+       !(PicoIn.AHW & PAHW_PICO)) {
+      video_cb(NULL, vout_width, vout_height, vout_width * 2);
+      return;
+   }
+
 #if defined(RENDER_GSKIT_PS2)
    buff = (uint32_t *)RETRO_HW_FRAME_BUFFER_VALID;
 
@@ -2589,6 +2662,9 @@ void retro_init(void)
    if (environ_cb(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL))
       libretro_supports_bitmasks = true;
 
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &libretro_can_dupe))
+      libretro_can_dupe = false;
+
    disk_initial_index = 0;
    disk_initial_path[0] = '\0';
    if (environ_cb(RETRO_ENVIRONMENT_GET_DISK_CONTROL_INTERFACE_VERSION, &dci_version) && (dci_version >= 1))
@@ -2683,4 +2759,5 @@ void retro_deinit(void)
    pico_overlay = NULL;
 
    libretro_supports_bitmasks = false;
+   libretro_can_dupe = false;
 }
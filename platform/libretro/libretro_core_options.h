@@ -173,6 +173,20 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "picodrive_cd_preload",
+      "Sega CD Preload Image",
+      NULL,
+      "Load the whole CD image into RAM, to avoid file accesses while the game is running. Helps with compressed (CSO, ZIP) images and images on slow or network storage. CHD images are not preloaded. Takes effect when content is loaded.",
+      NULL,
+      "system",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "picodrive_aspect",
       "Core-Provided Aspect Ratio",
@@ -370,6 +384,36 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       "enabled"
    },
 #endif
+#ifdef USE_SND_THREAD
+   {
+      "picodrive_sound_thread",
+      "Threaded Sound",
+      NULL,
+      "Render Mega Drive/Genesis sound in a separate thread while the next frame is emulated, and decode MP3/OGG CD audio tracks ahead in the background. Improves performance on multicore systems, but adds a frame of audio latency.",
+      NULL,
+      "performance",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+#endif
+   {
+      "picodrive_ff_profile",
+      "Fast Forward Turbo Profile",
+      NULL,
+      "While the frontend is fast forwarding, disable VDP FIFO timing and detect idle or polling CPUs sooner. Makes fast forward faster, but less exact.",
+      NULL,
+      "performance",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "picodrive_frameskip",
       "Frameskip",
@@ -20,6 +20,9 @@
 #include "../common/upscale.h"
 #include "../common/keyboard.h"
 #include "../common/version.h"
+#ifdef HAVE_CAPTURE
+#include "../common/capture.h"
+#endif
 
 #include <pico/pico_int.h>
 
@@ -217,6 +220,17 @@ void pemu_finalize_frame(const char *fps, const char *notice)
 			}
 	}
 
+#ifdef HAVE_CAPTURE
+	if (capture_active()) {
+		// capture the image before anything is drawn on top of it
+		int h = currentConfig.vscaling == EOPT_SCALE_SW ? 240:out_h;
+		int w = currentConfig.scaling == EOPT_SCALE_SW ? 320:out_w;
+		u16 *pd = screen_buffer(g_screen_ptr) + out_y*g_screen_ppitch + out_x;
+
+		capture_video(pd, w, h, g_screen_ppitch);
+	}
+#endif
+
 	if (PicoIn.AHW & PAHW_PICO) {
 		int h = currentConfig.vscaling == EOPT_SCALE_SW ? 240:out_h;
 		int w = currentConfig.scaling == EOPT_SCALE_SW ? 320:out_w;
@@ -107,6 +107,7 @@ static const struct {
 	IT(msh2),
 	IT(ssh2),
 	IT(memsh),
+	IT(wram),
 	IT(dummy),
 };
 
@@ -13,6 +13,7 @@ enum pprof_points {
   pp_msh2,
   pp_ssh2,
   pp_memsh,
+  pp_wram,
   pp_dummy,
   pp_total_points
 };
@@ -0,0 +1,290 @@
+/*
+ * PicoDrive
+ * headless movie replayer, for regression runs and benchmarking
+ *
+ * Plays .pmv/.gmv movies as fast as possible without video or sound
+ * output, printing state and image hashes every few frames and the
+ * resulting fps. The core is a global singleton, so movies are replayed
+ * in forked processes, several of them in parallel if requested.
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ */
+
+#define _GNU_SOURCE // mremap
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include <pico/pico_int.h>
+#include <pico/state.h>
+
+#define FB_W	320
+#define FB_H	240
+
+static unsigned short fb[FB_W * FB_H];
+static short snd_buf[2 * 54000 / 50 + 64];
+static int vm_line, vm_lines = FB_H, vm_col, vm_cols = FB_W;
+static const char *bios_fname;
+static unsigned long long state_hash;
+
+// core callbacks
+
+void lprintf(const char *fmt, ...)
+{
+	va_list vl;
+
+	va_start(vl, fmt);
+	vfprintf(stderr, fmt, vl);
+	va_end(vl);
+}
+
+void *plat_mmap(unsigned long addr, size_t size, int need_exec, int is_fixed)
+{
+	int prot = PROT_READ | PROT_WRITE | (need_exec ? PROT_EXEC : 0);
+	void *ret;
+
+	ret = mmap((void *)addr, size, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ret == MAP_FAILED)
+		return NULL;
+	if (addr != 0 && ret != (void *)addr && is_fixed) {
+		munmap(ret, size);
+		return NULL;
+	}
+	return ret;
+}
+
+void *plat_mremap(void *ptr, size_t oldsize, size_t newsize)
+{
+	void *ret = mremap(ptr, oldsize, newsize, MREMAP_MAYMOVE);
+	return ret == MAP_FAILED ? NULL : ret;
+}
+
+void plat_munmap(void *ptr, size_t size)
+{
+	if (ptr != NULL)
+		munmap(ptr, size);
+}
+
+void *plat_mem_get_for_drc(size_t size)
+{
+	return NULL;
+}
+
+int plat_mem_set_exec(void *ptr, size_t size)
+{
+	return mprotect(ptr, size, PROT_READ | PROT_WRITE | PROT_EXEC);
+}
+
+void cache_flush_d_inval_i(void *start, void *end)
+{
+#ifdef __arm__
+	__builtin___clear_cache(start, end);
+#endif
+}
+
+void emu_video_mode_change(int start_line, int line_count, int start_col, int col_count)
+{
+	vm_line = start_line, vm_lines = line_count;
+	vm_col = start_col, vm_cols = col_count;
+	memset(fb, 0, sizeof(fb));
+	PicoDrawSetOutBuf(fb, FB_W * 2);
+	Pico.m.dirtyPal = 1;
+}
+
+void emu_32x_startup(void)
+{
+	PicoDrawSetOutFormat(PDF_RGB555, 0);
+	PicoDrawSetOutBuf(fb, FB_W * 2);
+}
+
+static const char *find_bios(int *region, const char *cd_fname)
+{
+	return bios_fname;
+}
+
+// hashing
+
+static void hash(unsigned long long *h, const void *data, size_t len)
+{
+	const unsigned char *p = data;
+
+	while (len--) {
+		*h ^= *p++;
+		*h *= 1099511628211ULL;
+	}
+}
+
+static size_t state_hash_write(void *p, size_t size, size_t n, void *file)
+{
+	hash(&state_hash, p, size * n);
+	return n;
+}
+
+static void print_hashes(const char *name, unsigned int frame)
+{
+	unsigned long long vh = 14695981039346656037ULL;
+	int y, l = vm_lines, w = vm_cols;
+
+	state_hash = 14695981039346656037ULL;
+	PicoStateFP(NULL, 1, NULL, state_hash_write, NULL, NULL);
+
+	if (vm_line + l > FB_H) l = FB_H - vm_line;
+	if (vm_col + w > FB_W) w = FB_W - vm_col;
+	for (y = vm_line; y < vm_line + l; y++)
+		hash(&vh, fb + y * FB_W + vm_col, w * 2);
+
+	printf("%s: frame %u state %016llx video %016llx\n",
+		name, frame, state_hash, vh);
+}
+
+static double get_time(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// runs in a child process, returns the frame count or -1
+static int replay(const char *rom, const char *movie, int interval)
+{
+	unsigned int frame = 0, frames = 0;
+	enum media_type_e media_type;
+	double t;
+	int ret;
+
+	PicoIn.opt = POPT_EN_STEREO|POPT_EN_FM|POPT_EN_PSG|POPT_EN_Z80
+		| POPT_EN_MCD_PCM|POPT_EN_MCD_CDDA|POPT_EN_MCD_GFX
+		| POPT_EN_32X|POPT_EN_PWM|POPT_ACC_SPRITES|POPT_DIS_32C_BORDER;
+#ifdef DRC_SH2
+	PicoIn.opt |= POPT_EN_DRC;
+#endif
+	PicoIn.sndRate = 44100;
+	PicoIn.autoRgnOrder = 0x184; // US, EU, JP
+	PicoInit();
+
+	if (PicoMoviePlay(movie) != 0)
+		return -1;
+	PicoMovieStatus(NULL, &frames);
+
+	media_type = PicoLoadMedia(rom, NULL, 0, NULL, find_bios, NULL, NULL);
+	if (media_type < 0) {
+		fprintf(stderr, "%s: can't load %s\n", movie, rom);
+		return -1;
+	}
+
+	PicoDrawSetOutFormat(PDF_RGB555, 0);
+	PicoDrawSetOutBuf(fb, FB_W * 2);
+	PicoLoopPrepare();
+	if (PicoIn.sndRate > 54000)
+		PicoIn.sndRate = 54000;
+	PicoIn.sndOut = snd_buf;
+	PsndRerate(0);
+
+	t = get_time();
+	while ((ret = PicoMovieFrame()) > 0) {
+		frame++;
+		// no image or sound output, but the sound chips keep running
+		PicoIn.skipFrame = interval && frame % interval == 0 ? 0 : 2;
+		PicoFrame();
+		if (!PicoIn.skipFrame)
+			print_hashes(movie, frame);
+	}
+	t = get_time() - t;
+
+	if (ret < 0 && frame < frames)
+		fprintf(stderr, "%s: stopped at frame %u of %u\n", movie, frame, frames);
+	if (!interval || frame % interval) {
+		PicoIn.skipFrame = 0;
+		PicoFrameDrawOnly();
+		print_hashes(movie, frame);
+	}
+	printf("%s: %u frames in %.3f s, %.1f fps\n",
+		movie, frame, t, t > 0 ? frame / t : 0);
+
+	PicoExit();
+	return frame == frames ? (int)frame : -1;
+}
+
+static void usage(const char *argv0)
+{
+	printf("usage: %s [options] <rom> <movie> [movie...]\n"
+		"options:\n"
+		" -j <jobs>      replay up to <jobs> movies in parallel (1)\n"
+		" -i <frames>    print hashes every <frames> frames, 0: at the end (60)\n"
+		" -bios <file>   CD BIOS for Mega CD images\n", argv0);
+	exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+	int jobs = 1, interval = 60, running = 0, failed = 0;
+	int i, n, first;
+	long long *counts, total = 0;
+	double t;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if (i + 1 >= argc)
+			usage(argv[0]);
+		if (!strcmp(argv[i], "-j"))
+			jobs = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-i"))
+			interval = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-bios"))
+			bios_fname = argv[++i];
+		else
+			usage(argv[0]);
+	}
+	if (argc - i < 2 || jobs < 1)
+		usage(argv[0]);
+
+	first = i + 1;
+	n = argc - first;
+	// frame counts reported back by the children
+	counts = mmap(NULL, n * sizeof(*counts), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (counts == MAP_FAILED)
+		return 1;
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	t = get_time();
+	for (i = 0; i < n || running > 0; ) {
+		int status;
+
+		if (i < n && running < jobs) {
+			pid_t pid = fork();
+			if (pid == 0) {
+				counts[i] = replay(argv[first - 1], argv[first + i], interval);
+				fflush(stdout);
+				_exit(counts[i] < 0);
+			}
+			if (pid < 0) {
+				perror("fork");
+				failed++;
+			}
+			else
+				running++;
+			i++;
+			continue;
+		}
+		if (wait(&status) < 0)
+			break;
+		running--;
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			failed++;
+	}
+	t = get_time() - t;
+
+	for (i = 0; i < n; i++)
+		if (counts[i] > 0)
+			total += counts[i];
+	printf("%d movies, %d failed, %lld frames in %.3f s, %.1f fps with %d jobs\n",
+		n, failed, total, t, t > 0 ? total / t : 0, jobs);
+	return failed != 0;
+}
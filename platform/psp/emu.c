@@ -27,6 +27,7 @@
 #include "../common/emu.h"
 #include "../common/input_pico.h"
 #include "../common/keyboard.h"
+#include "../common/sndring.h"
 #include "platform/libpicofe/input.h"
 #include "platform/libpicofe/menu.h"
 #include "platform/libpicofe/plat.h"
@@ -426,42 +427,34 @@ static void vidResetMode(void)
 }
 
 /* sound stuff */
-#define SOUND_BLOCK_COUNT    7
 #define SOUND_BUFFER_CHUNK   (2*44100/50) // max.rate/min.frames in stereo
-
-static short sndBuffer_emu[SOUND_BUFFER_CHUNK+4]; // 4 for sample rounding overhang
-static short __attribute__((aligned(4))) sndBuffer[SOUND_BUFFER_CHUNK*SOUND_BLOCK_COUNT];
-static short *sndBuffer_endptr;
+#define SOUND_RING_SIZE      16384 // >9 chunks, power of 2
+#define SOUND_TARGET_BLOCKS  3 // ring fill level to aim for
+
+// +0.5% for rate adjustment, 4 for sample rounding overhang
+static short __attribute__((aligned(4))) sndBuffer_emu[SOUND_BUFFER_CHUNK+16];
+static short __attribute__((aligned(4))) sndBuffer_conv[SOUND_BUFFER_CHUNK+16];
+static short __attribute__((aligned(64))) sndBuffer_play[SOUND_BUFFER_CHUNK];
+static short sndBuffer[SOUND_RING_SIZE];
+static struct sndring snd_ring;
 static int samples_block;
-
-static short *snd_playptr, *sndBuffer_ptr;
-static int samples_made, samples_done;
+static int samples_done;
 
 static int sound_thread_exit = 0;
+static volatile int sound_flush = 0;
 static SceUID sound_sem = -1;
 
 // There are problems if the sample rate used with the PSP isn't 44100 Hz stereo.
 // Hence, use only 11025,22050,44100 here and handle duplication and upsampling.
 // Upsample by nearest neighbour, which is the fastest but may create artifacts.
 
-static void writeSound(int len)
-{
-	// make sure there is enough free space in the buffer after
-	// this frame, else the next frame may overwrite old stored samples.
-	if (samples_made - samples_done < samples_block * (SOUND_BLOCK_COUNT-2) - 8) {
-		sndBuffer_ptr += len / 2;
-		if (sndBuffer_ptr - sndBuffer > sizeof(sndBuffer)/2)
-			lprintf("snd ovrn %d %d\n", len, sndBuffer_ptr - sndBuffer);
-		if (sndBuffer_ptr >= sndBuffer_endptr) {
-			int wrap = sndBuffer_ptr - sndBuffer_endptr;
-			if (wrap > 0)
-				memcpy(sndBuffer, sndBuffer_endptr, 2*wrap);
-			sndBuffer_ptr -= sndBuffer_endptr - sndBuffer;
-		}
-
-		samples_made += len / 2;
-	} else
-		lprintf("snd oflow %i!\n", samples_made - samples_done);
+static void writeSound(const short *p, int len)
+{
+	// the ring is sized for several frames, with rate control it shouldn't
+	// ever fill up. If it does anyway, the excess is dropped
+	if (sndring_write(&snd_ring, p, len / 2) < len / 2)
+		lprintf("snd oflow %i!\n", sndring_fill(&snd_ring));
+	PsndSetRateAdjust(sndring_rate_adjust(&snd_ring, samples_block * SOUND_TARGET_BLOCKS));
 
 	// signal the snd thread
 	sceKernelSignalSema(sound_sem, 1);
@@ -469,66 +462,65 @@ static void writeSound(int len)
 
 static void writeSound_44100_stereo(int len)
 {
-	writeSound(len);
-	PicoIn.sndOut = sndBuffer_ptr;
+	writeSound(PicoIn.sndOut, len);
 }
 
 static void writeSound_44100_mono(int len)
 {
-	short *p = sndBuffer_ptr;
+	short *p = sndBuffer_conv;
 	int i;
 
 	for (i = 0; i < len / 2; i++, p+=2)
 		p[0] = p[1] = PicoIn.sndOut[i];
-	writeSound(2*len);
+	writeSound(sndBuffer_conv, 2*len);
 }
 
 static void writeSound_22050_stereo(int len)
 {
-	short *p = sndBuffer_ptr;
+	short *p = sndBuffer_conv;
 	int i;
 
 	for (i = 0; i < len / 2; i+=2, p+=4) {
 		p[0] = p[2] = PicoIn.sndOut[i];
 		p[1] = p[3] = PicoIn.sndOut[i+1];
 	}
-	writeSound(2*len);
+	writeSound(sndBuffer_conv, 2*len);
 }
 
 static void writeSound_22050_mono(int len)
 {
-	short *p = sndBuffer_ptr;
+	short *p = sndBuffer_conv;
 	int i;
 
 	for (i = 0; i < len / 2; i++, p+=4) {
 		p[0] = p[2] = PicoIn.sndOut[i];
 		p[1] = p[3] = PicoIn.sndOut[i];
 	}
-	writeSound(4*len);
+	writeSound(sndBuffer_conv, 4*len);
 }
 
 static void writeSound_11025_stereo(int len)
 {
-	short *p = sndBuffer_ptr;
+	short *p = sndBuffer_conv;
 	int i;
 
 	for (i = 0; i < len / 2; i+=2, p+=8) {
 		p[0] = p[2] = p[4] = p[6] = PicoIn.sndOut[i];
 		p[1] = p[3] = p[5] = p[7] = PicoIn.sndOut[i+1];
 	}
-	writeSound(4*len);
+	writeSound(sndBuffer_conv, 4*len);
 }
 
 static void writeSound_11025_mono(int len)
 {
-	short *p = sndBuffer_ptr;
+	short *p = sndBuffer_conv;
 	int i;
 
 	for (i = 0; i < len / 2; i++, p+=8) {
 		p[0] = p[2] = p[4] = p[6] = PicoIn.sndOut[i];
 		p[1] = p[3] = p[5] = p[7] = PicoIn.sndOut[i];
 	}
-	writeSound(8*len);
+	writeSound(sndBuffer_conv, 8*len);
 }
 
 static int sound_thread(SceSize args, void *argp)
@@ -537,28 +529,37 @@ static int sound_thread(SceSize args, void *argp)
 
 	while (!sound_thread_exit)
 	{
-		int ret;
+		int ret, n;
 
-		if (samples_made - samples_done < samples_block) {
+		// the ring read position is owned by this thread, drop data here
+		if (sound_flush) {
+			sndring_reset(&snd_ring);
+			sound_flush = 0;
+		}
+
+		if (sndring_fill(&snd_ring) < samples_block) {
 			// wait for data (use at least 2 blocks)
-			//lprintf("sthr: wait... (%i)\n", samples_made - samples_done);
-			while (samples_made - samples_done < samples_block*2 && !sound_thread_exit) {
+			//lprintf("sthr: wait... (%i)\n", sndring_fill(&snd_ring));
+			while (sndring_fill(&snd_ring) < samples_block*2 && !sound_thread_exit && !sound_flush) {
 				ret = sceKernelWaitSema(sound_sem, 1, 0);
 				if (ret < 0) lprintf("sthr: sceKernelWaitSema: %i\n", ret);
 			}
+			if (sound_flush)
+				continue;
 		}
 
+		n = sndring_read(&snd_ring, sndBuffer_play, samples_block);
+		if (n < samples_block)
+			memset(sndBuffer_play + n, 0, (samples_block - n) * 2);
+
 		// if the sample buffer runs low, push some extra
 		if (sceAudioOutput2GetRestSample()*2 < samples_block/4)
-			ret = sceAudioSRCOutputBlocking(PSP_AUDIO_VOLUME_MAX, snd_playptr);
-		ret = sceAudioSRCOutputBlocking(PSP_AUDIO_VOLUME_MAX, snd_playptr);
+			ret = sceAudioSRCOutputBlocking(PSP_AUDIO_VOLUME_MAX, sndBuffer_play);
+		ret = sceAudioSRCOutputBlocking(PSP_AUDIO_VOLUME_MAX, sndBuffer_play);
 		// 1.5 kernel returns 0, newer ones return # of samples queued
-		if (ret < 0) lprintf("sthr: play: ret %08x; pos %i/%i\n", ret, samples_done, samples_made);
+		if (ret < 0) lprintf("sthr: play: ret %08x; fill %i\n", ret, sndring_fill(&snd_ring));
 
 		samples_done += samples_block;
-		snd_playptr  += samples_block;
-		if (snd_playptr >= sndBuffer_endptr)
-			snd_playptr -= sndBuffer_endptr - sndBuffer;
 	}
 
 	lprintf("sthr: exit\n");
@@ -574,9 +575,10 @@ static void sound_init(void)
 	sound_sem = sceKernelCreateSema("sndsem", 0, 0, 1, NULL);
 	if (sound_sem < 0) lprintf("sceKernelCreateSema() failed: %i\n", sound_sem);
 
-	samples_made = samples_done = 0;
+	sndring_init(&snd_ring, sndBuffer, SOUND_RING_SIZE);
+	samples_done = 0;
 	samples_block = 2*22050/60; // make sure it goes to sema
-	sound_thread_exit = 0;
+	sound_thread_exit = sound_flush = 0;
 	thid = sceKernelCreateThread("sndthread", sound_thread, 0x12, 0x1000, 0, NULL);
 	if (thid >= 0)
 	{
@@ -595,7 +597,7 @@ void pemu_sound_start(void)
 	static int mp3_init_done;
 	int ret, stereo, factor;
 
-	samples_made = samples_done = 0;
+	samples_done = 0;
 
 	if (!(currentConfig.EmuOpt & EOPT_EN_SOUND))
 		return;
@@ -633,9 +635,7 @@ void pemu_sound_start(void)
 		case 2: PicoIn.writeSound = stereo ? writeSound_22050_stereo:writeSound_22050_mono; break;
 		case 4: PicoIn.writeSound = stereo ? writeSound_11025_stereo:writeSound_11025_mono; break;
 		}
-		sndBuffer_endptr = sndBuffer + (SOUND_BLOCK_COUNT-1)*samples_block;
-		snd_playptr = sndBuffer_ptr = sndBuffer;
-		PicoIn.sndOut = (factor == 1 && stereo ? sndBuffer_ptr : sndBuffer_emu);
+		PicoIn.sndOut = sndBuffer_emu;
 
 		// push one audio block to cover time to first frame audio
 //		memset32(PicoIn.sndOut, 0, samples_block/2);
@@ -655,12 +655,17 @@ void pemu_sound_stop(void)
 		// if no data is written between sceAudioSRCChReserve and sceAudioSRCChRelease calls,
 		// we get a deadlock on next sceAudioSRCChReserve call
 		// so this is yet another workaround:
-		memset32((int *)(void *)sndBuffer, 0, samples_block*4/4);
-		samples_made = samples_block * 3;
+		memset32((int *)(void *)sndBuffer_conv, 0, samples_block*2/4);
+		for (i = 0; i < 3; i++)
+			sndring_write(&snd_ring, sndBuffer_conv, samples_block);
 		sceKernelSignalSema(sound_sem, 1);
 	}
 	sceKernelDelayThread(100*1000);
-	samples_made = samples_done = 0;
+	samples_done = 0;
+	// drop what's left, and start over at the nominal rate
+	sound_flush = 1;
+	sceKernelSignalSema(sound_sem, 1);
+	PsndSetRateAdjust(0);
 	for (i = 0; sceAudioOutput2GetRestSample() > 0 && i < 16; i++)
 		psp_msleep(100);
 	sceAudioSRCChRelease();
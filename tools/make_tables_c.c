@@ -0,0 +1,377 @@
+/*
+ * generates constant lookup tables, so that they can be shared
+ * and don't need to be computed at startup
+ */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static void dump_table(FILE *fo, const char *decl, const int *tab, int len, int per_line)
+{
+	int i;
+
+	fprintf(fo, "%s = {\n", decl);
+	for (i = 0; i < len; i++) {
+		if (i % per_line == 0)
+			fprintf(fo, "\t");
+		fprintf(fo, "%d,", tab[i]);
+		fprintf(fo, (i % per_line == per_line-1 || i == len-1) ? "\n" : " ");
+	}
+	fprintf(fo, "};\n\n");
+}
+
+/* YM2612, must match the definitions in pico/sound/ym2612.c */
+#define ENV_STEP	(128.0/1024)
+#define SIN_LEN		1024
+#define TL_RES_LEN	256
+#define TL_TAB_LEN	(13*TL_RES_LEN*256/8)
+
+/* LFO PM levels, first quarter of the waveform (see ym2612.c) */
+static const unsigned char lfo_pm_output[7*8][8]={ /* 7 bits meaningful (of F-NUMBER), 8 LFO output levels per one depth (out of 32), 8 LFO depths */
+/* FNUM BIT 4: 000 0001xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 6 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 7 */ {0,   0,   0,   0,   1,   1,   1,   1},
+
+/* FNUM BIT 5: 000 0010xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 6 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 7 */ {0,   0,   1,   1,   2,   2,   2,   3},
+
+/* FNUM BIT 6: 000 0100xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   1},
+/* DEPTH 5 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 6 */ {0,   0,   1,   1,   2,   2,   2,   3},
+/* DEPTH 7 */ {0,   0,   2,   3,   4,   4,   5,   6},
+
+/* FNUM BIT 7: 000 1000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   1,   1},
+/* DEPTH 3 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 4 */ {0,   0,   0,   1,   1,   1,   1,   2},
+/* DEPTH 5 */ {0,   0,   1,   1,   2,   2,   2,   3},
+/* DEPTH 6 */ {0,   0,   2,   3,   4,   4,   5,   6},
+/* DEPTH 7 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
+
+/* FNUM BIT 8: 001 0000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 2 */ {0,   0,   0,   1,   1,   1,   2,   2},
+/* DEPTH 3 */ {0,   0,   1,   1,   2,   2,   3,   3},
+/* DEPTH 4 */ {0,   0,   1,   2,   2,   2,   3,   4},
+/* DEPTH 5 */ {0,   0,   2,   3,   4,   4,   5,   6},
+/* DEPTH 6 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
+/* DEPTH 7 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
+
+/* FNUM BIT 9: 010 0000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   2,   2,   2,   2},
+/* DEPTH 2 */ {0,   0,   0,   2,   2,   2,   4,   4},
+/* DEPTH 3 */ {0,   0,   2,   2,   4,   4,   6,   6},
+/* DEPTH 4 */ {0,   0,   2,   4,   4,   4,   6,   8},
+/* DEPTH 5 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
+/* DEPTH 6 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
+/* DEPTH 7 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
+
+/* FNUM BIT10: 100 0000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   4,   4,   4,   4},
+/* DEPTH 2 */ {0,   0,   0,   4,   4,   4,   8,   8},
+/* DEPTH 3 */ {0,   0,   4,   4,   8,   8, 0xc, 0xc},
+/* DEPTH 4 */ {0,   0,   4,   8,   8,   8, 0xc,0x10},
+/* DEPTH 5 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
+/* DEPTH 6 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
+/* DEPTH 7 */ {0,   0,0x20,0x30,0x40,0x40,0x50,0x60},
+
+};
+
+static void make_ym2612(FILE *fo)
+{
+	static int sin_tab[256], tl_tab2[13*TL_RES_LEN];
+	static int tl_tab[TL_TAB_LEN], lfo_pm_table[128*8*32];
+	double o, m;
+	int i, x, y, n, p, fnum, step, bit, value;
+
+	for (i = 0; i < 256; i++)
+	{
+		/* non-standard sinus */
+		m = sin( ((i*2)+1) * M_PI / SIN_LEN ); /* checked against the real chip */
+
+		if (m > 0.0)
+			o = 8*log(1.0/m)/log(2);	/* convert to 'decibels' */
+		else
+			o = 8*log(-1.0/m)/log(2);	/* convert to 'decibels' */
+
+		o = o / (ENV_STEP/4);
+
+		n = (int)(2.0*o);
+		if (n&1)			/* round to nearest */
+			n = (n>>1)+1;
+		else
+			n = n>>1;
+
+		sin_tab[i] = n;
+	}
+
+	for (x = 0; x < TL_RES_LEN; x++)
+	{
+		m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
+		m = floor(m);
+
+		n = (int)m;		/* 16 bits here */
+		n >>= 4;		/* 12 bits here */
+		if (n&1)		/* round to nearest */
+			n = (n>>1)+1;
+		else
+			n = n>>1;
+					/* 11 bits here (rounded) */
+		n <<= 2;		/* 13 bits here (as in real chip) */
+		tl_tab2[x] = n;
+
+		for (i = 1; i < 13; i++)
+			tl_tab2[x + i*TL_RES_LEN] = n >> i;
+	}
+
+	/* TL table indexed by sin | (env<<7), odd env rows are unused */
+	for (x = 0; x < 256; x++)
+	{
+		for (y = 0; y < 2*13*TL_RES_LEN/8; y += 2)
+		{
+			p = (y<<2) + sin_tab[x];
+			tl_tab[(y<<7) | x] = p >= 13*TL_RES_LEN ? 0 : tl_tab2[p];
+		}
+	}
+
+	/* LFO PM modulation table */
+	for (i = 0; i < 8; i++) /* 8 PM depths */
+	{
+		for (fnum = 0; fnum < 128; fnum++) /* 7 bits meaningful of F-NUMBER */
+		{
+			for (step = 0; step < 8; step++)
+			{
+				value = 0;
+				for (bit = 0; bit < 7; bit++)
+					if (fnum & (1<<bit))
+						value += lfo_pm_output[bit*8 + i][step];
+				value &= 0xff;
+				lfo_pm_table[(fnum*32*8) + (i*32) + step   + 0] = value;
+				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+ 8] = value;
+				lfo_pm_table[(fnum*32*8) + (i*32) + step   +16] = -value;
+				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+24] = -value;
+			}
+		}
+	}
+
+	fprintf(fo, "/* TL table in 'decibel' scale, indexed by sin | (env<<7) */\n");
+	dump_table(fo, "const UINT16 ym_tl_tab[TL_TAB_LEN]", tl_tab, TL_TAB_LEN, 32);
+	fprintf(fo, "/* all 128 LFO PM waveforms: 128 combinations of 7 bits meaningful (of F-NUMBER), 8 LFO depths, 32 LFO output levels per one depth */\n");
+	dump_table(fo, "static const INT32 lfo_pm_table[128*8*32]", lfo_pm_table, 128*8*32, 32);
+}
+
+/* Z80 flags, must match the definitions in cpu/cz80/cz80.c */
+#define CF	0x01
+#define NF	0x02
+#define PF	0x04
+#define VF	PF
+#define XF	0x08
+#define HF	0x10
+#define YF	0x20
+#define ZF	0x40
+#define SF	0x80
+
+static void make_cz80(FILE *fo)
+{
+	static int sz[256], szp[256], sz_bit[256], szhv_inc[256], szhv_dec[256];
+	static int szhvc_add[2*256*256], szhvc_sub[2*256*256];
+	int *padd, *padc, *psub, *psbc;
+	int i, j, p, oldval, newval, val;
+
+	for (i = 0; i < 256; i++)
+	{
+		sz[i] = i & (SF | YF | XF);
+		if (!i) sz[i] |= ZF;
+
+		sz_bit[i] = i & (SF | YF | XF);
+		if (!i) sz_bit[i] |= ZF | PF;
+
+		for (j = 0, p = 0; j < 8; j++) if (i & (1 << j)) p++;
+		szp[i] = sz[i];
+		if (!(p & 1)) szp[i] |= PF;
+
+		szhv_inc[i] = sz[i];
+		if (i == 0x80) szhv_inc[i] |= VF;
+		if ((i & 0x0f) == 0x00) szhv_inc[i] |= HF;
+
+		szhv_dec[i] = sz[i] | NF;
+		if (i == 0x7f) szhv_dec[i] |= VF;
+		if ((i & 0x0f) == 0x0f) szhv_dec[i] |= HF;
+	}
+
+	padd = &szhvc_add[  0*256];
+	padc = &szhvc_add[256*256];
+	psub = &szhvc_sub[  0*256];
+	psbc = &szhvc_sub[256*256];
+
+	for (oldval = 0; oldval < 256; oldval++)
+	{
+		for (newval = 0; newval < 256; newval++)
+		{
+			/* add or adc w/o carry set */
+			val = newval - oldval;
+			*padd = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
+			*padd |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
+			if ((newval & 0x0f) < (oldval & 0x0f)) *padd |= HF;
+			if (newval < oldval ) *padd |= CF;
+			if ((val ^ oldval ^ 0x80) & (val ^ newval) & 0x80) *padd |= VF;
+			padd++;
+
+			/* adc with carry set */
+			val = newval - oldval - 1;
+			*padc = (newval) ? ((newval & 0x80) ? SF : 0) : ZF;
+			*padc |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
+			if ((newval & 0x0f) <= (oldval & 0x0f)) *padc |= HF;
+			if (newval <= oldval) *padc |= CF;
+			if ((val ^ oldval ^ 0x80) & (val ^ newval) & 0x80) *padc |= VF;
+			padc++;
+
+			/* cp, sub or sbc w/o carry set */
+			val = oldval - newval;
+			*psub = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
+			*psub |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
+			if ((newval & 0x0f) > (oldval & 0x0f)) *psub |= HF;
+			if (newval > oldval) *psub |= CF;
+			if ((val^oldval) & (oldval^newval) & 0x80) *psub |= VF;
+			psub++;
+
+			/* sbc with carry set */
+			val = oldval - newval - 1;
+			*psbc = NF | ((newval) ? ((newval & 0x80) ? SF : 0) : ZF);
+			*psbc |= (newval & (YF | XF));	/* undocumented flag bits 5+3 */
+			if ((newval & 0x0f) >= (oldval & 0x0f)) *psbc |= HF;
+			if (newval >= oldval) *psbc |= CF;
+			if ((val ^ oldval) & (oldval^newval) & 0x80) *psbc |= VF;
+			psbc++;
+		}
+	}
+
+	fprintf(fo, "/* flags tables */\n");
+	dump_table(fo, "static const UINT8 ALIGN_DATA SZ[256]", sz, 256, 16);
+	dump_table(fo, "static const UINT8 ALIGN_DATA SZP[256]", szp, 256, 16);
+	dump_table(fo, "static const UINT8 ALIGN_DATA SZ_BIT[256]", sz_bit, 256, 16);
+	dump_table(fo, "static const UINT8 ALIGN_DATA SZHV_inc[256]", szhv_inc, 256, 16);
+	dump_table(fo, "static const UINT8 ALIGN_DATA SZHV_dec[256]", szhv_dec, 256, 16);
+	fprintf(fo, "#if CZ80_BIG_FLAGS_ARRAY\n");
+	fprintf(fo, "/* add/adc and sub/sbc flags, [carry][oldval][newval] */\n");
+	dump_table(fo, "static const UINT8 ALIGN_DATA SZHVC_add[2*256*256]", szhvc_add, 2*256*256, 32);
+	dump_table(fo, "static const UINT8 ALIGN_DATA SZHVC_sub[2*256*256]", szhvc_sub, 2*256*256, 32);
+	fprintf(fo, "#endif\n");
+}
+
+/* MCD graphics ASIC, see pico/cd/gfx.c */
+static void make_gfx(FILE *fo)
+{
+	static int prio[4*0x10*0x10], cell2[0x80], cell4[0x80], pixel[0x200];
+	int i, j, row, col, temp;
+
+	/* priority modes lookup table */
+	for (i = 0; i < 0x10; i++)
+	{
+		for (j = 0; j < 0x10; j++)
+		{
+			prio[0x000 + i*0x10 + j] = j;		/* normal */
+			prio[0x100 + i*0x10 + j] = i ? i : j;	/* underwrite */
+			prio[0x200 + i*0x10 + j] = j ? j : i;	/* overwrite */
+			prio[0x300 + i*0x10 + j] = i;		/* invalid */
+		}
+	}
+
+	/* cell lookup table, entry = yyxxhrr (7 bits) */
+	for (i = 0; i < 0x80; i++)
+	{
+		row = (i >> 5) & 3;
+		col = (i >> 3) & 3;
+
+		if (i & 4) { col = col ^ 3; }				/* HFLIP */
+		if (i & 2) { col = col ^ 3; row = row ^ 3; }		/* ROLL1 */
+		if (i & 1) { temp = col; col = row ^ 3; row = temp; }	/* ROLL0 */
+
+		cell2[i] = ((row&1) + (col&1) * 2) << 6;
+		cell4[i] = ((row&3) + (col&3) * 4) << 6;
+	}
+
+	/* pixel lookup table, entry = yyyxxxhrr (9 bits) */
+	for (i = 0; i < 0x200; i++)
+	{
+		row = (i >> 6) & 7;
+		col = (i >> 3) & 7;
+
+		if (i & 4) { col = col ^ 7; }				/* HFLIP */
+		if (i & 2) { col = col ^ 7; row = row ^ 7; }		/* ROLL1 */
+		if (i & 1) { temp = col; col = row ^ 7; row = temp; }	/* ROLL0 */
+
+		pixel[i] = col + row * 8;
+	}
+
+	fprintf(fo, "/* WORD-RAM data writes priority lookup table */\n");
+	fprintf(fo, "static const uint8 gfx_lut_prio[4][0x10][0x10] = {\n");
+	for (i = 0; i < 4*0x10; i++) {
+		fprintf(fo, "%s\t{", i % 0x10 ? "" : "{\n");
+		for (j = 0; j < 0x10; j++)
+			fprintf(fo, "%d%s", prio[i*0x10 + j], j < 0x10-1 ? ", " : "},\n");
+		if (i % 0x10 == 0x10-1)
+			fprintf(fo, "},\n");
+	}
+	fprintf(fo, "};\n\n");
+	fprintf(fo, "/* Graphics operation dot offset lookup table */\n");
+	dump_table(fo, "static const uint8 gfx_lut_pixel[0x200]", pixel, 0x200, 16);
+	fprintf(fo, "/* Graphics operation stamp offset lookup tables */\n");
+	dump_table(fo, "static const uint16 gfx_lut_cell2[0x80]", cell2, 0x80, 16);
+	dump_table(fo, "static const uint16 gfx_lut_cell4[0x80]", cell4, 0x80, 16);
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *fo;
+
+	if (argc != 3 || (strcmp(argv[1], "ym2612") && strcmp(argv[1], "gfx")
+			&& strcmp(argv[1], "cz80"))) {
+		printf("usage:\n%s <ym2612|gfx|cz80> <tables.c>\n", argv[0]);
+		return 1;
+	}
+
+	fo = fopen(argv[2], "w");
+	if (fo == NULL) {
+		printf("fopen failed\n");
+		return 1;
+	}
+
+	fprintf(fo, "/* generated by %s, do not modify */\n", argv[0]);
+	if (!strcmp(argv[1], "ym2612"))
+		make_ym2612(fo);
+	else if (!strcmp(argv[1], "gfx"))
+		make_gfx(fo);
+	else
+		make_cz80(fo);
+
+	fclose(fo);
+	return 0;
+}
@@ -0,0 +1,52 @@
+// gcc wramtest.c -I.. -o wramtest
+// checks the MCD word RAM 2M <-> 1M conversions in pico/cd/misc.c. The
+// expected layout is given in 16 bit words, so this holds on any host.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <pico/cd/misc.c>
+
+#define WRAM_SIZE	0x40000
+
+int main(void)
+{
+	// 1M banks are at 0x20000 and 0x40000, see the layout in misc.c
+	unsigned short *m = malloc(0x60000), *ref = malloc(WRAM_SIZE);
+	unsigned short *d = malloc(WRAM_SIZE);
+	int i, err = 0;
+
+	if (!m || !ref || !d)
+		return 1;
+
+	for (i = 0; i < WRAM_SIZE/2; i++)
+		ref[i] = i * 40503 + 1;
+
+	memcpy(m, ref, WRAM_SIZE);
+	wram_2M_to_1M((unsigned char *)m);
+	// even words go to bank0, odd words to bank1
+	for (i = 0; i < WRAM_SIZE/2; i++)
+		if (m[0x10000 + (i&1)*0x10000 + i/2] != ref[i]) {
+			printf("2M->1M: word %05x wrong\n", i);
+			err++;
+			break;
+		}
+
+	// saving in 1M mode, done in parts
+	for (i = 0; i < WRAM_SIZE; i += 0x8000)
+		wram_1M_to_2M_copy((unsigned char *)d + i, (unsigned char *)m, i, 0x8000);
+	if (memcmp(d, ref, WRAM_SIZE)) {
+		printf("1M->2M copy: mismatch\n");
+		err++;
+	}
+
+	wram_1M_to_2M((unsigned char *)m);
+	if (memcmp(m, ref, WRAM_SIZE)) {
+		printf("1M->2M: mismatch\n");
+		err++;
+	}
+
+	printf("%s\n", err ? "FAILED" : "ok");
+	return err != 0;
+}